@@ -174,6 +174,33 @@ PyAPI_FUNC(void) PyEval_ReInitThreads(void);
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(void) _PyEval_SetSwitchInterval(unsigned long microseconds);
 PyAPI_FUNC(unsigned long) _PyEval_GetSwitchInterval(void);
+PyAPI_FUNC(void) _PyEval_SetSwitchPriority(unsigned long microseconds);
+PyAPI_FUNC(unsigned long) _PyEval_GetSwitchPriority(void);
+
+/* Statistics on the GIL, see _PyEval_GetGILStats() */
+#define _PyEval_GIL_WAIT_BUCKETS 20
+typedef struct {
+    /* number of calls to take the GIL */
+    unsigned long acquisitions;
+    /* ... which had to wait, and which did so with priority */
+    unsigned long contended;
+    unsigned long priority_acquisitions;
+    /* number of times the GIL changed hands */
+    unsigned long switches;
+    /* number of drop requests made by waiting threads, and of times the
+       holder released the GIL because of one */
+    unsigned long drop_requests;
+    unsigned long forced_drops;
+    /* total and longest wait time, in seconds */
+    double wait_total;
+    double wait_max;
+    /* histogram of the wait times: wait_histogram[i] counts the waits
+       shorter than wait_bounds[i]; the last bucket has no upper bound */
+    double wait_bounds[_PyEval_GIL_WAIT_BUCKETS - 1];
+    unsigned long wait_histogram[_PyEval_GIL_WAIT_BUCKETS];
+} _PyEval_GILStats;
+
+PyAPI_FUNC(void) _PyEval_GetGILStats(_PyEval_GILStats *stats);
 #endif
 
 #define Py_BEGIN_ALLOW_THREADS { \
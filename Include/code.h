@@ -7,6 +7,44 @@
 extern "C" {
 #endif
 
+/* Inline cache entry for LOAD_GLOBAL: the cached object is a borrowed
+   reference, valid as long as neither dictionary has been modified. */
+typedef struct {
+    PyObject *ptr;
+    PY_UINT64_T globals_ver;
+    PY_UINT64_T builtins_ver;
+} _PyOpcache_LoadGlobal;
+
+/* Inline cache entry for LOAD_ATTR and STORE_ATTR on instances whose
+   __dict__ is a split table: the attribute lives at index "index" of
+   the values array when the instance dict uses the "keys" shared by all
+   instances of "type".  Both pointers are borrowed; the keys are kept
+   alive by the type as long as its version tag is unchanged. */
+typedef struct {
+    PyTypeObject *type;
+    unsigned int tp_version_tag;
+    PyDictKeysObject *keys;
+    Py_ssize_t index;
+} _PyOpcache_AttrEntry;
+
+/* Number of receiver types remembered by one LOAD_ATTR/STORE_ATTR */
+#define _PyOpcache_ATTR_ENTRIES 4
+
+typedef struct {
+    _PyOpcache_AttrEntry entries[_PyOpcache_ATTR_ENTRIES];
+    unsigned char next;         /* entry replaced by the next fill */
+    unsigned char misses;       /* number of cache misses so far */
+} _PyOpcache_Attr;
+
+typedef struct {
+    union {
+        _PyOpcache_LoadGlobal lg;
+        _PyOpcache_Attr la;
+    } u;
+    /* 0: empty, > 0: in use, < 0: given up on this instruction */
+    char optimized;
+} _PyOpcache;
+
 /* Bytecode object */
 typedef struct {
     PyObject_HEAD
@@ -30,6 +68,15 @@ typedef struct {
 				   Objects/lnotab_notes.txt for details. */
     void *co_zombieframe;     /* for optimization only (see frameobject.c) */
     PyObject *co_weakreflist;   /* to support weakrefs to code objects */
+    /* Per-opcode inline caches, allocated once co_opcache_flag, which
+       counts calls and loop iterations, reaches a threshold (see
+       Python/ceval.c).  co_opcache_map
+       maps a bytecode offset to a 1-based index into co_opcache, or 0
+       when the instruction at that offset has no cache entry. */
+    unsigned char *co_opcache_map;
+    _PyOpcache *co_opcache;
+    int co_opcache_flag;
+    unsigned char co_opcache_size;
 } PyCodeObject;
 
 /* Masks for co_flags above */
@@ -91,6 +138,9 @@ PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno);
    use PyFrame_GetLineNumber() instead. */
 PyAPI_FUNC(int) PyCode_Addr2Line(PyCodeObject *, int);
 
+/* Allocate the per-opcode inline caches of a code object */
+PyAPI_FUNC(int) _PyCode_InitOpcache(PyCodeObject *);
+
 /* for internal use only */
 typedef struct _addr_pair {
         int ap_lower;
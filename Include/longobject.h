@@ -101,6 +101,10 @@ PyAPI_FUNC(PyObject *) _PyLong_FromBytes(const char *, Py_ssize_t, int);
 #endif
 
 #ifndef Py_LIMITED_API
+#ifdef Py_IMMORTAL_OBJECTS
+PyAPI_FUNC(Py_ssize_t) _PyLong_Immortalize(void);
+#endif
+
 /* _PyLong_Sign.  Return 0 if v is 0, -1 if v < 0, +1 if v > 0.
    v must not be NULL, and must be a normalized long.
    There are no error cases.
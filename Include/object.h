@@ -488,6 +488,9 @@ PyAPI_FUNC(PyObject *) _PyType_Lookup(PyTypeObject *, PyObject *);
 PyAPI_FUNC(PyObject *) _PyType_LookupId(PyTypeObject *, _Py_Identifier *);
 PyAPI_FUNC(PyObject *) _PyObject_LookupSpecial(PyObject *, _Py_Identifier *);
 PyAPI_FUNC(PyTypeObject *) _PyType_CalculateMetaclass(PyTypeObject *, PyObject *);
+#ifdef Py_IMMORTAL_OBJECTS
+PyAPI_FUNC(Py_ssize_t) _PyType_Immortalize(PyTypeObject *);
+#endif
 #endif
 PyAPI_FUNC(unsigned int) PyType_ClearCache(void);
 PyAPI_FUNC(void) PyType_Modified(PyTypeObject *);
@@ -543,6 +546,10 @@ _PyObject_GenericGetAttrWithDict(PyObject *, PyObject *, PyObject *);
 PyAPI_FUNC(int)
 _PyObject_GenericSetAttrWithDict(PyObject *, PyObject *,
                                  PyObject *, PyObject *);
+#ifndef Py_LIMITED_API
+/* Look up a method without binding it, for LOAD_METHOD */
+PyAPI_FUNC(int) _PyObject_GetMethod(PyObject *, PyObject *, PyObject **);
+#endif
 
 /* Helper to look up a builtin object */
 #ifndef Py_LIMITED_API
@@ -750,6 +757,50 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
 #endif
 #endif /* !Py_TRACE_REFS */
 
+#ifdef Py_IMMORTAL_OBJECTS
+/* Immortal objects have a huge reference count, which Py_INCREF() and
+ * Py_DECREF() leave alone:  they are never deallocated, and the memory they
+ * live in isn't written by merely using them, so it stays shared between
+ * forked processes.  The test is against half of the count, so that code
+ * changing ob_refcnt directly can't make an immortal object mortal again.
+ * See Misc/SpecialBuilds.txt.
+ */
+#define _Py_IMMORTAL_REFCNT (PY_SSIZE_T_MAX / 2)
+#define _Py_IsImmortal(op) \
+    (((PyObject *)(op))->ob_refcnt >= _Py_IMMORTAL_REFCNT / 2)
+
+/* Make op immortal.  Return 1 if it wasn't immortal already, else 0. */
+PyAPI_FUNC(int) _Py_SetImmortal(PyObject *op);
+/* Make the objects which live as long as the interpreter, in practice,
+   immortal: singletons, small ints, interned strings, types and the code
+   objects of functions with their constants.  Return the number of objects
+   made immortal. */
+PyAPI_FUNC(Py_ssize_t) _Py_ImmortalizeObjects(void);
+
+/* A function, rather than a macro, to evaluate op only once */
+Py_LOCAL_INLINE(void)
+_Py_IncRefMortal(PyObject *op)
+{
+    if (!_Py_IsImmortal(op)) {
+        _Py_INC_REFTOTAL;
+        op->ob_refcnt++;
+    }
+}
+
+#define Py_INCREF(op) _Py_IncRefMortal((PyObject *)(op))
+
+#define Py_DECREF(op)                                   \
+    do {                                                \
+        PyObject *_py_decref_tmp = (PyObject *)(op);    \
+        if (_Py_IsImmortal(_py_decref_tmp))             \
+            ;                                           \
+        else if (_Py_DEC_REFTOTAL  _Py_REF_DEBUG_COMMA  \
+        --(_py_decref_tmp)->ob_refcnt != 0)             \
+            _Py_CHECK_REFCNT(_py_decref_tmp)            \
+        else                                            \
+        _Py_Dealloc(_py_decref_tmp);                    \
+    } while (0)
+#else
 #define Py_INCREF(op) (                         \
     _Py_INC_REFTOTAL  _Py_REF_DEBUG_COMMA       \
     ((PyObject *)(op))->ob_refcnt++)
@@ -763,6 +814,7 @@ PyAPI_FUNC(void) _Py_Dealloc(PyObject *);
         else                                            \
         _Py_Dealloc(_py_decref_tmp);                    \
     } while (0)
+#endif /* Py_IMMORTAL_OBJECTS */
 
 /* Safely decref `op` and set `op` to NULL, especially useful in tp_clear
  * and tp_dealloc implementatons.
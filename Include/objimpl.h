@@ -105,6 +105,50 @@ PyAPI_FUNC(Py_ssize_t) _Py_GetAllocatedBlocks(void);
 #ifdef WITH_PYMALLOC
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(void) _PyObject_DebugMallocStats(FILE *out);
+
+/* Snapshot of pymalloc's arenas and pools, see _PyObject_GetMallocStats() */
+#define _PyObject_MAX_SIZE_CLASSES 64
+typedef struct {
+    size_t arena_size;
+    size_t pool_size;
+    int hugepages;
+    /* per size class: block size, # of pools, allocated and free blocks */
+    unsigned int nclasses;
+    size_t class_size[_PyObject_MAX_SIZE_CLASSES];
+    size_t numpools[_PyObject_MAX_SIZE_CLASSES];
+    size_t numblocks[_PyObject_MAX_SIZE_CLASSES];
+    size_t numfreeblocks[_PyObject_MAX_SIZE_CLASSES];
+    /* # of arenas allocated ever, at the high water mark and currently */
+    size_t narenas_total;
+    size_t narenas_highwater;
+    size_t narenas;
+    /* total # of allocated bytes in used and full pools */
+    size_t allocated_bytes;
+    /* total # of available bytes in used pools */
+    size_t available_bytes;
+    /* # of free pools + pools not yet carved out of current arena */
+    size_t numfreepools;
+    /* # of bytes in used and full pools used for pool_headers */
+    size_t pool_header_bytes;
+    /* # of bytes in used and full pools wasted due to quantization,
+     * i.e. the necessarily leftover space at the ends of used and
+     * full pools.
+     */
+    size_t quantization;
+    /* # of bytes for arena alignment padding */
+    size_t arena_alignment;
+    /* whether empty pools are purged, # of pools currently purged, and
+     * total # of bytes returned to the system by purging pools and by
+     * freeing arenas
+     */
+    int purge;
+    size_t npurgedpools;
+    size_t purged_bytes;
+    size_t released_arena_bytes;
+} _PyObject_MallocStats;
+
+PyAPI_FUNC(void) _PyObject_GetMallocStats(_PyObject_MallocStats *stats);
+PyAPI_FUNC(int) _PyObject_SetMallocPurge(int enabled);
 #endif /* #ifndef Py_LIMITED_API */
 #endif
 
@@ -228,6 +272,35 @@ PyAPI_FUNC(Py_ssize_t) PyGC_Collect(void);
 
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(Py_ssize_t) _PyGC_CollectNoFail(void);
+
+/* Report of a collection, or of a slice of an incremental collection,
+   passed to the hook set with _PyGC_SetCollectHook().  Times are in
+   seconds. */
+typedef struct {
+    int generation;
+    int incremental;        /* true for a slice of an incremental collection */
+    int complete;           /* false for a slice which didn't complete it */
+    Py_ssize_t collected;
+    Py_ssize_t uncollectable;
+    Py_ssize_t examined;    /* # of objects examined */
+    double duration;        /* the whole pause */
+    double mark_time;       /* computing the unreachable objects */
+    double finalize_time;   /* legacy finalizers and tp_finalize */
+    double weakref_time;    /* clearing weakrefs, calling their callbacks */
+    double delete_time;     /* breaking the cycles, deallocation */
+} _PyGC_CollectionInfo;
+
+typedef void (*_PyGC_CollectHook)(const _PyGC_CollectionInfo *info,
+                                  void *arg);
+
+/* Call hook(info, arg) after each collection; NULL removes the hook.  The
+   hook is called with the GIL held and must not raise an exception. */
+PyAPI_FUNC(void) _PyGC_SetCollectHook(_PyGC_CollectHook hook, void *arg);
+
+/* Call visit(op, arg) for each object tracked by the collector, until it
+   returns non-zero, which is then returned.  visit must not track or
+   untrack objects. */
+PyAPI_FUNC(int) _PyGC_VisitObjects(visitproc visit, void *arg);
 #endif
 
 /* Test if a type has a GC head */
@@ -141,6 +141,11 @@ extern "C" {
 
 #define LOAD_CLASSDEREF   148
 
+/* Method calls without a bound method object, see LOAD_METHOD in
+   Python/ceval.c */
+#define LOAD_METHOD     160     /* Index in name list */
+#define CALL_METHOD     161     /* #args */
+
 /* EXCEPT_HANDLER is a special, implicit block type which is created when
    entering an except handler. It is not an opcode but we define it here
    as we want it to be available to both frameobject.c and ceval.c, while
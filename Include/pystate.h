@@ -134,6 +134,11 @@ typedef struct _ts {
     void (*on_delete)(void *);
     void *on_delete_data;
 
+    /* time spent holding the GIL, in seconds, and number of times the GIL
+       was taken */
+    double gil_hold_time;
+    unsigned long gil_acquisitions;
+
     /* XXX signal handlers should also be here */
 
 } PyThreadState;
@@ -247,6 +252,13 @@ PyAPI_FUNC(int) PyGILState_Check(void);
 PyAPI_FUNC(PyObject *) _PyThread_CurrentFrames(void);
 #endif
 
+/* Used by sys._getgilstats().  Returns a dict mapping thread id to a
+   (GIL hold time, GIL acquisitions) tuple.
+*/
+#ifndef Py_LIMITED_API
+PyAPI_FUNC(PyObject *) _PyThread_GILStats(void);
+#endif
+
 /* Routines for advanced debuggers, requested by David Beazley.
    Don't use unless you know what you are doing! */
 #ifndef Py_LIMITED_API
@@ -1007,6 +1007,9 @@ PyAPI_FUNC(PyObject *) PyUnicode_InternFromString(
     );
 #ifndef Py_LIMITED_API
 PyAPI_FUNC(void) _Py_ReleaseInternedUnicodeStrings(void);
+#ifdef Py_IMMORTAL_OBJECTS
+PyAPI_FUNC(Py_ssize_t) _PyUnicode_Immortalize(void);
+#endif
 #endif
 
 /* Use only if you know it's a string */
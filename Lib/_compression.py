@@ -0,0 +1,262 @@
+"""Internal classes used by the gzip, lzma and bz2 modules"""
+
+import io
+from collections import deque
+
+
+BUFFER_SIZE = io.DEFAULT_BUFFER_SIZE  # Compressed data read chunk size
+
+
+def _check_threads(threads):
+    """Return the number of worker threads to use for *threads*.
+
+    0 means one thread per CPU.
+    """
+    if threads == 0:
+        import os
+        threads = os.cpu_count() or 1
+    elif threads < 0:
+        raise ValueError("threads must be a non-negative integer")
+    return threads
+
+
+class BaseStream(io.BufferedIOBase):
+    """Mode-checking helper functions."""
+
+    def _check_not_closed(self):
+        if self.closed:
+            raise ValueError("I/O operation on closed file")
+
+    def _check_can_read(self):
+        if not self.readable():
+            raise io.UnsupportedOperation("File not open for reading")
+
+    def _check_can_write(self):
+        if not self.writable():
+            raise io.UnsupportedOperation("File not open for writing")
+
+    def _check_can_seek(self):
+        if not self.readable():
+            raise io.UnsupportedOperation("Seeking is only supported "
+                                          "on files open for reading")
+        if not self.seekable():
+            raise io.UnsupportedOperation("The underlying file object "
+                                          "does not support seeking")
+
+
+class DecompressReader(io.RawIOBase):
+    """Adapts the decompressor API to a RawIOBase reader API.
+
+    Wrapped in an io.BufferedReader, it gives compressed files the C
+    implementations of read(), readinto(), readline() and peek().
+    readinto() copies the decompressed data straight into the caller's
+    buffer.
+    """
+
+    def readable(self):
+        return True
+
+    def __init__(self, fp, decomp_factory, trailing_error=(), **decomp_args):
+        self._fp = fp
+        self._eof = False
+        self._pos = 0  # Current offset in decompressed stream
+
+        # Set to size of decompressed stream once it is known, for SEEK_END
+        self._size = -1
+
+        # Decompressed data not returned yet, starting at _buffer_offset
+        self._buffer = b""
+        self._buffer_offset = 0
+
+        # Save the decompressor factory and arguments.
+        # If the file contains multiple compressed streams, each
+        # stream will need a separate decompressor object. A new decompressor
+        # object is also needed when implementing a backwards seek().
+        self._decomp_factory = decomp_factory
+        self._decomp_args = decomp_args
+        self._decompressor = self._decomp_factory(**self._decomp_args)
+
+        # Exception class to catch from decompressor signifying invalid
+        # trailing data to ignore
+        self._trailing_error = trailing_error
+
+    def close(self):
+        self._decompressor = None
+        self._buffer = b""
+        self._buffer_offset = 0
+        return super().close()
+
+    def seekable(self):
+        return self._fp.seekable()
+
+    def _decompress_chunk(self):
+        """Return the next chunk of decompressed data, or b"" at EOF."""
+        # Depending on the input data, our call to the decompressor may not
+        # return any data. In this case, try again after reading another block.
+        while True:
+            rawblock = (self._decompressor.unused_data or
+                        self._fp.read(BUFFER_SIZE))
+            if not rawblock:
+                if self._decompressor.eof:
+                    # End-of-stream marker and end of file. We're good.
+                    return b""
+                # Problem - we were expecting more compressed data.
+                raise EOFError("Compressed file ended before the "
+                               "end-of-stream marker was reached")
+            if self._decompressor.eof:
+                # Continue to next stream.
+                self._decompressor = self._decomp_factory(
+                    **self._decomp_args)
+                try:
+                    data = self._decompressor.decompress(rawblock)
+                except self._trailing_error:
+                    # Trailing data isn't a valid compressed stream; ignore it.
+                    return b""
+            else:
+                data = self._decompressor.decompress(rawblock)
+            if data:
+                return data
+
+    # Fill the buffer if it is empty. Returns False on EOF.
+    def _fill_buffer(self):
+        if self._buffer_offset < len(self._buffer):
+            return True
+        if self._eof:
+            return False
+        self._buffer = self._decompress_chunk()
+        self._buffer_offset = 0
+        if not self._buffer:
+            self._eof = True
+            self._size = self._pos
+            return False
+        return True
+
+    def readinto(self, b):
+        with memoryview(b) as view, view.cast("B") as byte_view:
+            if not byte_view or not self._fill_buffer():
+                return 0
+            start = self._buffer_offset
+            n = min(len(byte_view), len(self._buffer) - start)
+            with memoryview(self._buffer) as data:
+                byte_view[:n] = data[start:start + n]
+        self._buffer_offset += n
+        self._pos += n
+        return n
+
+    def readall(self):
+        chunks = []
+        while self._fill_buffer():
+            # Slicing the whole chunk doesn't copy it.
+            chunk = self._buffer[self._buffer_offset:]
+            self._buffer = b""
+            self._buffer_offset = 0
+            self._pos += len(chunk)
+            chunks.append(chunk)
+        return b"".join(chunks)
+
+    # Skip n bytes of decompressed data, or all of it if n is None.
+    def _skip(self, n=None):
+        while (n is None or n > 0) and self._fill_buffer():
+            available = len(self._buffer) - self._buffer_offset
+            if n is not None:
+                available = min(available, n)
+                n -= available
+            self._buffer_offset += available
+            self._pos += available
+
+    # Rewind the file to the beginning of the data stream.
+    def _rewind(self):
+        self._fp.seek(0)
+        self._eof = False
+        self._pos = 0
+        self._buffer = b""
+        self._buffer_offset = 0
+        self._decompressor = self._decomp_factory(**self._decomp_args)
+
+    def seek(self, offset, whence=io.SEEK_SET):
+        # Recalculate offset as an absolute file position.
+        if whence == io.SEEK_SET:
+            pass
+        elif whence == io.SEEK_CUR:
+            offset = self._pos + offset
+        elif whence == io.SEEK_END:
+            # Seeking relative to EOF - we need to know the file's size.
+            if self._size < 0:
+                self._skip()
+            offset = self._size + offset
+        else:
+            raise ValueError("Invalid value for whence: {}".format(whence))
+
+        # Make it so that offset is the number of bytes to skip forward.
+        if offset < self._pos:
+            self._rewind()
+        else:
+            offset -= self._pos
+
+        # Read and discard data until we reach the desired position.
+        self._skip(offset)
+        return self._pos
+
+    def tell(self):
+        """Return the current file position."""
+        return self._pos
+
+
+class BlockCompressor:
+    """Compressor working on independent blocks on a pool of threads.
+
+    Input is cut into blocks of block_size bytes, which are handed to
+    _compress_block() on the worker threads.  Their output is returned
+    in order by compress() and flush(), like a compressor object would.
+    _compress_block() should spend its time in code releasing the GIL,
+    as the compressors of the zlib, bz2 and lzma modules do.
+
+    Subclasses implement _compress_block(data, mode), where mode is None
+    for blocks cut by compress(), and the argument of flush() otherwise.
+    They can override _submit() to pass it more arguments, computed in
+    order on the calling thread.
+    """
+
+    def __init__(self, block_size, threads):
+        from concurrent.futures import ThreadPoolExecutor
+        self._block_size = block_size
+        self._executor = ThreadPoolExecutor(threads)
+        # Bound the memory used by blocks waiting to be written.
+        self._max_pending = 2 * threads
+        self._pending = deque()
+        self._buffer = bytearray()
+
+    def _submit(self, data, mode):
+        future = self._executor.submit(self._compress_block, data, mode)
+        self._pending.append(future)
+
+    def _collect(self, wait):
+        pending = self._pending
+        output = []
+        while pending and (wait or pending[0].done() or
+                           len(pending) > self._max_pending):
+            output.append(pending.popleft().result())
+        return b"".join(output)
+
+    def compress(self, data):
+        buffer = self._buffer
+        buffer += data
+        size = self._block_size
+        if len(buffer) >= size:
+            end = len(buffer) - len(buffer) % size
+            for start in range(0, end, size):
+                self._submit(bytes(buffer[start:start + size]), None)
+            del buffer[:end]
+        return self._collect(False)
+
+    def flush(self, mode):
+        """Compress the buffered input as a block ended with *mode*, and
+        return the output of all the pending blocks."""
+        self._submit(bytes(self._buffer), mode)
+        self._buffer = bytearray()
+        return self._collect(True)
+
+    def close(self):
+        """Stop the worker threads."""
+        self._executor.shutdown()
+        self._pending.clear()
@@ -609,16 +609,19 @@ class BaseEventLoop(events.AbstractEventLoop):
             else:
                 timeout = min(timeout, deadline)
 
-        # TODO: Instrumentation only in debug mode?
-        t0 = self.time()
-        event_list = self._selector.select(timeout)
-        t1 = self.time()
-        argstr = '' if timeout is None else '{:.3f}'.format(timeout)
-        if t1-t0 >= 1:
-            level = logging.INFO
+        # Only time the poll when it can be logged.
+        if logger.isEnabledFor(logging.INFO):
+            t0 = self.time()
+            event_list = self._selector.select(timeout)
+            t1 = self.time()
+            argstr = '' if timeout is None else '{:.3f}'.format(timeout)
+            if t1-t0 >= 1:
+                level = logging.INFO
+            else:
+                level = logging.DEBUG
+            logger.log(level, 'poll%s took %.3f seconds', argstr, t1-t0)
         else:
-            level = logging.DEBUG
-        logger.log(level, 'poll%s took %.3f seconds', argstr, t1-t0)
+            event_list = self._selector.select(timeout)
         self._process_events(event_list)
 
         # Handle 'later' callbacks that are ready.
@@ -636,9 +639,9 @@ class BaseEventLoop(events.AbstractEventLoop):
         # callbacks scheduled by callbacks run this time around --
         # they will be run the next time (after another I/O poll).
         # Use an idiom that is threadsafe without using locks.
-        ntodo = len(self._ready)
-        for i in range(ntodo):
-            handle = self._ready.popleft()
+        ready = self._ready
+        for i in range(len(ready)):
+            handle = ready.popleft()
             if not handle._cancelled:
                 handle._run()
         handle = None  # Needed to break cycles when an exception occurs.
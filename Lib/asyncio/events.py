@@ -19,6 +19,8 @@ from .log import logger
 class Handle:
     """Object returned by callback registration methods."""
 
+    __slots__ = ['_callback', '_args', '_cancelled']
+
     def __init__(self, callback, args):
         self._callback = callback
         self._args = args
@@ -51,6 +53,8 @@ def make_handle(callback, args):
 class TimerHandle(Handle):
     """Object returned by timed callback registration methods."""
 
+    __slots__ = ['_when']
+
     def __init__(self, when, callback, args):
         assert when is not None
         super().__init__(callback, args)
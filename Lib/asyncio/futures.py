@@ -103,6 +103,27 @@ class _TracebackLogger:
                          ''.join(self.tb))
 
 
+def _future_repr(future):
+    # Shared by the C implementation of Future.
+    res = future.__class__.__name__
+    if future._state == _FINISHED:
+        if future._exception is not None:
+            res += '<exception={!r}>'.format(future._exception)
+        else:
+            res += '<result={!r}>'.format(future._result)
+    elif future._callbacks:
+        size = len(future._callbacks)
+        if size > 2:
+            res += '<{}, [{}, <{} more>, {}]>'.format(
+                future._state, future._callbacks[0],
+                size-2, future._callbacks[-1])
+        else:
+            res += '<{}, {}>'.format(future._state, future._callbacks)
+    else:
+        res += '<{}>'.format(future._state)
+    return res
+
+
 class Future:
     """This class is *almost* compatible with concurrent.futures.Future.
 
@@ -144,23 +165,7 @@ class Future:
         self._callbacks = []
 
     def __repr__(self):
-        res = self.__class__.__name__
-        if self._state == _FINISHED:
-            if self._exception is not None:
-                res += '<exception={!r}>'.format(self._exception)
-            else:
-                res += '<result={!r}>'.format(self._result)
-        elif self._callbacks:
-            size = len(self._callbacks)
-            if size > 2:
-                res += '<{}, [{}, <{} more>, {}]>'.format(
-                    self._state, self._callbacks[0],
-                    size-2, self._callbacks[-1])
-            else:
-                res += '<{}, {}>'.format(self._state, self._callbacks)
-        else:
-            res += '<{}>'.format(self._state)
-        return res
+        return _future_repr(self)
 
     def cancel(self):
         """Cancel the future and schedule callbacks.
@@ -341,3 +346,15 @@ def wrap_future(fut, *, loop=None):
         lambda future: loop.call_soon_threadsafe(
             new_future._copy_state, fut))
     return new_future
+
+
+# Use the C implementation when available; the pure Python one is kept
+# for testing.
+_PyFuture = Future
+
+try:
+    import _asyncio
+except ImportError:
+    pass
+else:
+    Future = _CFuture = _asyncio.Future
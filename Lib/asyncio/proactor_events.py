@@ -1,7 +1,7 @@
 """Event loop using a proactor and related classes.
 
 A proactor is a "notify-on-completion" multiplexer.  Currently a
-proactor is only implemented on Windows with IOCP.
+proactor is implemented on Windows with IOCP and on Linux with io_uring.
 """
 
 import socket
@@ -77,7 +77,11 @@ class _ProactorBasePipeTransport(transports.BaseTransport):
             # just close our end.  First calling shutdown() seems to
             # cure it, but maybe using DisconnectEx() would be better.
             if hasattr(self._sock, 'shutdown'):
-                self._sock.shutdown(socket.SHUT_RDWR)
+                try:
+                    self._sock.shutdown(socket.SHUT_RDWR)
+                except OSError:
+                    # ENOTCONN on Linux if the peer reset the connection.
+                    pass
             self._sock.close()
             server = self._server
             if server is not None:
@@ -412,7 +416,8 @@ class BaseProactorEventLoop(base_events.BaseEventLoop):
 
     def _start_serving(self, protocol_factory, sock, ssl=None, server=None):
         if ssl:
-            raise ValueError('IocpEventLoop is incompatible with SSL.')
+            raise ValueError('{} is incompatible with SSL.'
+                             .format(self.__class__.__name__))
 
         def loop(f=None):
             try:
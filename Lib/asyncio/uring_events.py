@@ -0,0 +1,256 @@
+"""Proactor event loop for Linux using io_uring.
+
+Operations are queued on the io_uring submission ring as they are
+requested and handed to the kernel together, in the same system call
+that waits for completions.  This needs Linux 5.11 or newer.
+"""
+
+import errno
+import os
+import select
+import socket
+import weakref
+
+from . import futures
+from . import proactor_events
+from .log import logger
+import _uring
+
+
+__all__ = ['UringProactorEventLoop', 'UringProactor']
+
+
+# Returned by a completion callback which queued a new operation for the
+# same future, e.g. to send the rest of a partially sent buffer.
+_PENDING = object()
+
+
+class _UringFuture(futures.Future):
+    """Subclass of Future which represents an io_uring operation.
+
+    Cancelling it will immediately cancel the operation.
+    """
+
+    def __init__(self, op, ring, *, loop=None):
+        super().__init__(loop=loop)
+        self.op = op
+        self._ring = ring
+
+    def cancel(self):
+        if self.op.pending and not self._ring.closed:
+            self._ring.cancel(self.op)
+        return super().cancel()
+
+
+class _UringWritePipeTransport(proactor_events._ProactorWritePipeTransport):
+    """Transport for write pipes which notices the read end closing."""
+
+    def __init__(self, loop, sock, protocol, waiter=None, extra=None):
+        super().__init__(loop, sock, protocol, waiter, extra)
+        # As in unix_events, the write end becoming readable means that
+        # the other end was closed.  close() cancels the poll.
+        self._read_fut = loop._proactor.poll(sock, select.POLLIN)
+        self._read_fut.add_done_callback(self._pipe_closed)
+
+    def _pipe_closed(self, fut):
+        if fut.cancelled() or self._closing:
+            return
+        self._read_fut = None
+        self._force_close(BrokenPipeError() if self._buffer else None)
+
+
+class UringProactorEventLoop(proactor_events.BaseProactorEventLoop):
+    """Linux version of proactor event loop using io_uring."""
+
+    def __init__(self, proactor=None):
+        if proactor is None:
+            proactor = UringProactor()
+        super().__init__(proactor)
+
+    def _socketpair(self):
+        return socket.socketpair()
+
+    def _make_write_pipe_transport(self, sock, protocol, waiter=None,
+                                   extra=None, check_for_hangup=True):
+        if check_for_hangup:
+            return _UringWritePipeTransport(self, sock, protocol, waiter,
+                                            extra)
+        else:
+            return proactor_events._ProactorWritePipeTransport(
+                self, sock, protocol, waiter, extra)
+
+
+class UringProactor:
+    """Proactor implementation using io_uring."""
+
+    def __init__(self, entries=256):
+        self._loop = None
+        self._results = []
+        self._ring = _uring.Ring(entries)
+        self._cache = {}
+        self._stopped_serving = weakref.WeakSet()
+
+    def set_loop(self, loop):
+        self._loop = loop
+
+    def fileno(self):
+        return self._ring.fileno()
+
+    def select(self, timeout=None):
+        if not self._results:
+            self._poll(timeout)
+        tmp = self._results
+        self._results = []
+        return tmp
+
+    def recv(self, conn, nbytes, flags=0):
+        fd = conn.fileno()
+        if isinstance(conn, socket.socket):
+            start = lambda: self._ring.recv(fd, nbytes, flags)
+        else:
+            start = lambda: self._ring.read(fd, nbytes)
+
+        def finish(f, op):
+            return op.getresult()
+
+        return self._register(start, select.POLLIN, conn, finish)
+
+    def send(self, conn, buf, flags=0):
+        fd = conn.fileno()
+        view = memoryview(buf)
+        if isinstance(conn, socket.socket):
+            start = lambda: self._ring.send(fd, view, flags)
+        else:
+            start = lambda: self._ring.write(fd, view)
+
+        def finish(f, op):
+            nonlocal view
+            view = view[op.getresult():]
+            if view:
+                # Partial write, queue the rest for the same future.
+                self._restart(f, conn, start, select.POLLOUT, finish)
+                return _PENDING
+            return len(buf)
+
+        return self._register(start, select.POLLOUT, conn, finish)
+
+    def accept(self, listener):
+        fd = listener.fileno()
+
+        def finish_accept(f, op):
+            conn = socket.socket(listener.family, listener.type,
+                                 listener.proto, fileno=op.getresult())
+            conn.settimeout(listener.gettimeout())
+            return conn, conn.getpeername()
+
+        return self._register(lambda: self._ring.accept(fd), select.POLLIN,
+                              listener, finish_accept)
+
+    def connect(self, conn, address):
+        fd = conn.fileno()
+
+        def finish_connect(f, op):
+            try:
+                op.getresult()
+            except OSError as exc:
+                # Kernels without the connect retry fix report the
+                # socket connected in the background as EISCONN.
+                if exc.errno != errno.EISCONN:
+                    raise
+            return conn
+
+        start = lambda: self._ring.connect(fd, conn.family, address)
+        return self._register(start, select.POLLOUT, conn, finish_connect)
+
+    def poll(self, conn, events):
+        # Return a future for the poll events reported for conn.
+        fd = conn.fileno()
+
+        def finish(f, op):
+            return op.getresult()
+
+        return self._register(lambda: self._ring.poll(fd, events), 0, conn,
+                              finish)
+
+    def _register(self, start, events, obj, callback):
+        # Return a future which will be set with the result of the
+        # operation when it completes.  The future's value is actually
+        # the value returned by callback().  Note that we store obj only
+        # to prevent it from being garbage collected too early.
+        op = start()
+        f = _UringFuture(op, self._ring, loop=self._loop)
+        self._cache[op] = (f, obj, start, events, callback, False)
+        return f
+
+    def _restart(self, f, obj, start, events, callback):
+        # Keep f pending on a new operation.
+        op = f.op = start()
+        self._cache[op] = (f, obj, start, events, callback, False)
+
+    def _poll(self, timeout=None):
+        if timeout is not None and timeout < 0:
+            raise ValueError("negative timeout")
+        try:
+            ops = self._ring.wait(timeout)
+        except InterruptedError:
+            return
+        for op in ops:
+            f, obj, start, events, callback, ready_wait = self._cache.pop(op)
+            if obj in self._stopped_serving or f.cancelled():
+                if op.type == 'accept' and op.result >= 0:
+                    os.close(op.result)
+                f.cancel()
+            elif (op.result in (-errno.EAGAIN, -errno.EINPROGRESS) and
+                  events and not ready_wait):
+                # Older kernels fail operations on non-blocking files
+                # instead of waiting: poll, then try again.
+                f.op = self._ring.poll(op.fd, events)
+                self._cache[f.op] = (f, obj, start, events, callback, True)
+            elif ready_wait and op.result >= 0:
+                self._restart(f, obj, start, events, callback)
+            else:
+                try:
+                    value = callback(f, op)
+                except OSError as e:
+                    f.set_exception(e)
+                    self._results.append(f)
+                else:
+                    if value is not _PENDING:
+                        f.set_result(value)
+                        self._results.append(f)
+
+    def _stop_serving(self, obj):
+        # obj is a socket which will be closed by
+        # BaseProactorEventLoop._stop_serving().  The ring holds its own
+        # reference to the file, so its pending operations must be
+        # cancelled explicitly, and before the descriptor is reused.
+        self._stopped_serving.add(obj)
+        for op, entry in self._cache.items():
+            if entry[1] is obj:
+                self._ring.cancel(op)
+        self._ring.submit()
+
+    def close(self):
+        if self._ring is None:
+            return
+        # Cancel remaining operations and wait for them to complete: the
+        # kernel may use their buffers until then.
+        for op in self._cache:
+            self._ring.cancel(op)
+        while self._cache:
+            try:
+                ops = self._ring.wait(1)
+            except InterruptedError:
+                continue
+            if not ops:
+                logger.debug('taking long time to close proactor')
+            for op in ops:
+                f = self._cache.pop(op)[0]
+                if op.type == 'accept' and op.result >= 0:
+                    # Completed before it could be cancelled.
+                    os.close(op.result)
+                f.cancel()
+
+        self._results = []
+        self._ring.close()
+        self._ring = None
@@ -26,47 +26,68 @@ def iglob(pathname):
     patterns.
 
     """
+    return _iglob(pathname, False)
+
+# If dironly is true, only directories are yielded: the pattern is
+# followed by more path components.
+def _iglob(pathname, dironly):
     if not has_magic(pathname):
         if os.path.lexists(pathname):
             yield pathname
         return
     dirname, basename = os.path.split(pathname)
     if not dirname:
-        yield from glob1(None, basename)
+        yield from _glob1(None, basename, dironly)
         return
     # `os.path.split()` returns the argument itself as a dirname if it is a
     # drive or UNC path.  Prevent an infinite recursion if a drive or UNC path
     # contains magic characters (i.e. r'\\?\C:').
     if dirname != pathname and has_magic(dirname):
-        dirs = iglob(dirname)
+        dirs = _iglob(dirname, True)
     else:
         dirs = [dirname]
     if has_magic(basename):
-        glob_in_dir = glob1
+        for dirname in dirs:
+            for name in _glob1(dirname, basename, dironly):
+                yield os.path.join(dirname, name)
     else:
-        glob_in_dir = glob0
-    for dirname in dirs:
-        for name in glob_in_dir(dirname, basename):
-            yield os.path.join(dirname, name)
+        for dirname in dirs:
+            for name in glob0(dirname, basename):
+                yield os.path.join(dirname, name)
 
 # These 2 helper functions non-recursively glob inside a literal directory.
 # They return a list of basenames. `glob1` accepts a pattern while `glob0`
 # takes a literal basename (so it only has to check for its existence).
 
 def glob1(dirname, pattern):
+    return _glob1(dirname, pattern, False)
+
+def _glob1(dirname, pattern, dironly):
     if not dirname:
         if isinstance(pattern, bytes):
             dirname = bytes(os.curdir, 'ASCII')
         else:
             dirname = os.curdir
-    try:
-        names = os.listdir(dirname)
-    except OSError:
-        return []
+    names = _iterdir(dirname, dironly)
     if not _ishidden(pattern):
-        names = [x for x in names if not _ishidden(x)]
+        names = (x for x in names if not _ishidden(x))
     return fnmatch.filter(names, pattern)
 
+# Yield the names of the entries of dirname, or of its subdirectories only.
+# The entries' types usually come with the directory listing, so this
+# doesn't stat() them.
+def _iterdir(dirname, dironly):
+    try:
+        with os.scandir(dirname) as it:
+            for entry in it:
+                try:
+                    if not dironly or entry.is_dir():
+                        yield entry.name
+                except OSError:
+                    pass
+    except OSError:
+        return
+
 def glob0(dirname, basename):
     if not basename:
         # `os.path.split()` returns an empty basename for paths ending with a
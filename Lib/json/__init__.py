@@ -97,13 +97,13 @@ Using json.tool from the shell to validate and pretty-print::
 """
 __version__ = '2.0.9'
 __all__ = [
-    'dump', 'dumps', 'load', 'loads',
-    'JSONDecoder', 'JSONEncoder',
+    'dump', 'dumps', 'load', 'loads', 'iterload',
+    'JSONDecoder', 'JSONEncoder', 'JSONStreamDecoder',
 ]
 
 __author__ = 'Bob Ippolito <bob@redivi.com>'
 
-from .decoder import JSONDecoder
+from .decoder import JSONDecoder, JSONStreamDecoder
 from .encoder import JSONEncoder
 
 _default_encoder = JSONEncoder(
@@ -165,18 +165,15 @@ def dump(obj, fp, skipkeys=False, ensure_ascii=True, check_circular=True,
         check_circular and allow_nan and
         cls is None and indent is None and separators is None and
         default is None and not sort_keys and not kw):
-        iterable = _default_encoder.iterencode(obj)
+        encoder = _default_encoder
     else:
         if cls is None:
             cls = JSONEncoder
-        iterable = cls(skipkeys=skipkeys, ensure_ascii=ensure_ascii,
+        encoder = cls(skipkeys=skipkeys, ensure_ascii=ensure_ascii,
             check_circular=check_circular, allow_nan=allow_nan, indent=indent,
             separators=separators,
-            default=default, sort_keys=sort_keys, **kw).iterencode(obj)
-    # could accelerate with writelines in some versions of Python, at
-    # a debuggability cost
-    for chunk in iterable:
-        fp.write(chunk)
+            default=default, sort_keys=sort_keys, **kw)
+    encoder.dump(obj, fp)
 
 
 def dumps(obj, skipkeys=False, ensure_ascii=True, check_circular=True,
@@ -268,10 +265,57 @@ def load(fp, cls=None, object_hook=None, parse_float=None,
         parse_constant=parse_constant, object_pairs_hook=object_pairs_hook, **kw)
 
 
+def iterload(fp, *, array=False, encoding='utf-8', chunk_size=65536,
+        cls=None, object_hook=None, parse_float=None, parse_int=None,
+        parse_constant=None, object_pairs_hook=None, **kw):
+    """Iterate over the JSON documents of the stream ``fp`` (a
+    ``.read()``-supporting file-like object), such as a file of
+    newline-delimited JSON documents.
+
+    If ``array`` is true, ``fp`` must hold a single JSON array instead, and
+    its items are returned one at a time.
+
+    ``fp`` is read ``chunk_size`` characters or bytes at a time, and only
+    the document being decoded is kept in memory.  Bytes are decoded with
+    ``encoding``.
+
+    The other arguments have the same meaning as in ``load()``.
+
+    """
+    if (cls is None and object_hook is None and
+            parse_int is None and parse_float is None and
+            parse_constant is None and object_pairs_hook is None and not kw):
+        decoder = _default_decoder
+    else:
+        if cls is None:
+            cls = JSONDecoder
+        if object_hook is not None:
+            kw['object_hook'] = object_hook
+        if object_pairs_hook is not None:
+            kw['object_pairs_hook'] = object_pairs_hook
+        if parse_float is not None:
+            kw['parse_float'] = parse_float
+        if parse_int is not None:
+            kw['parse_int'] = parse_int
+        if parse_constant is not None:
+            kw['parse_constant'] = parse_constant
+        decoder = cls(**kw)
+    parser = JSONStreamDecoder(decoder, array=array, encoding=encoding)
+    while True:
+        data = fp.read(chunk_size)
+        if not data:
+            break
+        parser.feed(data)
+        yield from parser.read_values()
+    parser.close()
+    yield from parser.read_values()
+
+
 def loads(s, encoding=None, cls=None, object_hook=None, parse_float=None,
         parse_int=None, parse_constant=None, object_pairs_hook=None, **kw):
     """Deserialize ``s`` (a ``str`` instance containing a JSON
-    document) to a Python object.
+    document, or a ``bytes``, ``bytearray`` or ``memoryview`` instance
+    containing a UTF-8 encoded JSON document) to a Python object.
 
     ``object_hook`` is an optional function that will be called with the
     result of any object literal decode (a ``dict``). The return value of
@@ -307,11 +351,15 @@ def loads(s, encoding=None, cls=None, object_hook=None, parse_float=None,
     The ``encoding`` argument is ignored and deprecated.
 
     """
-    if not isinstance(s, str):
-        raise TypeError('the JSON object must be str, not {!r}'.format(
-                            s.__class__.__name__))
-    if s.startswith(u'\ufeff'):
-        raise ValueError("Unexpected UTF-8 BOM (decode using utf-8-sig)")
+    if isinstance(s, str):
+        if s.startswith(u'\ufeff'):
+            raise ValueError("Unexpected UTF-8 BOM (decode using utf-8-sig)")
+    elif isinstance(s, (bytes, bytearray, memoryview)):
+        if s[:3] == b'\xef\xbb\xbf':
+            raise ValueError("Unexpected UTF-8 BOM (decode using utf-8-sig)")
+    else:
+        raise TypeError('the JSON object must be str or bytes, not {!r}'
+                        .format(s.__class__.__name__))
     if (cls is None and object_hook is None and
             parse_int is None and parse_float is None and
             parse_constant is None and object_pairs_hook is None and not kw):
@@ -1,5 +1,7 @@
 """Implementation of JSONDecoder
 """
+import codecs
+import collections
 import re
 
 from json import scanner
@@ -7,8 +9,12 @@ try:
     from _json import scanstring as c_scanstring
 except ImportError:
     c_scanstring = None
+try:
+    from _json import scan_value_end as c_scan_value_end
+except ImportError:
+    c_scan_value_end = None
 
-__all__ = ['JSONDecoder']
+__all__ = ['JSONDecoder', 'JSONStreamDecoder']
 
 FLAGS = re.VERBOSE | re.MULTILINE | re.DOTALL
 
@@ -18,10 +24,12 @@ NegInf = float('-inf')
 
 
 def linecol(doc, pos):
-    if isinstance(doc, bytes):
-        newline = b'\n'
-    else:
+    if isinstance(doc, str):
         newline = '\n'
+    else:
+        newline = b'\n'
+        if not isinstance(doc, (bytes, bytearray)):
+            doc = bytes(doc)
     lineno = doc.count(newline, 0, pos) + 1
     if lineno == 1:
         colno = pos + 1
@@ -133,6 +141,7 @@ def py_scanstring(s, end, strict=True,
 scanstring = c_scanstring or py_scanstring
 
 WHITESPACE = re.compile(r'[ \t\n\r]*', FLAGS)
+WHITESPACE_BYTES = re.compile(br'[ \t\n\r]*', FLAGS)
 WHITESPACE_STR = ' \t\n\r'
 
 
@@ -335,11 +344,25 @@ class JSONDecoder(object):
         self.scan_once = scanner.make_scanner(self)
 
 
-    def decode(self, s, _w=WHITESPACE.match):
+    def decode(self, s, _w=WHITESPACE.match, _wb=WHITESPACE_BYTES.match):
         """Return the Python representation of ``s`` (a ``str`` instance
-        containing a JSON document).
+        containing a JSON document, or a bytes-like object containing a
+        UTF-8 encoded JSON document).
 
         """
+        if not isinstance(s, str):
+            if not (scanner.c_make_scanner is not None and
+                    isinstance(self.scan_once, scanner.c_make_scanner)):
+                # Only the C scanner reads UTF-8 directly
+                try:
+                    s = str(s, 'utf-8')
+                except UnicodeDecodeError as exc:
+                    raise ValueError(errmsg("Invalid UTF-8 data at", s,
+                                            exc.start)) from None
+                return self.decode(s)
+            if not isinstance(s, (bytes, bytearray)):
+                s = memoryview(s).cast('B')
+            _w = _wb
         obj, end = self.raw_decode(s, idx=_w(s, 0).end())
         end = _w(s, end).end()
         if end != len(s):
@@ -360,3 +383,201 @@ class JSONDecoder(object):
         except StopIteration as err:
             raise ValueError(errmsg("Expecting value", s, err.value)) from None
         return obj, end
+
+
+VALUE_SPECIAL = re.compile(r'["\[\]{}]')
+STRING_SPECIAL = re.compile(r'["\\]')
+
+def py_scan_value_end(s, idx, state):
+    """Scan the string s from idx for the end of a JSON array, object or
+    string starting at or before idx, without decoding it.  state is 0 at
+    the start of the value.
+
+    Returns the index after the end of the value and 0, or -1 and the state
+    to pass back with the rest of the value if s ends before it."""
+    depth = state >> 2
+    in_string = state & 2
+    escape = state & 1
+    n = len(s)
+    while idx < n:
+        if escape:
+            escape = 0
+            idx += 1
+        elif in_string:
+            m = STRING_SPECIAL.search(s, idx)
+            if m is None:
+                idx = n
+                break
+            idx = m.end()
+            if m.group() == '\\':
+                escape = 1
+            else:
+                in_string = 0
+                if not depth:
+                    return idx, 0
+        else:
+            m = VALUE_SPECIAL.search(s, idx)
+            if m is None:
+                break
+            idx = m.end()
+            c = m.group()
+            if c == '"':
+                in_string = 2
+            elif c in '[{':
+                depth += 1
+            else:
+                depth -= 1
+                if depth <= 0:
+                    return idx, 0
+    return -1, (depth << 2) | in_string | escape
+
+scan_value_end = c_scan_value_end or py_scan_value_end
+
+SCALAR_END = re.compile(r'[ \t\n\r,:\[\]{}"]')
+
+# States of JSONStreamDecoder in array mode
+_ARRAY_START, _ARRAY_FIRST, _ARRAY_VALUE, _ARRAY_NEXT, _ARRAY_END = range(5)
+
+
+class JSONStreamDecoder(object):
+    """Incremental decoder of a stream of JSON documents.
+
+    The stream is passed in chunks of any size to ``feed()``, and the
+    documents decoded so far are returned by ``read_values()``.  The
+    documents may be separated by whitespace, as in newline-delimited JSON.
+    If ``array`` is true, the stream must instead hold a single JSON array,
+    and its items are returned one at a time.
+
+    Only the document being decoded is kept in memory, so that
+    arbitrarily long streams can be decoded in bounded memory.  Chunks may
+    be ``str`` or, decoded with ``encoding``, bytes-like objects.
+
+    ``decoder`` is the ``JSONDecoder`` used to decode each document.
+
+    """
+
+    def __init__(self, decoder=None, *, array=False, encoding='utf-8'):
+        if decoder is None:
+            decoder = JSONDecoder()
+        self.decoder = decoder
+        self.array = array
+        self.encoding = encoding
+        self._text = None
+        self._bytes_decoder = None
+        # Parts of the current document from previous chunks
+        self._pieces = []
+        # State of scan_value_end() in the current document, or -1 between
+        # documents
+        self._state = -1
+        self._scalar = False
+        self._array_state = _ARRAY_START
+        self._values = collections.deque()
+        self._closed = False
+
+    def feed(self, data):
+        """Feed the next chunk of the stream."""
+        if self._closed:
+            raise ValueError("feed() called after close()")
+        text = isinstance(data, str)
+        if self._text is None:
+            self._text = text
+        elif self._text != text:
+            raise TypeError("can't mix str and bytes chunks")
+        if not text:
+            if self._bytes_decoder is None:
+                self._bytes_decoder = codecs.getincrementaldecoder(
+                    self.encoding)()
+            data = self._bytes_decoder.decode(data)
+        self._parse(data, False)
+
+    def close(self):
+        """Signal the end of the stream, and check that it does not end in
+        the middle of a document."""
+        if self._closed:
+            return
+        data = ''
+        if self._bytes_decoder is not None:
+            data = self._bytes_decoder.decode(b'', True)
+        self._parse(data, True)
+        self._closed = True
+        if self._state >= 0:
+            raise ValueError("Unterminated JSON document at end of stream")
+        if self.array and self._array_state != _ARRAY_END:
+            if self._array_state == _ARRAY_START:
+                raise ValueError("Expecting JSON array")
+            raise ValueError("Unterminated JSON array at end of stream")
+
+    def read_values(self):
+        """Return an iterator over the documents decoded so far.  Each
+        document is returned only once."""
+        values = self._values
+        while values:
+            yield values.popleft()
+
+    def _parse(self, buf, final, _w=WHITESPACE.match):
+        # Start of the current document in buf
+        start = pos = 0
+        n = len(buf)
+        while True:
+            if self._state < 0:
+                # Between documents
+                pos = _w(buf, pos).end()
+                if pos == n:
+                    break
+                if self.array and self._array_state != _ARRAY_VALUE:
+                    c = buf[pos]
+                    if self._array_state == _ARRAY_START:
+                        if c != '[':
+                            raise ValueError(errmsg("Expecting JSON array",
+                                                    buf, pos))
+                        self._array_state = _ARRAY_FIRST
+                        pos += 1
+                        continue
+                    elif self._array_state == _ARRAY_END:
+                        raise ValueError(errmsg("Extra data", buf, pos, n))
+                    elif c == ']':
+                        self._array_state = _ARRAY_END
+                        pos += 1
+                        continue
+                    elif self._array_state == _ARRAY_NEXT:
+                        if c != ',':
+                            raise ValueError(errmsg("Expecting ',' delimiter",
+                                                    buf, pos))
+                        self._array_state = _ARRAY_VALUE
+                        pos += 1
+                        continue
+                start = pos
+                self._state = 0
+                self._scalar = buf[pos] not in '[{"'
+            # In a document; its end is found before decoding it
+            if self._scalar:
+                m = SCALAR_END.search(buf, pos)
+                if m is not None:
+                    end = m.start()
+                elif final:
+                    end = n
+                else:
+                    end = -1
+            else:
+                end, self._state = scan_value_end(buf, pos, self._state)
+            if end < 0:
+                # Keep the beginning of the document until its end comes
+                self._pieces.append(buf[start:])
+                break
+            if self._pieces:
+                self._pieces.append(buf[start:end])
+                doc = ''.join(self._pieces)
+                self._pieces = []
+                value, docend = self.decoder.raw_decode(doc)
+                if docend != len(doc):
+                    raise ValueError(errmsg("Extra data", doc, docend,
+                                            len(doc)))
+            else:
+                value, docend = self.decoder.raw_decode(buf, start)
+                if docend != end:
+                    raise ValueError(errmsg("Extra data", buf, docend, end))
+            self._values.append(value)
+            self._state = -1
+            if self.array:
+                self._array_state = _ARRAY_NEXT
+            pos = end
@@ -249,6 +249,44 @@ class JSONEncoder(object):
                 self.skipkeys, _one_shot)
         return _iterencode(o, 0)
 
+    def dump(self, o, fp, buffer_size=65536):
+        """Write the JSON representation of ``o`` to ``fp`` (a
+        ``.write()``-supporting file-like object) as it is produced, in
+        pieces of about ``buffer_size`` characters.
+
+        Unlike ``encode()``, the whole representation is never held in
+        memory.
+
+        """
+        write = fp.write
+        if (c_make_encoder is not None and self.indent is None and
+                type(self).iterencode is JSONEncoder.iterencode):
+            if self.check_circular:
+                markers = {}
+            else:
+                markers = None
+            if self.ensure_ascii:
+                _encoder = encode_basestring_ascii
+            else:
+                _encoder = encode_basestring
+            _iterencode = c_make_encoder(
+                markers, self.default, _encoder, self.indent,
+                self.key_separator, self.item_separator, self.sort_keys,
+                self.skipkeys, self.allow_nan)
+            _iterencode(o, 0, write, buffer_size)
+            return
+        chunks = []
+        size = 0
+        for chunk in self.iterencode(o):
+            chunks.append(chunk)
+            size += len(chunk)
+            if size >= buffer_size:
+                write(''.join(chunks))
+                chunks = []
+                size = 0
+        if chunks:
+            write(''.join(chunks))
+
 def _make_iterencode(markers, _default, _encoder, _indent, _floatstr,
         _key_separator, _item_separator, _sort_keys, _skipkeys, _one_shot,
         ## HACK: hand-optimized bytecode; turn globals into locals
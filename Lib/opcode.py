@@ -194,6 +194,9 @@ def_op('MAP_ADD', 147)
 def_op('LOAD_CLASSDEREF', 148)
 hasfree.append(148)
 
+name_op('LOAD_METHOD', 160)     # Index in name list
+def_op('CALL_METHOD', 161)      # Number of positional arguments
+
 def_op('EXTENDED_ARG', 144)
 EXTENDED_ARG = 144
 
@@ -338,7 +338,7 @@ def walk(top, topdown=True, onerror=None, followlinks=False):
     dirnames have already been generated by the time dirnames itself is
     generated.
 
-    By default errors from the os.listdir() call are ignored.  If
+    By default errors from the os.scandir() call are ignored.  If
     optional arg 'onerror' is specified, it should be a function; it
     will be called with one argument, an OSError instance.  It can
     report the error to continue with the walk, or raise the exception
@@ -366,7 +366,9 @@ def walk(top, topdown=True, onerror=None, followlinks=False):
             dirs.remove('CVS')  # don't visit CVS directories
     """
 
-    islink, join, isdir = path.islink, path.join, path.isdir
+    dirs = []
+    nondirs = []
+    walk_dirs = []
 
     # We may not have read permission for top, in which case we can't
     # get a list of the files the directory contains.  os.walk
@@ -374,28 +376,64 @@ def walk(top, topdown=True, onerror=None, followlinks=False):
     # minor reason when (say) a thousand readable directories are still
     # left to visit.  That logic is copied here.
     try:
-        # Note that listdir is global in this module due
-        # to earlier import-*.
-        names = listdir(top)
+        # Note that scandir is global in this module due
+        # to earlier import-*.  The entries it yields know their type
+        # without a stat() call on most systems.
+        scandir_it = scandir(top)
     except OSError as err:
         if onerror is not None:
             onerror(err)
         return
 
-    dirs, nondirs = [], []
-    for name in names:
-        if isdir(join(top, name)):
-            dirs.append(name)
-        else:
-            nondirs.append(name)
+    with scandir_it:
+        while True:
+            try:
+                try:
+                    entry = next(scandir_it)
+                except StopIteration:
+                    break
+            except OSError as err:
+                if onerror is not None:
+                    onerror(err)
+                return
+
+            try:
+                is_dir = entry.is_dir()
+            except OSError:
+                # Like os.path.isdir(), consider that the entry is not a
+                # directory if is_dir() fails.
+                is_dir = False
+
+            if is_dir:
+                dirs.append(entry.name)
+            else:
+                nondirs.append(entry.name)
+
+            if not topdown and is_dir:
+                # Bottom-up: the entries tell us which directories are
+                # symlinks.  They are walked after the directory is closed.
+                if followlinks:
+                    walk_into = True
+                else:
+                    try:
+                        walk_into = not entry.is_symlink()
+                    except OSError:
+                        walk_into = True
+                if walk_into:
+                    walk_dirs.append(entry.path)
 
     if topdown:
         yield top, dirs, nondirs
-    for name in dirs:
-        new_path = join(top, name)
-        if followlinks or not islink(new_path):
+
+        # The caller may have changed dirs, so the entries can't be used.
+        islink, join = path.islink, path.join
+        for name in dirs:
+            new_path = join(top, name)
+            if followlinks or not islink(new_path):
+                yield from walk(new_path, topdown, onerror, followlinks)
+    else:
+        for new_path in walk_dirs:
             yield from walk(new_path, topdown, onerror, followlinks)
-    if not topdown:
         yield top, dirs, nondirs
 
 __all__.append("walk")
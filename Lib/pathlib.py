@@ -7,7 +7,6 @@ import posixpath
 import re
 import sys
 from collections import Sequence
-from contextlib import contextmanager
 from errno import EINVAL, ENOENT
 from operator import attrgetter
 from stat import S_ISDIR, S_ISLNK, S_ISREG, S_ISSOCK, S_ISBLK, S_ISCHR, S_ISFIFO
@@ -332,6 +331,8 @@ class _NormalAccessor(_Accessor):
 
     listdir = _wrap_strfunc(os.listdir)
 
+    scandir = _wrap_strfunc(os.scandir)
+
     chmod = _wrap_strfunc(os.chmod)
 
     if hasattr(os, "lchmod"):
@@ -376,25 +377,6 @@ _normal_accessor = _NormalAccessor()
 # Globbing helpers
 #
 
-@contextmanager
-def _cached(func):
-    try:
-        func.__cached__
-        yield func
-    except AttributeError:
-        cache = {}
-        def wrapper(*args):
-            try:
-                return cache[args]
-            except KeyError:
-                value = cache[args] = func(*args)
-                return value
-        wrapper.__cached__ = True
-        try:
-            yield wrapper
-        finally:
-            cache.clear()
-
 def _make_selector(pattern_parts):
     pat = pattern_parts[0]
     child_parts = pattern_parts[1:]
@@ -420,8 +402,11 @@ class _Selector:
         self.child_parts = child_parts
         if child_parts:
             self.successor = _make_selector(child_parts)
+            # Only directories can match when other parts follow.
+            self.dironly = True
         else:
             self.successor = _TerminatingSelector()
+            self.dironly = False
 
     def select_from(self, parent_path):
         """Iterate over all child paths of `parent_path` matched by this
@@ -429,13 +414,15 @@ class _Selector:
         path_cls = type(parent_path)
         is_dir = path_cls.is_dir
         exists = path_cls.exists
-        listdir = parent_path._accessor.listdir
-        return self._select_from(parent_path, is_dir, exists, listdir)
+        scandir = parent_path._accessor.scandir
+        if not is_dir(parent_path):
+            return iter([])
+        return self._select_from(parent_path, is_dir, exists, scandir)
 
 
 class _TerminatingSelector:
 
-    def _select_from(self, parent_path, is_dir, exists, listdir):
+    def _select_from(self, parent_path, is_dir, exists, scandir):
         yield parent_path
 
 
@@ -445,30 +432,36 @@ class _PreciseSelector(_Selector):
         self.name = name
         _Selector.__init__(self, child_parts)
 
-    def _select_from(self, parent_path, is_dir, exists, listdir):
-        if not is_dir(parent_path):
-            return
+    def _select_from(self, parent_path, is_dir, exists, scandir):
         path = parent_path._make_child_relpath(self.name)
-        if exists(path):
-            for p in self.successor._select_from(path, is_dir, exists, listdir):
+        if (is_dir if self.dironly else exists)(path):
+            for p in self.successor._select_from(path, is_dir, exists, scandir):
                 yield p
 
 
+def _scandir_list(scandir, path):
+    # Don't keep the directory open while the successors run.
+    with scandir(path) as scandir_it:
+        return list(scandir_it)
+
+
 class _WildcardSelector(_Selector):
 
     def __init__(self, pat, child_parts):
         self.pat = re.compile(fnmatch.translate(pat))
         _Selector.__init__(self, child_parts)
 
-    def _select_from(self, parent_path, is_dir, exists, listdir):
-        if not is_dir(parent_path):
-            return
+    def _select_from(self, parent_path, is_dir, exists, scandir):
         cf = parent_path._flavour.casefold
-        for name in listdir(parent_path):
+        for entry in _scandir_list(scandir, parent_path):
+            # The entry usually knows its type without a stat() call.
+            if self.dironly and not entry.is_dir():
+                continue
+            name = entry.name
             casefolded = cf(name)
             if self.pat.match(casefolded):
                 path = parent_path._make_child_relpath(name)
-                for p in self.successor._select_from(path, is_dir, exists, listdir):
+                for p in self.successor._select_from(path, is_dir, exists, scandir):
                     yield p
 
 
@@ -477,28 +470,25 @@ class _RecursiveWildcardSelector(_Selector):
     def __init__(self, pat, child_parts):
         _Selector.__init__(self, child_parts)
 
-    def _iterate_directories(self, parent_path, is_dir, listdir):
+    def _iterate_directories(self, parent_path, is_dir, scandir):
         yield parent_path
-        for name in listdir(parent_path):
-            path = parent_path._make_child_relpath(name)
-            if is_dir(path):
-                for p in self._iterate_directories(path, is_dir, listdir):
+        for entry in _scandir_list(scandir, parent_path):
+            if entry.is_dir():
+                path = parent_path._make_child_relpath(entry.name)
+                for p in self._iterate_directories(path, is_dir, scandir):
                     yield p
 
-    def _select_from(self, parent_path, is_dir, exists, listdir):
-        if not is_dir(parent_path):
-            return
-        with _cached(listdir) as listdir:
-            yielded = set()
-            try:
-                successor_select = self.successor._select_from
-                for starting_point in self._iterate_directories(parent_path, is_dir, listdir):
-                    for p in successor_select(starting_point, is_dir, exists, listdir):
-                        if p not in yielded:
-                            yield p
-                            yielded.add(p)
-            finally:
-                yielded.clear()
+    def _select_from(self, parent_path, is_dir, exists, scandir):
+        yielded = set()
+        try:
+            successor_select = self.successor._select_from
+            for starting_point in self._iterate_directories(parent_path, is_dir, scandir):
+                for p in successor_select(starting_point, is_dir, exists, scandir):
+                    if p not in yielded:
+                        yield p
+                        yielded.add(p)
+        finally:
+            yielded.clear()
 
 
 #
@@ -960,11 +950,9 @@ class Path(PurePath):
         """
         if self._closed:
             self._raise_closed()
-        for name in self._accessor.listdir(self):
-            if name in {'.', '..'}:
-                # Yielding a path object for these makes little sense
-                continue
-            yield self._make_child_relpath(name)
+        # scandir() skips '.' and '..'.
+        for entry in _scandir_list(self._accessor.scandir, self):
+            yield self._make_child_relpath(entry.name)
             if self._closed:
                 self._raise_closed()
 
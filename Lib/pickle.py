@@ -38,11 +38,19 @@ import _compat_pickle
 __all__ = ["PickleError", "PicklingError", "UnpicklingError", "Pickler",
            "Unpickler", "dump", "dumps", "load", "loads"]
 
+try:
+    from _pickle import PickleBuffer
+    __all__.append("PickleBuffer")
+    _HAVE_PICKLE_BUFFER = True
+except ImportError:
+    _HAVE_PICKLE_BUFFER = False
+
+
 # Shortcut for use in isinstance testing
 bytes_types = (bytes, bytearray)
 
 # These are purely informational; no code uses these.
-format_version = "4.0"                  # File format version we write
+format_version = "5.0"                  # File format version we write
 compatible_formats = ["1.0",            # Original protocol 0
                       "1.1",            # Protocol 0 with INST added
                       "1.2",            # Original protocol 1
@@ -50,10 +58,11 @@ compatible_formats = ["1.0",            # Original protocol 0
                       "2.0",            # Protocol 2
                       "3.0",            # Protocol 3
                       "4.0",            # Protocol 4
+                      "5.0",            # Protocol 5
                       ]                 # Old format versions we can read
 
 # This is the highest protocol number we know how to read.
-HIGHEST_PROTOCOL = 4
+HIGHEST_PROTOCOL = 5
 
 # The protocol we write by default.  May be less than HIGHEST_PROTOCOL.
 # We intentionally write a protocol that Python 2.x cannot read;
@@ -177,6 +186,13 @@ STACK_GLOBAL     = b'\x93'  # same as GLOBAL but using names on the stacks
 MEMOIZE          = b'\x94'  # store top of the stack in memo
 FRAME            = b'\x95'  # indicate the beginning of a new frame
 
+# Protocol 5
+BYTEARRAY8       = b'\x96'  # push bytearray
+NEXT_BUFFER      = b'\x97'  # push next out-of-band buffer
+READONLY_BUFFER  = b'\x98'  # make top of stack readonly
+PACKED_LIST      = b'\x99'  # push list of packed ints, floats or strs
+PACKED_TUPLE     = b'\x9a'  # push tuple of packed ints, floats or strs
+
 __all__.extend([x for x in dir() if re.match("[A-Z][A-Z0-9_]+$", x)])
 
 
@@ -340,16 +356,69 @@ def decode_long(data):
     """
     return int.from_bytes(data, byteorder='little', signed=True)
 
+def _readonly_view(m):
+    # There is no way to make a read-only view of a writable buffer in
+    # Python code, so this returns a view of a read-only copy.
+    view = memoryview(m.tobytes())
+    if m.ndim != 1 or m.format != 'B':
+        try:
+            view = view.cast(m.format, m.shape)
+        except (TypeError, ValueError):
+            pass
+    return view
+
+# Item sizes of the fixed-size packed array type codes.
+_PACKED_ITEMSIZES = {b'B': 1, b'h': 2, b'i': 4, b'q': 8, b'd': 8}
+
+def _pack_items(items):
+    """Return the type code and the data of a packed array of items.
+
+    (None, None) is returned if the items can't be packed: they must be
+    all ints fitting in 64 bits, all floats or all ASCII strs of at most
+    255 characters.  Ints use the smallest type code which can hold all of
+    them.
+    """
+    t = type(items[0])
+    if not all(type(x) is t for x in items):
+        return None, None
+    if t is int:
+        lo = min(items)
+        hi = max(items)
+        if 0 <= lo and hi <= 0xff:
+            code = 'B'
+        elif -0x8000 <= lo and hi <= 0x7fff:
+            code = 'h'
+        elif -0x80000000 <= lo and hi <= 0x7fffffff:
+            code = 'i'
+        elif -1 << 63 <= lo and hi < 1 << 63:
+            code = 'q'
+        else:
+            return None, None
+    elif t is float:
+        code = 'd'
+    elif t is str:
+        try:
+            data = [x.encode('ascii') for x in items]
+        except UnicodeEncodeError:
+            return None, None
+        if any(len(x) > 0xff for x in data):
+            return None, None
+        return b's', b''.join([bytes((len(x),)) + x for x in data])
+    else:
+        return None, None
+    return code.encode('ascii'), pack('<%d%s' % (len(items), code), *items)
+
 
 # Pickling machinery
 
 class _Pickler:
 
-    def __init__(self, file, protocol=None, *, fix_imports=True):
+    def __init__(self, file, protocol=None, *, fix_imports=True,
+                 buffer_callback=None):
         """This takes a binary file for writing a pickle data stream.
 
         The optional *protocol* argument tells the pickler to use the
-        given protocol; supported protocols are 0, 1, 2, 3 and 4.  The
+        given protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The
         default protocol is 3; a backward-incompatible protocol designed
         for Python 3.
 
@@ -367,6 +436,12 @@ class _Pickler:
         will try to map the new Python 3 names to the old module names
         used in Python 2, so that the pickle data stream is readable
         with Python 2.
+
+        If *buffer_callback* is not None and *protocol* is at least 5,
+        it is called with each PickleBuffer being pickled.  If it
+        returns a false value, the buffer is kept out of the pickle
+        data stream and must be given back to the unpickler in its
+        *buffers* argument; otherwise it is serialized in-band.
         """
         if protocol is None:
             protocol = DEFAULT_PROTOCOL
@@ -374,6 +449,9 @@ class _Pickler:
             protocol = HIGHEST_PROTOCOL
         elif not 0 <= protocol <= HIGHEST_PROTOCOL:
             raise ValueError("pickle protocol must be <= %d" % HIGHEST_PROTOCOL)
+        if buffer_callback is not None and protocol < 5:
+            raise ValueError("buffer_callback needs protocol >= 5")
+        self._buffer_callback = buffer_callback
         try:
             self._file_write = file.write
         except AttributeError:
@@ -473,7 +551,7 @@ class _Pickler:
         # Check the type dispatch table
         t = type(obj)
         f = self.dispatch.get(t)
-        if f is not None:
+        if f is not None and (t is not bytearray or self.proto >= 5):
             f(self, obj) # Call unbound method with explicit self
             return
 
@@ -693,6 +771,40 @@ class _Pickler:
         self.memoize(obj)
     dispatch[bytes] = save_bytes
 
+    # Older protocols pickle bytearrays with their __reduce_ex__() method,
+    # see save().
+    def save_bytearray(self, obj):
+        n = len(obj)
+        self.write(BYTEARRAY8 + pack("<Q", n) + obj)
+        self.memoize(obj)
+    dispatch[bytearray] = save_bytearray
+
+    if _HAVE_PICKLE_BUFFER:
+        def save_picklebuffer(self, obj):
+            if self.proto < 5:
+                raise PicklingError("PickleBuffer can only be pickled with "
+                                    "protocol >= 5")
+            with obj.raw() as m:
+                if not m.contiguous:
+                    raise PicklingError("PickleBuffer can not be pickled when "
+                                        "pointing to a non-contiguous buffer")
+                in_band = True
+                if self._buffer_callback is not None:
+                    in_band = bool(self._buffer_callback(obj))
+                if in_band:
+                    # Write data in-band
+                    if m.readonly:
+                        self.save_bytes(m.tobytes())
+                    else:
+                        self.save_bytearray(m.tobytes())
+                else:
+                    # Write data out-of-band
+                    self.write(NEXT_BUFFER)
+                    if m.readonly:
+                        self.write(READONLY_BUFFER)
+
+        dispatch[PickleBuffer] = save_picklebuffer
+
     def save_str(self, obj):
         if self.bin:
             encoded = obj.encode('utf-8', 'surrogatepass')
@@ -719,6 +831,10 @@ class _Pickler:
                 self.write(MARK + TUPLE)
             return
 
+        if self.proto >= 5 and self._save_packed(obj, PACKED_TUPLE):
+            self.memoize(obj)
+            return
+
         n = len(obj)
         save = self.save
         memo = self.memo
@@ -763,6 +879,10 @@ class _Pickler:
     dispatch[tuple] = save_tuple
 
     def save_list(self, obj):
+        if self.proto >= 5 and self._save_packed(obj, PACKED_LIST):
+            self.memoize(obj)
+            return
+
         if self.bin:
             self.write(EMPTY_LIST)
         else:   # proto 0 -- can't use EMPTY_LIST
@@ -775,6 +895,24 @@ class _Pickler:
 
     _BATCHSIZE = 1000
 
+    # Keep in synch with PACK_MIN_SIZE in Modules/_pickle.c.  Lists and tuples
+    # of at least this many ints, floats or short ASCII strs are saved as
+    # packed arrays with protocol 5; their items aren't memoized.
+    _PACK_MIN_SIZE = 8
+
+    def _save_packed(self, obj, opcode):
+        if len(obj) < self._PACK_MIN_SIZE:
+            return False
+        # Packed items don't go through persistent_id().
+        if (getattr(self.persistent_id, '__func__', None) is not
+                _Pickler.persistent_id):
+            return False
+        code, data = _pack_items(obj)
+        if code is None:
+            return False
+        self.write(opcode + code + pack("<Q", len(obj)) + data)
+        return True
+
     def _batch_appends(self, items):
         # Helper to batch up APPENDS sequences
         save = self.save
@@ -972,7 +1110,7 @@ class _Pickler:
 class _Unpickler:
 
     def __init__(self, file, *, fix_imports=True,
-                 encoding="ASCII", errors="strict"):
+                 encoding="ASCII", errors="strict", buffers=None):
         """This takes a binary file for reading a pickle data stream.
 
         The protocol version of the pickle is detected automatically, so
@@ -999,7 +1137,13 @@ class _Unpickler:
         to decode 8-bit string instances pickled by Python 2; these
         default to 'ASCII' and 'strict', respectively. *encoding* can be
         'bytes' to read theses 8-bit string instances as bytes objects.
+
+        If *buffers* is not None, it should be an iterable of
+        buffer-enabled objects that is consumed each time the pickle
+        stream references an out-of-band buffer view.  Such buffers have
+        been given in order to the *buffer_callback* of a Pickler object.
         """
+        self._buffers = iter(buffers) if buffers is not None else None
         self._file_readline = file.readline
         self._file_read = file.read
         self.memo = {}
@@ -1182,6 +1326,72 @@ class _Unpickler:
         self.append(self.read(len))
     dispatch[BINBYTES[0]] = load_binbytes
 
+    def load_bytearray8(self):
+        len, = unpack('<Q', self.read(8))
+        if len > maxsize:
+            raise UnpicklingError("BYTEARRAY8 exceeds system's maximum size "
+                                  "of %d bytes" % maxsize)
+        b = bytearray(len)
+        b[:] = self.read(len)
+        self.append(b)
+    dispatch[BYTEARRAY8[0]] = load_bytearray8
+
+    def load_next_buffer(self):
+        if self._buffers is None:
+            raise UnpicklingError("pickle stream refers to out-of-band data "
+                                  "but no *buffers* argument was given")
+        try:
+            buf = next(self._buffers)
+        except StopIteration:
+            raise UnpicklingError("not enough out-of-band buffers")
+        self.append(buf)
+    dispatch[NEXT_BUFFER[0]] = load_next_buffer
+
+    def load_readonly_buffer(self):
+        buf = self.stack[-1]
+        with memoryview(buf) as m:
+            if not m.readonly:
+                self.stack[-1] = _readonly_view(m)
+    dispatch[READONLY_BUFFER[0]] = load_readonly_buffer
+
+    def _read_packed(self):
+        read = self.read
+        header = read(9)
+        if len(header) < 9:
+            raise EOFError
+        code = header[:1]
+        n, = unpack('<Q', header[1:])
+        if n > maxsize:
+            raise UnpicklingError("packed array exceeds system's maximum size "
+                                  "of %d items" % maxsize)
+        if code == b's':
+            # The count isn't backed by any data yet: don't preallocate.
+            items = []
+            for i in range(n):
+                size = read(1)
+                if not size:
+                    raise EOFError
+                data = read(size[0])
+                if len(data) < size[0]:
+                    raise EOFError
+                items.append(str(data, 'ascii'))
+            return items
+        size = _PACKED_ITEMSIZES.get(code)
+        if size is None:
+            raise UnpicklingError("invalid packed array type code, %r." % code)
+        data = read(n * size)
+        if len(data) < n * size:
+            raise EOFError
+        return unpack('<%d%s' % (n, code.decode('ascii')), data)
+
+    def load_packed_list(self):
+        self.append(list(self._read_packed()))
+    dispatch[PACKED_LIST[0]] = load_packed_list
+
+    def load_packed_tuple(self):
+        self.append(tuple(self._read_packed()))
+    dispatch[PACKED_TUPLE[0]] = load_packed_tuple
+
     def load_unicode(self):
         self.append(str(self.readline()[:-1], 'raw-unicode-escape'))
     dispatch[UNICODE[0]] = load_unicode
@@ -1530,25 +1740,29 @@ class _Unpickler:
 
 # Shorthands
 
-def _dump(obj, file, protocol=None, *, fix_imports=True):
-    _Pickler(file, protocol, fix_imports=fix_imports).dump(obj)
+def _dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None):
+    _Pickler(file, protocol, fix_imports=fix_imports,
+             buffer_callback=buffer_callback).dump(obj)
 
-def _dumps(obj, protocol=None, *, fix_imports=True):
+def _dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None):
     f = io.BytesIO()
-    _Pickler(f, protocol, fix_imports=fix_imports).dump(obj)
+    _Pickler(f, protocol, fix_imports=fix_imports,
+             buffer_callback=buffer_callback).dump(obj)
     res = f.getvalue()
     assert isinstance(res, bytes_types)
     return res
 
-def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict"):
-    return _Unpickler(file, fix_imports=fix_imports,
+def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict",
+          buffers=None):
+    return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
                      encoding=encoding, errors=errors).load()
 
-def _loads(s, *, fix_imports=True, encoding="ASCII", errors="strict"):
+def _loads(s, *, fix_imports=True, encoding="ASCII", errors="strict",
+           buffers=None):
     if isinstance(s, str):
         raise TypeError("Can't load pickle from unicode string")
     file = io.BytesIO(s)
-    return _Unpickler(file, fix_imports=fix_imports,
+    return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
                       encoding=encoding, errors=errors).load()
 
 # Use the faster _pickle if possible
@@ -594,6 +594,98 @@ bytes8 = ArgumentDescriptor(
               the number of bytes, and the second argument is that many bytes.
               """)
 
+
+def read_bytearray8(f):
+    r"""
+    >>> import io, struct, sys
+    >>> read_bytearray8(io.BytesIO(b"\x00\x00\x00\x00\x00\x00\x00\x00abc"))
+    bytearray(b'')
+    >>> read_bytearray8(io.BytesIO(b"\x03\x00\x00\x00\x00\x00\x00\x00abcdef"))
+    bytearray(b'abc')
+    >>> bigsize8 = struct.pack("<Q", sys.maxsize//3)
+    >>> read_bytearray8(io.BytesIO(bigsize8 + b"abcdef"))  #doctest: +ELLIPSIS
+    Traceback (most recent call last):
+    ...
+    ValueError: expected ... bytes in a bytearray8, but only 6 remain
+    """
+
+    n = read_uint8(f)
+    assert n >= 0
+    if n > sys.maxsize:
+        raise ValueError("bytearray8 byte count > sys.maxsize: %d" % n)
+    data = f.read(n)
+    if len(data) == n:
+        return bytearray(data)
+    raise ValueError("expected %d bytes in a bytearray8, but only %d remain" %
+                     (n, len(data)))
+
+bytearray8 = ArgumentDescriptor(
+              name="bytearray8",
+              n=TAKEN_FROM_ARGUMENT8U,
+              reader=read_bytearray8,
+              doc="""A counted bytearray.
+
+              The first argument is a 8-byte little-endian unsigned int giving
+              the number of bytes, and the second argument is that many bytes.
+              """)
+
+_packedarray_itemsizes = {b'B': 1, b'h': 2, b'i': 4, b'q': 8, b'd': 8}
+
+def read_packedarray(f):
+    r"""
+    >>> import io
+    >>> read_packedarray(io.BytesIO(b"B\x03\x00\x00\x00\x00\x00\x00\x00abc"))
+    [97, 98, 99]
+    >>> read_packedarray(io.BytesIO(b"h\x02\x00\x00\x00\x00\x00\x00\x00\xff\xff\x00\x01"))
+    [-1, 256]
+    >>> read_packedarray(io.BytesIO(b"s\x02\x00\x00\x00\x00\x00\x00\x00\x02ab\x00"))
+    ['ab', '']
+    >>> read_packedarray(io.BytesIO(b"d\x01\x00\x00\x00\x00\x00\x00\x00abc"))
+    Traceback (most recent call last):
+    ...
+    ValueError: expected 8 bytes in a packedarray, but only 3 remain
+    >>> read_packedarray(io.BytesIO(b"x\x00\x00\x00\x00\x00\x00\x00\x00"))
+    Traceback (most recent call last):
+    ...
+    ValueError: invalid packedarray type code b'x'
+    """
+
+    code = f.read(1)
+    n = read_uint8(f)
+    if n > sys.maxsize:
+        raise ValueError("packedarray item count > sys.maxsize: %d" % n)
+    if code == b's':
+        result = []
+        for i in range(n):
+            result.append(read_unicodestring1(f))
+        return result
+    size = _packedarray_itemsizes.get(code)
+    if size is None:
+        raise ValueError("invalid packedarray type code %r" % code)
+    data = f.read(n * size)
+    if len(data) == n * size:
+        return list(_unpack("<%d%s" % (n, code.decode("ascii")), data))
+    raise ValueError("expected %d bytes in a packedarray, but only %d remain" %
+                     (n * size, len(data)))
+
+packedarray = ArgumentDescriptor(
+              name="packedarray",
+              n=TAKEN_FROM_ARGUMENT8U,
+              reader=read_packedarray,
+              doc="""A packed array of ints, floats or strings.
+
+              The first byte is a type code, followed by an 8-byte
+              little-endian unsigned int giving the number of items, and
+              then by the items:
+
+                'B'  unsigned 8-bit ints
+                'h'  signed 16-bit little-endian ints
+                'i'  signed 32-bit little-endian ints
+                'q'  signed 64-bit little-endian ints
+                'd'  little-endian IEEE 754 doubles
+                's'  ASCII strings, each prefixed with its 1-byte length
+              """)
+
 def read_unicodestringnl(f):
     r"""
     >>> import io
@@ -999,6 +1091,11 @@ pybytes = StackObject(
     obtype=bytes,
     doc="A Python bytes object.")
 
+pybytearray = StackObject(
+    name='bytearray',
+    obtype=bytearray,
+    doc="A Python bytearray object.")
+
 pyunicode = StackObject(
     name='str',
     obtype=str,
@@ -1039,6 +1136,11 @@ anyobject = StackObject(
     obtype=object,
     doc="Any kind of object whatsoever.")
 
+pybuffer = StackObject(
+    name='buffer',
+    obtype=object,
+    doc="Any buffer-enabled object.")
+
 markobject = StackObject(
     name="mark",
     obtype=StackObject,
@@ -1335,6 +1437,63 @@ opcodes = [
       which are taken literally as the string content.
       """),
 
+    # Bytearray
+
+    I(name='BYTEARRAY8',
+      code='\x96',
+      arg=bytearray8,
+      stack_before=[],
+      stack_after=[pybytearray],
+      proto=5,
+      doc="""Push a Python bytearray object.
+
+      There are two arguments:  the first is a 8-byte unsigned int giving
+      the number of bytes in the bytearray, and the second is that many bytes,
+      which are taken literally as the bytearray content.
+      """),
+
+    # Out-of-band buffer
+
+    I(name='NEXT_BUFFER',
+      code='\x97',
+      arg=None,
+      stack_before=[],
+      stack_after=[pybuffer],
+      proto=5,
+      doc="Push an out-of-band buffer object."),
+
+    I(name='READONLY_BUFFER',
+      code='\x98',
+      arg=None,
+      stack_before=[pybuffer],
+      stack_after=[pybuffer],
+      proto=5,
+      doc="Make an out-of-band buffer object read-only."),
+
+    I(name='PACKED_LIST',
+      code='\x99',
+      arg=packedarray,
+      stack_before=[],
+      stack_after=[pylist],
+      proto=5,
+      doc="""Push a list of ints, floats or strings.
+
+      The items are packed in the argument, without any per-item opcode.
+      They aren't memoized.
+      """),
+
+    I(name='PACKED_TUPLE',
+      code='\x9a',
+      arg=packedarray,
+      stack_before=[],
+      stack_after=[pytuple],
+      proto=5,
+      doc="""Push a tuple of ints, floats or strings.
+
+      The items are packed in the argument, without any per-item opcode.
+      They aren't memoized.
+      """),
+
     # Ways to spell None.
 
     I(name='NONE',
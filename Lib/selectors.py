@@ -10,6 +10,11 @@ from collections import namedtuple, Mapping
 import functools
 import select
 import sys
+from time import monotonic
+try:
+    import _uring
+except ImportError:
+    _uring = None
 
 
 # generic events, that must be mapped to implementation-specific ones
@@ -499,6 +504,79 @@ if hasattr(select, 'kqueue'):
             super().close()
 
 
+if _uring is not None:
+
+    class UringSelector(_BaseSelectorImpl):
+        """io_uring-based selector."""
+
+        def __init__(self):
+            super().__init__()
+            self._ring = _uring.Ring()
+            # this maps file descriptors to their pending poll operation
+            self._polls = {}
+
+        def fileno(self):
+            return self._ring.fileno()
+
+        def register(self, fileobj, events, data=None):
+            key = super().register(fileobj, events, data)
+            self._arm(key)
+            return key
+
+        def unregister(self, fileobj):
+            key = super().unregister(fileobj)
+            op = self._polls.pop(key.fd, None)
+            if op is not None:
+                self._ring.cancel(op)
+            return key
+
+        def _arm(self, key):
+            # Polls are one-shot: queue a new one for the next select(),
+            # which submits it together with all the others.
+            poll_events = 0
+            if key.events & EVENT_READ:
+                poll_events |= select.POLLIN
+            if key.events & EVENT_WRITE:
+                poll_events |= select.POLLOUT
+            self._polls[key.fd] = self._ring.poll(key.fd, poll_events)
+
+        def select(self, timeout=None):
+            if timeout is not None:
+                timeout = max(timeout, 0)
+                deadline = monotonic() + timeout
+            ready = []
+            while True:
+                try:
+                    ops = self._ring.wait(timeout)
+                except InterruptedError:
+                    return ready
+                for op in ops:
+                    if self._polls.get(op.fd) is not op:
+                        # Cancelled by unregister() or modify().
+                        continue
+                    del self._polls[op.fd]
+                    key = self._key_from_fd(op.fd)
+                    # Report errors such as EBADF as both events, the
+                    # caller will get the error from the next I/O call.
+                    event = op.result if op.result >= 0 else ~0
+                    events = 0
+                    if event & ~select.POLLIN:
+                        events |= EVENT_WRITE
+                    if event & ~select.POLLOUT:
+                        events |= EVENT_READ
+                    ready.append((key, events & key.events))
+                    self._arm(key)
+                if ready or not ops or timeout == 0:
+                    return ready
+                if timeout is not None:
+                    timeout = max(deadline - monotonic(), 0)
+
+        def close(self):
+            self._ring.close()
+            self._polls.clear()
+            super().close()
+
+
 # Choose the best implementation: roughly, epoll|kqueue > poll > select.
 # select() also can't accept a FD > FD_SETSIZE (usually around 1024)
 if 'KqueueSelector' in globals():
@@ -59,6 +59,81 @@ class RegistryError(Exception):
     """Raised when a registry operation with the archiving
     and unpacking registeries fails"""
 
+class _GiveupOnFastCopy(Exception):
+    """Raised when the kernel can't copy a file, to fall back on a
+    read()/write() copy."""
+
+
+COPY_BUFSIZE = 1024 * 1024
+_USE_CP_COPY_FILE_RANGE = hasattr(os, "copy_file_range")
+_USE_CP_SENDFILE = hasattr(os, "sendfile") and sys.platform.startswith("linux")
+
+def _copy_file_range(infd, outfd, count):
+    return os.copy_file_range(infd, outfd, count)
+
+def _sendfile(infd, outfd, count):
+    return os.sendfile(outfd, infd, None, count)
+
+def _fastcopy_kernel(fsrc, fdst, copy_func):
+    """Copy data from one regular file object to another with
+    copy_func(infd, outfd, count), which is _copy_file_range() or
+    _sendfile(): the data never leaves the kernel.
+
+    Raise _GiveupOnFastCopy if the kernel can't copy these files, and
+    nothing was copied yet.
+    """
+    try:
+        infd = fsrc.fileno()
+        outfd = fdst.fileno()
+    except Exception as err:
+        raise _GiveupOnFastCopy(err)  # not a regular file
+
+    # Copy in chunks of at least 8 MiB, or of the whole file.
+    try:
+        blocksize = max(os.fstat(infd).st_size, 2 ** 23)
+    except OSError:
+        blocksize = 2 ** 27
+    # On 32-bit architectures truncate to 1 GiB to avoid OverflowError.
+    if sys.maxsize < 2 ** 32:
+        blocksize = min(blocksize, 2 ** 30)
+
+    offset = 0
+    while True:
+        try:
+            copied = copy_func(infd, outfd, blocksize)
+        except OSError as err:
+            err.filename = fsrc.name
+            err.filename2 = fdst.name
+            if err.errno == errno.ENOSPC:  # filesystem is full
+                raise err from None
+            if offset == 0:
+                # Not supported by the kernel or the filesystems
+                # (ENOSYS, EXDEV, EINVAL...).
+                raise _GiveupOnFastCopy(err)
+            raise err
+        if copied == 0:
+            if offset == 0:
+                # Files in /proc and /sys report a size of 0 and can't
+                # be copied by the kernel: read them, to be sure.
+                raise _GiveupOnFastCopy()
+            break
+        offset += copied
+
+def _copyfileobj_readinto(fsrc, fdst, length=COPY_BUFSIZE):
+    """readinto()/write() based variant of copyfileobj(), which reuses
+    a single buffer.  fsrc must support readinto()."""
+    fsrc_readinto = fsrc.readinto
+    fdst_write = fdst.write
+    with memoryview(bytearray(length)) as mv:
+        while True:
+            n = fsrc_readinto(mv)
+            if not n:
+                break
+            elif n < length:
+                with mv[:n] as smv:
+                    fdst_write(smv)
+            else:
+                fdst_write(mv)
 
 def copyfileobj(fsrc, fdst, length=16*1024):
     """copy data from file-like object fsrc to file-like object fdst"""
@@ -104,9 +179,29 @@ def copyfile(src, dst, *, follow_symlinks=True):
     if not follow_symlinks and os.path.islink(src):
         os.symlink(os.readlink(src), dst)
     else:
-        with open(src, 'rb') as fsrc:
-            with open(dst, 'wb') as fdst:
-                copyfileobj(fsrc, fdst)
+        with open(src, 'rb') as fsrc, open(dst, 'wb') as fdst:
+            # Let the kernel copy the data if it can (Linux).
+            if _USE_CP_COPY_FILE_RANGE:
+                try:
+                    _fastcopy_kernel(fsrc, fdst, _copy_file_range)
+                    return dst
+                except _GiveupOnFastCopy:
+                    pass
+            if _USE_CP_SENDFILE:
+                try:
+                    _fastcopy_kernel(fsrc, fdst, _sendfile)
+                    return dst
+                except _GiveupOnFastCopy:
+                    pass
+
+            try:
+                file_size = os.fstat(fsrc.fileno()).st_size
+            except OSError:
+                file_size = 0
+            if 0 < file_size < COPY_BUFSIZE:
+                _copyfileobj_readinto(fsrc, fdst, file_size)
+            else:
+                _copyfileobj_readinto(fsrc, fdst)
     return dst
 
 def copymode(src, dst, *, follow_symlinks=True):
@@ -257,8 +352,58 @@ def ignore_patterns(*patterns):
         return set(ignored_names)
     return _ignore_patterns
 
+class _Pool:
+    """Pool of threads running file operations for copytree() and rmtree().
+
+    The calls are handled in order on the calling thread by wait(),
+    which passes the exception of the failed ones to their on_error
+    callback, in an except clause.  At most a few calls per worker are
+    pending at any time, to bound the memory used on huge directories.
+    """
+
+    def __init__(self, workers):
+        from concurrent.futures import ThreadPoolExecutor
+        if workers < 1:
+            raise ValueError("workers must be a positive integer")
+        self._executor = ThreadPoolExecutor(workers)
+        self._max_pending = 4 * workers
+        self._pending = collections.deque()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.cancel()
+        self._executor.shutdown()
+
+    def submit(self, on_error, func, *args, **kwargs):
+        future = self._executor.submit(func, *args, **kwargs)
+        self._pending.append((future, on_error))
+        if len(self._pending) > self._max_pending:
+            self.wait(self._max_pending)
+
+    def wait(self, max_pending=0):
+        """Handle the oldest calls until at most max_pending remain."""
+        pending = self._pending
+        while len(pending) > max_pending:
+            future, on_error = pending.popleft()
+            try:
+                future.result()
+            except OSError as exc:
+                on_error(exc)
+
+    def cancel(self):
+        """Cancel the pending calls, after an error.  Wait for the
+        running ones, which may use file descriptors about to be closed."""
+        from concurrent.futures import wait
+        futures = [future for future, on_error in self._pending]
+        self._pending.clear()
+        for future in futures:
+            future.cancel()
+        wait(futures)
+
 def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
-             ignore_dangling_symlinks=False):
+             ignore_dangling_symlinks=False, *, workers=None):
     """Recursively copy a directory tree.
 
     The destination directory must not already exist.
@@ -292,7 +437,20 @@ def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
     destination path as arguments. By default, copy2() is used, but any
     function that supports the same signature (like copy()) can be used.
 
+    If the optional workers argument is given, the files are copied
+    concurrently by that many threads, while the tree is walked.  The
+    errors are reported as for a sequential copy.
+
     """
+    if workers is None:
+        return _copytree(src, dst, symlinks, ignore, copy_function,
+                         ignore_dangling_symlinks)
+    with _Pool(workers) as pool:
+        return _copytree(src, dst, symlinks, ignore, copy_function,
+                         ignore_dangling_symlinks, pool)
+
+def _copytree(src, dst, symlinks, ignore, copy_function,
+              ignore_dangling_symlinks=False, pool=None):
     names = os.listdir(src)
     if ignore is not None:
         ignored_names = ignore(src, names)
@@ -301,6 +459,11 @@ def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
 
     os.makedirs(dst)
     errors = []
+    def on_error(exc, srcname=None, dstname=None):
+        if isinstance(exc, Error):
+            errors.extend(exc.args[0])
+        else:
+            errors.append((srcname, dstname, str(exc)))
     for name in names:
         if name in ignored_names:
             continue
@@ -320,18 +483,26 @@ def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
                     if not os.path.exists(linkto) and ignore_dangling_symlinks:
                         continue
                     # otherwise let the copy occurs. copy2 will raise an error
-                    copy_function(srcname, dstname)
+                    _copyfile_maybe_async(pool, on_error, copy_function,
+                                          srcname, dstname)
             elif os.path.isdir(srcname):
-                copytree(srcname, dstname, symlinks, ignore, copy_function)
+                _copytree(srcname, dstname, symlinks, ignore, copy_function,
+                          pool=pool)
             else:
                 # Will raise a SpecialFileError for unsupported file types
-                copy_function(srcname, dstname)
+                _copyfile_maybe_async(pool, on_error, copy_function,
+                                      srcname, dstname)
         # catch the Error from the recursive copytree so that we can
         # continue with other files
-        except Error as err:
-            errors.extend(err.args[0])
         except OSError as why:
-            errors.append((srcname, dstname, str(why)))
+            if pool is not None:
+                # Report the earlier copies' errors first, as a sequential
+                # copy would.
+                pool.wait()
+            on_error(why, srcname, dstname)
+    if pool is not None:
+        # The files must be copied before setting the directory's times.
+        pool.wait()
     try:
         copystat(src, dst)
     except OSError as why:
@@ -342,8 +513,27 @@ def copytree(src, dst, symlinks=False, ignore=None, copy_function=copy2,
         raise Error(errors)
     return dst
 
+def _copyfile_maybe_async(pool, on_error, copy_function, srcname, dstname):
+    if pool is None:
+        copy_function(srcname, dstname)
+    else:
+        pool.submit(lambda exc: on_error(exc, srcname, dstname),
+                    copy_function, srcname, dstname)
+
+# Remove a file, or submit its removal to the pool.  The pool must be
+# waited for before removing the directory.
+def _unlink_maybe_async(pool, onerror, fullname, *args, **kwargs):
+    if pool is None:
+        try:
+            os.unlink(*args, **kwargs)
+        except OSError:
+            onerror(os.unlink, fullname, sys.exc_info())
+    else:
+        pool.submit(lambda exc: onerror(os.unlink, fullname, sys.exc_info()),
+                    os.unlink, *args, **kwargs)
+
 # version vulnerable to race conditions
-def _rmtree_unsafe(path, onerror):
+def _rmtree_unsafe(path, onerror, pool=None):
     try:
         if os.path.islink(path):
             # symlinks to directories are forbidden, see bug #1669
@@ -364,19 +554,18 @@ def _rmtree_unsafe(path, onerror):
         except OSError:
             mode = 0
         if stat.S_ISDIR(mode):
-            _rmtree_unsafe(fullname, onerror)
+            _rmtree_unsafe(fullname, onerror, pool)
         else:
-            try:
-                os.unlink(fullname)
-            except OSError:
-                onerror(os.unlink, fullname, sys.exc_info())
+            _unlink_maybe_async(pool, onerror, fullname, fullname)
+    if pool is not None:
+        pool.wait()
     try:
         os.rmdir(path)
     except OSError:
         onerror(os.rmdir, path, sys.exc_info())
 
 # Version using fd-based APIs to protect against races
-def _rmtree_safe_fd(topfd, path, onerror):
+def _rmtree_safe_fd(topfd, path, onerror, pool=None):
     names = []
     try:
         names = os.listdir(topfd)
@@ -398,7 +587,7 @@ def _rmtree_safe_fd(topfd, path, onerror):
             else:
                 try:
                     if os.path.samestat(orig_st, os.fstat(dirfd)):
-                        _rmtree_safe_fd(dirfd, fullname, onerror)
+                        _rmtree_safe_fd(dirfd, fullname, onerror, pool)
                         try:
                             os.rmdir(name, dir_fd=topfd)
                         except OSError:
@@ -412,20 +601,27 @@ def _rmtree_safe_fd(topfd, path, onerror):
                                           "link")
                         except OSError:
                             onerror(os.path.islink, fullname, sys.exc_info())
+                except BaseException:
+                    if pool is not None:
+                        # onerror raised: no unlink relative to dirfd may
+                        # still be pending once it is closed.  Otherwise
+                        # the recursive call already waited for them.
+                        pool.cancel()
+                    raise
                 finally:
                     os.close(dirfd)
         else:
-            try:
-                os.unlink(name, dir_fd=topfd)
-            except OSError:
-                onerror(os.unlink, fullname, sys.exc_info())
+            _unlink_maybe_async(pool, onerror, fullname, name, dir_fd=topfd)
+    if pool is not None:
+        # topfd is closed and the directory removed once this returns.
+        pool.wait()
 
 _use_fd_functions = ({os.open, os.stat, os.unlink, os.rmdir} <=
                      os.supports_dir_fd and
                      os.listdir in os.supports_fd and
                      os.stat in os.supports_follow_symlinks)
 
-def rmtree(path, ignore_errors=False, onerror=None):
+def rmtree(path, ignore_errors=False, onerror=None, *, workers=None):
     """Recursively delete a directory tree.
 
     If ignore_errors is set, errors are ignored; otherwise, if onerror
@@ -435,7 +631,18 @@ def rmtree(path, ignore_errors=False, onerror=None):
     exc_info is a tuple returned by sys.exc_info().  If ignore_errors
     is false and onerror is None, an exception is raised.
 
+    If the optional workers argument is given, the files are removed
+    concurrently by that many threads, while the tree is walked.
+    onerror is still called on the calling thread, in the order of a
+    sequential removal.
+
     """
+    if workers is not None:
+        with _Pool(workers) as pool:
+            return _rmtree(path, ignore_errors, onerror, pool)
+    return _rmtree(path, ignore_errors, onerror)
+
+def _rmtree(path, ignore_errors, onerror, pool=None):
     if ignore_errors:
         def onerror(*args):
             pass
@@ -460,7 +667,7 @@ def rmtree(path, ignore_errors=False, onerror=None):
             return
         try:
             if os.path.samestat(orig_st, os.fstat(fd)):
-                _rmtree_safe_fd(fd, path, onerror)
+                _rmtree_safe_fd(fd, path, onerror, pool)
                 try:
                     os.rmdir(path)
                 except OSError:
@@ -472,9 +679,11 @@ def rmtree(path, ignore_errors=False, onerror=None):
                 except OSError:
                     onerror(os.path.islink, path, sys.exc_info())
         finally:
+            if pool is not None:
+                pool.cancel()
             os.close(fd)
     else:
-        return _rmtree_unsafe(path, onerror)
+        return _rmtree_unsafe(path, onerror, pool)
 
 # Allow introspection of whether or not the hardening against symlink
 # attacks is supported on the current platform
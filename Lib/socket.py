@@ -284,6 +284,49 @@ class socket(_socket.socket):
     get_inheritable.__doc__ = "Get the inheritable flag of the socket"
     set_inheritable.__doc__ = "Set the inheritable flag of the socket"
 
+    if hasattr(_socket, "SO_EE_ORIGIN_ZEROCOPY"):
+        def recv_zerocopy_completions(self):
+            """recv_zerocopy_completions() -> list of (first, last, copied)
+
+            Read the notifications of the error queue telling that sends
+            made with the MSG_ZEROCOPY flag completed: their buffers can
+            be modified again.  The zero-copy sends of a socket are
+            numbered from 0, and each notification covers those from
+            first to last inclusive.  copied is true if the kernel
+            copied their data anyway, which makes MSG_ZEROCOPY slower
+            than a plain send.  Return an empty list if there is no
+            notification, without blocking.
+
+            Any other error read from the queue, such as an ICMP error
+            queued because IP_RECVERR is set, is raised as OSError, whose
+            completions attribute holds the notifications read before it.
+            """
+            import struct
+            completions = []
+            while True:
+                try:
+                    data, ancdata, msg_flags, address = self.recvmsg(
+                        0, CMSG_SPACE(64), MSG_ERRQUEUE)
+                except BlockingIOError:
+                    return completions
+                for level, type, cmsg_data in ancdata:
+                    if ((level, type) not in ((IPPROTO_IP, IP_RECVERR),
+                                              (IPPROTO_IPV6, IPV6_RECVERR))
+                        or len(cmsg_data) < 16):
+                        continue
+                    # struct sock_extended_err
+                    (ee_errno, ee_origin, ee_type, ee_code, ee_pad,
+                     ee_info, ee_data) = struct.unpack_from("=IBBBBII",
+                                                            cmsg_data)
+                    if ee_errno == 0 and ee_origin == SO_EE_ORIGIN_ZEROCOPY:
+                        copied = bool(ee_code & SO_EE_CODE_ZEROCOPY_COPIED)
+                        completions.append((ee_info, ee_data, copied))
+                    elif ee_errno != 0:
+                        # Don't drop it: it was taken off the queue.
+                        exc = OSError(ee_errno, os.strerror(ee_errno))
+                        exc.completions = completions
+                        raise exc
+
 def fromfd(fd, family, type, proto=0):
     """ fromfd(fd, family, type[, proto]) -> socket object
 
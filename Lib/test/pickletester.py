@@ -480,6 +480,36 @@ DATA9 = (b'\x80\x02cexceptions\nUnicodeEncodeError\n'
          b'U\x03badq\x03tq\x04Rq\x05.')
 
 
+# Objects giving their buffer to protocol 5 picklers, which can be kept
+# out-of-band and given back without any copy when unpickling.
+
+def _reconstruct_zero_copy(cls, obj):
+    with memoryview(obj) as m:
+        obj = m.obj
+        if type(obj) is cls:
+            # Zero-copy
+            return obj
+        return cls(obj)
+
+class ZeroCopyBytes(bytes):
+    readonly = True
+
+    def __reduce_ex__(self, protocol):
+        if protocol >= 5:
+            return _reconstruct_zero_copy, (type(self), pickle.PickleBuffer(self))
+        else:
+            return _reconstruct_zero_copy, (type(self), bytes(self))
+
+class ZeroCopyBytearray(bytearray):
+    readonly = False
+
+    def __reduce_ex__(self, protocol):
+        if protocol >= 5:
+            return _reconstruct_zero_copy, (type(self), pickle.PickleBuffer(self))
+        else:
+            return _reconstruct_zero_copy, (type(self), bytes(self))
+
+
 def create_data():
     c = C()
     c.foo = 1
@@ -752,6 +782,103 @@ class AbstractPickleTests(unittest.TestCase):
                 p = self.dumps(s, proto)
                 self.assert_is_copy(s, self.loads(p))
 
+    def test_bytearray(self):
+        for proto in protocols:
+            for s in b'', b'xyz', b'xyz'*100:
+                b = bytearray(s)
+                p = self.dumps(b, proto)
+                bb = self.loads(p)
+                self.assertIsNot(bb, b)
+                self.assert_is_copy(b, bb)
+                if proto >= 5:
+                    self.assertTrue(opcode_in_pickle(pickle.BYTEARRAY8, p))
+                else:
+                    self.assertFalse(opcode_in_pickle(pickle.BYTEARRAY8, p))
+
+    def test_bytearray_memoization(self):
+        for proto in protocols:
+            b = bytearray(b'xyz')
+            b1, b2 = self.loads(self.dumps([b, b], proto))
+            self.assertIs(b1, b2)
+            self.assert_is_copy(b, b1)
+
+    def test_in_band_buffers(self):
+        for proto in protocols:
+            for obj in ZeroCopyBytes(b'abcdefgh'), ZeroCopyBytearray(b'abcdefgh'):
+                data = self.dumps(obj, proto)
+                if proto >= 5:
+                    self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 0)
+                    self.assertEqual(opcode_in_pickle(pickle.BYTEARRAY8, data),
+                                     not obj.readonly)
+                new = self.loads(data)
+                self.assertIsNot(new, obj)
+                self.assert_is_copy(obj, new)
+        # A buffer_callback returning a true value keeps buffers in-band
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            for obj in ZeroCopyBytes(b'abcdefgh'), ZeroCopyBytearray(b'abcdefgh'):
+                buffers = []
+                def buffer_callback(buf):
+                    buffers.append(buf)
+                    return True
+                data = self.dumps(obj, proto, buffer_callback=buffer_callback)
+                self.assertEqual(len(buffers), 1)
+                self.assertIn(b'abcdefgh', data)
+                self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 0)
+                new = self.loads(data)
+                self.assert_is_copy(obj, new)
+
+    def test_oob_buffers(self):
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            for obj in ZeroCopyBytes(b'abcdefgh'), ZeroCopyBytearray(b'abcdefgh'):
+                buffers = []
+                data = self.dumps([obj, obj], proto,
+                                  buffer_callback=buffers.append)
+                self.assertNotIn(b'abcdefgh', data)
+                self.assertEqual(len(buffers), 1)
+                self.assertEqual(bytes(buffers[0]), b'abcdefgh')
+                self.assertEqual(count_opcode(pickle.NEXT_BUFFER, data), 1)
+                self.assertEqual(count_opcode(pickle.READONLY_BUFFER, data),
+                                 1 if obj.readonly else 0)
+                new = self.loads(data, buffers=buffers)
+                # Zero-copy unpickling, memoized
+                self.assertIs(new[0], obj)
+                self.assertIs(new[1], obj)
+                # Buffers can be given back in any iterable
+                new = self.loads(data, buffers=iter(buffers))
+                self.assertIs(new[0], obj)
+                # The pickle refers to out-of-band data
+                with self.assertRaises(pickle.UnpicklingError):
+                    self.loads(data)
+                with self.assertRaises(pickle.UnpicklingError):
+                    self.loads(data, buffers=[])
+
+    def test_oob_buffers_writable_to_readonly(self):
+        # A readonly object can be unpickled from a writable buffer
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            obj = ZeroCopyBytes(b'foobar')
+            buffers = []
+            data = self.dumps(obj, proto, buffer_callback=buffers.append)
+            buffers = [bytearray(buf) for buf in buffers]
+            new = self.loads(data, buffers=buffers)
+            self.assertIs(type(new), type(obj))
+            self.assertEqual(new, obj)
+
+    def test_picklebuffer_errors(self):
+        pb = pickle.PickleBuffer(b'foobar')
+        for proto in range(0, 5):
+            with self.assertRaises(pickle.PicklingError):
+                self.dumps(pb, proto)
+            with self.assertRaises(ValueError):
+                self.dumps(b'foobar', proto, buffer_callback=list.append)
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            def buffer_callback(buf):
+                1/0
+            with self.assertRaises(ZeroDivisionError):
+                self.dumps(pb, proto, buffer_callback=buffer_callback)
+        pb.release()
+        with self.assertRaises(ValueError):
+            self.dumps(pb, pickle.HIGHEST_PROTOCOL)
+
     def test_ints(self):
         import sys
         for proto in protocols:
@@ -1078,7 +1205,8 @@ class AbstractPickleTests(unittest.TestCase):
 
     def test_list_chunking(self):
         n = 10  # too small to chunk
-        x = list(range(n))
+        # None keeps protocol 5 from packing the list.
+        x = [None] + list(range(n - 1))
         for proto in protocols:
             s = self.dumps(x, proto)
             y = self.loads(s)
@@ -1087,7 +1215,7 @@ class AbstractPickleTests(unittest.TestCase):
             self.assertEqual(num_appends, proto > 0)
 
         n = 2500  # expect at least two chunks when proto > 0
-        x = list(range(n))
+        x = [None] + list(range(n - 1))
         for proto in protocols:
             s = self.dumps(x, proto)
             y = self.loads(s)
@@ -1098,6 +1226,94 @@ class AbstractPickleTests(unittest.TestCase):
             else:
                 self.assertTrue(num_appends >= 2)
 
+    def test_packed_arrays(self):
+        samples = [
+            list(range(10)),
+            list(range(-300, 300)),
+            [0, 0x7fff, -0x8000] * 3,
+            [0, 0x7fffffff, -0x80000000] * 3,
+            [0, 2**63 - 1, -2**63] * 3,
+            [i / 7 for i in range(-10, 10)],
+            [0.0, -0.0, 1e300, -1e-300, float('inf'), float('-inf')] * 2,
+            ['', 'a', 'bc', 'x' * 255] * 3,
+            [str(i) for i in range(5000)],
+        ]
+        for sample in samples:
+            for x in sample, tuple(sample):
+                for proto in protocols:
+                    s = self.dumps(x, proto)
+                    y = self.loads(s)
+                    self.assert_is_copy(x, y)
+                    self.assertEqual([type(i) for i in y],
+                                     [type(i) for i in x])
+                    op = (pickle.PACKED_TUPLE if type(x) is tuple
+                          else pickle.PACKED_LIST)
+                    self.assertEqual(count_opcode(op, s), int(proto >= 5))
+                    if proto >= 5:
+                        self.assertEqual(count_opcode(pickle.APPENDS, s), 0)
+                        # The items aren't memoized.
+                        self.assertEqual(count_opcode(pickle.MEMOIZE, s), 1)
+
+    def test_packed_arrays_unpackable(self):
+        samples = [
+            list(range(7)),               # too small
+            [True, False] * 4,            # bools aren't ints
+            [myint(i) for i in range(8)],
+            [0] * 7 + [2**63],
+            [0] * 7 + [-2**63 - 1],
+            [0] * 7 + [0.0],
+            [0.0] * 7 + [0],
+            ['a'] * 7 + [b'a'],
+            ['a'] * 7 + ['\xe9'],
+            ['a'] * 7 + ['x' * 256],
+            ['a'] * 7 + ['\udc80'],
+            [MyStr('a')] * 8,
+        ]
+        for sample in samples:
+            for x in sample, tuple(sample):
+                for proto in protocols:
+                    s = self.dumps(x, proto)
+                    y = self.loads(s)
+                    self.assert_is_copy(x, y)
+                    self.assertEqual(count_opcode(pickle.PACKED_LIST, s), 0)
+                    self.assertEqual(count_opcode(pickle.PACKED_TUPLE, s), 0)
+
+    def test_packed_arrays_memoization(self):
+        for proto in protocols:
+            x = list(range(10))
+            t = tuple(x)
+            y = self.loads(self.dumps([x, x, t, t, (x, t)], proto))
+            self.assert_is_copy(x, y[0])
+            self.assertIs(y[0], y[1])
+            self.assertIs(y[0], y[4][0])
+            self.assert_is_copy(t, y[2])
+            self.assertIs(y[2], y[3])
+            self.assertIs(y[2], y[4][1])
+
+    def test_bad_packed_arrays(self):
+        badpickles = [
+            b'\x80\x05\x99x\x00\x00\x00\x00\x00\x00\x00\x00.',  # bad type code
+            b'\x80\x05\x99s\x01\x00\x00\x00\x00\x00\x00\x00\x01\xe9.',  # not ASCII
+        ]
+        for p in badpickles:
+            self.assertRaises((pickle.UnpicklingError, UnicodeDecodeError),
+                              self.loads, p)
+        truncated = [
+            b'\x80\x05\x99B\x02\x00\x00',
+            b'\x80\x05\x99B\x02\x00\x00\x00\x00\x00\x00\x00\x01',
+            b'\x80\x05\x99d\x01\x00\x00\x00\x00\x00\x00\x00\x00\x00',
+            b'\x80\x05\x99s\x02\x00\x00\x00\x00\x00\x00\x00\x01a',
+            b'\x80\x05\x99s\x02\x00\x00\x00\x00\x00\x00\x00\x01a\x02b',
+            # Huge item counts with no data: these must fail without
+            # allocating the items first.
+            b'\x80\x05\x99s\x00\x00\x00\x10\x00\x00\x00\x00',
+            b'\x80\x05\x9as\x00\x00\x00\x10\x00\x00\x00\x00\x01a',
+            b'\x80\x05\x99q\x00\x00\x00\x10\x00\x00\x00\x00',
+        ]
+        for p in truncated:
+            self.assertRaises((EOFError, pickle.UnpicklingError),
+                              self.loads, p)
+
     def test_dict_chunking(self):
         n = 10  # too small to chunk
         x = dict.fromkeys(range(n))
@@ -1467,7 +1683,8 @@ class AbstractPickleTests(unittest.TestCase):
         self.assertEqual(frame_size, last_arg)
 
     def test_framing_many_objects(self):
-        obj = list(range(10**5))
+        # None keeps protocol 5 from packing the list in a single opcode.
+        obj = [None] + list(range(10**5))
         for proto in range(4, pickle.HIGHEST_PROTOCOL + 1):
             with self.subTest(proto=proto):
                 pickled = self.dumps(obj, proto)
@@ -1906,7 +2123,7 @@ class AbstractPickleModuleTests(unittest.TestCase):
 
     def test_highest_protocol(self):
         # Of course this needs to be changed when HIGHEST_PROTOCOL changes.
-        self.assertEqual(pickle.HIGHEST_PROTOCOL, 4)
+        self.assertEqual(pickle.HIGHEST_PROTOCOL, 5)
 
     def test_callapi(self):
         f = io.BytesIO()
@@ -1917,6 +2134,13 @@ class AbstractPickleModuleTests(unittest.TestCase):
         pickle.dumps(123, protocol=-1)
         pickle.Pickler(f, -1)
         pickle.Pickler(f, protocol=-1)
+        pickle.dump(123, f, 5, buffer_callback=None)
+        pickle.dumps(123, 5, buffer_callback=None)
+        pickle.Pickler(f, 5, buffer_callback=None)
+        f.seek(0)
+        pickle.load(f, buffers=None)
+        pickle.loads(pickle.dumps(123), buffers=[])
+        pickle.Unpickler(f, buffers=None)
 
     def test_bad_init(self):
         # Test issue3664 (pickle can segfault from a badly initialized Pickler).
@@ -1975,6 +2199,25 @@ class AbstractPersistentPicklerTests(unittest.TestCase):
             self.assertEqual(self.load_count, 5)
             self.assertEqual(self.load_false_count, 1)
 
+    def test_persistence_packed(self):
+        # Lists and tuples which could be packed must still have their
+        # items saved through persistent_id().
+        L = list(range(10))
+        for x in L, tuple(L), ["test_false_value"] * 8:
+            for proto in protocols:
+                self.id_count = 0
+                self.false_count = 0
+                self.load_false_count = 0
+                self.load_count = 0
+                s = self.dumps(x, proto)
+                self.assertEqual(self.loads(s), x)
+                self.assertEqual(count_opcode(pickle.PACKED_LIST, s), 0)
+                self.assertEqual(count_opcode(pickle.PACKED_TUPLE, s), 0)
+                self.assertEqual(self.id_count + self.false_count,
+                                 self.load_count + self.load_false_count)
+                self.assertTrue(self.id_count or self.false_count)
+                self.assertNotIn(b'test_false_value', s)
+
 
 class AbstractPicklerUnpicklerObjectTests(unittest.TestCase):
 
@@ -77,6 +77,7 @@ __all__ = [
     # filesystem
     "TESTFN", "SAVEDCWD", "unlink", "rmtree", "temp_cwd", "findfile",
     "create_empty_file", "can_symlink", "fs_is_case_insensitive",
+    "can_uring",
     # unittest
     "is_resource_enabled", "requires", "requires_freebsd_version",
     "requires_linux_version", "requires_mac_ver", "check_syntax_error",
@@ -2044,6 +2045,22 @@ def skip_unless_xattr(test):
     msg = "no non-broken extended attribute support"
     return test if ok else unittest.skip(msg)(test)
 
+_can_uring = None
+def can_uring():
+    """Return True if the _uring module is built and io_uring usable."""
+    global _can_uring
+    if _can_uring is not None:
+        return _can_uring
+    try:
+        import _uring
+        _uring.Ring(1).close()
+        can = True
+    except (ImportError, OSError):
+        # Old kernel, or io_uring disabled by a sysctl or seccomp
+        can = False
+    _can_uring = can
+    return can
+
 
 def fs_is_case_insensitive(directory):
     """Detects if the file system for the specified directory is case-insensitive."""
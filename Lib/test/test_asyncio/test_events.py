@@ -899,6 +899,7 @@ class EventLoopTestsMixin:
     def test_internal_fds(self):
         loop = self.create_event_loop()
         if not isinstance(loop, selector_events.BaseSelectorEventLoop):
+            loop.close()
             self.skipTest('loop is not a BaseSelectorEventLoop')
 
         self.assertEqual(1, loop._internal_fds)
@@ -1462,6 +1463,78 @@ else:
             def create_event_loop(self):
                 return unix_events.SelectorEventLoop(selectors.PollSelector())
 
+    if hasattr(selectors, 'UringSelector') and support.can_uring():
+        class UringEventLoopTests(UnixEventLoopTestsMixin,
+                                  SubprocessTestsMixin,
+                                  unittest.TestCase):
+
+            def create_event_loop(self):
+                return unix_events.SelectorEventLoop(selectors.UringSelector())
+
+        from asyncio import uring_events
+
+        class UringProactorEventLoopTests(EventLoopTestsMixin,
+                                          unittest.TestCase):
+
+            def create_event_loop(self):
+                return uring_events.UringProactorEventLoop()
+
+            def test_create_ssl_connection(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop incompatible with SSL")
+
+            def test_create_server_ssl(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop incompatible with SSL")
+
+            def test_create_server_ssl_verify_failed(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop incompatible with SSL")
+
+            def test_create_server_ssl_match_failed(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop incompatible with SSL")
+
+            def test_create_server_ssl_verified(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop incompatible with SSL")
+
+            def test_reader_callback(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have add_reader()")
+
+            def test_reader_callback_cancel(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have add_reader()")
+
+            def test_writer_callback(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have add_writer()")
+
+            def test_writer_callback_cancel(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have add_writer()")
+
+            def test_create_datagram_endpoint(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have "
+                    "create_datagram_endpoint()")
+
+            def test_add_signal_handler(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have "
+                    "add_signal_handler()")
+
+            def test_signal_handling_args(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have "
+                    "add_signal_handler()")
+
+            def test_signal_handling_while_selecting(self):
+                raise unittest.SkipTest(
+                    "UringProactorEventLoop does not have "
+                    "add_signal_handler()")
+
     # Should always exist.
     class SelectEventLoopTests(UnixEventLoopTestsMixin,
                                SubprocessTestsMixin,
@@ -14,7 +14,7 @@ def _fakefunc(f):
     return f
 
 
-class FutureTests(unittest.TestCase):
+class BaseFutureTests:
 
     def setUp(self):
         self.loop = test_utils.TestLoop()
@@ -24,7 +24,7 @@ class FutureTests(unittest.TestCase):
         self.loop.close()
 
     def test_initial_state(self):
-        f = futures.Future(loop=self.loop)
+        f = self.cls(loop=self.loop)
         self.assertFalse(f.cancelled())
         self.assertFalse(f.done())
         f.cancel()
@@ -33,17 +33,17 @@ class FutureTests(unittest.TestCase):
     def test_init_constructor_default_loop(self):
         try:
             events.set_event_loop(self.loop)
-            f = futures.Future()
+            f = self.cls()
             self.assertIs(f._loop, self.loop)
         finally:
             events.set_event_loop(None)
 
     def test_constructor_positional(self):
         # Make sure Future does't accept a positional argument
-        self.assertRaises(TypeError, futures.Future, 42)
+        self.assertRaises(TypeError, self.cls, 42)
 
     def test_cancel(self):
-        f = futures.Future(loop=self.loop)
+        f = self.cls(loop=self.loop)
         self.assertTrue(f.cancel())
         self.assertTrue(f.cancelled())
         self.assertTrue(f.done())
@@ -54,7 +54,7 @@ class FutureTests(unittest.TestCase):
         self.assertFalse(f.cancel())
 
     def test_result(self):
-        f = futures.Future(loop=self.loop)
+        f = self.cls(loop=self.loop)
         self.assertRaises(futures.InvalidStateError, f.result)
 
         f.set_result(42)
@@ -68,7 +68,7 @@ class FutureTests(unittest.TestCase):
 
     def test_exception(self):
         exc = RuntimeError()
-        f = futures.Future(loop=self.loop)
+        f = self.cls(loop=self.loop)
         self.assertRaises(futures.InvalidStateError, f.exception)
 
         f.set_exception(exc)
@@ -81,7 +81,7 @@ class FutureTests(unittest.TestCase):
         self.assertFalse(f.cancel())
 
     def test_yield_from_twice(self):
-        f = futures.Future(loop=self.loop)
+        f = self.cls(loop=self.loop)
 
         def fixture():
             yield 'A'
@@ -99,32 +99,32 @@ class FutureTests(unittest.TestCase):
         self.assertEqual(next(g), ('C', 42))  # yield 'C', y.
 
     def test_repr(self):
-        f_pending = futures.Future(loop=self.loop)
+        f_pending = self.cls(loop=self.loop)
         self.assertEqual(repr(f_pending), 'Future<PENDING>')
         f_pending.cancel()
 
-        f_cancelled = futures.Future(loop=self.loop)
+        f_cancelled = self.cls(loop=self.loop)
         f_cancelled.cancel()
         self.assertEqual(repr(f_cancelled), 'Future<CANCELLED>')
 
-        f_result = futures.Future(loop=self.loop)
+        f_result = self.cls(loop=self.loop)
         f_result.set_result(4)
         self.assertEqual(repr(f_result), 'Future<result=4>')
         self.assertEqual(f_result.result(), 4)
 
         exc = RuntimeError()
-        f_exception = futures.Future(loop=self.loop)
+        f_exception = self.cls(loop=self.loop)
         f_exception.set_exception(exc)
         self.assertEqual(repr(f_exception), 'Future<exception=RuntimeError()>')
         self.assertIs(f_exception.exception(), exc)
 
-        f_few_callbacks = futures.Future(loop=self.loop)
+        f_few_callbacks = self.cls(loop=self.loop)
         f_few_callbacks.add_done_callback(_fakefunc)
         self.assertIn('Future<PENDING, [<function _fakefunc',
                       repr(f_few_callbacks))
         f_few_callbacks.cancel()
 
-        f_many_callbacks = futures.Future(loop=self.loop)
+        f_many_callbacks = self.cls(loop=self.loop)
         for i in range(20):
             f_many_callbacks.add_done_callback(_fakefunc)
         r = repr(f_many_callbacks)
@@ -135,31 +135,31 @@ class FutureTests(unittest.TestCase):
     def test_copy_state(self):
         # Test the internal _copy_state method since it's being directly
         # invoked in other modules.
-        f = futures.Future(loop=self.loop)
+        f = self.cls(loop=self.loop)
         f.set_result(10)
 
-        newf = futures.Future(loop=self.loop)
+        newf = self.cls(loop=self.loop)
         newf._copy_state(f)
         self.assertTrue(newf.done())
         self.assertEqual(newf.result(), 10)
 
-        f_exception = futures.Future(loop=self.loop)
+        f_exception = self.cls(loop=self.loop)
         f_exception.set_exception(RuntimeError())
 
-        newf_exception = futures.Future(loop=self.loop)
+        newf_exception = self.cls(loop=self.loop)
         newf_exception._copy_state(f_exception)
         self.assertTrue(newf_exception.done())
         self.assertRaises(RuntimeError, newf_exception.result)
 
-        f_cancelled = futures.Future(loop=self.loop)
+        f_cancelled = self.cls(loop=self.loop)
         f_cancelled.cancel()
 
-        newf_cancelled = futures.Future(loop=self.loop)
+        newf_cancelled = self.cls(loop=self.loop)
         newf_cancelled._copy_state(f_cancelled)
         self.assertTrue(newf_cancelled.cancelled())
 
     def test_iter(self):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
 
         def coro():
             yield from fut
@@ -172,20 +172,20 @@ class FutureTests(unittest.TestCase):
 
     @unittest.mock.patch('asyncio.futures.logger')
     def test_tb_logger_abandoned(self, m_log):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
         del fut
         self.assertFalse(m_log.error.called)
 
     @unittest.mock.patch('asyncio.futures.logger')
     def test_tb_logger_result_unretrieved(self, m_log):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
         fut.set_result(42)
         del fut
         self.assertFalse(m_log.error.called)
 
     @unittest.mock.patch('asyncio.futures.logger')
     def test_tb_logger_result_retrieved(self, m_log):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
         fut.set_result(42)
         fut.result()
         del fut
@@ -193,7 +193,7 @@ class FutureTests(unittest.TestCase):
 
     @unittest.mock.patch('asyncio.futures.logger')
     def test_tb_logger_exception_unretrieved(self, m_log):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
         fut.set_exception(RuntimeError('boom'))
         del fut
         test_utils.run_briefly(self.loop)
@@ -201,7 +201,7 @@ class FutureTests(unittest.TestCase):
 
     @unittest.mock.patch('asyncio.futures.logger')
     def test_tb_logger_exception_retrieved(self, m_log):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
         fut.set_exception(RuntimeError('boom'))
         fut.exception()
         del fut
@@ -209,12 +209,100 @@ class FutureTests(unittest.TestCase):
 
     @unittest.mock.patch('asyncio.futures.logger')
     def test_tb_logger_exception_result_retrieved(self, m_log):
-        fut = futures.Future(loop=self.loop)
+        fut = self.cls(loop=self.loop)
         fut.set_exception(RuntimeError('boom'))
         self.assertRaises(RuntimeError, fut.result)
         del fut
         self.assertFalse(m_log.error.called)
 
+class PyFutureTests(BaseFutureTests, unittest.TestCase):
+    cls = futures._PyFuture
+
+
+@unittest.skipUnless(hasattr(futures, '_CFuture'),
+                     'requires the C _asyncio module')
+class CFutureTests(BaseFutureTests, unittest.TestCase):
+    cls = getattr(futures, '_CFuture', None)
+
+    def test_uninitialized(self):
+        fut = self.cls.__new__(self.cls, loop=self.loop)
+        self.assertRaises(RuntimeError, fut.result)
+        self.assertRaises(RuntimeError, fut.set_result, None)
+        self.assertRaises(RuntimeError, fut.add_done_callback, _fakefunc)
+        self.assertFalse(fut.done())
+
+    def test_state_attributes(self):
+        fut = self.cls(loop=self.loop)
+        self.assertEqual(fut._state, futures._PENDING)
+        self.assertIsNone(fut._result)
+        self.assertIsNone(fut._exception)
+        self.assertEqual(fut._callbacks, [])
+        self.assertFalse(fut._blocking)
+        fut.set_result(42)
+        self.assertEqual(fut._state, futures._FINISHED)
+        self.assertEqual(fut._result, 42)
+        with self.assertRaises(AttributeError):
+            fut._state = futures._PENDING
+
+    def test_iter_send_before_start(self):
+        fut = self.cls(loop=self.loop)
+        it = iter(fut)
+        self.assertRaises(TypeError, it.send, 1)
+        self.assertIs(it.send(None), fut)
+        self.assertTrue(fut._blocking)
+        self.assertRaises(AssertionError, next, it)
+        fut.cancel()
+
+    def test_iter_throw(self):
+        fut = self.cls(loop=self.loop)
+        it = iter(fut)
+        self.assertIs(next(it), fut)
+        self.assertRaises(ValueError, it.throw, ValueError)
+        self.assertRaises(ValueError, it.throw, ValueError('spam'))
+        self.assertRaises(TypeError, it.throw, 42)
+        fut.cancel()
+
+    def test_result_traceback(self):
+        def raiser():
+            raise ValueError('spam')
+        try:
+            raiser()
+        except ValueError as e:
+            exc = e
+        fut = self.cls(loop=self.loop)
+        fut.set_exception(exc)
+        try:
+            fut.result()
+        except ValueError as e:
+            self.assertIs(e, exc)
+            tb = e.__traceback__
+        frames = []
+        while tb is not None:
+            frames.append(tb.tb_frame.f_code.co_name)
+            tb = tb.tb_next
+        self.assertIn('raiser', frames)
+
+    def test_subclass(self):
+        class MyFuture(self.cls):
+            def __init__(self, *, loop=None):
+                super().__init__(loop=loop)
+                self.extra = 'spam'
+
+        fut = MyFuture(loop=self.loop)
+        self.assertEqual(fut.extra, 'spam')
+        self.assertEqual(repr(fut), 'MyFuture<PENDING>')
+        fut.set_result(1)
+        self.assertEqual(fut.result(), 1)
+
+class WrapFutureTests(unittest.TestCase):
+
+    def setUp(self):
+        self.loop = test_utils.TestLoop()
+        events.set_event_loop(None)
+
+    def tearDown(self):
+        self.loop.close()
+
     def test_wrap_future(self):
 
         def run(arg):
@@ -260,7 +348,7 @@ class FutureTests(unittest.TestCase):
         self.assertTrue(f2.cancelled())
 
 
-class FutureDoneCallbackTests(unittest.TestCase):
+class BaseFutureDoneCallbackTests:
 
     def setUp(self):
         self.loop = test_utils.TestLoop()
@@ -279,7 +367,7 @@ class FutureDoneCallbackTests(unittest.TestCase):
         return bag_appender
 
     def _new_future(self):
-        return futures.Future(loop=self.loop)
+        return self.cls(loop=self.loop)
 
     def test_callbacks_invoked_on_set_result(self):
         bag = []
@@ -343,5 +431,17 @@ class FutureDoneCallbackTests(unittest.TestCase):
         self.assertEqual(f.result(), 'foo')
 
 
+class PyFutureDoneCallbackTests(BaseFutureDoneCallbackTests,
+                                 unittest.TestCase):
+    cls = futures._PyFuture
+
+
+@unittest.skipUnless(hasattr(futures, '_CFuture'),
+                     'requires the C _asyncio module')
+class CFutureDoneCallbackTests(BaseFutureDoneCallbackTests,
+                               unittest.TestCase):
+    cls = getattr(futures, '_CFuture', None)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -3,6 +3,7 @@
 import gc
 import unittest
 import unittest.mock
+import weakref
 from unittest.mock import Mock
 
 from asyncio import events
@@ -1300,6 +1301,142 @@ class TaskTests(unittest.TestCase):
         test_utils.run_briefly(self.loop)
 
 
+@unittest.skipUnless(hasattr(tasks, '_CTask'),
+                     'requires the C _asyncio module')
+class PyTaskTests(TaskTests):
+    # Run the tests above against the pure Python Task, which is also
+    # used by the helpers of the tasks module.
+
+    def setUp(self):
+        super().setUp()
+        patcher = unittest.mock.patch('asyncio.tasks.Task', tasks._PyTask)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+
+@unittest.skipUnless(hasattr(tasks, '_CTask'),
+                     'requires the C _asyncio module')
+class CTaskTests(unittest.TestCase):
+
+    def setUp(self):
+        self.loop = test_utils.TestLoop()
+        events.set_event_loop(None)
+
+    def tearDown(self):
+        self.loop.close()
+        gc.collect()
+
+    def test_c_implementation(self):
+        self.assertIs(tasks.Task, tasks._CTask)
+        self.assertTrue(issubclass(tasks.Task, futures.Future))
+
+    def test_not_a_coroutine(self):
+        self.assertRaises(AssertionError, tasks.Task, 42, loop=self.loop)
+        self.assertRaises(AssertionError, tasks.Task, lambda: 42,
+                          loop=self.loop)
+        self.assertRaises(TypeError, tasks.Task)
+
+    def test_wait_for_py_future(self):
+        fut = futures._PyFuture(loop=self.loop)
+
+        @tasks.coroutine
+        def coro():
+            return (yield from fut)
+
+        t = tasks.Task(coro(), loop=self.loop)
+        test_utils.run_briefly(self.loop)
+        self.assertIs(t._fut_waiter, fut)
+        fut.set_result('spam')
+        self.assertEqual(self.loop.run_until_complete(t), 'spam')
+
+    def test_current_task_restored_on_error(self):
+        @tasks.coroutine
+        def coro():
+            self.assertIs(tasks.Task.current_task(loop=self.loop), t)
+            raise ValueError
+
+        t = tasks.Task(coro(), loop=self.loop)
+        self.assertRaises(ValueError, self.loop.run_until_complete, t)
+        self.assertIsNone(tasks.Task.current_task(loop=self.loop))
+        self.assertNotIn(self.loop, tasks._current_tasks)
+
+    def test_base_exception_propagates(self):
+        @tasks.coroutine
+        def coro():
+            yield
+            raise KeyboardInterrupt
+
+        t = tasks.Task(coro(), loop=self.loop)
+        self.assertRaises(KeyboardInterrupt, self.loop.run_until_complete, t)
+        self.assertTrue(t.done())
+        self.assertIsInstance(t.exception(), KeyboardInterrupt)
+
+    def test_step_when_done(self):
+        @tasks.coroutine
+        def coro():
+            return 1
+
+        t = tasks.Task(coro(), loop=self.loop)
+        self.loop.run_until_complete(t)
+        with self.assertRaisesRegex(AssertionError, 'already done'):
+            t._step()
+
+    def test_coro_wrapper(self):
+        # A coroutine which isn't a generator: the task must use its
+        # send() and throw() methods.
+        def coro(fut):
+            return (yield from fut)
+
+        def make_task(fut):
+            wrapper = tasks.CoroWrapper(coro(fut), coro)
+            wrapper.__name__ = 'coro'
+            return tasks.Task(wrapper, loop=self.loop)
+
+        fut = futures.Future(loop=self.loop)
+        t = make_task(fut)
+        test_utils.run_briefly(self.loop)
+        fut.set_result('ok')
+        self.assertEqual(self.loop.run_until_complete(t), 'ok')
+
+        fut = futures.Future(loop=self.loop)
+        t = make_task(fut)
+        test_utils.run_briefly(self.loop)
+        fut.set_exception(ValueError())
+        self.assertRaises(ValueError, self.loop.run_until_complete, t)
+
+    def test_subclass(self):
+        class MyTask(tasks.Task):
+            stepped = 0
+
+            def _step(self, value=None, exc=None):
+                self.stepped += 1
+                super()._step(value, exc)
+
+        @tasks.coroutine
+        def coro():
+            yield
+            return 'done'
+
+        t = MyTask(coro(), loop=self.loop)
+        self.assertEqual(self.loop.run_until_complete(t), 'done')
+        self.assertEqual(t.stepped, 2)
+        self.assertIn(t, tasks.Task.all_tasks(loop=self.loop))
+
+    def test_task_cycle_collected(self):
+        @tasks.coroutine
+        def coro():
+            fut = futures.Future(loop=self.loop)
+            fut.task = t
+            yield
+
+        t = tasks.Task(coro(), loop=self.loop)
+        self.loop.run_until_complete(t)
+        wr = weakref.ref(t)
+        del t
+        gc.collect()
+        self.assertIsNone(wr())
+
+
 class GatherTestsBase:
 
     def setUp(self):
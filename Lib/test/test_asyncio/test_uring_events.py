@@ -0,0 +1,246 @@
+import errno
+import os
+import socket
+import time
+import unittest
+from test import support
+
+if not support.can_uring():
+    raise unittest.SkipTest('io_uring not available')
+
+import _uring
+
+import asyncio
+
+from asyncio import uring_events
+from asyncio import protocols
+from asyncio import test_utils
+
+
+class RingTests(unittest.TestCase):
+
+    def setUp(self):
+        self.ring = _uring.Ring(8)
+
+    def tearDown(self):
+        self.ring.close()
+
+    def wait_for(self, op):
+        while op.pending:
+            self.ring.wait(5)
+
+    def test_recv_send(self):
+        a, b = test_utils.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+
+        recv = self.ring.recv(a.fileno(), 100)
+        send = self.ring.send(b.fileno(), b'data')
+        self.assertTrue(recv.pending)
+        self.assertEqual(self.ring.pending, 2)
+        self.assertRaises(ValueError, recv.getresult)
+
+        self.wait_for(recv)
+        self.wait_for(send)
+        self.assertEqual(recv.getresult(), b'data')
+        self.assertEqual(send.getresult(), 4)
+        self.assertEqual(recv.type, 'recv')
+        self.assertEqual(recv.fd, a.fileno())
+        self.assertEqual(self.ring.pending, 0)
+
+    def test_read_write(self):
+        with open(support.TESTFN, 'w+b') as f:
+            self.addCleanup(support.unlink, support.TESTFN)
+            op = self.ring.write(f.fileno(), b'0123456789', 0)
+            self.wait_for(op)
+            self.assertEqual(op.getresult(), 10)
+            op = self.ring.read(f.fileno(), 100, 4)
+            self.wait_for(op)
+            self.assertEqual(op.getresult(), b'456789')
+
+    def test_submission_ring_full(self):
+        # More operations than entries: the ring is flushed when full.
+        r, w = os.pipe()
+        self.addCleanup(os.close, r)
+        self.addCleanup(os.close, w)
+        ops = [self.ring.write(w, b'x') for i in range(20)]
+        for op in ops:
+            self.wait_for(op)
+            self.assertEqual(op.getresult(), 1)
+        self.assertEqual(len(os.read(r, 100)), 20)
+
+    def test_cancel(self):
+        a, b = test_utils.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+
+        op = self.ring.recv(a.fileno(), 100)
+        self.assertEqual(self.ring.wait(0), [])
+        self.ring.cancel(op)
+        self.wait_for(op)
+        with self.assertRaises(OSError) as cm:
+            op.getresult()
+        self.assertEqual(cm.exception.errno, errno.ECANCELED)
+
+    def test_wait_timeout(self):
+        t = time.monotonic()
+        self.assertEqual(self.ring.wait(0.1), [])
+        self.assertGreaterEqual(time.monotonic() - t, 0.08)
+
+    def test_error(self):
+        op = self.ring.recv(-1, 100)
+        self.wait_for(op)
+        self.assertRaises(OSError, op.getresult)
+        self.assertLess(op.result, 0)
+
+    def test_close_pending(self):
+        # close() cancels pending operations and waits for them.
+        a, b = test_utils.socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+
+        ring = _uring.Ring()
+        op = ring.recv(a.fileno(), 100)
+        ring.close()
+        self.assertTrue(ring.closed)
+        self.assertFalse(op.pending)
+        self.assertRaises(ValueError, ring.fileno)
+        self.assertRaises(ValueError, ring.recv, a.fileno(), 100)
+
+    def test_connect_bad_address(self):
+        s = socket.socket()
+        self.addCleanup(s.close)
+        self.assertRaises(ValueError, self.ring.connect, s.fileno(),
+                          socket.AF_INET, ('localhost', 80))
+        self.assertRaises(ValueError, self.ring.connect, s.fileno(),
+                          socket.AF_INET, ('127.0.0.1', 70000))
+        self.assertEqual(self.ring.pending, 0)
+
+
+class ProactorTests(unittest.TestCase):
+
+    def setUp(self):
+        self.loop = uring_events.UringProactorEventLoop()
+        asyncio.set_event_loop(None)
+
+    def tearDown(self):
+        self.loop.close()
+        self.loop = None
+
+    def test_close(self):
+        a, b = self.loop._socketpair()
+        trans = self.loop._make_socket_transport(a, protocols.Protocol())
+        f = asyncio.async(self.loop.sock_recv(b, 100), loop=self.loop)
+        trans.close()
+        self.loop.run_until_complete(f)
+        self.assertEqual(f.result(), b'')
+        b.close()
+
+    def test_sendall_large(self):
+        # send() completes only once all the data was sent.
+        a, b = self.loop._socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        data = b'x' * (4 * 1024 * 1024)
+
+        @asyncio.coroutine
+        def reader():
+            received = 0
+            while received < len(data):
+                received += len((yield from self.loop.sock_recv(b, 65536)))
+            return received
+
+        f = self.loop.sock_sendall(a, data)
+        received = self.loop.run_until_complete(reader())
+        self.assertEqual(received, len(data))
+        self.assertEqual(self.loop.run_until_complete(f), len(data))
+
+    def test_recv_eagain(self):
+        # Operations failing with EAGAIN are retried once the socket is
+        # ready; MSG_DONTWAIT forces this on all kernels.
+        a, b = self.loop._socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+
+        f = self.loop._proactor.recv(a, 100, socket.MSG_DONTWAIT)
+        self.loop.call_later(0.05, b.send, b'data')
+        self.assertEqual(self.loop.run_until_complete(f), b'data')
+
+    def test_cancel_recv(self):
+        a, b = self.loop._socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+
+        f = self.loop.sock_recv(a, 100)
+        self.loop.call_soon(f.cancel)
+        self.assertRaises(asyncio.CancelledError,
+                          self.loop.run_until_complete, f)
+        # The cancelled operation doesn't consume the data.
+        b.send(b'data')
+        f = self.loop.sock_recv(a, 100)
+        self.assertEqual(self.loop.run_until_complete(f), b'data')
+
+    def test_close_loop_pending(self):
+        # Closing the loop cancels the futures of pending operations.
+        a, b = self.loop._socketpair()
+        self.addCleanup(a.close)
+        self.addCleanup(b.close)
+        listener = socket.socket()
+        self.addCleanup(listener.close)
+        listener.bind(('127.0.0.1', 0))
+        listener.listen(1)
+
+        recv = self.loop.sock_recv(a, 100)
+        accept = self.loop._proactor.accept(listener)
+        self.loop.run_until_complete(asyncio.sleep(0.01, loop=self.loop))
+        self.loop.close()
+        self.assertTrue(recv.cancelled())
+        self.assertTrue(accept.cancelled())
+        # The cancelled recv didn't consume the data.
+        b.send(b'data')
+        self.assertEqual(a.recv(100), b'data')
+
+    def test_pipe(self):
+        r, w = os.pipe()
+        rpipe = open(r, 'rb', 0)
+        wpipe = open(w, 'wb', 0)
+        self.addCleanup(rpipe.close)
+        self.addCleanup(wpipe.close)
+
+        f = self.loop._proactor.recv(rpipe, 100)
+        self.loop.run_until_complete(self.loop._proactor.send(wpipe, b'abc'))
+        self.assertEqual(self.loop.run_until_complete(f), b'abc')
+
+    def test_echo(self):
+        lost = asyncio.Future(loop=self.loop)
+
+        class Echo(protocols.Protocol):
+            def connection_made(self, transport):
+                self.transport = transport
+
+            def data_received(self, data):
+                self.transport.write(data)
+
+            def connection_lost(self, exc):
+                lost.set_result(exc)
+
+        server = self.loop.run_until_complete(
+            self.loop.create_server(Echo, '127.0.0.1', 0))
+        host, port = server.sockets[0].getsockname()
+
+        @asyncio.coroutine
+        def client():
+            reader, writer = yield from asyncio.open_connection(
+                host, port, loop=self.loop)
+            writer.write(b'hello\n')
+            line = yield from reader.readline()
+            writer.close()
+            return line
+
+        self.assertEqual(self.loop.run_until_complete(client()), b'hello\n')
+        self.assertIsNone(self.loop.run_until_complete(lost))
+        server.close()
+
+
+if __name__ == '__main__':
+    unittest.main()
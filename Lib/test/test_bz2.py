@@ -6,6 +6,7 @@ import unittest
 from io import BytesIO
 import os
 import pickle
+import _compression
 import random
 import subprocess
 import sys
@@ -97,7 +98,7 @@ class BZ2FileTest(BaseTest):
     def testRead(self):
         self.createTempFile()
         with BZ2File(self.filename) as bz2f:
-            self.assertRaises(TypeError, bz2f.read, None)
+            self.assertRaises(TypeError, bz2f.read, float())
             self.assertEqual(bz2f.read(), self.TEXT)
 
     def testReadBadFile(self):
@@ -108,21 +109,21 @@ class BZ2FileTest(BaseTest):
     def testReadMultiStream(self):
         self.createTempFile(streams=5)
         with BZ2File(self.filename) as bz2f:
-            self.assertRaises(TypeError, bz2f.read, None)
+            self.assertRaises(TypeError, bz2f.read, float())
             self.assertEqual(bz2f.read(), self.TEXT * 5)
 
     def testReadMonkeyMultiStream(self):
         # Test BZ2File.read() on a multi-stream archive where a stream
         # boundary coincides with the end of the raw read buffer.
-        buffer_size = bz2._BUFFER_SIZE
-        bz2._BUFFER_SIZE = len(self.DATA)
+        buffer_size = _compression.BUFFER_SIZE
+        _compression.BUFFER_SIZE = len(self.DATA)
         try:
             self.createTempFile(streams=5)
             with BZ2File(self.filename) as bz2f:
-                self.assertRaises(TypeError, bz2f.read, None)
+                self.assertRaises(TypeError, bz2f.read, float())
                 self.assertEqual(bz2f.read(), self.TEXT * 5)
         finally:
-            bz2._BUFFER_SIZE = buffer_size
+            _compression.BUFFER_SIZE = buffer_size
 
     def testReadTrailingJunk(self):
         self.createTempFile(suffix=self.BAD_DATA)
@@ -137,7 +138,7 @@ class BZ2FileTest(BaseTest):
     def testRead0(self):
         self.createTempFile()
         with BZ2File(self.filename) as bz2f:
-            self.assertRaises(TypeError, bz2f.read, None)
+            self.assertRaises(TypeError, bz2f.read, float())
             self.assertEqual(bz2f.read(0), b"")
 
     def testReadChunk10(self):
@@ -187,6 +188,19 @@ class BZ2FileTest(BaseTest):
             self.assertEqual(bz2f.readinto(b), n)
             self.assertEqual(b[:n], self.TEXT[-n:])
 
+    def testReadIntoMultiStream(self):
+        self.createTempFile(streams=5)
+        with BZ2File(self.filename) as bz2f:
+            b = bytearray(len(self.TEXT) * 5 + 1)
+            n = 0
+            while True:
+                k = bz2f.readinto(memoryview(b)[n:])
+                if not k:
+                    break
+                n += k
+            self.assertEqual(n, len(self.TEXT) * 5)
+            self.assertEqual(b[:n], self.TEXT * 5)
+
     def testReadLine(self):
         self.createTempFile()
         with BZ2File(self.filename) as bz2f:
@@ -223,6 +237,20 @@ class BZ2FileTest(BaseTest):
         with BZ2File(self.filename) as bz2f:
             self.assertEqual(list(iter(bz2f)), self.TEXT_LINES * 5)
 
+    def testIteratorMixed(self):
+        # Iteration, readline() and tell() share the same position.
+        self.createTempFile(streams=2)
+        lines = self.TEXT_LINES * 2
+        with BZ2File(self.filename) as bz2f:
+            it = iter(bz2f)
+            self.assertEqual(next(it), lines[0])
+            self.assertEqual(bz2f.readline(), lines[1])
+            self.assertEqual(next(it), lines[2])
+            self.assertEqual(bz2f.tell(), len(b"".join(lines[:3])))
+            self.assertEqual(list(it), lines[3:])
+            bz2f.close()
+            self.assertRaises(ValueError, next, it)
+
     def testClosedIteratorDeadlock(self):
         # Issue #3309: Iteration on a closed BZ2File should release the lock.
         self.createTempFile()
@@ -554,7 +582,7 @@ class BZ2FileTest(BaseTest):
     def testReadBytesIO(self):
         with BytesIO(self.DATA) as bio:
             with BZ2File(bio) as bz2f:
-                self.assertRaises(TypeError, bz2f.read, None)
+                self.assertRaises(TypeError, bz2f.read, float())
                 self.assertEqual(bz2f.read(), self.TEXT)
             self.assertFalse(bio.closed)
 
@@ -706,6 +734,26 @@ class BZ2DecompressorTest(BaseTest):
         with self.assertRaises(TypeError):
             pickle.dumps(BZ2Decompressor())
 
+    @unittest.skipUnless(threading, 'requires threading')
+    def testWriteThreads(self):
+        # At compresslevel 1, blocks of 100 kB are compressed to independent
+        # streams.
+        text = self.TEXT * 1000
+        with BZ2File(self.filename, "w", compresslevel=1, threads=2) as bz2f:
+            for i in range(0, len(text), 30000):
+                bz2f.write(text[i:i + 30000])
+        with open(self.filename, "rb") as f:
+            data = f.read()
+        self.assertEqual(data.count(b"BZh1"), (len(text) + 99999) // 100000)
+        self.assertEqual(self.decompress(data), text)
+        with BZ2File(self.filename) as bz2f:
+            self.assertEqual(bz2f.read(), text)
+        with bz2.open(self.filename, "wb", threads=0) as bz2f:
+            bz2f.write(text)
+        with bz2.open(self.filename) as bz2f:
+            self.assertEqual(bz2f.read(), text)
+        self.assertRaises(ValueError, BZ2File, self.filename, "w", threads=-1)
+
 
 class CompressDecompressTest(BaseTest):
     def testCompress(self):
@@ -716,6 +764,15 @@ class CompressDecompressTest(BaseTest):
         text = bz2.compress(b'')
         self.assertEqual(text, self.EMPTY_DATA)
 
+    @unittest.skipUnless(threading, 'requires threading')
+    def testCompressThreads(self):
+        text = self.TEXT * 1000
+        for threads in (0, 1, 2, 4):
+            data = bz2.compress(text, 1, threads=threads)
+            self.assertEqual(bz2.decompress(data), text)
+        self.assertEqual(bz2.compress(b'', threads=2), self.EMPTY_DATA)
+        self.assertRaises(ValueError, bz2.compress, text, 0, threads=2)
+
     def testDecompress(self):
         text = bz2.decompress(self.DATA)
         self.assertEqual(text, self.TEXT)
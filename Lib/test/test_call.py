@@ -1,4 +1,5 @@
 import unittest
+import sys
 from test import support
 
 # The test cases here cover several paths through the function calling
@@ -123,8 +124,132 @@ class CFunctionCalls(unittest.TestCase):
         self.assertRaises(TypeError, [].count, x=2, y=2)
 
 
+class MethodCalls(unittest.TestCase):
+    # obj.meth(args) is compiled to LOAD_METHOD/CALL_METHOD, which
+    # must behave exactly like an attribute lookup followed by a call.
+
+    def test_python_method(self):
+        class C:
+            def meth(self, *args):
+                return self, args
+        obj = C()
+        self.assertEqual(obj.meth(), (obj, ()))
+        self.assertEqual(obj.meth(1, 2), (obj, (1, 2)))
+
+    def test_instance_attribute_shadows_method(self):
+        class C:
+            def meth(self):
+                return 'method'
+        obj = C()
+        obj.meth = lambda: 'instance'
+        self.assertEqual(obj.meth(), 'instance')
+
+    def test_static_and_class_methods(self):
+        class C:
+            @staticmethod
+            def smeth(*args):
+                return args
+            @classmethod
+            def cmeth(cls, *args):
+                return cls, args
+        obj = C()
+        self.assertEqual(obj.smeth(1), (1,))
+        self.assertEqual(obj.cmeth(1), (C, (1,)))
+        self.assertEqual(C.smeth(1), (1,))
+        self.assertEqual(C.cmeth(1), (C, (1,)))
+
+    def test_data_descriptor(self):
+        class C:
+            @property
+            def meth(self):
+                return lambda *args: args
+        self.assertEqual(C().meth(1), (1,))
+
+    def test_getattr_hook(self):
+        class C:
+            def __getattr__(self, name):
+                return lambda: name
+        self.assertEqual(C().spam(), 'spam')
+
+    def test_module_function(self):
+        self.assertEqual(support.os.path.join('a', 'b'),
+                         'a' + support.os.sep + 'b')
+
+    def test_builtin_methods(self):
+        lst = [3, 1, 2]
+        lst.append(4)
+        lst.sort()
+        self.assertEqual(lst, [1, 2, 3, 4])
+        self.assertEqual(lst.pop(), 4)
+        self.assertEqual(lst.index(2), 1)
+        self.assertEqual(lst.index(3, 1, 3), 2)
+        self.assertEqual('a,b'.split(','), ['a', 'b'])
+        self.assertEqual('abc'.upper(), 'ABC')
+        self.assertEqual({1: 2}.get(1), 2)
+
+    def test_builtin_method_errors(self):
+        with self.assertRaises(TypeError):
+            [].append()
+        with self.assertRaises(TypeError):
+            [].append(1, 2)
+        with self.assertRaises(TypeError):
+            'abc'.upper(1)
+        with self.assertRaises(TypeError):
+            str.upper([])
+        with self.assertRaises(TypeError):
+            list.append()
+
+    def test_builtin_subclass(self):
+        class MyList(list):
+            pass
+        lst = MyList()
+        lst.append(1)
+        self.assertEqual(lst, [1])
+
+    def test_super(self):
+        class A:
+            def meth(self):
+                return 'A'
+        class B(A):
+            def meth(self):
+                return 'B' + super().meth()
+        self.assertEqual(B().meth(), 'BA')
+
+    def test_missing_attribute(self):
+        with self.assertRaises(AttributeError):
+            object().spam()
+
+    def test_yield_in_arguments(self):
+        def gen(lst):
+            lst.append((yield))
+        lst = []
+        g = gen(lst)
+        next(g)
+        # Close the generator while [method, self] is on its stack
+        del g
+        self.assertEqual(lst, [])
+        g = gen(lst)
+        next(g)
+        self.assertRaises(StopIteration, g.send, 42)
+        self.assertEqual(lst, [42])
+
+    def test_profile_builtin_method(self):
+        events = []
+        def profile(frame, event, arg):
+            if event == 'c_call':
+                events.append(arg)
+        lst = []
+        sys.setprofile(profile)
+        try:
+            lst.append(1)
+        finally:
+            sys.setprofile(None)
+        self.assertEqual([e.__name__ for e in events[:1]], ['append'])
+        self.assertIs(events[0].__self__, lst)
+
+
 def test_main():
-    support.run_unittest(CFunctionCalls)
+    support.run_unittest(CFunctionCalls, MethodCalls)
 
 
 if __name__ == "__main__":
@@ -1,12 +1,14 @@
 """Unit tests for collections.py."""
 
 import unittest, doctest, operator
-from test.support import TESTFN, forget, unlink
+from test.support import TESTFN, forget, unlink, import_fresh_module
+import contextlib
 import inspect
 from test import support
 from collections import namedtuple, Counter, OrderedDict, _count_elements
 from test import mapping_tests
 import pickle, copy
+import weakref
 from random import randrange, shuffle
 import keyword
 import re
@@ -1090,9 +1092,24 @@ class TestCounter(unittest.TestCase):
 ### OrderedDict
 ################################################################################
 
-class TestOrderedDict(unittest.TestCase):
+py_coll = import_fresh_module('collections', blocked=['_collections'])
+c_coll = import_fresh_module('collections', fresh=['_collections'])
+
+
+@contextlib.contextmanager
+def replaced_module(name, replacement):
+    original_module = sys.modules[name]
+    sys.modules[name] = replacement
+    try:
+        yield
+    finally:
+        sys.modules[name] = original_module
+
+
+class OrderedDictTests:
 
     def test_init(self):
+        OrderedDict = self.OrderedDict
         with self.assertRaises(TypeError):
             OrderedDict([('a', 1), ('b', 2)], None)                                 # too many args
         pairs = [('a', 1), ('b', 2), ('c', 3), ('d', 4), ('e', 5)]
@@ -1102,10 +1119,6 @@ class TestOrderedDict(unittest.TestCase):
         self.assertEqual(list(OrderedDict([('a', 1), ('b', 2), ('c', 9), ('d', 4)],
                                           c=3, e=5).items()), pairs)                # mixed input
 
-        # make sure no positional args conflict with possible kwdargs
-        self.assertEqual(inspect.getargspec(OrderedDict.__dict__['__init__']).args,
-                         ['self'])
-
         # Make sure that direct calls to __init__ do not clear previous contents
         d = OrderedDict([('a', 1), ('b', 2), ('c', 3), ('d', 44), ('e', 55)])
         d.__init__([('e', 5), ('f', 6)], g=7, d=4)
@@ -1113,6 +1126,7 @@ class TestOrderedDict(unittest.TestCase):
             [('a', 1), ('b', 2), ('c', 3), ('d', 4), ('e', 5), ('f', 6), ('g', 7)])
 
     def test_update(self):
+        OrderedDict = self.OrderedDict
         with self.assertRaises(TypeError):
             OrderedDict().update([('a', 1), ('b', 2)], None)                        # too many args
         pairs = [('a', 1), ('b', 2), ('c', 3), ('d', 4), ('e', 5)]
@@ -1150,10 +1164,12 @@ class TestOrderedDict(unittest.TestCase):
             [('a', 1), ('b', 2), ('c', 3), ('d', 4), ('e', 5), ('f', 6), ('g', 7)])
 
     def test_abc(self):
+        OrderedDict = self.OrderedDict
         self.assertIsInstance(OrderedDict(), MutableMapping)
         self.assertTrue(issubclass(OrderedDict, MutableMapping))
 
     def test_clear(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         shuffle(pairs)
         od = OrderedDict(pairs)
@@ -1162,6 +1178,7 @@ class TestOrderedDict(unittest.TestCase):
         self.assertEqual(len(od), 0)
 
     def test_delitem(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         od = OrderedDict(pairs)
         del od['a']
@@ -1171,6 +1188,7 @@ class TestOrderedDict(unittest.TestCase):
         self.assertEqual(list(od.items()), pairs[:2] + pairs[3:])
 
     def test_setitem(self):
+        OrderedDict = self.OrderedDict
         od = OrderedDict([('d', 1), ('b', 2), ('c', 3), ('a', 4), ('e', 5)])
         od['c'] = 10           # existing element
         od['f'] = 20           # new element
@@ -1178,6 +1196,7 @@ class TestOrderedDict(unittest.TestCase):
                          [('d', 1), ('b', 2), ('c', 10), ('a', 4), ('e', 5), ('f', 20)])
 
     def test_iterators(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         shuffle(pairs)
         od = OrderedDict(pairs)
@@ -1189,6 +1208,7 @@ class TestOrderedDict(unittest.TestCase):
                          [t[0] for t in reversed(pairs)])
 
     def test_popitem(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         shuffle(pairs)
         od = OrderedDict(pairs)
@@ -1199,6 +1219,7 @@ class TestOrderedDict(unittest.TestCase):
         self.assertEqual(len(od), 0)
 
     def test_pop(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         shuffle(pairs)
         od = OrderedDict(pairs)
@@ -1223,6 +1244,7 @@ class TestOrderedDict(unittest.TestCase):
             m.pop('a')
 
     def test_equality(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         shuffle(pairs)
         od1 = OrderedDict(pairs)
@@ -1238,36 +1260,32 @@ class TestOrderedDict(unittest.TestCase):
         self.assertNotEqual(od1, OrderedDict(pairs[:-1]))
 
     def test_copying(self):
+        OrderedDict = self.OrderedDict
         # Check that ordered dicts are copyable, deepcopyable, picklable,
         # and have a repr/eval round-trip
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         od = OrderedDict(pairs)
         update_test = OrderedDict()
         update_test.update(od)
+        with replaced_module('collections', self.module):
+            pickles = [('pickle.loads(pickle.dumps(od, %d))' % proto,
+                        pickle.loads(pickle.dumps(od, proto)))
+                       for proto in range(-1, pickle.HIGHEST_PROTOCOL + 1)]
         for label, dup in [
                     ('od.copy()', od.copy()),
                     ('copy.copy(od)', copy.copy(od)),
                     ('copy.deepcopy(od)', copy.deepcopy(od)),
-                    ('pickle.loads(pickle.dumps(od, 0))',
-                        pickle.loads(pickle.dumps(od, 0))),
-                    ('pickle.loads(pickle.dumps(od, 1))',
-                        pickle.loads(pickle.dumps(od, 1))),
-                    ('pickle.loads(pickle.dumps(od, 2))',
-                        pickle.loads(pickle.dumps(od, 2))),
-                    ('pickle.loads(pickle.dumps(od, 3))',
-                        pickle.loads(pickle.dumps(od, 3))),
-                    ('pickle.loads(pickle.dumps(od, -1))',
-                        pickle.loads(pickle.dumps(od, -1))),
-                    ('eval(repr(od))', eval(repr(od))),
+                    ('eval(repr(od))', eval(repr(od), {'OrderedDict': OrderedDict})),
                     ('update_test', update_test),
                     ('OrderedDict(od)', OrderedDict(od)),
-                    ]:
+                    ] + pickles:
             with self.subTest(label=label):
                 msg = "\ncopy: %s\nod: %s" % (dup, od)
                 self.assertIsNot(dup, od, msg)
                 self.assertEqual(dup, od)
 
     def test_yaml_linkage(self):
+        OrderedDict = self.OrderedDict
         # Verify that __reduce__ is setup in a way that supports PyYAML's dump() feature.
         # In yaml, lists are native but tuples are not.
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
@@ -1277,6 +1295,7 @@ class TestOrderedDict(unittest.TestCase):
         self.assertTrue(all(type(pair)==list for pair in od.__reduce__()[1]))
 
     def test_reduce_not_too_fat(self):
+        OrderedDict = self.OrderedDict
         # do not save instance dictionary if not needed
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         od = OrderedDict(pairs)
@@ -1285,22 +1304,26 @@ class TestOrderedDict(unittest.TestCase):
         self.assertIsNotNone(od.__reduce__()[2])
 
     def test_pickle_recursive(self):
+        OrderedDict = self.OrderedDict
         od = OrderedDict()
         od[1] = od
         for proto in range(-1, pickle.HIGHEST_PROTOCOL + 1):
-            dup = pickle.loads(pickle.dumps(od, proto))
+            with replaced_module('collections', self.module):
+                dup = pickle.loads(pickle.dumps(od, proto))
             self.assertIsNot(dup, od)
             self.assertEqual(list(dup.keys()), [1])
             self.assertIs(dup[1], dup)
 
     def test_repr(self):
+        OrderedDict = self.OrderedDict
         od = OrderedDict([('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)])
         self.assertEqual(repr(od),
             "OrderedDict([('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)])")
-        self.assertEqual(eval(repr(od)), od)
+        self.assertEqual(eval(repr(od), {'OrderedDict': OrderedDict}), od)
         self.assertEqual(repr(OrderedDict()), "OrderedDict()")
 
     def test_repr_recursive(self):
+        OrderedDict = self.OrderedDict
         # See issue #9826
         od = OrderedDict.fromkeys('abc')
         od['x'] = od
@@ -1308,6 +1331,7 @@ class TestOrderedDict(unittest.TestCase):
             "OrderedDict([('a', None), ('b', None), ('c', None), ('x', ...)])")
 
     def test_setdefault(self):
+        OrderedDict = self.OrderedDict
         pairs = [('c', 1), ('b', 2), ('a', 3), ('d', 4), ('e', 5), ('f', 6)]
         shuffle(pairs)
         od = OrderedDict(pairs)
@@ -1326,6 +1350,7 @@ class TestOrderedDict(unittest.TestCase):
         self.assertEqual(Missing().setdefault(5, 9), 9)
 
     def test_reinsert(self):
+        OrderedDict = self.OrderedDict
         # Given insert a, insert b, delete a, re-insert a,
         # verify that a is now later than b.
         od = OrderedDict()
@@ -1336,6 +1361,7 @@ class TestOrderedDict(unittest.TestCase):
         self.assertEqual(list(od.items()), [('b', 2), ('a', 1)])
 
     def test_move_to_end(self):
+        OrderedDict = self.OrderedDict
         od = OrderedDict.fromkeys('abcde')
         self.assertEqual(list(od), list('abcde'))
         od.move_to_end('c')
@@ -1350,12 +1376,14 @@ class TestOrderedDict(unittest.TestCase):
             od.move_to_end('x')
 
     def test_sizeof(self):
+        OrderedDict = self.OrderedDict
         # Wimpy test: Just verify the reported size is larger than a regular dict
         d = dict(a=1)
         od = OrderedDict(**d)
         self.assertGreater(sys.getsizeof(od), sys.getsizeof(d))
 
     def test_override_update(self):
+        OrderedDict = self.OrderedDict
         # Verify that subclasses can override update() without breaking __init__()
         class MyOD(OrderedDict):
             def update(self, *args, **kwds):
@@ -1363,6 +1391,128 @@ class TestOrderedDict(unittest.TestCase):
         items = [('a', 1), ('c', 3), ('b', 2)]
         self.assertEqual(list(MyOD(items).items()), items)
 
+    def test_many_updates(self):
+        # Grow, shrink and reorder past several resizes of the hash table
+        OrderedDict = self.OrderedDict
+        od = OrderedDict()
+        keys = []
+        for i in range(1, 2000):
+            od[i] = i
+            keys.append(i)
+            if i % 3 == 0:
+                del od[i // 2]
+                keys.remove(i // 2)
+            if i % 7 == 0:
+                od.move_to_end(keys[0])
+                keys.append(keys.pop(0))
+        self.assertEqual(list(od), keys)
+        self.assertEqual(list(reversed(od)), keys[::-1])
+        self.assertEqual(list(od.values()), keys)
+        while od:
+            self.assertEqual(od.popitem(last=False), (keys[0], keys.pop(0)))
+
+
+class PurePythonOrderedDictTests(OrderedDictTests, unittest.TestCase):
+
+    module = py_coll
+    OrderedDict = py_coll.OrderedDict
+
+    def test_init_signature(self):
+        # make sure no positional args conflict with possible kwdargs
+        self.assertEqual(inspect.getargspec(self.OrderedDict.__dict__['__init__']).args,
+                         ['self'])
+
+
+class CPythonOrderedDictTests(OrderedDictTests, unittest.TestCase):
+
+    module = c_coll
+    OrderedDict = c_coll.OrderedDict
+
+    def test_c_implementation(self):
+        self.assertIsNot(self.OrderedDict, py_coll.OrderedDict)
+        self.assertIs(OrderedDict, self.OrderedDict)
+
+    def test_mutation_during_iteration(self):
+        for make_iter in (iter, reversed, lambda od: iter(od.keys()),
+                          lambda od: iter(od.values()),
+                          lambda od: iter(od.items())):
+            for mutate in (lambda od: od.__setitem__('y', None),
+                           lambda od: od.__delitem__('x'),
+                           lambda od: od.move_to_end('b'),
+                           lambda od: od.clear()):
+                od = self.OrderedDict.fromkeys('abcdex')
+                it = make_iter(od)
+                next(it)
+                mutate(od)
+                with self.assertRaises(RuntimeError):
+                    next(it)
+        # Changing values doesn't change the order
+        od = self.OrderedDict.fromkeys('abc')
+        it = iter(od)
+        next(it)
+        od['a'] = od['c'] = 1
+        self.assertEqual(list(it), ['b', 'c'])
+
+    def test_views(self):
+        od = self.OrderedDict.fromkeys('abc')
+        self.assertEqual(list(reversed(od.keys())), list('cba'))
+        self.assertEqual(list(reversed(od.values())), [None] * 3)
+        self.assertEqual(list(reversed(od.items())),
+                         [(k, None) for k in 'cba'])
+        self.assertEqual(od.keys() & {'a', 'x'}, {'a'})
+        self.assertEqual(od.items() - {('a', None)},
+                         {('b', None), ('c', None)})
+        self.assertEqual(od.keys(), {'a', 'b', 'c'})
+        self.assertIn('b', od.keys())
+        self.assertIn(('b', None), od.items())
+        self.assertEqual(len(od.values()), 3)
+
+    def test_dict_methods_bypass(self):
+        # Changing the dict behind the OrderedDict's back leaves it
+        # inconsistent, but must not crash.
+        od = self.OrderedDict.fromkeys(range(10))
+        dict.__delitem__(od, 5)
+        dict.__setitem__(od, 'x', None)
+        with self.assertRaises(KeyError):
+            list(od.items())
+        self.assertEqual(list(od), list(range(10)))
+        for i in range(100):
+            od[i] = i
+        del od[3]
+        od.move_to_end(7)
+        od.popitem()
+        dict.clear(od)
+        self.assertEqual(len(od), 0)
+        od.clear()
+        self.assertEqual(list(od), [])
+        od['a'] = 1
+        self.assertEqual(list(od.items()), [('a', 1)])
+
+    def test_key_mutating_during_lookup(self):
+        od = self.OrderedDict()
+        class Key:
+            def __hash__(self):
+                return 0
+            def __eq__(self, other):
+                od.clear()
+                return False
+        od[Key()] = 1
+        od[Key()] = 2
+        self.assertEqual(len(od), 1)
+        self.assertEqual(len(list(od.items())), 1)
+        del od[next(iter(od))]
+        self.assertEqual(list(od), [])
+
+    def test_weakref_and_gc(self):
+        od = self.OrderedDict()
+        od['self'] = od
+        od.x = od
+        ref = weakref.ref(od)
+        del od
+        support.gc_collect()
+        self.assertIsNone(ref())
+
+
 class GeneralMappingTests(mapping_tests.BasicTestMappingProtocol):
     type2test = OrderedDict
 
@@ -1380,6 +1530,13 @@ class SubclassMappingTests(mapping_tests.BasicTestMappingProtocol):
         d = self._empty_mapping()
         self.assertRaises(KeyError, d.popitem)
 
+class PurePythonGeneralMappingTests(mapping_tests.BasicTestMappingProtocol):
+    type2test = py_coll.OrderedDict
+
+    def test_popitem(self):
+        d = self._empty_mapping()
+        self.assertRaises(KeyError, d.popitem)
+
 
 ################################################################################
 ### Run tests
@@ -1391,7 +1548,9 @@ def test_main(verbose=None):
     NamedTupleDocs = doctest.DocTestSuite(module=collections)
     test_classes = [TestNamedTuple, NamedTupleDocs, TestOneTrickPonyABCs,
                     TestCollectionABCs, TestCounter, TestChainMap,
-                    TestOrderedDict, GeneralMappingTests, SubclassMappingTests]
+                    PurePythonOrderedDictTests, CPythonOrderedDictTests,
+                    GeneralMappingTests, SubclassMappingTests,
+                    PurePythonGeneralMappingTests]
     support.run_unittest(*test_classes)
     support.run_doctest(collections, verbose)
 
@@ -229,6 +229,27 @@ dis_traceback = """\
        TRACEBACK_CODE.co_firstlineno + 4,
        TRACEBACK_CODE.co_firstlineno + 5)
 
+def _meth(obj):
+    obj.meth(1)
+    return obj.meth(key=1)
+
+dis_meth = """\
+%3d           0 LOAD_FAST                0 (obj)
+              3 LOAD_METHOD              0 (meth)
+              6 LOAD_CONST               1 (1)
+              9 CALL_METHOD              1
+             12 POP_TOP
+
+%3d          13 LOAD_FAST                0 (obj)
+             16 LOAD_ATTR                0 (meth)
+             19 LOAD_CONST               2 ('key')
+             22 LOAD_CONST               1 (1)
+             25 CALL_FUNCTION          256 (0 positional, 1 keyword pair)
+             28 RETURN_VALUE
+""" % (_meth.__code__.co_firstlineno + 1,
+       _meth.__code__.co_firstlineno + 2)
+
+
 class DisTests(unittest.TestCase):
 
     def get_disassembly(self, func, lasti=-1, wrapper=True):
@@ -262,6 +283,9 @@ class DisTests(unittest.TestCase):
     def test_dis(self):
         self.do_disassembly_test(_f, dis_f)
 
+    def test_method_call(self):
+        self.do_disassembly_test(_meth, dis_meth)
+
     def test_bug_708901(self):
         self.do_disassembly_test(bug708901, dis_bug708901)
 
@@ -1,5 +1,6 @@
 import abc
 import collections
+import copy
 from itertools import permutations
 import pickle
 from random import choice
@@ -7,6 +8,11 @@ import sys
 from test import support
 import unittest
 from weakref import proxy
+import weakref
+try:
+    import threading
+except ImportError:
+    threading = None
 
 import functools
 
@@ -879,12 +885,12 @@ class TestTotalOrdering(unittest.TestCase):
             with self.assertRaises(TypeError):
                 a <= b
 
-class TestLRU(unittest.TestCase):
+class TestLRU:
 
     def test_lru(self):
         def orig(x, y):
             return 3 * x + y
-        f = functools.lru_cache(maxsize=20)(orig)
+        f = self.module.lru_cache(maxsize=20)(orig)
         hits, misses, maxsize, currsize = f.cache_info()
         self.assertEqual(maxsize, 20)
         self.assertEqual(currsize, 0)
@@ -922,7 +928,7 @@ class TestLRU(unittest.TestCase):
         self.assertEqual(currsize, 1)
 
         # test size zero (which means "never-cache")
-        @functools.lru_cache(0)
+        @self.module.lru_cache(0)
         def f():
             nonlocal f_cnt
             f_cnt += 1
@@ -938,7 +944,7 @@ class TestLRU(unittest.TestCase):
         self.assertEqual(currsize, 0)
 
         # test size one
-        @functools.lru_cache(1)
+        @self.module.lru_cache(1)
         def f():
             nonlocal f_cnt
             f_cnt += 1
@@ -954,7 +960,7 @@ class TestLRU(unittest.TestCase):
         self.assertEqual(currsize, 1)
 
         # test size two
-        @functools.lru_cache(2)
+        @self.module.lru_cache(2)
         def f(x):
             nonlocal f_cnt
             f_cnt += 1
@@ -971,7 +977,7 @@ class TestLRU(unittest.TestCase):
         self.assertEqual(currsize, 2)
 
     def test_lru_with_maxsize_none(self):
-        @functools.lru_cache(maxsize=None)
+        @self.module.lru_cache(maxsize=None)
         def fib(n):
             if n < 2:
                 return n
@@ -979,17 +985,17 @@ class TestLRU(unittest.TestCase):
         self.assertEqual([fib(n) for n in range(16)],
             [0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233, 377, 610])
         self.assertEqual(fib.cache_info(),
-            functools._CacheInfo(hits=28, misses=16, maxsize=None, currsize=16))
+            self.module._CacheInfo(hits=28, misses=16, maxsize=None, currsize=16))
         fib.cache_clear()
         self.assertEqual(fib.cache_info(),
-            functools._CacheInfo(hits=0, misses=0, maxsize=None, currsize=0))
+            self.module._CacheInfo(hits=0, misses=0, maxsize=None, currsize=0))
 
     def test_lru_with_exceptions(self):
         # Verify that user_function exceptions get passed through without
         # creating a hard-to-read chained exception.
         # http://bugs.python.org/issue13177
         for maxsize in (None, 128):
-            @functools.lru_cache(maxsize)
+            @self.module.lru_cache(maxsize)
             def func(i):
                 return 'abc'[i]
             self.assertEqual(func(0), 'a')
@@ -1002,7 +1008,7 @@ class TestLRU(unittest.TestCase):
 
     def test_lru_with_types(self):
         for maxsize in (None, 128):
-            @functools.lru_cache(maxsize=maxsize, typed=True)
+            @self.module.lru_cache(maxsize=maxsize, typed=True)
             def square(x):
                 return x * x
             self.assertEqual(square(3), 9)
@@ -1017,7 +1023,7 @@ class TestLRU(unittest.TestCase):
             self.assertEqual(square.cache_info().misses, 4)
 
     def test_lru_with_keyword_args(self):
-        @functools.lru_cache()
+        @self.module.lru_cache()
         def fib(n):
             if n < 2:
                 return n
@@ -1027,13 +1033,13 @@ class TestLRU(unittest.TestCase):
             [0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233, 377, 610]
         )
         self.assertEqual(fib.cache_info(),
-            functools._CacheInfo(hits=28, misses=16, maxsize=128, currsize=16))
+            self.module._CacheInfo(hits=28, misses=16, maxsize=128, currsize=16))
         fib.cache_clear()
         self.assertEqual(fib.cache_info(),
-            functools._CacheInfo(hits=0, misses=0, maxsize=128, currsize=0))
+            self.module._CacheInfo(hits=0, misses=0, maxsize=128, currsize=0))
 
     def test_lru_with_keyword_args_maxsize_none(self):
-        @functools.lru_cache(maxsize=None)
+        @self.module.lru_cache(maxsize=None)
         def fib(n):
             if n < 2:
                 return n
@@ -1041,15 +1047,15 @@ class TestLRU(unittest.TestCase):
         self.assertEqual([fib(n=number) for number in range(16)],
             [0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233, 377, 610])
         self.assertEqual(fib.cache_info(),
-            functools._CacheInfo(hits=28, misses=16, maxsize=None, currsize=16))
+            self.module._CacheInfo(hits=28, misses=16, maxsize=None, currsize=16))
         fib.cache_clear()
         self.assertEqual(fib.cache_info(),
-            functools._CacheInfo(hits=0, misses=0, maxsize=None, currsize=0))
+            self.module._CacheInfo(hits=0, misses=0, maxsize=None, currsize=0))
 
     def test_need_for_rlock(self):
         # This will deadlock on an LRU cache that uses a regular lock
 
-        @functools.lru_cache(maxsize=10)
+        @self.module.lru_cache(maxsize=10)
         def test_func(x):
             'Used to demonstrate a reentrant lru_cache call within a single thread'
             return x
@@ -1070,6 +1076,237 @@ class TestLRU(unittest.TestCase):
         self.assertEqual(test_func(DoubleEq(2)),    # Trigger a re-entrant __eq__ call
                          DoubleEq(2))               # Verify the correct return value
 
+    def test_lru_type_error(self):
+        # Unhashable arguments raise TypeError, without leaking the key
+
+        @self.module.lru_cache(maxsize=None)
+        def infinite_cache(o):
+            pass
+
+        @self.module.lru_cache(maxsize=10)
+        def limited_cache(o):
+            pass
+
+        with self.assertRaises(TypeError):
+            infinite_cache([])
+
+        with self.assertRaises(TypeError):
+            limited_cache([])
+
+    @unittest.skipUnless(threading, 'This test requires threading.')
+    def test_lru_cache_threaded(self):
+        n, m = 5, 11
+        def orig(x, y):
+            return 3 * x + y
+        f = self.module.lru_cache(maxsize=n*m)(orig)
+        hits, misses, maxsize, currsize = f.cache_info()
+        self.assertEqual(currsize, 0)
+
+        start = threading.Event()
+        def full(k):
+            start.wait(10)
+            for _ in range(m):
+                self.assertEqual(f(k, 0), orig(k, 0))
+
+        def clear():
+            start.wait(10)
+            for _ in range(2*m):
+                f.cache_clear()
+
+        def run(threads):
+            for t in threads:
+                t.start()
+            start.set()
+            for t in threads:
+                t.join()
+
+        orig_si = sys.getswitchinterval()
+        sys.setswitchinterval(1e-6)
+        try:
+            # create n threads in order to fill cache
+            run([threading.Thread(target=full, args=[k]) for k in range(n)])
+
+            hits, misses, maxsize, currsize = f.cache_info()
+            self.assertEqual(hits + misses, n*m)
+            self.assertEqual(currsize, n)
+
+            # create n threads in order to fill cache and 1 to clear it
+            threads = [threading.Thread(target=clear)]
+            threads += [threading.Thread(target=full, args=[k])
+                        for k in range(n)]
+            start.clear()
+            run(threads)
+        finally:
+            sys.setswitchinterval(orig_si)
+
+    def test_lru_eviction_order(self):
+        # Check the cache contents against a model of the LRU policy
+        maxsize = 7
+        calls = []
+        def orig(x):
+            calls.append(x)
+            return x * 10
+        f = self.module.lru_cache(maxsize)(orig)
+        model = collections.OrderedDict()
+        for i in range(2000):
+            x = choice(range(12))
+            self.assertEqual(f(x), x * 10)
+            if x in model:
+                model.move_to_end(x)
+            else:
+                self.assertEqual(calls.pop(), x)
+                model[x] = None
+                if len(model) > maxsize:
+                    model.popitem(last=False)
+            self.assertFalse(calls)
+            self.assertEqual(f.cache_info().currsize, len(model))
+
+    def test_lru_method(self):
+        class X(int):
+            f_cnt = 0
+            @self.module.lru_cache(2)
+            def f(self, x):
+                self.f_cnt += 1
+                return x*10+self
+        a = X(5)
+        b = X(5)
+        c = X(7)
+        self.assertEqual(X.f.cache_info(), (0, 0, 2, 0))
+
+        for x in 1, 2, 2, 3, 1, 1, 1, 2, 3, 3:
+            self.assertEqual(a.f(x), x*10 + 5)
+        self.assertEqual((a.f_cnt, b.f_cnt, c.f_cnt), (6, 0, 0))
+        self.assertEqual(X.f.cache_info(), (4, 6, 2, 2))
+
+        for x in 1, 2, 1, 1, 1, 1, 3, 2, 2, 2:
+            self.assertEqual(b.f(x), x*10 + 5)
+        self.assertEqual((a.f_cnt, b.f_cnt, c.f_cnt), (6, 4, 0))
+        self.assertEqual(X.f.cache_info(), (10, 10, 2, 2))
+
+        for x in 2, 1, 1, 1, 1, 2, 1, 3, 2, 1:
+            self.assertEqual(c.f(x), x*10 + 7)
+        self.assertEqual((a.f_cnt, b.f_cnt, c.f_cnt), (6, 4, 5))
+        self.assertEqual(X.f.cache_info(), (15, 15, 2, 2))
+
+        self.assertEqual(a.f.cache_info(), X.f.cache_info())
+        self.assertEqual(b.f.cache_info(), X.f.cache_info())
+        self.assertEqual(c.f.cache_info(), X.f.cache_info())
+
+    def test_pickle(self):
+        cls = self.__class__
+        for proto in range(pickle.HIGHEST_PROTOCOL + 1):
+            with self.subTest(proto=proto):
+                f = cls.cached_func[0]
+                self.assertIs(pickle.loads(pickle.dumps(f, proto)), f)
+        # Nested qualified names need protocol 4
+        for f in cls.cached_meth, cls.cached_staticmeth:
+            with self.subTest(fn=f):
+                self.assertIs(pickle.loads(pickle.dumps(f, 4)), f)
+
+    def test_copy(self):
+        cls = self.__class__
+        for f in cls.cached_func[0], cls.cached_meth, cls.cached_staticmeth:
+            with self.subTest(fn=f):
+                self.assertIs(copy.copy(f), f)
+                self.assertIs(copy.deepcopy(f), f)
+
+    def test_early_detection_of_bad_call(self):
+        # Using @lru_cache without parentheses passes the function as maxsize
+        with self.assertRaises(TypeError):
+            @self.module.lru_cache
+            def f():
+                pass
+
+
+@py_functools.lru_cache()
+def py_cached_func(x, y):
+    return 3 * x + y
+
+@c_functools.lru_cache()
+def c_cached_func(x, y):
+    return 3 * x + y
+
+
+class TestLRUPy(TestLRU, unittest.TestCase):
+    module = py_functools
+    cached_func = py_cached_func,
+
+    @module.lru_cache()
+    def cached_meth(self, x, y):
+        return 3 * x + y
+
+    @staticmethod
+    @module.lru_cache()
+    def cached_staticmeth(x, y):
+        return 3 * x + y
+
+
+class TestLRUC(TestLRU, unittest.TestCase):
+    module = c_functools
+    cached_func = c_cached_func,
+
+    @module.lru_cache()
+    def cached_meth(self, x, y):
+        return 3 * x + y
+
+    @staticmethod
+    @module.lru_cache()
+    def cached_staticmeth(x, y):
+        return 3 * x + y
+
+    def test_c_implementation(self):
+        f = self.module.lru_cache()(capture)
+        self.assertIsInstance(f, c_functools._lru_cache_wrapper)
+        self.assertIsNot(py_functools._lru_cache_wrapper,
+                         c_functools._lru_cache_wrapper)
+
+    def test_reentrant_eviction(self):
+        # A reentrant call from __eq__ while the oldest entry is evicted
+        # must leave the cache consistent.
+        @self.module.lru_cache(maxsize=2)
+        def f(x):
+            return x
+
+        ncalls = 0
+        reenter = False
+        def call(x):
+            nonlocal ncalls
+            ncalls += 1
+            return f(x)
+
+        class Reenter:
+            def __hash__(self):
+                return 0
+            def __eq__(self, other):
+                nonlocal reenter
+                if reenter:
+                    reenter = False
+                    call(Reenter())
+                return self is other
+
+        keys = [Reenter() for i in range(20)]
+        for i, k in enumerate(keys):
+            reenter = True
+            self.assertIs(call(k), k)
+            self.assertIs(call(keys[i // 2]), keys[i // 2])
+            info = f.cache_info()
+            self.assertLessEqual(info.currsize, 2)
+            self.assertEqual(info.hits + info.misses, ncalls)
+        for i in range(10):
+            self.assertEqual(call(i), i)
+        self.assertEqual(f.cache_info().currsize, 2)
+
+    def test_cycle_collected(self):
+        # Results referencing the wrapper are found by the garbage collector
+        @self.module.lru_cache(maxsize=10)
+        def f(x):
+            return [f]
+        f(1)
+        wr = weakref.ref(f)
+        del f
+        support.gc_collect()
+        self.assertIsNone(wr())
+
 
 class TestSingleDispatch(unittest.TestCase):
     def test_simple_overloads(self):
@@ -1558,7 +1795,8 @@ def test_main(verbose=None):
         TestCmpToKeyPy,
         TestWraps,
         TestReduce,
-        TestLRU,
+        TestLRUC,
+        TestLRUPy,
         TestSingleDispatch,
     )
     support.run_unittest(*test_classes)
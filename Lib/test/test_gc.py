@@ -6,6 +6,7 @@ from test.script_helper import assert_python_ok, make_script, temp_dir
 
 import sys
 import time
+import itertools
 import gc
 import weakref
 
@@ -658,10 +659,25 @@ class GCTests(unittest.TestCase):
         for st in stats:
             self.assertIsInstance(st, dict)
             self.assertEqual(set(st),
-                             {"collected", "collections", "uncollectable"})
+                             {"collected", "collections", "uncollectable",
+                              "increments", "examined", "mark_time",
+                              "finalize_time", "weakref_time", "delete_time",
+                              "pause_total", "pause_max", "pause_histogram"})
             self.assertGreaterEqual(st["collected"], 0)
             self.assertGreaterEqual(st["collections"], 0)
             self.assertGreaterEqual(st["uncollectable"], 0)
+            self.assertGreaterEqual(st["increments"], 0)
+            self.assertGreaterEqual(st["examined"], 0)
+            self.assertGreaterEqual(st["pause_total"],
+                                    st["mark_time"] + st["finalize_time"] +
+                                    st["weakref_time"] + st["delete_time"])
+            self.assertGreaterEqual(st["pause_total"], st["pause_max"])
+            hist = st["pause_histogram"]
+            bounds = [bound for bound, count in hist]
+            self.assertEqual(bounds, sorted(bounds))
+            self.assertEqual(bounds[-1], float("inf"))
+            self.assertGreaterEqual(sum(count for bound, count in hist),
+                                    st["collections"])
         # Check that collection counts are incremented correctly
         if gc.isenabled():
             self.addCleanup(gc.enable)
@@ -672,6 +688,8 @@ class GCTests(unittest.TestCase):
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
         self.assertEqual(new[1]["collections"], old[1]["collections"])
         self.assertEqual(new[2]["collections"], old[2]["collections"])
+        self.assertGreater(new[0]["pause_total"], old[0]["pause_total"])
+        self.assertEqual(new[1]["pause_total"], old[1]["pause_total"])
         gc.collect(2)
         new = gc.get_stats()
         self.assertEqual(new[0]["collections"], old[0]["collections"] + 1)
@@ -679,6 +697,56 @@ class GCTests(unittest.TestCase):
         self.assertEqual(new[2]["collections"], old[2]["collections"] + 1)
 
 
+class GCFreezeTests(unittest.TestCase):
+    def setUp(self):
+        gc.collect()
+
+    def tearDown(self):
+        gc.unfreeze()
+        gc.collect()
+
+    def test_freeze(self):
+        gc.freeze()
+        self.assertGreater(gc.get_freeze_count(), 0)
+        self.assertEqual(gc.get_count(), (0, 0, 0))
+        gc.unfreeze()
+        self.assertEqual(gc.get_freeze_count(), 0)
+
+    def test_frozen_objects_are_not_collected(self):
+        garbage = C1055820(1)
+        wr = weakref.ref(garbage)
+        keep = []
+        gc.freeze()
+        count = gc.get_freeze_count()
+        del garbage
+        self.assertEqual(gc.collect(), 0)
+        self.assertIsNotNone(wr())
+        # Frozen objects are still tracked, but not visible to the
+        # introspection functions which walk the generations.
+        self.assertTrue(gc.is_tracked(keep))
+        self.assertNotIn(id(keep), map(id, gc.get_objects()))
+        # New objects go to the generations
+        new = []
+        self.assertIn(id(new), map(id, gc.get_objects()))
+        self.assertEqual(gc.get_freeze_count(), count)
+        gc.unfreeze()
+        self.assertIn(id(keep), map(id, gc.get_objects()))
+        self.assertGreater(gc.collect(), 0)
+        self.assertIsNone(wr())
+
+    def test_freeze_aborts_incremental_collection(self):
+        self.addCleanup(gc.set_incremental, *gc.get_incremental())
+        keep = [[] for i in range(1000)]
+        gc.collect()
+        gc.set_incremental(max_objects=100)
+        self.assertFalse(gc.collect_step())
+        gc.freeze()
+        self.assertGreaterEqual(gc.get_freeze_count(), 1000)
+        self.assertNotIn(id(keep), map(id, gc.get_objects()))
+        gc.unfreeze()
+        self.assertIn(id(keep), map(id, gc.get_objects()))
+
+
 class GCCallbackTests(unittest.TestCase):
     def setUp(self):
         # Save gc state and disable it.
@@ -757,6 +825,49 @@ class GCCallbackTests(unittest.TestCase):
             self.assertTrue("collected" in info)
             self.assertTrue("uncollectable" in info)
 
+    def test_collect_timings(self):
+        self.preclean()
+        gc.collect()
+        stops = [v[2] for v in self.visit if v[1] == "stop"]
+        self.assertEqual(len(stops), 2)
+        for info in stops:
+            self.assertGreater(info["examined"], 0)
+            self.assertGreater(info["duration"], 0)
+            phases = [info["mark_time"], info["finalize_time"],
+                      info["weakref_time"], info["delete_time"]]
+            for t in phases:
+                self.assertGreaterEqual(t, 0)
+            self.assertGreater(info["mark_time"], 0)
+            self.assertLessEqual(sum(phases), info["duration"])
+        starts = [v[2] for v in self.visit if v[1] == "start"]
+        for info in starts:
+            self.assertNotIn("duration", info)
+
+    def test_collect_hook(self):
+        self.preclean()
+        _testcapi.set_gc_hook(True)
+        try:
+            C1055820(666)
+            gc.collect(1)
+            gc.collect()
+        finally:
+            reports = _testcapi.set_gc_hook(False)
+        self.assertEqual(len(reports), 2)
+        self.assertEqual([r[0] for r in reports], [1, 2])
+        for (generation, incremental, complete, collected, uncollectable,
+             examined, duration, mark_time, finalize_time, weakref_time,
+             delete_time) in reports:
+            self.assertFalse(incremental)
+            self.assertTrue(complete)
+            self.assertGreater(examined, 0)
+            self.assertLessEqual(mark_time + finalize_time + weakref_time +
+                                 delete_time, duration)
+        self.assertEqual(reports[0][3], 2)
+        self.assertEqual(reports[1][3], 0)
+        self.assertGreater(reports[1][5], reports[0][5])
+        stops = [v[2] for v in self.visit if v[1] == "stop"]
+        self.assertEqual([info["duration"] for info in stops],
+                         [r[6] for r in reports for i in range(2)])
     def test_collect_generation(self):
         self.preclean()
         gc.collect(2)
@@ -800,6 +911,175 @@ class GCCallbackTests(unittest.TestCase):
         self.assertEqual(len(gc.garbage), 0)
 
 
+class Node:
+    def __init__(self):
+        self.loop = self
+
+
+class GCIncrementalTests(unittest.TestCase):
+    def setUp(self):
+        self.addCleanup(gc.set_incremental, *gc.get_incremental())
+        gc.collect()
+
+    def tearDown(self):
+        # Don't leave an incremental collection in progress
+        gc.collect()
+
+    def run_steps(self, between=None):
+        for steps in itertools.count(1):
+            if gc.collect_step():
+                return steps
+            if between is not None:
+                between(steps)
+
+    def test_settings(self):
+        gc.set_incremental(100, 2000)
+        self.assertEqual(gc.get_incremental(), (100, 2000))
+        gc.set_incremental(max_usec=500)
+        self.assertEqual(gc.get_incremental(), (0, 500))
+        gc.set_incremental()
+        self.assertEqual(gc.get_incremental(), (0, 0))
+        self.assertRaises(ValueError, gc.set_incremental, -1)
+        self.assertRaises(ValueError, gc.set_incremental, 0, -1)
+
+    def test_collect_old_cycle(self):
+        keep = [Node() for i in range(1000)]
+        garbage = Node()
+        wr = weakref.ref(garbage)
+        gc.collect()
+        del garbage
+        gc.set_incremental(max_objects=100)
+        before = gc.get_stats()[2]
+        steps = self.run_steps()
+        after = gc.get_stats()[2]
+        self.assertGreater(steps, 10)
+        self.assertIsNone(wr())
+        self.assertEqual(after["collections"], before["collections"] + 1)
+        self.assertEqual(after["increments"], before["increments"] + steps)
+        self.assertGreaterEqual(after["collected"], before["collected"] + 1)
+        self.assertEqual(sum(count for bound, count in
+                             after["pause_histogram"]),
+                         sum(count for bound, count in
+                             before["pause_histogram"]) + steps)
+        for node in keep:
+            self.assertIs(node.loop, node)
+
+    def test_disabled(self):
+        # Without limits, a single slice does the whole collection
+        garbage = Node()
+        wr = weakref.ref(garbage)
+        gc.collect()
+        del garbage
+        gc.set_incremental()
+        self.assertTrue(gc.collect_step())
+        self.assertIsNone(wr())
+
+    def test_reference_moved_to_young_object(self):
+        filler = [Node() for i in range(1000)]
+        box = [Node()]
+        wr = weakref.ref(box[0])
+        gc.collect()
+        gc.set_incremental(max_objects=50)
+        def between(steps):
+            nonlocal box
+            # The only reference is now held by an object the collection
+            # didn't see.
+            box = [box.pop()]
+        self.run_steps(between)
+        self.assertIsNotNone(wr())
+        self.assertIs(box[0].loop, box[0])
+
+    def test_reference_moved_between_old_objects(self):
+        holders = [[] for i in range(1000)]
+        holders[0].append(Node())
+        wr = weakref.ref(holders[0][0])
+        gc.collect()
+        gc.set_incremental(max_objects=20)
+        position = 0
+        def between(steps):
+            nonlocal position
+            node = holders[position].pop()
+            position = (position * 7 + 13) % len(holders)
+            holders[position].append(node)
+        self.run_steps(between)
+        node = wr()
+        self.assertIsNotNone(node)
+        self.assertIs(node.loop, node)
+        self.assertIs(holders[position][0], node)
+
+    def test_full_collection_aborts(self):
+        keep = [Node() for i in range(1000)]
+        garbage = Node()
+        wr = weakref.ref(garbage)
+        gc.collect()
+        del garbage
+        gc.set_incremental(max_objects=100)
+        self.assertFalse(gc.collect_step())
+        # The objects are still tracked while the collection is in progress
+        self.assertTrue(gc.is_tracked(keep))
+        ids = set(map(id, gc.get_objects()))
+        self.assertIn(id(keep), ids)
+        self.assertIn(id(keep[500]), ids)
+        self.assertIn(keep, gc.get_referrers(keep[500]))
+        gc.collect()
+        self.assertIsNone(wr())
+        for node in keep:
+            self.assertIs(node.loop, node)
+        # Disabling incremental collection aborts it too
+        self.assertFalse(gc.collect_step())
+        gc.set_incremental()
+        self.assertTrue(gc.collect_step())
+
+    def test_callbacks(self):
+        calls = []
+        def cb(phase, info):
+            calls.append((phase, info["generation"]))
+        gc.callbacks.append(cb)
+        self.addCleanup(gc.callbacks.remove, cb)
+        keep = [Node() for i in range(1000)]
+        gc.collect()
+        gc.set_incremental(max_objects=100)
+        calls.clear()
+        _testcapi.set_gc_hook(True)
+        try:
+            steps = self.run_steps()
+        finally:
+            reports = _testcapi.set_gc_hook(False)
+        # Only the final slice is reported to the callbacks, all of them to
+        # the C hook
+        self.assertEqual(calls, [("start", 2), ("stop", 2)])
+        self.assertEqual(len(reports), steps)
+        self.assertEqual([r[2] for r in reports], [0] * (steps - 1) + [1])
+        for report in reports:
+            self.assertEqual(report[:2], (2, 1))
+        self.assertGreaterEqual(sum(r[5] for r in reports), 1000)
+
+    def test_automatic(self):
+        thresholds = gc.get_threshold()
+        self.addCleanup(gc.set_threshold, *thresholds)
+        self.addCleanup(gc.disable)
+        gc.set_threshold(100, 2, 2)
+        gc.set_incremental(max_objects=200)
+        before = gc.get_stats()[2]
+        wrs = []
+        gc.enable()
+        keep = []
+        for i in range(20000):
+            node = Node()
+            if i % 3:
+                keep.append(node)
+            else:
+                wrs.append(weakref.ref(node))
+            del node
+        gc.disable()
+        after = gc.get_stats()[2]
+        self.assertGreater(after["increments"], before["increments"])
+        self.assertGreater(after["collections"], before["collections"])
+        self.assertGreater(sum(wr() is None for wr in wrs), len(wrs) // 2)
+        for node in keep:
+            self.assertIs(node.loop, node)
+
+
 class GCTogglingTests(unittest.TestCase):
     def setUp(self):
         gc.enable()
@@ -953,7 +1233,8 @@ def test_main():
 
     try:
         gc.collect() # Delete 2nd generation garbage
-        run_unittest(GCTests, GCTogglingTests, GCCallbackTests)
+        run_unittest(GCTests, GCTogglingTests, GCCallbackTests,
+                     GCIncrementalTests, GCFreezeTests)
     finally:
         gc.set_debug(debug)
         # test gc.enable() even if GC is disabled by default
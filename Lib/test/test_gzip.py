@@ -8,6 +8,12 @@ import os
 import io
 import struct
 gzip = support.import_module('gzip')
+zlib = support.import_module('zlib')
+
+try:
+    import threading
+except ImportError:
+    threading = None
 
 data1 = b"""  int length=DEFAULTALLOC, err = Z_OK;
   PyObject *RetVal;
@@ -162,6 +168,41 @@ class TestGzip(BaseTest):
                 self.assertTrue(len(L) <= line_length)
                 line_length = (line_length + 1) % 50
 
+    def test_readinto(self):
+        self.test_write()
+        expected = data1 * 50
+        with gzip.GzipFile(self.filename, 'rb') as f:
+            b = bytearray(100)
+            self.assertEqual(f.readinto(b), 100)
+            self.assertEqual(b, expected[:100])
+            # Larger than the buffer of the underlying BufferedReader
+            b = bytearray(len(expected))
+            n = f.readinto(memoryview(b)[10:])
+            self.assertEqual(b[10:10 + n], expected[100:100 + n])
+            self.assertEqual(f.tell(), 100 + n)
+            b = bytearray(len(expected))
+            n += f.readinto(b)
+            self.assertEqual(n, len(expected) - 100)
+            self.assertEqual(f.readinto(b), 0)
+        with gzip.GzipFile(self.filename, 'wb') as f:
+            self.assertRaises(OSError, f.readinto, bytearray(10))
+
+    def test_iterator(self):
+        self.test_write()
+        lines = 50 * data1.splitlines(keepends=True)
+        with gzip.GzipFile(self.filename, 'rb') as f:
+            self.assertEqual(list(f), lines)
+        with gzip.GzipFile(self.filename, 'rb') as f:
+            # Iteration, readline() and tell() share the same position.
+            it = iter(f)
+            self.assertEqual(next(it), lines[0])
+            self.assertEqual(f.readline(), lines[1])
+            self.assertEqual(next(it), lines[2])
+            self.assertEqual(f.tell(), len(b''.join(lines[:3])))
+            f.close()
+            self.assertRaises(ValueError, next, it)
+        self.assertRaises(ValueError, iter, f)
+
     def test_readlines(self):
         self.test_write()
         # Try .readlines()
@@ -203,6 +244,14 @@ class TestGzip(BaseTest):
             y = f.read(10)
         self.assertEqual(y, data1[20:30])
 
+    def test_seek_end(self):
+        self.test_write()
+        with gzip.GzipFile(self.filename) as f:
+            self.assertEqual(f.seek(-10, io.SEEK_END), len(data1) * 50 - 10)
+            self.assertEqual(f.read(), data1[-10:])
+        with gzip.GzipFile(self.filename, 'w') as f:
+            self.assertRaises(ValueError, f.seek, 0, io.SEEK_END)
+
     def test_seek_write(self):
         # Try seek, write test
         with gzip.GzipFile(self.filename, 'w') as f:
@@ -390,6 +439,36 @@ class TestGzip(BaseTest):
                 with gzip.GzipFile(fileobj=io.BytesIO(datac), mode="rb") as f:
                     self.assertEqual(f.read(), data)
 
+    @unittest.skipUnless(threading, 'requires threading')
+    def test_compress_threads(self):
+        # Several blocks, the last one being partial
+        data = (data1 + data2) * 1500
+        self.assertGreater(len(data), 3 * gzip._PARALLEL_BLOCK_SIZE)
+        for threads in (0, 1, 2, 4):
+            datac = gzip.compress(data, threads=threads)
+            self.assertEqual(gzip.decompress(datac), data)
+            # A single standard gzip member
+            self.assertEqual(zlib.decompress(datac, 16 + zlib.MAX_WBITS), data)
+        self.assertEqual(gzip.decompress(gzip.compress(b"", threads=2)), b"")
+        self.assertRaises(ValueError, gzip.compress, data, threads=-1)
+
+    @unittest.skipUnless(threading, 'requires threading')
+    def test_write_threads(self):
+        data = (data1 + data2) * 1500
+        buf = io.BytesIO()
+        with gzip.GzipFile(fileobj=buf, mode="wb", threads=2) as f:
+            for i in range(0, len(data), 10000):
+                f.write(data[i:i + 10000])
+                if i % 70000 == 0:
+                    f.flush()
+                if i % 110000 == 0:
+                    f.flush(zlib.Z_FULL_FLUSH)
+        self.assertEqual(gzip.decompress(buf.getvalue()), data)
+        with gzip.open(self.filename, "wb", threads=2) as f:
+            f.write(data)
+        with gzip.open(self.filename, "rb") as f:
+            self.assertEqual(f.read(), data)
+
     def test_decompress(self):
         for data in (data1, data2):
             buf = io.BytesIO()
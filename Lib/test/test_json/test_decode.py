@@ -1,4 +1,5 @@
 import decimal
+import sys
 from io import StringIO, BytesIO
 from collections import OrderedDict
 from test.test_json import PyTest, CTest
@@ -60,6 +61,34 @@ class TestDecode:
         self.check_keys_reuse(s, self.loads)
         self.check_keys_reuse(s, self.json.decoder.JSONDecoder().decode)
 
+    def test_same_shape_objects(self):
+        s = ('[{"a": 1, "b": [{"a": 2, "b": 3}]}, {"a": 4, "b": 5}, '
+             '{"b": 6, "a": 7}, {"a": 8, "a": 9}, {"a": 10, "b": 11}, {}]')
+        rval = self.loads(s)
+        self.assertEqual(rval, [{"a": 1, "b": [{"a": 2, "b": 3}]},
+                                {"a": 4, "b": 5}, {"b": 6, "a": 7},
+                                {"a": 9}, {"a": 10, "b": 11}, {}])
+        # changing one of the objects doesn't change the others
+        rval[1]["c"] = 12
+        del rval[4]["a"]
+        rval[5]["a"] = 13
+        self.assertEqual(rval[0], {"a": 1, "b": [{"a": 2, "b": 3}]})
+        self.assertEqual(rval[1], {"a": 4, "b": 5, "c": 12})
+        self.assertEqual(rval[2], {"b": 6, "a": 7})
+        self.assertEqual(rval[4], {"b": 11})
+        self.assertEqual(rval[5], {"a": 13})
+        self.assertEqual(self.loads(s), [{"a": 1, "b": [{"a": 2, "b": 3}]},
+                                         {"a": 4, "b": 5}, {"b": 6, "a": 7},
+                                         {"a": 9}, {"a": 10, "b": 11}, {}])
+        self.assertEqual(self.loads(s, object_hook=sorted),
+                         [["a", "b"], ["a", "b"], ["a", "b"], ["a"],
+                          ["a", "b"], []])
+
+    def test_large_objects(self):
+        d = {"k%d" % i: i for i in range(100)}
+        s = self.dumps([d, d, {"k1": 1}])
+        self.assertEqual(self.loads(s), [d, d, {"k1": 1}])
+
     def test_extra_data(self):
         s = '[1, 2, 3]5'
         msg = 'Extra data'
@@ -71,11 +100,35 @@ class TestDecode:
         self.assertRaisesRegex(ValueError, msg, self.loads, s)
 
     def test_invalid_input_type(self):
-        msg = 'the JSON object must be str'
-        for value in [1, 3.14, b'bytes', b'\xff\x00', [], {}, None]:
+        msg = 'the JSON object must be str or bytes'
+        for value in [1, 3.14, [], {}, None]:
             self.assertRaisesRegex(TypeError, msg, self.loads, value)
-        with self.assertRaisesRegex(TypeError, msg):
-            self.json.load(BytesIO(b'[1,2,3]'))
+
+    def test_bytes_input(self):
+        doc = '{"k\xe9y": ["v\u20acl", 1, 2.5e3, true, null, {"": "\\u00e9"}]}'
+        expected = self.loads(doc)
+        data = doc.encode('utf-8')
+        for value in (data, bytearray(data), memoryview(data)):
+            self.assertEqual(self.loads(value), expected)
+        self.assertEqual(self.json.load(BytesIO(b' [1,2,3] ')), [1, 2, 3])
+        self.assertEqual(self.loads(memoryview(b'x[1]x')[1:-1]), [1])
+        self.assertEqual(self.loads(b'{"a": 1, "b": 2}',
+                                    object_pairs_hook=list),
+                         [('a', 1), ('b', 2)])
+        self.assertEqual(self.loads(b'1.5', parse_float=str), '1.5')
+
+    def test_bytes_input_errors(self):
+        for data, msg in ((b'"\xff"', 'Invalid UTF-8 data'),
+                          (b'["abc\xc3"]', 'Invalid UTF-8 data'),
+                          (b'\xff', 'Expecting value|Invalid UTF-8'),
+                          (b'[1 2]', "Expecting ','"),
+                          (b'[1] 2', 'Extra data'),
+                          (b'"\x01"', 'Invalid control character')):
+            self.assertRaisesRegex(ValueError, msg, self.loads, data)
+        with self.assertRaisesRegex(ValueError, 'line 2 column 4'):
+            self.loads(memoryview(b'[1,\n 2 3]'))
+        bom_json = "[1,2,3]".encode('utf-8-sig')
+        self.assertRaisesRegex(ValueError, 'BOM', self.loads, bom_json)
 
     def test_string_with_utf8_bom(self):
         # see #18958
@@ -92,4 +145,37 @@ class TestDecode:
         self.assertEqual(self.json.load(StringIO(bom_in_str)), '\ufeff')
 
 class TestPyDecode(TestDecode, PyTest): pass
-class TestCDecode(TestDecode, CTest): pass
+class TestCDecode(TestDecode, CTest):
+    def test_shared_keys(self):
+        # objects with the same keys share them as instance dicts do
+        decode = self.json.decoder.JSONDecoder().decode
+        rval = decode('[{"spam": 1, "eggs": 2, "ham": 3},'
+                      ' {"spam": 4, "eggs": 5, "ham": 6}]')
+        self.assertLess(sys.getsizeof(rval[0]),
+                        sys.getsizeof({"spam": 1, "eggs": 2, "ham": 3}))
+        # and keep sharing them when decoding more documents
+        rval2 = decode('{"spam": 7, "eggs": 8, "ham": 9}')
+        self.assertEqual(rval2, {"spam": 7, "eggs": 8, "ham": 9})
+        (a, b, c), (d, e, f) = sorted(rval[0]), sorted(rval2)
+        self.assertIs(a, d)
+        self.assertIs(b, e)
+        self.assertIs(c, f)
+
+    def test_keys_released(self):
+        # decoded keys don't outlive the result, except the keys of
+        # cached shapes (the big key's object has too many keys for one)
+        import tracemalloc
+        key = 'x' * (1 << 20)
+        s = '{%s}' % ', '.join('"%s": %d' % (k, i) for i, k in
+                               enumerate([key] + ['k%d' % i
+                                                  for i in range(16)]))
+        tracemalloc.start()
+        try:
+            before = tracemalloc.get_traced_memory()[0]
+            rval = self.loads(s)
+            self.assertIn(key, rval)
+            del rval
+            self.assertLess(tracemalloc.get_traced_memory()[0] - before,
+                            1 << 19)
+        finally:
+            tracemalloc.stop()
@@ -12,6 +12,36 @@ class TestDump:
     def test_dumps(self):
         self.assertEqual(self.dumps({}), '{}')
 
+    def test_dump_buffered(self):
+        class Writer:
+            def __init__(self):
+                self.chunks = []
+            def write(self, s):
+                self.chunks.append(s)
+        obj = [{'key': i, 'value': [str(i)] * 3} for i in range(1000)]
+        for kwargs in {}, {'indent': 2}, {'sort_keys': True}:
+            encoder = self.json.JSONEncoder(**kwargs)
+            writer = Writer()
+            encoder.dump(obj, writer, buffer_size=100)
+            self.assertEqual(''.join(writer.chunks), encoder.encode(obj))
+            self.assertGreater(len(writer.chunks), 100)
+            # each write holds at most one more token than buffer_size
+            self.assertLess(max(map(len, writer.chunks)), 200)
+            writer = Writer()
+            self.json.dump(obj, writer, **kwargs)
+            self.assertEqual(''.join(writer.chunks), encoder.encode(obj))
+            self.assertLess(len(writer.chunks), 5)
+
+    def test_dump_errors(self):
+        sio = StringIO()
+        with self.assertRaises(TypeError):
+            self.json.dump([1, 2, object()], sio)
+        class Writer:
+            def write(self, s):
+                1/0
+        with self.assertRaises(ZeroDivisionError):
+            self.json.dump([1, 2, 3], Writer())
+
     def test_encode_truefalse(self):
         self.assertEqual(self.dumps(
                  {True: False, False: True}, sort_keys=True),
@@ -0,0 +1,129 @@
+import io
+from collections import OrderedDict
+from test.test_json import PyTest, CTest
+
+
+DOCS = [
+    {"a": [1, 2.5, "x\"]}"], "b": {"c": None}},
+    [],
+    "str[{\\",
+    12345,
+    -1.5e10,
+    True,
+    None,
+    [[[{"": []}]]],
+]
+
+
+class TestStream:
+    def text(self):
+        return ' \n'.join(self.dumps(doc) for doc in DOCS) + '\n'
+
+    def decode(self, chunks, **kwargs):
+        parser = self.json.JSONStreamDecoder(**kwargs)
+        values = []
+        for chunk in chunks:
+            parser.feed(chunk)
+            values.extend(parser.read_values())
+        parser.close()
+        values.extend(parser.read_values())
+        return values
+
+    def split(self, data, size):
+        return [data[i:i + size] for i in range(0, len(data), size)]
+
+    def test_chunks(self):
+        data = self.text()
+        for size in 1, 2, 3, 7, 64, len(data):
+            self.assertEqual(self.decode(self.split(data, size)), DOCS)
+            encoded = data.encode('utf-8')
+            self.assertEqual(self.decode(self.split(encoded, size)), DOCS)
+
+    def test_values_as_decoded(self):
+        parser = self.json.JSONStreamDecoder()
+        parser.feed('{"a": 1}\n[1, ')
+        self.assertEqual(list(parser.read_values()), [{"a": 1}])
+        self.assertEqual(list(parser.read_values()), [])
+        parser.feed('2]"ab')
+        self.assertEqual(list(parser.read_values()), [[1, 2]])
+        parser.feed('c" 12')
+        # the number may go on in the next chunk
+        self.assertEqual(list(parser.read_values()), ['abc'])
+        parser.feed('3')
+        self.assertEqual(list(parser.read_values()), [])
+        parser.close()
+        self.assertEqual(list(parser.read_values()), [123])
+
+    def test_concatenated(self):
+        self.assertEqual(self.decode(['{}[]""{"a":1}']),
+                         [{}, [], "", {"a": 1}])
+        self.assertEqual(self.decode(['']), [])
+        self.assertEqual(self.decode([' \n\t ']), [])
+
+    def test_array(self):
+        data = self.dumps(DOCS)
+        for size in 1, 5, len(data):
+            self.assertEqual(self.decode(self.split(data, size), array=True),
+                             DOCS)
+        self.assertEqual(self.decode([' [ ] '], array=True), [])
+        self.assertEqual(self.decode(['[1,2', ',3]'], array=True), [1, 2, 3])
+
+    def test_array_errors(self):
+        for data in ('', '{}', '[1, 2', '[1 2]', '[1,]', '[1] 2', '[,1]'):
+            with self.assertRaises(ValueError, msg=data):
+                self.decode([data], array=True)
+
+    def test_errors(self):
+        for data in ('{"a": 1', '[1, 2}', '"abc', '{"a" 1}', 'nul', '1x',
+                     '[1] x'):
+            with self.assertRaises(ValueError, msg=data):
+                self.decode([data])
+        parser = self.json.JSONStreamDecoder()
+        parser.feed('[]')
+        self.assertRaises(TypeError, parser.feed, b'[]')
+        parser.close()
+        self.assertRaises(ValueError, parser.feed, '[]')
+
+    def test_decoder(self):
+        decoder = self.json.JSONDecoder(object_pairs_hook=OrderedDict)
+        values = self.decode(['{"b": 1, "a": 2}'], decoder=decoder)
+        self.assertEqual(values, [OrderedDict([('b', 1), ('a', 2)])])
+        self.assertIs(type(values[0]), OrderedDict)
+
+    def test_encoding(self):
+        data = '["\xe9€"]'.encode('utf-16-le')
+        self.assertEqual(self.decode(self.split(data, 1), encoding='utf-16-le'),
+                         [['\xe9€']])
+        self.assertEqual(self.decode(self.split('"\xe9"'.encode(), 1)),
+                         ['\xe9'])
+        with self.assertRaises(ValueError):
+            self.decode([b'"\xc3'])
+
+    def test_iterload(self):
+        data = self.text()
+        self.assertEqual(list(self.json.iterload(io.StringIO(data),
+                                                 chunk_size=5)), DOCS)
+        self.assertEqual(list(self.json.iterload(io.BytesIO(data.encode()),
+                                                 chunk_size=5)), DOCS)
+        data = self.dumps(DOCS)
+        self.assertEqual(list(self.json.iterload(io.StringIO(data),
+                                                 array=True)), DOCS)
+        it = self.json.iterload(io.StringIO('{"a": 1.5}'),
+                                object_pairs_hook=OrderedDict,
+                                parse_float=str)
+        self.assertEqual(list(it), [OrderedDict(a='1.5')])
+
+    def test_scan_value_end(self):
+        scan_value_end = self.json.decoder.scan_value_end
+        self.assertEqual(scan_value_end('[1, [2]] 3', 0, 0), (8, 0))
+        self.assertEqual(scan_value_end('x"a\\"b"', 1, 0), (7, 0))
+        self.assertEqual(scan_value_end('{"]": "\\\\"}', 0, 0), (11, 0))
+        end, state = scan_value_end('[{"a\\', 0, 0)
+        self.assertEqual(end, -1)
+        end, state = scan_value_end('"}', 0, state)
+        self.assertEqual(end, -1)
+        self.assertEqual(scan_value_end('"}]', 0, state), (3, 0))
+
+
+class TestPyStream(TestStream, PyTest): pass
+class TestCStream(TestStream, CTest): pass
@@ -3,8 +3,8 @@ from test.test_json import PyTest, CTest
 
 
 class TestUnicode:
-    # test_encoding1 and test_encoding2 from 2.x are irrelevant (only str
-    # is supported as input, not bytes).
+    # test_encoding1 and test_encoding2 from 2.x are irrelevant (bytes
+    # input is always UTF-8).
 
     def test_encoding3(self):
         u = '\N{GREEK SMALL LETTER ALPHA}\N{GREEK CAPITAL LETTER OMEGA}'
@@ -52,8 +52,12 @@ class TestUnicode:
         self.assertRaises(TypeError, self.dumps, [b"hi"])
 
     def test_bytes_decode(self):
-        self.assertRaises(TypeError, self.loads, b'"hi"')
-        self.assertRaises(TypeError, self.loads, b'["hi"]')
+        self.assertEqual(self.loads(b'"hi"'), 'hi')
+        self.assertEqual(self.loads(b'["hi"]'), ['hi'])
+        for c in '\xe9', '\u20ac', '\U0001d120':
+            data = self.dumps(c, ensure_ascii=False).encode('utf-8')
+            self.assertEqual(self.loads(data), c)
+            self.assertEqual(self.loads(self.dumps(c).encode('ascii')), c)
 
 
     def test_object_pairs_hook_with_unicode(self):
@@ -1,6 +1,7 @@
 from io import BytesIO, UnsupportedOperation
 import os
 import pickle
+import _compression
 import random
 import unittest
 
@@ -56,6 +57,19 @@ class CompressorDecompressorTestCase(unittest.TestCase):
         lzd.decompress(empty)
         self.assertRaises(EOFError, lzd.decompress, b"quux")
 
+    def test_bad_threads(self):
+        self.assertRaises(TypeError, LZMACompressor, threads="2")
+        # threads is keyword-only.
+        self.assertRaises(TypeError, LZMACompressor,
+                          lzma.FORMAT_XZ, -1, None, None, 2)
+        self.assertRaises(ValueError, LZMACompressor, threads=-1)
+        # Only FORMAT_XZ supports multi-threaded compression.
+        with self.assertRaises(ValueError):
+            LZMACompressor(format=lzma.FORMAT_ALONE, threads=2)
+        with self.assertRaises(ValueError):
+            LZMACompressor(format=lzma.FORMAT_RAW, filters=FILTERS_RAW_1,
+                           threads=2)
+
     def test_bad_filter_spec(self):
         self.assertRaises(TypeError, LZMACompressor, filters=[b"wobsite"])
         self.assertRaises(ValueError, LZMACompressor, filters=[{"xyzzy": 3}])
@@ -230,6 +244,24 @@ class CompressDecompressFunctionTestCase(unittest.TestCase):
 
     # Test error cases:
 
+    def test_compress_threads(self):
+        # Small blocks, so that the input is compressed by several threads.
+        filters = [{"id": lzma.FILTER_LZMA2, "preset": 1,
+                    "dict_size": 64 * 1024}]
+        data = INPUT * 1000
+        for threads in (0, 2, 4):
+            try:
+                comp = LZMACompressor(filters=filters, threads=threads)
+            except ValueError:
+                self.skipTest("multi-threaded compression not supported")
+            cdata = b"".join([comp.compress(data[i:i + 50000])
+                              for i in range(0, len(data), 50000)])
+            cdata += comp.flush()
+            self.assertEqual(lzma.decompress(cdata), data)
+            cdata = lzma.compress(data, preset=1, threads=threads)
+            self.assertEqual(lzma.decompress(cdata), data)
+        self.assertEqual(lzma.decompress(lzma.compress(b"", threads=2)), b"")
+
     def test_bad_args(self):
         self.assertRaises(TypeError, lzma.compress)
         self.assertRaises(TypeError, lzma.compress, [])
@@ -680,13 +712,13 @@ class FileTestCase(unittest.TestCase):
     def test_read_multistream_buffer_size_aligned(self):
         # Test the case where a stream boundary coincides with the end
         # of the raw read buffer.
-        saved_buffer_size = lzma._BUFFER_SIZE
-        lzma._BUFFER_SIZE = len(COMPRESSED_XZ)
+        saved_buffer_size = _compression.BUFFER_SIZE
+        _compression.BUFFER_SIZE = len(COMPRESSED_XZ)
         try:
             with LZMAFile(BytesIO(COMPRESSED_XZ *  5)) as f:
                 self.assertEqual(f.read(), INPUT * 5)
         finally:
-            lzma._BUFFER_SIZE = saved_buffer_size
+            _compression.BUFFER_SIZE = saved_buffer_size
 
     def test_read_trailing_junk(self):
         with LZMAFile(BytesIO(COMPRESSED_XZ + COMPRESSED_BOGUS)) as f:
@@ -737,7 +769,7 @@ class FileTestCase(unittest.TestCase):
         with LZMAFile(BytesIO(), "w") as f:
             self.assertRaises(ValueError, f.read)
         with LZMAFile(BytesIO(COMPRESSED_XZ)) as f:
-            self.assertRaises(TypeError, f.read, None)
+            self.assertRaises(TypeError, f.read, float())
 
     def test_read_bad_data(self):
         with LZMAFile(BytesIO(COMPRESSED_BOGUS)) as f:
@@ -820,6 +852,19 @@ class FileTestCase(unittest.TestCase):
                       format=lzma.FORMAT_RAW, filters=FILTERS_RAW_2) as f:
             self.assertListEqual(list(iter(f)), lines)
 
+    def test_readinto(self):
+        with LZMAFile(BytesIO(COMPRESSED_XZ * 2)) as f:
+            b = bytearray(len(INPUT) * 2)
+            n = 0
+            while n < len(b):
+                k = f.readinto(memoryview(b)[n:])
+                self.assertGreater(k, 0)
+                n += k
+            self.assertEqual(b, INPUT * 2)
+            self.assertEqual(f.readinto(b), 0)
+        with LZMAFile(BytesIO(), "w") as f:
+            self.assertRaises(ValueError, f.readinto, bytearray(10))
+
     def test_readline(self):
         with BytesIO(INPUT) as f:
             lines = f.readlines()
@@ -857,6 +902,24 @@ class FileTestCase(unittest.TestCase):
                                      filters=FILTERS_RAW_2)
             self.assertEqual(dst.getvalue(), expected)
 
+    def test_write_threads(self):
+        try:
+            LZMACompressor(threads=2)
+        except ValueError:
+            self.skipTest("multi-threaded compression not supported")
+        data = INPUT * 100
+        with BytesIO() as dst:
+            with LZMAFile(dst, "w", threads=2) as f:
+                f.write(data)
+            self.assertEqual(lzma.decompress(dst.getvalue()), data)
+        with TempFile(TESTFN):
+            with lzma.open(TESTFN, "wb", threads=0) as f:
+                f.write(data)
+            with lzma.open(TESTFN) as f:
+                self.assertEqual(f.read(), data)
+        with self.assertRaises(ValueError):
+            LZMAFile(BytesIO(COMPRESSED_XZ), "r", threads=2)
+
     def test_write_10(self):
         with BytesIO() as dst:
             with LZMAFile(dst, "w") as f:
@@ -998,7 +1061,7 @@ class FileTestCase(unittest.TestCase):
             self.assertRaises(ValueError, f.seek, 0)
         with LZMAFile(BytesIO(COMPRESSED_XZ)) as f:
             self.assertRaises(ValueError, f.seek, 0, 3)
-            self.assertRaises(ValueError, f.seek, 9, ())
+            self.assertRaises(TypeError, f.seek, 9, ())
             self.assertRaises(TypeError, f.seek, None)
             self.assertRaises(TypeError, f.seek, b"derp")
 
@@ -0,0 +1,269 @@
+"""
+Test the per-opcode inline caches of the eval loop.
+
+Caches are only allocated once a code object has been run a number of
+times (OPCACHE_MIN_RUNS in Python/ceval.c), so the functions under test
+are warmed up before the namespace they read from is modified.
+"""
+import builtins
+import unittest
+import weakref
+from test import support
+
+# Comfortably above OPCACHE_MIN_RUNS
+WARMUP = 2000
+
+
+def warm(func, *args):
+    for i in range(WARMUP):
+        result = func(*args)
+    return result
+
+
+class LoadGlobalTests(unittest.TestCase):
+
+    def make_function(self, namespace, source="def f():\n    return x\n"):
+        exec(source, namespace)
+        return namespace['f']
+
+    def test_global_rebound(self):
+        ns = {'x': 1}
+        f = self.make_function(ns)
+        self.assertEqual(warm(f), 1)
+        ns['x'] = 2
+        self.assertEqual(f(), 2)
+        ns['x'] = 3
+        self.assertEqual(warm(f), 3)
+
+    def test_global_deleted(self):
+        ns = {'x': 1}
+        f = self.make_function(ns)
+        self.assertEqual(warm(f), 1)
+        del ns['x']
+        self.assertRaises(NameError, f)
+
+    def test_global_shadows_builtin(self):
+        ns = {}
+        f = self.make_function(ns, "def f():\n    return len\n")
+        self.assertIs(warm(f), len)
+        ns['len'] = 42
+        self.assertEqual(f(), 42)
+        del ns['len']
+        self.assertIs(f(), len)
+
+    def test_builtin_changed(self):
+        ns = {}
+        f = self.make_function(ns, "def f():\n    return _opcache_test\n")
+        with support.swap_attr(builtins, '_opcache_test', 1):
+            self.assertEqual(warm(f), 1)
+            builtins._opcache_test = 2
+            self.assertEqual(f(), 2)
+        self.assertRaises(NameError, f)
+
+    def test_other_globals(self):
+        # The same code object run against a different namespace must
+        # not reuse the cached value of the first one.
+        ns = {'x': 1}
+        f = self.make_function(ns)
+        self.assertEqual(warm(f), 1)
+        ns2 = {'x': 2}
+        g = type(f)(f.__code__, ns2)
+        self.assertEqual(g(), 2)
+        self.assertEqual(f(), 1)
+
+    def test_value_freed(self):
+        class Value:
+            pass
+        ns = {'x': Value()}
+        f = self.make_function(ns)
+        self.assertIsInstance(warm(f), Value)
+        ns['x'] = None
+        support.gc_collect()
+        self.assertIsNone(f())
+
+
+class AttributeCacheTests(unittest.TestCase):
+
+    def test_load_attr(self):
+        class C:
+            def __init__(self, x):
+                self.x = x
+        def f(obj):
+            return obj.x
+        self.assertEqual(warm(f, C(1)), 1)
+        self.assertEqual(f(C(2)), 2)
+
+    def test_polymorphic(self):
+        classes = []
+        for i in range(6):
+            class C:
+                def __init__(self, x):
+                    self.x = x
+            classes.append(C)
+        def f(obj):
+            return obj.x
+        objs = [cls(i) for i, cls in enumerate(classes)]
+        for i in range(WARMUP):
+            for j, obj in enumerate(objs):
+                self.assertEqual(f(obj), j)
+
+    def test_attribute_deleted(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.x
+        obj = C()
+        obj.x = 1
+        self.assertEqual(warm(f, obj), 1)
+        del obj.x
+        self.assertRaises(AttributeError, f, obj)
+        obj.x = 2
+        self.assertEqual(f(obj), 2)
+
+    def test_class_attribute_added(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.x
+        obj = C()
+        obj.x = 1
+        self.assertEqual(warm(f, obj), 1)
+        C.x = property(lambda self: 'property')
+        self.assertEqual(f(obj), 'property')
+        del C.x
+        self.assertEqual(f(obj), 1)
+
+    def test_base_class_modified(self):
+        class Base:
+            pass
+        class C(Base):
+            pass
+        def f(obj):
+            return obj.x
+        obj = C()
+        obj.x = 1
+        self.assertEqual(warm(f, obj), 1)
+        Base.x = property(lambda self: 'property')
+        self.assertEqual(f(obj), 'property')
+
+    def test_getattribute_added(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.x
+        obj = C()
+        obj.x = 1
+        self.assertEqual(warm(f, obj), 1)
+        C.__getattribute__ = lambda self, name: 'hook'
+        self.assertEqual(f(obj), 'hook')
+
+    def test_class_changed(self):
+        class C:
+            pass
+        class D:
+            x = 'class'
+        def f(obj):
+            return obj.x
+        obj = C()
+        obj.x = 1
+        self.assertEqual(warm(f, obj), 1)
+        obj.__class__ = D
+        self.assertEqual(f(obj), 1)
+        del obj.x
+        self.assertEqual(f(obj), 'class')
+
+    def test_dict_replaced(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.x
+        obj = C()
+        obj.x = 1
+        self.assertEqual(warm(f, obj), 1)
+        obj.__dict__ = {'x': 2}
+        self.assertEqual(f(obj), 2)
+        obj.__dict__.clear()
+        self.assertRaises(AttributeError, f, obj)
+
+    def test_shared_keys_resized(self):
+        class C:
+            pass
+        def f(obj):
+            return obj.a
+        obj = C()
+        obj.a = 1
+        self.assertEqual(warm(f, obj), 1)
+        # Grow the shared keys of the class beyond their initial size
+        for i in range(30):
+            setattr(obj, 'attr%d' % i, i)
+        self.assertEqual(f(obj), 1)
+        obj2 = C()
+        obj2.a = 2
+        self.assertEqual(warm(f, obj2), 2)
+        self.assertEqual(f(obj), 1)
+
+    def test_store_attr(self):
+        class C:
+            pass
+        def f(obj, value):
+            obj.x = value
+        objs = [C() for i in range(WARMUP)]
+        for i, obj in enumerate(objs):
+            f(obj, i)
+        for i, obj in enumerate(objs):
+            self.assertEqual(obj.x, i)
+            self.assertEqual(obj.__dict__, {'x': i})
+
+    def test_store_attr_data_descriptor(self):
+        class C:
+            pass
+        def f(obj, value):
+            obj.x = value
+        obj = C()
+        for i in range(WARMUP):
+            f(obj, i)
+        self.assertEqual(obj.x, WARMUP - 1)
+        stored = []
+        C.x = property(lambda self: 'property',
+                       lambda self, value: stored.append(value))
+        f(obj, 'value')
+        self.assertEqual(stored, ['value'])
+        self.assertEqual(obj.__dict__['x'], WARMUP - 1)
+
+    def test_store_attr_setattr_added(self):
+        class C:
+            pass
+        def f(obj, value):
+            obj.x = value
+        obj = C()
+        for i in range(WARMUP):
+            f(obj, i)
+        stored = []
+        C.__setattr__ = lambda self, name, value: stored.append(value)
+        f(obj, 'value')
+        self.assertEqual(stored, ['value'])
+
+    def test_store_attr_gc_tracking(self):
+        class C:
+            pass
+        def f(obj, value):
+            obj.x = value
+        objs = [C() for i in range(WARMUP)]
+        for obj in objs:
+            f(obj, 1)
+        # A cycle through a split dict filled by the cache must be
+        # collectable.
+        obj = C()
+        f(obj, 1)
+        f(obj, obj)
+        ref = weakref.ref(obj)
+        del obj
+        support.gc_collect()
+        self.assertIsNone(ref())
+
+
+def test_main():
+    support.run_unittest(LoadGlobalTests, AttributeCacheTests)
+
+if __name__ == "__main__":
+    test_main()
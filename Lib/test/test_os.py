@@ -5,6 +5,7 @@
 import os
 import errno
 import unittest
+import unittest.mock
 import warnings
 import sys
 import signal
@@ -2093,6 +2094,65 @@ class TestSendfile(unittest.TestCase):
                 raise
 
 
+@unittest.skipUnless(hasattr(os, 'copy_file_range'), 'test needs os.copy_file_range()')
+class CopyFileRangeTests(unittest.TestCase):
+
+    DATA = b"12345abcde" * 1000
+
+    def setUp(self):
+        self.dstname = support.TESTFN + "2"
+        self.addCleanup(support.unlink, support.TESTFN)
+        self.addCleanup(support.unlink, self.dstname)
+        with open(support.TESTFN, "wb") as f:
+            f.write(self.DATA)
+        self.src = os.open(support.TESTFN, os.O_RDONLY)
+        self.addCleanup(os.close, self.src)
+        self.dst = os.open(self.dstname, os.O_RDWR | os.O_CREAT)
+        self.addCleanup(os.close, self.dst)
+
+    def copy_file_range(self, *args, **kwargs):
+        try:
+            return os.copy_file_range(*args, **kwargs)
+        except OSError as err:
+            if err.errno in (errno.ENOSYS, errno.EXDEV, errno.EINVAL,
+                             errno.EOPNOTSUPP):
+                self.skipTest('copy_file_range() not supported: %s' % err)
+            raise
+
+    def read_dst(self):
+        with open(self.dstname, "rb") as f:
+            return f.read()
+
+    def test_copy(self):
+        total = 0
+        while True:
+            n = self.copy_file_range(self.src, self.dst, 4096)
+            if not n:
+                break
+            self.assertLessEqual(n, 4096)
+            total += n
+        self.assertEqual(total, len(self.DATA))
+        self.assertEqual(os.lseek(self.src, 0, os.SEEK_CUR), len(self.DATA))
+        self.assertEqual(self.read_dst(), self.DATA)
+
+    def test_offsets(self):
+        n = self.copy_file_range(self.src, self.dst, 5,
+                                 offset_src=5, offset_dst=10)
+        self.assertEqual(n, 5)
+        # The file positions are not used nor updated.
+        self.assertEqual(os.lseek(self.src, 0, os.SEEK_CUR), 0)
+        self.assertEqual(os.lseek(self.dst, 0, os.SEEK_CUR), 0)
+        self.assertEqual(self.read_dst(), b"\0" * 10 + b"abcde")
+
+    def test_invalid_arguments(self):
+        self.assertRaises(ValueError, os.copy_file_range,
+                          self.src, self.dst, -1)
+        self.assertRaises(TypeError, os.copy_file_range,
+                          self.src, self.dst, 10, offset_src="")
+        self.assertRaises(OSError, os.copy_file_range,
+                          support.make_bad_fd(), self.dst, 10)
+
+
 def supports_extended_attributes():
     if not hasattr(os, "setxattr"):
         return False
@@ -2459,6 +2519,226 @@ class FDInheritanceTests(unittest.TestCase):
         self.assertEqual(os.get_inheritable(slave_fd), False)
 
 
+class TestScandir(unittest.TestCase):
+    def setUp(self):
+        self.path = os.path.realpath(support.TESTFN)
+        os.mkdir(self.path)
+        self.addCleanup(support.rmtree, self.path)
+
+    def create_file(self, name="file.txt"):
+        filename = os.path.join(self.path, name)
+        with open(filename, "wb") as fp:
+            fp.write(b'python')
+        return filename
+
+    def get_entries(self, names):
+        entries = dict((entry.name, entry)
+                       for entry in os.scandir(self.path))
+        self.assertEqual(sorted(entries.keys()), names)
+        return entries
+
+    def check_entry(self, entry, name, is_dir, is_file, is_symlink):
+        self.assertEqual(entry.name, name)
+        self.assertEqual(entry.path, os.path.join(self.path, name))
+        self.assertEqual(entry.inode(),
+                         os.stat(entry.path, follow_symlinks=False).st_ino)
+
+        entry_stat = os.stat(entry.path)
+        self.assertEqual(entry.is_dir(),
+                         stat.S_ISDIR(entry_stat.st_mode))
+        self.assertEqual(entry.is_file(),
+                         stat.S_ISREG(entry_stat.st_mode))
+        self.assertEqual(entry.is_symlink(),
+                         os.path.islink(entry.path))
+
+        entry_lstat = os.stat(entry.path, follow_symlinks=False)
+        self.assertEqual(entry.is_dir(follow_symlinks=False),
+                         stat.S_ISDIR(entry_lstat.st_mode))
+        self.assertEqual(entry.is_file(follow_symlinks=False),
+                         stat.S_ISREG(entry_lstat.st_mode))
+
+        self.assertEqual(entry.stat(), entry_stat)
+        self.assertEqual(entry.stat(follow_symlinks=False), entry_lstat)
+
+        self.assertEqual(entry.is_dir(), is_dir)
+        self.assertEqual(entry.is_file(), is_file)
+        self.assertEqual(entry.is_symlink(), is_symlink)
+
+    def test_attributes(self):
+        link = hasattr(os, 'link')
+        symlink = support.can_symlink()
+
+        dirname = os.path.join(self.path, "dir")
+        os.mkdir(dirname)
+        filename = self.create_file("file.txt")
+        if link:
+            os.link(filename, os.path.join(self.path, "link_file.txt"))
+        if symlink:
+            os.symlink(dirname, os.path.join(self.path, "symlink_dir"),
+                       target_is_directory=True)
+            os.symlink(filename, os.path.join(self.path, "symlink_file.txt"))
+
+        names = ['dir', 'file.txt']
+        if link:
+            names.append('link_file.txt')
+        if symlink:
+            names.extend(('symlink_dir', 'symlink_file.txt'))
+        entries = self.get_entries(names)
+
+        entry = entries['dir']
+        self.check_entry(entry, 'dir', True, False, False)
+
+        entry = entries['file.txt']
+        self.check_entry(entry, 'file.txt', False, True, False)
+
+        if link:
+            entry = entries['link_file.txt']
+            self.check_entry(entry, 'link_file.txt', False, True, False)
+
+        if symlink:
+            entry = entries['symlink_dir']
+            self.check_entry(entry, 'symlink_dir', True, False, True)
+
+            entry = entries['symlink_file.txt']
+            self.check_entry(entry, 'symlink_file.txt', False, True, True)
+
+    def test_current_directory(self):
+        filename = self.create_file()
+        old_dir = os.getcwd()
+        try:
+            os.chdir(self.path)
+
+            # call scandir() without parameter: it must list the content
+            # of the current directory
+            entries = dict((entry.name, entry) for entry in os.scandir())
+            self.assertEqual(sorted(entries.keys()),
+                             [os.path.basename(filename)])
+            self.assertEqual(entries['file.txt'].path,
+                             os.path.join(os.curdir, 'file.txt'))
+        finally:
+            os.chdir(old_dir)
+
+    def test_repr(self):
+        entry = self.get_entries(['file.txt'] if self.create_file() else [])
+        self.assertEqual(repr(entry['file.txt']), "<DirEntry 'file.txt'>")
+
+    def test_removed_dir(self):
+        path = os.path.join(self.path, 'dir')
+
+        os.mkdir(path)
+        entry = self.get_entries(['dir'])['dir']
+        os.rmdir(path)
+
+        # On POSIX, is_dir() result depends if scandir() filled d_type or not
+        if os.name == 'nt':
+            self.assertTrue(entry.is_dir())
+        self.assertFalse(entry.is_file())
+        self.assertFalse(entry.is_symlink())
+        if os.name == 'nt':
+            self.assertRaises(FileNotFoundError, entry.inode)
+        self.assertRaises(FileNotFoundError, entry.stat)
+        self.assertRaises(FileNotFoundError, entry.stat,
+                          follow_symlinks=False)
+
+    def test_removed_file(self):
+        entry = self.get_entries(['file.txt'] if self.create_file() else [])
+        entry = entry['file.txt']
+        os.unlink(entry.path)
+
+        self.assertFalse(entry.is_dir())
+        # On POSIX, is_file() result depends if scandir() filled d_type or not
+        if os.name == 'nt':
+            self.assertTrue(entry.is_file())
+        self.assertFalse(entry.is_symlink())
+        self.assertRaises(FileNotFoundError, entry.stat)
+        self.assertRaises(FileNotFoundError, entry.stat,
+                          follow_symlinks=False)
+
+    @support.skip_unless_symlink
+    def test_broken_symlink(self):
+        filename = self.create_file("file.txt")
+        os.symlink(filename, os.path.join(self.path, "symlink.txt"))
+        entries = self.get_entries(['file.txt', 'symlink.txt'])
+        entry = entries['symlink.txt']
+        os.unlink(filename)
+
+        self.assertGreater(entry.inode(), 0)
+        self.assertFalse(entry.is_dir())
+        self.assertFalse(entry.is_file())  # broken symlink returns False
+        self.assertFalse(entry.is_dir(follow_symlinks=False))
+        self.assertFalse(entry.is_file(follow_symlinks=False))
+        self.assertTrue(entry.is_symlink())
+        self.assertRaises(FileNotFoundError, entry.stat)
+        # don't fail
+        entry.stat(follow_symlinks=False)
+
+    def test_stat_cached(self):
+        self.create_file("file.txt")
+        entry = self.get_entries(['file.txt'])['file.txt']
+        st = entry.stat()
+        self.assertIs(entry.stat(), st)
+        self.assertIs(entry.stat(follow_symlinks=False), st)
+
+    def test_bytes(self):
+        self.create_file("file.txt")
+
+        path_bytes = os.fsencode(self.path)
+        entries = list(os.scandir(path_bytes))
+        self.assertEqual(len(entries), 1, entries)
+        entry = entries[0]
+
+        self.assertEqual(entry.name, b'file.txt')
+        self.assertEqual(entry.path,
+                         os.fsencode(os.path.join(self.path, 'file.txt')))
+        self.assertTrue(entry.is_file())
+
+    def test_trailing_separator(self):
+        self.create_file("file.txt")
+        entry, = os.scandir(self.path + os.sep)
+        self.assertEqual(entry.path, os.path.join(self.path, 'file.txt'))
+
+    def test_empty_path(self):
+        self.assertRaises(FileNotFoundError, os.scandir, '')
+
+    def test_consume_iterator_twice(self):
+        self.create_file("file.txt")
+        iterator = os.scandir(self.path)
+
+        entries = list(iterator)
+        self.assertEqual(len(entries), 1, entries)
+
+        # check than consuming the iterator twice doesn't raise exception
+        entries2 = list(iterator)
+        self.assertEqual(len(entries2), 0, entries2)
+
+    def test_close(self):
+        self.create_file("file.txt")
+        self.create_file("file2.txt")
+        with os.scandir(self.path) as iterator:
+            next(iterator)
+        self.assertEqual(list(iterator), [])
+        iterator = os.scandir(self.path)
+        iterator.close()
+        iterator.close()
+        self.assertEqual(list(iterator), [])
+
+    def test_bad_path_type(self):
+        for obj in [1234, 1.234, {}, []]:
+            self.assertRaises(TypeError, os.scandir, obj)
+
+    def test_walk_does_not_stat_files(self):
+        os.mkdir(os.path.join(self.path, 'dir'))
+        self.create_file(os.path.join('dir', 'file.txt'))
+        expected = [(self.path, ['dir'], []),
+                    (os.path.join(self.path, 'dir'), [], ['file.txt'])]
+        # The entries yielded by scandir() tell which ones are directories
+        with unittest.mock.patch('os.stat', side_effect=AssertionError), \
+             unittest.mock.patch('os.path.isdir', side_effect=AssertionError):
+            self.assertEqual(list(os.walk(self.path)), expected)
+            self.assertEqual(list(os.walk(self.path, topdown=False)),
+                             expected[::-1])
+
+
 @support.reap_threads
 def test_main():
     support.run_unittest(
@@ -2485,6 +2765,7 @@ def test_main():
         LoginTests,
         LinkTests,
         TestSendfile,
+        CopyFileRangeTests,
         ProgramPriorityTests,
         ExtendedAttributeTests,
         Win32DeprecatedBytesAPI,
@@ -2493,6 +2774,7 @@ def test_main():
         RemoveDirsTests,
         CPUCountTests,
         FDInheritanceTests,
+        TestScandir,
     )
 
 if __name__ == "__main__":
@@ -441,10 +441,45 @@ class KqueueSelectorTestCase(BaseSelectorTestCase, ScalableSelectorMixIn):
     SELECTOR = getattr(selectors, 'KqueueSelector', None)
 
 
+@unittest.skipUnless(hasattr(selectors, 'UringSelector') and
+                     support.can_uring(),
+                     "Test needs selectors.UringSelector")
+class UringSelectorTestCase(BaseSelectorTestCase, ScalableSelectorMixIn):
+
+    SELECTOR = getattr(selectors, 'UringSelector', None)
+
+    def test_unregister_pending(self):
+        # A poll cancelled by unregister() completes later, it must not
+        # be reported nor make select() return early.
+        s = self.SELECTOR()
+        self.addCleanup(s.close)
+
+        rd, wr = self.make_socketpair()
+        s.register(rd, selectors.EVENT_READ)
+        s.unregister(rd)
+        s.register(wr, selectors.EVENT_READ)
+
+        t = time()
+        self.assertEqual(s.select(0.5), [])
+        self.assertGreaterEqual(time() - t, 0.4)
+
+    def test_level_triggered(self):
+        s = self.SELECTOR()
+        self.addCleanup(s.close)
+
+        rd, wr = self.make_socketpair()
+        s.register(rd, selectors.EVENT_READ)
+        wr.send(b'x')
+        for i in range(3):
+            result = s.select(1)
+            self.assertEqual([(key.fileobj, events) for key, events in result],
+                             [(rd, selectors.EVENT_READ)])
+
+
 def test_main():
     tests = [DefaultSelectorTestCase, SelectSelectorTestCase,
              PollSelectorTestCase, EpollSelectorTestCase,
-             KqueueSelectorTestCase]
+             KqueueSelectorTestCase, UringSelectorTestCase]
     support.run_unittest(*tests)
     support.reap_children()
 
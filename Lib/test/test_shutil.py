@@ -1,6 +1,7 @@
 # Copyright (C) 2003 Python Software Foundation
 
 import unittest
+import unittest.mock
 import shutil
 import tempfile
 import sys
@@ -9,6 +10,7 @@ import os
 import os.path
 import errno
 import functools
+import io
 import subprocess
 from test import support
 from test.support import TESTFN
@@ -1313,6 +1315,190 @@ class TestShutil(unittest.TestCase):
         self.assertEqual(['foo'], os.listdir(rv))
 
 
+class TestTreeWorkers(unittest.TestCase):
+    """copytree() and rmtree() with a pool of workers."""
+
+    def setUp(self):
+        self.tmp = tempfile.mkdtemp()
+        self.addCleanup(shutil.rmtree, self.tmp)
+        self.src = os.path.join(self.tmp, 'src')
+
+    def make_tree(self, top):
+        os.mkdir(top)
+        for i in range(3):
+            sub = os.path.join(top, 'dir%d' % i)
+            os.mkdir(sub)
+            os.mkdir(os.path.join(sub, 'empty'))
+            for j in range(20):
+                write_file((sub, 'file%d' % j), 'data %d %d' % (i, j))
+            write_file((sub, 'bad'), 'bad')
+        write_file((top, 'bad'), 'bad')
+        write_file((top, 'top'), 'top')
+
+    def tree_contents(self, top):
+        contents = []
+        for root, dirs, files in os.walk(top):
+            dirs.sort()
+            rel = os.path.relpath(root, top)
+            contents.append((rel, sorted(dirs),
+                             [(name, read_file((root, name)))
+                              for name in sorted(files)]))
+        return contents
+
+    def test_copytree(self):
+        self.make_tree(self.src)
+        # The times of the directories are set after copying their files.
+        os.utime(os.path.join(self.src, 'dir1'), (1e9, 1e9))
+        dst = os.path.join(self.tmp, 'dst')
+        self.assertEqual(shutil.copytree(self.src, dst, workers=4), dst)
+        self.assertEqual(self.tree_contents(dst),
+                         self.tree_contents(self.src))
+        self.assertEqual(os.stat(os.path.join(dst, 'dir1')).st_mtime, 1e9)
+
+    def test_copytree_errors(self):
+        self.make_tree(self.src)
+        def copy_function(src, dst):
+            if os.path.basename(src) == 'bad':
+                raise OSError(errno.EIO, "can't copy", src)
+            return shutil.copy2(src, dst)
+        errors = []
+        for workers in (None, 1, 3):
+            dst = os.path.join(self.tmp, 'dst%s' % workers)
+            with self.assertRaises(shutil.Error) as cm:
+                shutil.copytree(self.src, dst, copy_function=copy_function,
+                                workers=workers)
+            errors.append([(os.path.relpath(src, self.src),
+                            os.path.relpath(dst_, dst), why)
+                           for src, dst_, why in cm.exception.args[0]])
+            # Everything else was copied.
+            os.remove(os.path.join(self.src, 'bad'))
+            for i in range(3):
+                os.remove(os.path.join(self.src, 'dir%d' % i, 'bad'))
+            self.assertEqual(self.tree_contents(dst),
+                             self.tree_contents(self.src))
+            shutil.rmtree(self.src)
+            self.make_tree(self.src)
+        self.assertEqual(len(errors[0]), 4)
+        # The errors are reported in the same order.
+        self.assertEqual(errors[1], errors[0])
+        self.assertEqual(errors[2], errors[0])
+
+    def test_copytree_unlistable_subdir(self):
+        self.make_tree(self.src)
+        real_listdir = os.listdir
+        def listdir(path):
+            if os.path.basename(path) == 'dir0':
+                raise PermissionError(errno.EACCES, "can't list", path)
+            # The copy of 'bad' is queued before dir0 is listed.
+            return sorted(real_listdir(path))
+        def copy_function(src, dst):
+            if os.path.basename(src) == 'bad':
+                raise OSError(errno.EIO, "can't copy", src)
+            return shutil.copy2(src, dst)
+        errors = []
+        for workers in (None, 1, 3):
+            dst = os.path.join(self.tmp, 'dst%s' % workers)
+            with unittest.mock.patch('os.listdir', listdir), \
+                 self.assertRaises(shutil.Error) as cm:
+                shutil.copytree(self.src, dst, copy_function=copy_function,
+                                workers=workers)
+            errors.append([(os.path.relpath(src, self.src),
+                            os.path.relpath(dst_, dst))
+                           for src, dst_, why in cm.exception.args[0]])
+        self.assertEqual(errors[0], [('bad', 'bad'),
+                                     ('dir0', 'dir0'),
+                                     ('dir1/bad', 'dir1/bad'),
+                                     ('dir2/bad', 'dir2/bad')])
+        self.assertEqual(errors[1], errors[0])
+        self.assertEqual(errors[2], errors[0])
+
+    def test_rmtree(self):
+        self.make_tree(self.src)
+        shutil.rmtree(self.src, workers=4)
+        self.assertFalse(os.path.exists(self.src))
+
+    def test_rmtree_unsafe(self):
+        self.make_tree(self.src)
+        with unittest.mock.patch('shutil._use_fd_functions', False):
+            shutil.rmtree(self.src, workers=4)
+        self.assertFalse(os.path.exists(self.src))
+
+    def rmtree_failing_unlink(self, **kwargs):
+        real_unlink = os.unlink
+        def unlink(path, **kwargs):
+            if os.path.basename(path) == 'bad':
+                raise PermissionError(errno.EACCES, "can't remove", path)
+            return real_unlink(path, **kwargs)
+        with unittest.mock.patch('os.unlink', side_effect=unlink):
+            shutil.rmtree(self.src, **kwargs)
+
+    def test_rmtree_onerror(self):
+        calls = []
+        for workers in (None, 3):
+            self.make_tree(self.src)
+            errors = []
+            def onerror(func, path, exc_info):
+                self.assertIs(exc_info[0], PermissionError
+                              if func is os.unlink else OSError)
+                # os.unlink is mocked
+                errors.append(('unlink' if func is os.unlink
+                               else func.__name__, path))
+            self.rmtree_failing_unlink(onerror=onerror, workers=workers)
+            calls.append(errors)
+            self.assertEqual(self.tree_contents(self.src),
+                             [('.', ['dir0', 'dir1', 'dir2'], [('bad', 'bad')]),
+                              ('dir0', [], [('bad', 'bad')]),
+                              ('dir1', [], [('bad', 'bad')]),
+                              ('dir2', [], [('bad', 'bad')])])
+            shutil.rmtree(self.src)
+        self.assertEqual(len(calls[0]), 8)
+        self.assertEqual(calls[1], calls[0])
+
+    @unittest.skipUnless(shutil._use_fd_functions, "requires fd functions")
+    def test_rmtree_onerror_returns_in_subdir(self):
+        # An error handled by onerror in a subdirectory doesn't drop the
+        # removals still pending in its parent.
+        calls = []
+        for workers in (None, 1):
+            os.mkdir(self.src)
+            for i in range(20):
+                write_file((self.src, 'f%02d' % i), 'data')
+                if i % 7 == 3:
+                    os.mkdir(os.path.join(self.src, 'd%02d' % i))
+            errors = []
+            def onerror(func, path, exc_info):
+                errors.append((func.__name__, os.path.basename(path)))
+            # The subdirectories look replaced after their stat() call.
+            checks = [True]
+            def samestat(s1, s2):
+                return checks.pop() if checks else False
+            with unittest.mock.patch('os.path.samestat', samestat):
+                shutil.rmtree(self.src, onerror=onerror, workers=workers)
+            calls.append(errors)
+            self.assertEqual(sorted(os.listdir(self.src)),
+                             ['d03', 'd10', 'd17'])
+            shutil.rmtree(self.src)
+        self.assertEqual(sorted(calls[0]),
+                         [('islink', 'd03'), ('islink', 'd10'),
+                          ('islink', 'd17'), ('rmdir', 'src')])
+        self.assertEqual(calls[1], calls[0])
+
+    def test_rmtree_onerror_raises(self):
+        self.make_tree(self.src)
+        with self.assertRaises(PermissionError):
+            self.rmtree_failing_unlink(workers=3)
+        self.assertTrue(os.path.exists(self.src))
+
+    def test_invalid_workers(self):
+        self.make_tree(self.src)
+        dst = os.path.join(self.tmp, 'dst')
+        self.assertRaises(ValueError, shutil.copytree, self.src, dst,
+                          workers=0)
+        self.assertFalse(os.path.exists(dst))
+        self.assertRaises(ValueError, shutil.rmtree, self.src, workers=-1)
+        self.assertTrue(os.path.exists(self.src))
+
+
 class TestWhich(unittest.TestCase):
 
     def setUp(self):
@@ -1698,6 +1884,175 @@ class TestCopyFile(unittest.TestCase):
         finally:
             os.rmdir(dst_dir)
 
+class _ZeroCopyFileTest(object):
+    """Tests common to the kernel copy functions used by copyfile()."""
+    FILESIZE = (10 * 1024 * 1024)  # 10 MiB
+    FILEDATA = b""
+    copy_func_name = None
+
+    @classmethod
+    def setUpClass(cls):
+        if not getattr(shutil, '_USE_CP_' + cls.copy_func_name.upper()):
+            raise unittest.SkipTest('os.%s() is not used by shutil' %
+                                    cls.copy_func_name)
+        write_data = b''.join(bytes([i]) * 1024 for i in range(256))
+        with open(TESTFN, 'wb') as f:
+            while f.tell() < cls.FILESIZE:
+                f.write(write_data)
+        with open(TESTFN, 'rb') as f:
+            cls.FILEDATA = f.read()
+
+    @classmethod
+    def tearDownClass(cls):
+        support.unlink(TESTFN)
+
+    def tearDown(self):
+        support.unlink(TESTFN2)
+
+    def get_copy_func(self):
+        return getattr(shutil, '_' + self.copy_func_name)
+
+    def mock_os_func(self, **kwargs):
+        return unittest.mock.patch('os.' + self.copy_func_name, **kwargs)
+
+    def fastcopy(self, src, dst):
+        with open(src, 'rb') as fsrc, open(dst, 'wb') as fdst:
+            shutil._fastcopy_kernel(fsrc, fdst, self.get_copy_func())
+
+    def test_regular_copy(self):
+        self.fastcopy(TESTFN, TESTFN2)
+        with open(TESTFN2, 'rb') as f:
+            self.assertEqual(f.read(), self.FILEDATA)
+
+    def test_copyfile(self):
+        # copyfile(), and copy(), copy2() and move() through it, use the
+        # kernel copy function.
+        with self.mock_os_func(wraps=getattr(os, self.copy_func_name)) as m:
+            shutil.copyfile(TESTFN, TESTFN2)
+        self.assertTrue(m.called)
+        with open(TESTFN2, 'rb') as f:
+            self.assertEqual(f.read(), self.FILEDATA)
+
+    def test_empty_file(self):
+        srcname = TESTFN + 'src'
+        dstname = TESTFN + 'dst'
+        self.addCleanup(lambda: support.unlink(srcname))
+        self.addCleanup(lambda: support.unlink(dstname))
+        with open(srcname, "wb"):
+            pass
+        # An empty file can't be told from a /proc file.
+        self.assertRaises(shutil._GiveupOnFastCopy,
+                          self.fastcopy, srcname, dstname)
+        shutil.copyfile(srcname, dstname)
+        with open(dstname, "rb") as f:
+            self.assertEqual(f.read(), b"")
+
+    def test_non_regular_file(self):
+        with io.BytesIO(self.FILEDATA) as src:
+            with open(TESTFN2, 'wb') as dst:
+                self.assertRaises(shutil._GiveupOnFastCopy,
+                                  shutil._fastcopy_kernel, src, dst,
+                                  self.get_copy_func())
+
+    def test_unsupported_falls_back(self):
+        # The kernel or the filesystems don't support the copy before
+        # anything was copied: give up, and let copyfile() use read().
+        for errnum in (errno.ENOSYS, errno.EXDEV, errno.EINVAL):
+            with self.subTest(errno=errnum):
+                with self.mock_os_func(side_effect=OSError(errnum, "")):
+                    self.assertRaises(shutil._GiveupOnFastCopy,
+                                      self.fastcopy, TESTFN, TESTFN2)
+                    shutil.copyfile(TESTFN, TESTFN2)
+                with open(TESTFN2, 'rb') as f:
+                    self.assertEqual(f.read(), self.FILEDATA)
+
+    def test_proc_file_falls_back(self):
+        # The kernel copies nothing from files in /proc.
+        with self.mock_os_func(return_value=0) as m:
+            shutil.copyfile(TESTFN, TESTFN2)
+        self.assertEqual(m.call_count, 1)
+        with open(TESTFN2, 'rb') as f:
+            self.assertEqual(f.read(), self.FILEDATA)
+
+    def test_filesystem_full(self):
+        # Don't retry with read()/write() when the filesystem is full.
+        with self.mock_os_func(side_effect=OSError(errno.ENOSPC, "")):
+            with self.assertRaises(OSError) as cm:
+                shutil.copyfile(TESTFN, TESTFN2)
+        self.assertEqual(cm.exception.errno, errno.ENOSPC)
+        self.assertEqual(cm.exception.filename, TESTFN)
+        self.assertEqual(cm.exception.filename2, TESTFN2)
+
+    def test_exception_after_partial_copy(self):
+        # An error after some data was copied is reported.
+        calls = []
+        os_func = getattr(os, self.copy_func_name)
+        def side_effect(*args):
+            if calls:
+                raise OSError(errno.EIO, "")
+            calls.append(args)
+            # Copy a part of the file only.
+            return os_func(*args[:-1] + (1024,))
+        with self.mock_os_func(side_effect=side_effect):
+            with self.assertRaises(OSError) as cm:
+                self.fastcopy(TESTFN, TESTFN2)
+        self.assertEqual(cm.exception.errno, errno.EIO)
+
+
+class TestZeroCopyCopyFileRange(_ZeroCopyFileTest, unittest.TestCase):
+    copy_func_name = 'copy_file_range'
+
+    @unittest.skipUnless(shutil._USE_CP_SENDFILE,
+                         'os.sendfile() is not used by shutil')
+    def test_falls_back_on_sendfile(self):
+        # Use sendfile() when copy_file_range() isn't supported.
+        with self.mock_os_func(side_effect=OSError(errno.EXDEV, "")), \
+             unittest.mock.patch('os.sendfile', wraps=os.sendfile) as m:
+            shutil.copyfile(TESTFN, TESTFN2)
+        self.assertTrue(m.called)
+        with open(TESTFN2, 'rb') as f:
+            self.assertEqual(f.read(), self.FILEDATA)
+
+
+class TestZeroCopySendfile(_ZeroCopyFileTest, unittest.TestCase):
+    copy_func_name = 'sendfile'
+
+    def setUp(self):
+        # copyfile() tries copy_file_range() first.
+        patcher = unittest.mock.patch('shutil._USE_CP_COPY_FILE_RANGE', False)
+        patcher.start()
+        self.addCleanup(patcher.stop)
+
+
+class TestCopyFileObjReadinto(unittest.TestCase):
+
+    def test_copyfileobj_readinto(self):
+        data = bytes(range(256)) * 4000
+        for length in (1, 1000, len(data), len(data) + 1,
+                       shutil.COPY_BUFSIZE):
+            with self.subTest(length=length):
+                src = io.BytesIO(data)
+                dst = io.BytesIO()
+                shutil._copyfileobj_readinto(src, dst, length)
+                self.assertEqual(dst.getvalue(), data)
+
+    def test_copyfile_without_kernel_copy(self):
+        data = bytes(range(256)) * 1000
+        self.addCleanup(support.unlink, TESTFN)
+        self.addCleanup(support.unlink, TESTFN2)
+        with open(TESTFN, 'wb') as f:
+            f.write(data)
+        with unittest.mock.patch('shutil._USE_CP_COPY_FILE_RANGE', False), \
+             unittest.mock.patch('shutil._USE_CP_SENDFILE', False), \
+             unittest.mock.patch('shutil._copyfileobj_readinto',
+                                 wraps=shutil._copyfileobj_readinto) as m:
+            shutil.copyfile(TESTFN, TESTFN2)
+        # The buffer is no larger than the file.
+        self.assertEqual(m.call_args[0][2], len(data))
+        with open(TESTFN2, 'rb') as f:
+            self.assertEqual(f.read(), data)
+
+
 class TermsizeTests(unittest.TestCase):
     def test_does_not_crash(self):
         """Check if get_terminal_size() returns a meaningful value.
@@ -4508,6 +4508,165 @@ class UDPTimeoutTest(SocketUDPTest):
         if not ok:
             self.fail("recv() returned success when we did not expect it")
 
+@requireAttrs(socket.socket, "sendmmsg", "recvmmsg_into")
+class MultipleMessagesUDPTest(SocketUDPTest):
+    # Tests for sendmmsg() and recvmmsg_into().
+
+    def setUp(self):
+        super().setUp()
+        self.serv.settimeout(10.0)
+        self.cli = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.addCleanup(self.cli.close)
+        self.cli.connect((HOST, self.port))
+
+    def testSendAndReceive(self):
+        msgs = [b"first", b"second message", b"", b"x" * 1000]
+        self.assertEqual(self.cli.sendmmsg(msgs), len(msgs))
+        bufs = [bytearray(1024) for i in range(6)]
+        results = []
+        while len(results) < len(msgs):
+            results += self.serv.recvmmsg_into(bufs[len(results):])
+        self.assertEqual(len(results), len(msgs))
+        for buf, msg, (nbytes, flags, address) in zip(bufs, msgs, results):
+            self.assertEqual(nbytes, len(msg))
+            self.assertEqual(bytes(buf[:nbytes]), msg)
+            self.assertEqual(flags, 0)
+            self.assertEqual(address, self.cli.getsockname())
+
+    def testSendToAddress(self):
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+            self.assertEqual(sock.sendmmsg([b"a", b"b"], 0, (HOST, self.port)),
+                             2)
+        bufs = [bytearray(10), bytearray(10)]
+        results = self.serv.recvmmsg_into(bufs)
+        if len(results) < 2:
+            results += self.serv.recvmmsg_into(bufs[1:])
+        self.assertEqual([bytes(buf[:nbytes]) for buf, (nbytes, flags, address)
+                          in zip(bufs, results)], [b"a", b"b"])
+
+    def testReturnAfterOneMessage(self):
+        # Don't wait for all the buffers to be filled.
+        self.cli.send(b"single")
+        bufs = [bytearray(10) for i in range(4)]
+        results = self.serv.recvmmsg_into(bufs)
+        self.assertEqual(len(results), 1)
+        self.assertEqual(results[0][0], 6)
+        self.assertEqual(bufs[0][:6], b"single")
+
+    def testTruncated(self):
+        self.cli.send(b"0123456789")
+        buf = bytearray(4)
+        [(nbytes, flags, address)] = self.serv.recvmmsg_into([buf])
+        self.assertEqual(nbytes, 4)
+        self.assertEqual(buf, b"0123")
+        self.assertTrue(flags & socket.MSG_TRUNC)
+
+    def testMemoryviewBuffers(self):
+        self.cli.sendmmsg([memoryview(b"abcdef")[2:], bytearray(b"gh")])
+        storage = bytearray(20)
+        view = memoryview(storage)
+        bufs = [view[:10], view[10:]]
+        results = self.serv.recvmmsg_into(bufs)
+        if len(results) < 2:
+            results += self.serv.recvmmsg_into(bufs[1:])
+        self.assertEqual(storage[:4], b"cdef")
+        self.assertEqual(storage[10:12], b"gh")
+
+    def testTimeout(self):
+        self.serv.settimeout(0.1)
+        self.assertRaises(socket.timeout, self.serv.recvmmsg_into,
+                          [bytearray(10)])
+
+    def testNonBlocking(self):
+        self.serv.setblocking(False)
+        self.assertRaises(BlockingIOError, self.serv.recvmmsg_into,
+                          [bytearray(10)])
+
+    def testEmpty(self):
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+        self.assertEqual(self.cli.sendmmsg([]), 0)
+
+    def testBadArguments(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b"read-only"])
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, 42)
+        self.assertRaises(TypeError, self.cli.sendmmsg, ["str"])
+        self.assertRaises(TypeError, self.cli.sendmmsg, [b"a"], "flags")
+
+
+@requireAttrs(socket, "MSG_ZEROCOPY", "SO_ZEROCOPY")
+@requireAttrs(socket.socket, "recv_zerocopy_completions")
+class ZeroCopySendTest(SocketUDPTest):
+
+    def setUp(self):
+        super().setUp()
+        self.cli = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+        self.addCleanup(self.cli.close)
+        try:
+            self.cli.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+        except OSError as err:
+            self.skipTest("SO_ZEROCOPY not supported: %s" % err)
+        self.cli.connect((HOST, self.port))
+
+    def get_completions(self, count):
+        completed = set()
+        deadline = time.time() + 10.0
+        while len(completed) < count and time.time() < deadline:
+            for first, last, copied in self.cli.recv_zerocopy_completions():
+                # Loopback sends are always copied.
+                self.assertTrue(copied)
+                completed.update(range(first, last + 1))
+            time.sleep(0.01)
+        return completed
+
+    def testCompletions(self):
+        self.assertEqual(self.cli.recv_zerocopy_completions(), [])
+        data = b"x" * 10000
+        for i in range(3):
+            try:
+                self.cli.send(data, socket.MSG_ZEROCOPY)
+            except OSError as err:
+                # ENOBUFS when going over the optmem limit
+                self.skipTest("MSG_ZEROCOPY send failed: %s" % err)
+        self.cli.sendmmsg([data, data], socket.MSG_ZEROCOPY)
+        self.assertEqual(self.get_completions(5), set(range(5)))
+        for i in range(5):
+            self.assertEqual(self.serv.recv(20000), data)
+
+    @requireAttrs(socket, "IP_RECVERR")
+    def testOtherErrors(self):
+        # Errors which aren't zero-copy notifications are raised, not
+        # dropped.
+        data = b"x" * 100
+        try:
+            self.cli.send(data, socket.MSG_ZEROCOPY)
+        except OSError as err:
+            self.skipTest("MSG_ZEROCOPY send failed: %s" % err)
+        self.assertEqual(self.get_completions(1), {0})
+        self.cli.setsockopt(socket.IPPROTO_IP, socket.IP_RECVERR, 1)
+        self.serv.close()
+        # An ICMP port unreachable error is queued.
+        self.cli.send(data)
+        deadline = time.time() + 10.0
+        while time.time() < deadline:
+            try:
+                completions = self.cli.recv_zerocopy_completions()
+            except ConnectionRefusedError as exc:
+                self.assertEqual(exc.completions, [])
+                break
+            self.assertEqual(completions, [])
+            time.sleep(0.01)
+        else:
+            self.fail("the ICMP error wasn't reported")
+        self.assertEqual(self.cli.recv_zerocopy_completions(), [])
+
+    def testNeverBlocks(self):
+        # Reading the error queue doesn't wait for the socket to be readable.
+        self.cli.settimeout(10.0)
+        start = time.monotonic()
+        self.assertEqual(self.cli.recv_zerocopy_completions(), [])
+        self.assertLess(time.monotonic() - start, 5.0)
+
+
 class TestExceptions(unittest.TestCase):
 
     def testExceptionTree(self):
@@ -5033,7 +5192,8 @@ class TestSocketSharing(SocketTCPTest):
 
 def test_main():
     tests = [GeneralModuleTests, BasicTCPTest, TCPCloserTest, TCPTimeoutTest,
-             TestExceptions, BufferIOTest, BasicTCPTest2, BasicUDPTest, UDPTimeoutTest ]
+             TestExceptions, BufferIOTest, BasicTCPTest2, BasicUDPTest, UDPTimeoutTest,
+             MultipleMessagesUDPTest, ZeroCopySendTest ]
 
     tests.extend([
         NonBlockingTCPTests,
@@ -8,6 +8,7 @@ import operator
 import codecs
 import gc
 import sysconfig
+import time
 import platform
 
 # count the number of test runs, used to create unique
@@ -209,6 +210,73 @@ class SysModuleTest(unittest.TestCase):
         finally:
             sys.setswitchinterval(orig)
 
+    @test.support.cpython_only
+    def test_switchpriority(self):
+        self.assertRaises(TypeError, sys._setswitchpriority)
+        self.assertRaises(TypeError, sys._setswitchpriority, "a")
+        self.assertRaises(ValueError, sys._setswitchpriority, -1.0)
+        orig = sys._getswitchpriority()
+        self.assertEqual(orig, 0.0)
+        try:
+            for n in 0.0001, 0.05, 0.0:
+                sys._setswitchpriority(n)
+                self.assertAlmostEqual(sys._getswitchpriority(), n)
+        finally:
+            sys._setswitchpriority(orig)
+
+    @test.support.cpython_only
+    @unittest.skipUnless(threading, 'Threading required for this test.')
+    def test_getgilstats(self):
+        def check(stats):
+            self.assertIsInstance(stats, dict)
+            for key in ('acquisitions', 'contended', 'priority_acquisitions',
+                        'switches', 'drop_requests', 'forced_drops'):
+                self.assertIsInstance(stats[key], int)
+                self.assertGreaterEqual(stats[key], 0)
+            self.assertLessEqual(stats['contended'], stats['acquisitions'])
+            self.assertLessEqual(stats['priority_acquisitions'],
+                                 stats['contended'])
+            self.assertLessEqual(stats['wait_max'], stats['wait_total'])
+            histogram = stats['wait_histogram']
+            bounds = [bound for bound, count in histogram]
+            self.assertEqual(bounds, sorted(bounds))
+            self.assertEqual(bounds[-1], float('inf'))
+            # threads waiting right now are not in the histogram yet
+            self.assertLessEqual(sum(count for bound, count in histogram),
+                                 stats['contended'])
+            return stats
+
+        def worker(lock):
+            for i in range(1000):
+                with lock:
+                    pass
+                time.sleep(0)
+
+        orig = sys._getswitchpriority()
+        before = check(sys._getgilstats())
+        lock = threading.Lock()
+        threads = [threading.Thread(target=worker, args=(lock,))
+                   for i in range(3)]
+        sys._setswitchpriority(0.0001)
+        try:
+            for t in threads:
+                t.start()
+            for t in threads:
+                t.join()
+        finally:
+            sys._setswitchpriority(orig)
+        after = check(sys._getgilstats())
+        for key in ('acquisitions', 'contended', 'priority_acquisitions',
+                    'switches', 'drop_requests', 'forced_drops'):
+            self.assertGreaterEqual(after[key], before[key])
+        self.assertGreater(after['acquisitions'], before['acquisitions'])
+        self.assertGreater(after['switches'], before['switches'])
+        self.assertGreaterEqual(after['wait_total'], before['wait_total'])
+        me = after['threads'][threading.get_ident()]
+        hold_time, acquisitions = me
+        self.assertGreater(hold_time, 0.0)
+        self.assertGreater(acquisitions, 0)
+
     def test_recursionlimit(self):
         self.assertRaises(TypeError, sys.getrecursionlimit, 42)
         oldlimit = sys.getrecursionlimit()
@@ -694,6 +762,158 @@ class SysModuleTest(unittest.TestCase):
         c = sys.getallocatedblocks()
         self.assertIn(c, range(b - 50, b + 50))
 
+    @unittest.skipUnless(hasattr(sys, "_getmallocstats"),
+                         "sys._getmallocstats unavailable on this build")
+    def test_getmallocstats(self):
+        stats = sys._getmallocstats()
+        self.assertEqual(stats['arena_size'] % stats['pool_size'], 0)
+        self.assertGreater(stats['arenas_allocated_current'], 0)
+        self.assertEqual(stats['arenas_reclaimed'],
+                         stats['arenas_allocated_total'] -
+                         stats['arenas_allocated_current'])
+        self.assertGreaterEqual(stats['arenas_highwater'],
+                                stats['arenas_allocated_current'])
+        classes = stats['size_classes']
+        self.assertEqual([c['size'] for c in classes],
+                         [8 * (i + 1) for i in range(len(classes))])
+        self.assertEqual(sum(c['blocks'] * c['size'] for c in classes),
+                         stats['allocated_bytes'])
+        self.assertEqual(sum(c['free_blocks'] * c['size'] for c in classes),
+                         stats['available_bytes'])
+        # Everything in the arenas is accounted for.
+        total = (stats['allocated_bytes'] + stats['available_bytes'] +
+                 stats['free_pools'] * stats['pool_size'] +
+                 stats['pool_header_bytes'] + stats['quantization_bytes'] +
+                 stats['arena_alignment_bytes'])
+        self.assertEqual(total,
+                         stats['arenas_allocated_current'] *
+                         stats['arena_size'])
+
+    @unittest.skipUnless(hasattr(sys, "_getmallocstats"),
+                         "sys._getmallocstats unavailable on this build")
+    def test_malloc_arena_size(self):
+        from test.script_helper import assert_python_ok, assert_python_failure
+        code = 'import sys; print(sys._getmallocstats()["arena_size"])'
+        rc, out, err = assert_python_ok('-c', code,
+                                        PYTHONMALLOCARENASIZE='1M')
+        self.assertEqual(int(out), 1 << 20)
+        rc, out, err = assert_python_ok('-c', code,
+                                        PYTHONMALLOCARENASIZE='524288')
+        self.assertEqual(int(out), 1 << 19)
+        for value in ('3M', '64K', '1G', '1MB', 'x'):
+            rc, out, err = assert_python_failure(
+                '-c', 'pass', PYTHONMALLOCARENASIZE=value)
+            self.assertIn(b'PYTHONMALLOCARENASIZE', err)
+
+    @unittest.skipUnless(hasattr(sys, "_getmallocstats"),
+                         "sys._getmallocstats unavailable on this build")
+    def test_malloc_hugepages(self):
+        from test.script_helper import assert_python_ok
+        code = ('import sys; s = sys._getmallocstats(); '
+                'print(s["hugepages"], s["arena_size"])')
+        rc, out, err = assert_python_ok('-c', code, PYTHONMALLOCHUGEPAGES='1')
+        hugepages, arena_size = out.split()
+        if hugepages == b'True':
+            self.assertEqual(int(arena_size), 2 << 20)
+        else:
+            # Huge pages are not supported on this platform.
+            self.assertEqual(hugepages, b'False')
+        # An explicit arena size wins over the huge page size.
+        rc, out, err = assert_python_ok('-c', code, PYTHONMALLOCHUGEPAGES='1',
+                                        PYTHONMALLOCARENASIZE='4M')
+        self.assertEqual(int(out.split()[1]), 4 << 20)
+
+    @unittest.skipUnless(hasattr(sys, "_getmallocstats"),
+                         "sys._getmallocstats unavailable on this build")
+    def test_malloc_purge(self):
+        from test.script_helper import assert_python_ok
+        code = textwrap.dedent('''
+            import sys
+            # Fill many arenas, then keep one object in each of them alive.
+            objs = [(i,) for i in range(200000)]
+            keep = objs[::500]
+            before = sys._getmallocstats()
+            del objs
+            after = sys._getmallocstats()
+            print(before['purge'], after['purge'],
+                  after['purged_bytes_total'] - before['purged_bytes_total'],
+                  after['purged_pools'] * after['pool_size'],
+                  after['arenas_allocated_current'] * after['arena_size'],
+                  after['pool_size'])
+            # Purged pools are reused.
+            objs = [(i,) for i in range(200000)]
+            print(sys._getmallocstats()['purged_pools'])
+            ''')
+        rc, out, err = assert_python_ok('-c', code)
+        self.assertEqual(out.split()[:3], [b'False', b'False', b'0'])
+        pool_size = sys._getmallocstats()['pool_size']
+        try:
+            sys._setmallocpurge(True)
+        except NotImplementedError:
+            # Pools must span whole pages for madvise().
+            if hasattr(os, 'sysconf'):
+                self.assertGreater(os.sysconf('SC_PAGESIZE'), pool_size)
+            self.skipTest("purging is not supported on this platform")
+        sys._setmallocpurge(False)
+        self.assertLessEqual(os.sysconf('SC_PAGESIZE'), pool_size)
+        rc, out, err = assert_python_ok('-c', code, PYTHONMALLOCPURGE='1')
+        (purge, purge2, purged, purged_current, arena_bytes, child_pool_size,
+         reused) = out.split()
+        self.assertEqual((purge, purge2), (b'True', b'True'))
+        self.assertEqual(int(child_pool_size), pool_size)
+        self.assertGreater(int(purged), 0)
+        # Most of the arenas' memory has been given back.
+        self.assertGreater(int(purged_current), int(arena_bytes) // 2)
+        self.assertLess(int(reused), int(purged_current) // pool_size)
+
+    @unittest.skipUnless(hasattr(sys, "_setmallocpurge"),
+                         "sys._setmallocpurge unavailable on this build")
+    def test_setmallocpurge(self):
+        self.assertFalse(sys._getmallocstats()['purge'])
+        try:
+            sys._setmallocpurge(True)
+        except NotImplementedError:
+            self.skipTest("purging is not supported on this platform")
+        try:
+            self.assertTrue(sys._getmallocstats()['purge'])
+        finally:
+            sys._setmallocpurge(False)
+        self.assertFalse(sys._getmallocstats()['purge'])
+
+    @unittest.skipUnless(hasattr(sys, '_immortalize'),
+                         'requires a Py_IMMORTAL_OBJECTS build')
+    def test_immortalize(self):
+        from test.script_helper import assert_python_ok
+        # Immortal objects stay so until the end, use a child process
+        code = """if 1:
+            import gc, sys, weakref
+            class A:
+                def f(self):
+                    return ("constant", 123456, (b"nested", 1.5))
+            def immortal(obj):
+                return sys.getrefcount(obj) >= sys.maxsize // 4
+            assert not immortal(A)
+            assert sys._immortalize() > 1000
+            code = A.f.__code__
+            objects = [None, True, 5, -3, "f", "", A, int, type, object,
+                       code, code.co_consts, A().f(), A().f()[2][0]]
+            for obj in objects:
+                assert immortal(obj), obj
+            counts = [sys.getrefcount(obj) for obj in objects]
+            keep = [objects * 10, dict.fromkeys(range(100))]
+            assert [sys.getrefcount(obj) for obj in objects] == counts
+            del keep
+            assert [sys.getrefcount(obj) for obj in objects] == counts
+            # New objects are mortal
+            x = object()
+            assert sys.getrefcount(x) == 2
+            wr = weakref.ref(A)
+            del A, objects
+            gc.collect()
+            assert wr() is not None
+            """
+        assert_python_ok('-c', code)
+
 
 class SizeofTest(unittest.TestCase):
 
@@ -750,13 +970,13 @@ class SizeofTest(unittest.TestCase):
             return inner
         check(get_cell().__closure__[0], size('P'))
         # code
-        check(get_cell().__code__, size('5i9Pi3P'))
-        check(get_cell.__code__, size('5i9Pi3P'))
+        check(get_cell().__code__, size('5i9Pi5PiB'))
+        check(get_cell.__code__, size('5i9Pi5PiB'))
         def get_cell2(x):
             def inner():
                 return x
             return inner
-        check(get_cell2.__code__, size('5i9Pi3P') + 1)
+        check(get_cell2.__code__, size('5i9Pi5PiB') + 1)
         # complex
         check(complex(0,1), size('2d'))
         # method_descriptor (descriptor object)
@@ -774,9 +994,9 @@ class SizeofTest(unittest.TestCase):
         # method-wrapper (descriptor object)
         check({}.__iter__, size('2P'))
         # dict
-        check({}, size('n2P' + '2nPn' + 8*'n2P'))
+        check({}, size('nQ2P' + '2nPn' + 8*'n2P'))
         longdict = {1:1, 2:2, 3:3, 4:4, 5:5, 6:6, 7:7, 8:8}
-        check(longdict, size('n2P' + '2nPn') + 16*struct.calcsize('n2P'))
+        check(longdict, size('nQ2P' + '2nPn') + 16*struct.calcsize('n2P'))
         # dictionary-keyiterator
         check({}.keys(), size('P'))
         # dictionary-valueiterator
@@ -929,7 +1149,7 @@ class SizeofTest(unittest.TestCase):
         class newstyleclass(object): pass
         check(newstyleclass, s)
         # dict with shared keys
-        check(newstyleclass().__dict__, size('n2P' + '2nPn'))
+        check(newstyleclass().__dict__, size('nQ2P' + '2nPn'))
         # unicode
         # each tuple contains a string and its expected character size
         # don't put any static strings here, as they may contain
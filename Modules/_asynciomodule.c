@@ -0,0 +1,1705 @@
+/* C implementation of asyncio.Future and asyncio.Task */
+
+#include "Python.h"
+#include "structmember.h"
+
+
+_Py_IDENTIFIER(add);
+_Py_IDENTIFIER(call_soon);
+_Py_IDENTIFIER(cancel);
+_Py_IDENTIFIER(send);
+_Py_IDENTIFIER(throw);
+_Py_IDENTIFIER(_step);
+_Py_IDENTIFIER(_wakeup);
+_Py_IDENTIFIER(activate);
+_Py_IDENTIFIER(clear);
+_Py_IDENTIFIER(done);
+_Py_IDENTIFIER(cancelled);
+_Py_IDENTIFIER(exception);
+_Py_IDENTIFIER(result);
+_Py_IDENTIFIER(set_result);
+_Py_IDENTIFIER(set_exception);
+_Py_IDENTIFIER(add_done_callback);
+_Py_IDENTIFIER(_blocking);
+_Py_IDENTIFIER(_loop);
+_Py_IDENTIFIER(get_event_loop);
+
+
+/* State imported from the asyncio package.  The asyncio modules import
+   _asyncio themselves, so this is filled in on first use rather than when
+   _asyncio is imported. */
+static int module_initialized = 0;
+static PyObject *asyncio_events = NULL;        /* asyncio.events module */
+static PyObject *asyncio_InvalidStateError = NULL;
+static PyObject *asyncio_CancelledError = NULL;
+static PyObject *traceback_logger = NULL;      /* futures._TracebackLogger */
+static PyObject *py_future_type = NULL;        /* futures._PyFuture */
+static PyObject *future_repr_func = NULL;      /* futures._future_repr */
+static PyObject *iscoroutine_func = NULL;      /* tasks.iscoroutine */
+static PyObject *task_repr_func = NULL;        /* tasks._task_repr */
+static PyObject *task_get_stack_func = NULL;   /* tasks._task_get_stack */
+static PyObject *task_print_stack_func = NULL; /* tasks._task_print_stack */
+static PyObject *all_tasks = NULL;             /* tasks._all_tasks */
+static PyObject *current_tasks = NULL;         /* tasks._current_tasks */
+
+/* Values of the _state attribute, equal to futures._PENDING & co. */
+static PyObject *state_names[3] = {NULL, NULL, NULL};
+
+static int
+module_init(void)
+{
+    PyObject *module;
+
+    if (module_initialized)
+        return 0;
+
+#define GET_MOD_ATTR(var, name)                         \
+    do {                                                \
+        Py_XDECREF(var);                                \
+        var = PyObject_GetAttrString(module, name);     \
+        if (var == NULL)                                \
+            goto fail;                                  \
+    } while (0)
+
+    module = PyImport_ImportModule("asyncio.events");
+    if (module == NULL)
+        return -1;
+    Py_XDECREF(asyncio_events);
+    asyncio_events = module;
+
+    module = PyImport_ImportModule("asyncio.futures");
+    if (module == NULL)
+        return -1;
+    GET_MOD_ATTR(asyncio_InvalidStateError, "InvalidStateError");
+    GET_MOD_ATTR(asyncio_CancelledError, "CancelledError");
+    GET_MOD_ATTR(traceback_logger, "_TracebackLogger");
+    GET_MOD_ATTR(py_future_type, "_PyFuture");
+    GET_MOD_ATTR(future_repr_func, "_future_repr");
+    Py_DECREF(module);
+
+    module = PyImport_ImportModule("asyncio.tasks");
+    if (module == NULL)
+        return -1;
+    GET_MOD_ATTR(iscoroutine_func, "iscoroutine");
+    GET_MOD_ATTR(task_repr_func, "_task_repr");
+    GET_MOD_ATTR(task_get_stack_func, "_task_get_stack");
+    GET_MOD_ATTR(task_print_stack_func, "_task_print_stack");
+    GET_MOD_ATTR(all_tasks, "_all_tasks");
+    GET_MOD_ATTR(current_tasks, "_current_tasks");
+    Py_DECREF(module);
+
+#undef GET_MOD_ATTR
+
+    if (!PyDict_Check(current_tasks)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "asyncio.tasks._current_tasks must be a dict");
+        return -1;
+    }
+    module_initialized = 1;
+    return 0;
+
+fail:
+    Py_DECREF(module);
+    return -1;
+}
+
+
+/* Future object ************************************************************/
+
+typedef enum {
+    STATE_PENDING,
+    STATE_CANCELLED,
+    STATE_FINISHED
+} fut_state;
+
+#define FutureObj_HEAD(prefix)                                              \
+    PyObject_HEAD                                                           \
+    PyObject *prefix##_loop;                                                \
+    PyObject *prefix##_callbacks;                                           \
+    PyObject *prefix##_result;                                              \
+    PyObject *prefix##_exception;                                           \
+    PyObject *prefix##_tb_logger;                                           \
+    fut_state prefix##_state;                                               \
+    char prefix##_blocking;                                                 \
+    PyObject *dict;                                                         \
+    PyObject *prefix##_weakreflist;
+
+typedef struct {
+    FutureObj_HEAD(fut)
+} FutureObj;
+
+typedef struct {
+    FutureObj_HEAD(task)
+    PyObject *task_coro;
+    PyObject *task_fut_waiter;
+    char task_must_cancel;
+} TaskObj;
+
+static PyTypeObject FutureType;
+static PyTypeObject FutureIterType;
+static PyTypeObject TaskType;
+
+#define Future_CheckExact(obj) (Py_TYPE(obj) == &FutureType)
+#define Task_CheckExact(obj) (Py_TYPE(obj) == &TaskType)
+#define Future_Check(obj) PyObject_TypeCheck(obj, &FutureType)
+#define Task_Check(obj) PyObject_TypeCheck(obj, &TaskType)
+
+/* Futures created by __new__() only get their loop in __init__() */
+static int
+future_ensure_alive(FutureObj *fut)
+{
+    if (fut->fut_loop == NULL) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "Future object is not initialized.");
+        return -1;
+    }
+    return 0;
+}
+
+#define ENSURE_FUTURE_ALIVE(fut)                                \
+    do {                                                        \
+        if (future_ensure_alive((FutureObj *)(fut)) < 0)        \
+            return NULL;                                        \
+    } while (0)
+
+static int
+future_call_soon(FutureObj *fut, PyObject *func, PyObject *arg)
+{
+    PyObject *handle;
+
+    handle = _PyObject_CallMethodIdObjArgs(fut->fut_loop, &PyId_call_soon,
+                                           func, arg, NULL);
+    if (handle == NULL)
+        return -1;
+    Py_DECREF(handle);
+    return 0;
+}
+
+static int
+future_schedule_callbacks(FutureObj *fut)
+{
+    Py_ssize_t len, i;
+    PyObject *callbacks;
+
+    len = PyList_GET_SIZE(fut->fut_callbacks);
+    if (len == 0)
+        return 0;
+
+    /* Empty the list itself, which may be shared with Python code */
+    callbacks = PyList_GetSlice(fut->fut_callbacks, 0, len);
+    if (callbacks == NULL)
+        return -1;
+    if (PyList_SetSlice(fut->fut_callbacks, 0, len, NULL) < 0) {
+        Py_DECREF(callbacks);
+        return -1;
+    }
+
+    for (i = 0; i < PyList_GET_SIZE(callbacks); i++) {
+        if (future_call_soon(fut, PyList_GET_ITEM(callbacks, i),
+                             (PyObject *)fut) < 0) {
+            Py_DECREF(callbacks);
+            return -1;
+        }
+    }
+    Py_DECREF(callbacks);
+    return 0;
+}
+
+static int
+future_init(FutureObj *fut, PyObject *loop)
+{
+    PyObject *tmp;
+
+    if (module_init() < 0)
+        return -1;
+
+    if (loop == NULL || loop == Py_None) {
+        /* Looked up at each call so that it can be patched */
+        loop = _PyObject_CallMethodId(asyncio_events, &PyId_get_event_loop,
+                                      NULL);
+        if (loop == NULL)
+            return -1;
+    }
+    else {
+        Py_INCREF(loop);
+    }
+    tmp = fut->fut_loop;
+    fut->fut_loop = loop;
+    Py_XDECREF(tmp);
+
+    tmp = fut->fut_callbacks;
+    fut->fut_callbacks = PyList_New(0);
+    Py_XDECREF(tmp);
+    if (fut->fut_callbacks == NULL)
+        return -1;
+    return 0;
+}
+
+static PyObject *
+future_set_result(FutureObj *fut, PyObject *res)
+{
+    PyObject *tmp;
+
+    ENSURE_FUTURE_ALIVE(fut);
+    if (fut->fut_state != STATE_PENDING) {
+        PyErr_Format(asyncio_InvalidStateError, "%U: %R",
+                     state_names[fut->fut_state], fut);
+        return NULL;
+    }
+
+    Py_INCREF(res);
+    tmp = fut->fut_result;
+    fut->fut_result = res;
+    Py_XDECREF(tmp);
+    fut->fut_state = STATE_FINISHED;
+
+    if (future_schedule_callbacks(fut) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+future_set_exception(FutureObj *fut, PyObject *exc)
+{
+    PyObject *tb_logger, *activate, *tmp;
+
+    ENSURE_FUTURE_ALIVE(fut);
+    if (fut->fut_state != STATE_PENDING) {
+        PyErr_Format(asyncio_InvalidStateError, "%U: %R",
+                     state_names[fut->fut_state], fut);
+        return NULL;
+    }
+
+    tb_logger = PyObject_CallFunctionObjArgs(traceback_logger, exc, NULL);
+    if (tb_logger == NULL)
+        return NULL;
+
+    Py_INCREF(exc);
+    tmp = fut->fut_exception;
+    fut->fut_exception = exc;
+    Py_XDECREF(tmp);
+    tmp = fut->fut_tb_logger;
+    fut->fut_tb_logger = tb_logger;
+    Py_XDECREF(tmp);
+    fut->fut_state = STATE_FINISHED;
+
+    if (future_schedule_callbacks(fut) < 0)
+        return NULL;
+
+    /* Arrange for the logger to be activated after all callbacks
+       have had a chance to call result() or exception(). */
+    activate = _PyObject_GetAttrId(tb_logger, &PyId_activate);
+    if (activate == NULL)
+        return NULL;
+    if (future_call_soon(fut, activate, NULL) < 0) {
+        Py_DECREF(activate);
+        return NULL;
+    }
+    Py_DECREF(activate);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+future_cancel(FutureObj *fut)
+{
+    ENSURE_FUTURE_ALIVE(fut);
+    if (fut->fut_state != STATE_PENDING)
+        Py_RETURN_FALSE;
+    fut->fut_state = STATE_CANCELLED;
+
+    if (future_schedule_callbacks(fut) < 0)
+        return NULL;
+    Py_RETURN_TRUE;
+}
+
+/* The result or exception was retrieved: don't log it */
+static int
+future_clear_tb_logger(FutureObj *fut)
+{
+    PyObject *tb_logger = fut->fut_tb_logger;
+    PyObject *res;
+
+    if (tb_logger == NULL)
+        return 0;
+    fut->fut_tb_logger = NULL;
+    res = _PyObject_CallMethodId(tb_logger, &PyId_clear, NULL);
+    Py_DECREF(tb_logger);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+/* Raise exc like the raise statement does, keeping its traceback */
+static void
+raise_exception(PyObject *exc)
+{
+    PyObject *type, *value, *tb;
+
+    if (PyExceptionInstance_Check(exc)) {
+        PyErr_SetObject(PyExceptionInstance_Class(exc), exc);
+        PyErr_Fetch(&type, &value, &tb);
+        Py_XDECREF(tb);
+        tb = PyException_GetTraceback(value);
+        PyErr_Restore(type, value, tb);
+    }
+    else if (PyExceptionClass_Check(exc)) {
+        PyErr_SetNone(exc);
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError,
+                        "exceptions must derive from BaseException");
+    }
+}
+
+/* Return a new reference to the result, or NULL with an exception set */
+static PyObject *
+future_get_result(FutureObj *fut)
+{
+    ENSURE_FUTURE_ALIVE(fut);
+    if (fut->fut_state == STATE_CANCELLED) {
+        PyErr_SetNone(asyncio_CancelledError);
+        return NULL;
+    }
+    if (fut->fut_state != STATE_FINISHED) {
+        PyErr_SetString(asyncio_InvalidStateError, "Result is not ready.");
+        return NULL;
+    }
+    if (future_clear_tb_logger(fut) < 0)
+        return NULL;
+    if (fut->fut_exception != NULL && fut->fut_exception != Py_None) {
+        raise_exception(fut->fut_exception);
+        return NULL;
+    }
+    Py_INCREF(fut->fut_result);
+    return fut->fut_result;
+}
+
+static PyObject *
+future_add_done_callback(FutureObj *fut, PyObject *fn)
+{
+    ENSURE_FUTURE_ALIVE(fut);
+    if (fut->fut_state != STATE_PENDING) {
+        if (future_call_soon(fut, fn, (PyObject *)fut) < 0)
+            return NULL;
+    }
+    else {
+        if (PyList_Append(fut->fut_callbacks, fn) < 0)
+            return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static int
+FutureObj_init(FutureObj *fut, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"loop", NULL};
+    PyObject *loop = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|$O:Future", kwlist,
+                                     &loop))
+        return -1;
+    return future_init(fut, loop);
+}
+
+static int
+FutureObj_clear(FutureObj *fut)
+{
+    Py_CLEAR(fut->fut_loop);
+    Py_CLEAR(fut->fut_callbacks);
+    Py_CLEAR(fut->fut_result);
+    Py_CLEAR(fut->fut_exception);
+    Py_CLEAR(fut->fut_tb_logger);
+    Py_CLEAR(fut->dict);
+    return 0;
+}
+
+static int
+FutureObj_traverse(FutureObj *fut, visitproc visit, void *arg)
+{
+    Py_VISIT(fut->fut_loop);
+    Py_VISIT(fut->fut_callbacks);
+    Py_VISIT(fut->fut_result);
+    Py_VISIT(fut->fut_exception);
+    Py_VISIT(fut->fut_tb_logger);
+    Py_VISIT(fut->dict);
+    return 0;
+}
+
+static void
+FutureObj_dealloc(FutureObj *fut)
+{
+    PyObject_GC_UnTrack(fut);
+    if (fut->fut_weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)fut);
+    FutureObj_clear(fut);
+    Py_TYPE(fut)->tp_free(fut);
+}
+
+static PyObject *
+FutureObj_repr(FutureObj *fut)
+{
+    if (module_init() < 0)
+        return NULL;
+    return PyObject_CallFunctionObjArgs(future_repr_func, fut, NULL);
+}
+
+PyDoc_STRVAR(future_result_doc,
+"Return the result this future represents.\n\
+\n\
+If the future has been cancelled, raises CancelledError.  If the\n\
+future's result isn't yet available, raises InvalidStateError.  If\n\
+the future is done and has an exception set, this exception is raised.");
+
+static PyObject *
+FutureObj_result(FutureObj *fut, PyObject *unused)
+{
+    return future_get_result(fut);
+}
+
+PyDoc_STRVAR(future_exception_doc,
+"Return the exception that was set on this future.\n\
+\n\
+The exception (or None if no exception was set) is returned only if\n\
+the future is done.  If the future has been cancelled, raises\n\
+CancelledError.  If the future isn't done yet, raises\n\
+InvalidStateError.");
+
+static PyObject *
+FutureObj_exception(FutureObj *fut, PyObject *unused)
+{
+    PyObject *exc;
+
+    ENSURE_FUTURE_ALIVE(fut);
+    if (fut->fut_state == STATE_CANCELLED) {
+        PyErr_SetNone(asyncio_CancelledError);
+        return NULL;
+    }
+    if (fut->fut_state != STATE_FINISHED) {
+        PyErr_SetString(asyncio_InvalidStateError, "Exception is not set.");
+        return NULL;
+    }
+    if (future_clear_tb_logger(fut) < 0)
+        return NULL;
+    exc = fut->fut_exception != NULL ? fut->fut_exception : Py_None;
+    Py_INCREF(exc);
+    return exc;
+}
+
+PyDoc_STRVAR(future_set_result_doc,
+"Mark the future done and set its result.\n\
+\n\
+If the future is already done when this method is called, raises\n\
+InvalidStateError.");
+
+static PyObject *
+FutureObj_set_result(FutureObj *fut, PyObject *res)
+{
+    return future_set_result(fut, res);
+}
+
+PyDoc_STRVAR(future_set_exception_doc,
+"Mark the future done and set an exception.\n\
+\n\
+If the future is already done when this method is called, raises\n\
+InvalidStateError.");
+
+static PyObject *
+FutureObj_set_exception(FutureObj *fut, PyObject *exc)
+{
+    return future_set_exception(fut, exc);
+}
+
+PyDoc_STRVAR(future_add_done_callback_doc,
+"Add a callback to be run when the future becomes done.\n\
+\n\
+The callback is called with a single argument - the future object. If\n\
+the future is already done when this is called, the callback is\n\
+scheduled with call_soon.");
+
+static PyObject *
+FutureObj_add_done_callback(FutureObj *fut, PyObject *fn)
+{
+    return future_add_done_callback(fut, fn);
+}
+
+PyDoc_STRVAR(future_remove_done_callback_doc,
+"Remove all instances of a callback from the \"call when done\" list.\n\
+\n\
+Returns the number of callbacks removed.");
+
+static PyObject *
+FutureObj_remove_done_callback(FutureObj *fut, PyObject *fn)
+{
+    PyObject *filtered, *item;
+    Py_ssize_t len, i;
+    int ret;
+
+    ENSURE_FUTURE_ALIVE(fut);
+    filtered = PyList_New(0);
+    if (filtered == NULL)
+        return NULL;
+    for (i = 0; i < PyList_GET_SIZE(fut->fut_callbacks); i++) {
+        item = PyList_GET_ITEM(fut->fut_callbacks, i);
+        Py_INCREF(item);
+        ret = PyObject_RichCompareBool(item, fn, Py_NE);
+        if (ret > 0)
+            ret = PyList_Append(filtered, item);
+        Py_DECREF(item);
+        if (ret < 0) {
+            Py_DECREF(filtered);
+            return NULL;
+        }
+    }
+    len = PyList_GET_SIZE(fut->fut_callbacks);
+    if (len != PyList_GET_SIZE(filtered)) {
+        if (PyList_SetSlice(fut->fut_callbacks, 0, len, filtered) < 0) {
+            Py_DECREF(filtered);
+            return NULL;
+        }
+    }
+    len -= PyList_GET_SIZE(filtered);
+    Py_DECREF(filtered);
+    return PyLong_FromSsize_t(len);
+}
+
+PyDoc_STRVAR(future_cancel_doc,
+"Cancel the future and schedule callbacks.\n\
+\n\
+If the future is already done or cancelled, return False.  Otherwise,\n\
+change the future's state to cancelled, schedule the callbacks and\n\
+return True.");
+
+static PyObject *
+FutureObj_cancel(FutureObj *fut, PyObject *unused)
+{
+    return future_cancel(fut);
+}
+
+PyDoc_STRVAR(future_cancelled_doc,
+"Return True if the future was cancelled.");
+
+static PyObject *
+FutureObj_cancelled(FutureObj *fut, PyObject *unused)
+{
+    return PyBool_FromLong(fut->fut_state == STATE_CANCELLED);
+}
+
+PyDoc_STRVAR(future_done_doc,
+"Return True if the future is done.\n\
+\n\
+Done means either that a result / exception are available, or that the\n\
+future was cancelled.");
+
+static PyObject *
+FutureObj_done(FutureObj *fut, PyObject *unused)
+{
+    return PyBool_FromLong(fut->fut_state != STATE_PENDING);
+}
+
+static PyObject *
+call_method_noargs(PyObject *obj, _Py_Identifier *name)
+{
+    return _PyObject_CallMethodId(obj, name, NULL);
+}
+
+static int
+call_method_bool(PyObject *obj, _Py_Identifier *name)
+{
+    PyObject *res = call_method_noargs(obj, name);
+    int ret;
+
+    if (res == NULL)
+        return -1;
+    ret = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    return ret;
+}
+
+PyDoc_STRVAR(future_copy_state_doc,
+"Internal helper to copy state from another Future.\n\
+\n\
+The other Future may be a concurrent.futures.Future.");
+
+static PyObject *
+FutureObj__copy_state(FutureObj *fut, PyObject *other)
+{
+    PyObject *res, *value;
+    int ret;
+
+    ENSURE_FUTURE_ALIVE(fut);
+    ret = call_method_bool(other, &PyId_done);
+    if (ret < 0)
+        return NULL;
+    if (!ret) {
+        PyErr_SetNone(PyExc_AssertionError);
+        return NULL;
+    }
+    if (fut->fut_state == STATE_CANCELLED)
+        Py_RETURN_NONE;
+    if (fut->fut_state != STATE_PENDING) {
+        PyErr_SetNone(PyExc_AssertionError);
+        return NULL;
+    }
+
+    ret = call_method_bool(other, &PyId_cancelled);
+    if (ret < 0)
+        return NULL;
+    if (ret)
+        return call_method_noargs((PyObject *)fut, &PyId_cancel);
+
+    value = call_method_noargs(other, &PyId_exception);
+    if (value == NULL)
+        return NULL;
+    if (value != Py_None) {
+        res = _PyObject_CallMethodIdObjArgs((PyObject *)fut,
+                                            &PyId_set_exception, value, NULL);
+    }
+    else {
+        Py_DECREF(value);
+        value = call_method_noargs(other, &PyId_result);
+        if (value == NULL)
+            return NULL;
+        res = _PyObject_CallMethodIdObjArgs((PyObject *)fut,
+                                            &PyId_set_result, value, NULL);
+    }
+    Py_DECREF(value);
+    return res;
+}
+
+static PyObject *
+FutureObj_get_state(FutureObj *fut)
+{
+    PyObject *name = state_names[fut->fut_state];
+
+    Py_INCREF(name);
+    return name;
+}
+
+static PyObject *future_new_iter(PyObject *);
+
+static PyMethodDef FutureType_methods[] = {
+    {"result", (PyCFunction)FutureObj_result, METH_NOARGS,
+     future_result_doc},
+    {"exception", (PyCFunction)FutureObj_exception, METH_NOARGS,
+     future_exception_doc},
+    {"set_result", (PyCFunction)FutureObj_set_result, METH_O,
+     future_set_result_doc},
+    {"set_exception", (PyCFunction)FutureObj_set_exception, METH_O,
+     future_set_exception_doc},
+    {"add_done_callback", (PyCFunction)FutureObj_add_done_callback, METH_O,
+     future_add_done_callback_doc},
+    {"remove_done_callback", (PyCFunction)FutureObj_remove_done_callback,
+     METH_O, future_remove_done_callback_doc},
+    {"cancel", (PyCFunction)FutureObj_cancel, METH_NOARGS,
+     future_cancel_doc},
+    {"cancelled", (PyCFunction)FutureObj_cancelled, METH_NOARGS,
+     future_cancelled_doc},
+    {"done", (PyCFunction)FutureObj_done, METH_NOARGS, future_done_doc},
+    {"_copy_state", (PyCFunction)FutureObj__copy_state, METH_O,
+     future_copy_state_doc},
+    {NULL, NULL}        /* Sentinel */
+};
+
+#define FUTURE_COMMON_MEMBERS(prefix, type)                                 \
+    {"_loop", T_OBJECT, offsetof(type, prefix##_loop), READONLY},          \
+    {"_callbacks", T_OBJECT, offsetof(type, prefix##_callbacks), READONLY},\
+    {"_result", T_OBJECT, offsetof(type, prefix##_result), READONLY},      \
+    {"_exception", T_OBJECT, offsetof(type, prefix##_exception), READONLY},\
+    {"_tb_logger", T_OBJECT, offsetof(type, prefix##_tb_logger), READONLY},\
+    {"_blocking", T_BOOL, offsetof(type, prefix##_blocking), 0},
+
+static PyMemberDef FutureType_members[] = {
+    FUTURE_COMMON_MEMBERS(fut, FutureObj)
+    {NULL}      /* Sentinel */
+};
+
+static PyGetSetDef FutureType_getsetlist[] = {
+    {"_state", (getter)FutureObj_get_state, NULL, NULL},
+    {"__dict__", PyObject_GenericGetDict, PyObject_GenericSetDict},
+    {NULL} /* Sentinel */
+};
+
+PyDoc_STRVAR(future_doc,
+"Future(*, loop=None)\n\
+\n\
+This class is *almost* compatible with concurrent.futures.Future.\n\
+\n\
+    Differences:\n\
+\n\
+    - result() and exception() do not take a timeout argument and\n\
+      raise an exception when the future isn't done yet.\n\
+\n\
+    - Callbacks registered with add_done_callback() are always called\n\
+      via the event loop's call_soon_threadsafe().\n\
+\n\
+    - This class is not compatible with the wait() and as_completed()\n\
+      methods in the concurrent.futures package.");
+
+static PyTypeObject FutureType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.Future",                          /* tp_name */
+    sizeof(FutureObj),                          /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)FutureObj_dealloc,              /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_reserved */
+    (reprfunc)FutureObj_repr,                   /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    0,                                          /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+        Py_TPFLAGS_BASETYPE,                    /* tp_flags */
+    future_doc,                                 /* tp_doc */
+    (traverseproc)FutureObj_traverse,           /* tp_traverse */
+    (inquiry)FutureObj_clear,                   /* tp_clear */
+    0,                                          /* tp_richcompare */
+    offsetof(FutureObj, fut_weakreflist),       /* tp_weaklistoffset */
+    (getiterfunc)future_new_iter,               /* tp_iter */
+    0,                                          /* tp_iternext */
+    FutureType_methods,                         /* tp_methods */
+    FutureType_members,                         /* tp_members */
+    FutureType_getsetlist,                      /* tp_getset */
+    0,                                          /* tp_base */
+    0,                                          /* tp_dict */
+    0,                                          /* tp_descr_get */
+    0,                                          /* tp_descr_set */
+    offsetof(FutureObj, dict),                  /* tp_dictoffset */
+    (initproc)FutureObj_init,                   /* tp_init */
+    0,                                          /* tp_alloc */
+    PyType_GenericNew,                          /* tp_new */
+    PyObject_GC_Del,                            /* tp_free */
+};
+
+
+/* Future iterator **********************************************************/
+
+/* The iterator behind "yield from future".  It yields the future itself
+   once if it isn't done yet, so that the task waits for it, and returns
+   its result when resumed, like the generator of the pure Python
+   Future.__iter__(). */
+
+typedef struct {
+    PyObject_HEAD
+    FutureObj *future;  /* NULL once exhausted */
+    int started;
+} futureiterobject;
+
+static PyObject *
+future_new_iter(PyObject *fut)
+{
+    futureiterobject *it;
+
+    if (!Future_Check(fut)) {
+        PyErr_BadInternalCall();
+        return NULL;
+    }
+    it = PyObject_GC_New(futureiterobject, &FutureIterType);
+    if (it == NULL)
+        return NULL;
+    Py_INCREF(fut);
+    it->future = (FutureObj *)fut;
+    it->started = 0;
+    PyObject_GC_Track(it);
+    return (PyObject *)it;
+}
+
+static void
+FutureIter_dealloc(futureiterobject *it)
+{
+    PyObject_GC_UnTrack(it);
+    Py_XDECREF(it->future);
+    PyObject_GC_Del(it);
+}
+
+static int
+FutureIter_traverse(futureiterobject *it, visitproc visit, void *arg)
+{
+    Py_VISIT(it->future);
+    return 0;
+}
+
+static PyObject *
+FutureIter_iternext(futureiterobject *it)
+{
+    PyObject *res, *exc;
+    FutureObj *fut = it->future;
+
+    if (fut == NULL)
+        return NULL;
+
+    if (!it->started) {
+        it->started = 1;
+        if (fut->fut_state == STATE_PENDING) {
+            fut->fut_blocking = 1;
+            Py_INCREF(fut);
+            return (PyObject *)fut;
+        }
+    }
+
+    it->future = NULL;
+    if (fut->fut_state == STATE_PENDING) {
+        Py_DECREF(fut);
+        PyErr_SetString(PyExc_AssertionError,
+                        "yield from wasn't used with future");
+        return NULL;
+    }
+    res = future_get_result(fut);
+    Py_DECREF(fut);
+    if (res == NULL)
+        return NULL;
+
+    /* The result is returned by raising StopIteration(res) */
+    if (res == Py_None) {
+        Py_DECREF(res);
+        PyErr_SetNone(PyExc_StopIteration);
+        return NULL;
+    }
+    exc = PyObject_CallFunctionObjArgs(PyExc_StopIteration, res, NULL);
+    Py_DECREF(res);
+    if (exc == NULL)
+        return NULL;
+    PyErr_SetObject(PyExc_StopIteration, exc);
+    Py_DECREF(exc);
+    return NULL;
+}
+
+static PyObject *
+FutureIter_send(futureiterobject *it, PyObject *arg)
+{
+    if (!it->started && arg != Py_None) {
+        PyErr_SetString(PyExc_TypeError,
+                        "can't send non-None value to a "
+                        "just-started generator");
+        return NULL;
+    }
+    /* The sent value is ignored, like the generator ignores it */
+    return FutureIter_iternext(it);
+}
+
+static PyObject *
+FutureIter_throw(futureiterobject *it, PyObject *args)
+{
+    PyObject *type, *val = NULL, *tb = NULL;
+
+    if (!PyArg_UnpackTuple(args, "throw", 1, 3, &type, &val, &tb))
+        return NULL;
+
+    if (tb == Py_None)
+        tb = NULL;
+    else if (tb != NULL && !PyTraceBack_Check(tb)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "throw() third argument must be a traceback");
+        return NULL;
+    }
+
+    Py_INCREF(type);
+    Py_XINCREF(val);
+    Py_XINCREF(tb);
+
+    if (PyExceptionClass_Check(type)) {
+        PyErr_NormalizeException(&type, &val, &tb);
+    }
+    else if (PyExceptionInstance_Check(type)) {
+        if (val != NULL && val != Py_None) {
+            PyErr_SetString(PyExc_TypeError,
+                            "instance exception may not have a "
+                            "separate value");
+            goto fail;
+        }
+        Py_XDECREF(val);
+        val = type;
+        type = PyExceptionInstance_Class(type);
+        Py_INCREF(type);
+    }
+    else {
+        PyErr_Format(PyExc_TypeError,
+                     "exceptions must be classes or instances deriving "
+                     "from BaseException, not %s",
+                     Py_TYPE(type)->tp_name);
+        goto fail;
+    }
+
+    /* The exception is raised at the yield point, which finishes the
+       iteration */
+    Py_CLEAR(it->future);
+    PyErr_Restore(type, val, tb);
+    return NULL;
+
+fail:
+    Py_DECREF(type);
+    Py_XDECREF(val);
+    Py_XDECREF(tb);
+    return NULL;
+}
+
+static PyObject *
+FutureIter_close(futureiterobject *it, PyObject *unused)
+{
+    Py_CLEAR(it->future);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef FutureIter_methods[] = {
+    {"send",  (PyCFunction)FutureIter_send, METH_O, NULL},
+    {"throw", (PyCFunction)FutureIter_throw, METH_VARARGS, NULL},
+    {"close", (PyCFunction)FutureIter_close, METH_NOARGS, NULL},
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyTypeObject FutureIterType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.FutureIter",                      /* tp_name */
+    sizeof(futureiterobject),                   /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)FutureIter_dealloc,             /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_reserved */
+    0,                                          /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    PyObject_GenericGetAttr,                    /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC,    /* tp_flags */
+    0,                                          /* tp_doc */
+    (traverseproc)FutureIter_traverse,          /* tp_traverse */
+    0,                                          /* tp_clear */
+    0,                                          /* tp_richcompare */
+    0,                                          /* tp_weaklistoffset */
+    PyObject_SelfIter,                          /* tp_iter */
+    (iternextfunc)FutureIter_iternext,          /* tp_iternext */
+    FutureIter_methods,                         /* tp_methods */
+    0,                                          /* tp_members */
+};
+
+
+/* Task object **************************************************************/
+
+static PyObject *task_step_impl(TaskObj *, PyObject *, PyObject *);
+
+/* Schedule task._step(), with an exception to throw into the coroutine if
+   exc is not NULL. */
+static int
+task_call_step_soon(TaskObj *task, PyObject *exc)
+{
+    PyObject *step, *handle;
+
+    step = _PyObject_GetAttrId((PyObject *)task, &PyId__step);
+    if (step == NULL)
+        return -1;
+    if (exc == NULL)
+        handle = _PyObject_CallMethodIdObjArgs(task->task_loop,
+                                               &PyId_call_soon, step, NULL);
+    else
+        handle = _PyObject_CallMethodIdObjArgs(task->task_loop,
+                                               &PyId_call_soon, step,
+                                               Py_None, exc, NULL);
+    Py_DECREF(step);
+    if (handle == NULL)
+        return -1;
+    Py_DECREF(handle);
+    return 0;
+}
+
+/* Schedule task._step() with a RuntimeError built from format */
+static int
+task_call_step_soon_error(TaskObj *task, const char *format, ...)
+{
+    PyObject *msg, *exc;
+    va_list vargs;
+    int ret;
+
+#ifdef HAVE_STDARG_PROTOTYPES
+    va_start(vargs, format);
+#else
+    va_start(vargs);
+#endif
+    msg = PyUnicode_FromFormatV(format, vargs);
+    va_end(vargs);
+    if (msg == NULL)
+        return -1;
+    exc = PyObject_CallFunctionObjArgs(PyExc_RuntimeError, msg, NULL);
+    Py_DECREF(msg);
+    if (exc == NULL)
+        return -1;
+    ret = task_call_step_soon(task, exc);
+    Py_DECREF(exc);
+    return ret;
+}
+
+static int
+TaskObj_init(TaskObj *task, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"coro", "loop", NULL};
+    PyObject *coro, *loop = Py_None, *res, *tmp;
+    int ret;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|$O:Task", kwlist,
+                                     &coro, &loop))
+        return -1;
+    if (module_init() < 0)
+        return -1;
+
+    /* Not a coroutine function! */
+    if (!PyGen_CheckExact(coro)) {
+        res = PyObject_CallFunctionObjArgs(iscoroutine_func, coro, NULL);
+        if (res == NULL)
+            return -1;
+        ret = PyObject_IsTrue(res);
+        Py_DECREF(res);
+        if (ret < 0)
+            return -1;
+        if (!ret) {
+            PyErr_SetObject(PyExc_AssertionError, coro);
+            return -1;
+        }
+    }
+
+    if (future_init((FutureObj *)task, loop) < 0)
+        return -1;
+
+    tmp = task->task_coro;
+    task->task_coro = PyObject_GetIter(coro);  /* Just in case. */
+    Py_XDECREF(tmp);
+    if (task->task_coro == NULL)
+        return -1;
+    Py_CLEAR(task->task_fut_waiter);
+    task->task_must_cancel = 0;
+
+    if (task_call_step_soon(task, NULL) < 0)
+        return -1;
+
+    res = _PyObject_CallMethodIdObjArgs(all_tasks, &PyId_add, task, NULL);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+static int
+TaskObj_clear(TaskObj *task)
+{
+    FutureObj_clear((FutureObj *)task);
+    Py_CLEAR(task->task_coro);
+    Py_CLEAR(task->task_fut_waiter);
+    return 0;
+}
+
+static int
+TaskObj_traverse(TaskObj *task, visitproc visit, void *arg)
+{
+    Py_VISIT(task->task_coro);
+    Py_VISIT(task->task_fut_waiter);
+    return FutureObj_traverse((FutureObj *)task, visit, arg);
+}
+
+static void
+TaskObj_dealloc(TaskObj *task)
+{
+    PyObject_GC_UnTrack(task);
+    if (task->task_weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)task);
+    TaskObj_clear(task);
+    Py_TYPE(task)->tp_free(task);
+}
+
+static PyObject *
+TaskObj_repr(TaskObj *task)
+{
+    PyObject *super, *base_repr, *res;
+
+    if (module_init() < 0)
+        return NULL;
+    /* super().__repr__(), which may come from a subclass of Future */
+    super = PyObject_CallFunctionObjArgs((PyObject *)&PySuper_Type,
+                                         (PyObject *)&TaskType, task, NULL);
+    if (super == NULL)
+        return NULL;
+    base_repr = PyObject_CallMethod(super, "__repr__", NULL);
+    Py_DECREF(super);
+    if (base_repr == NULL)
+        return NULL;
+    res = PyObject_CallFunctionObjArgs(task_repr_func, task, base_repr, NULL);
+    Py_DECREF(base_repr);
+    return res;
+}
+
+/* The task is waiting for fut, which came out of "yield from fut" */
+static int
+task_wait_for(TaskObj *task, PyObject *fut)
+{
+    PyObject *wakeup, *res;
+    int ret;
+
+    wakeup = _PyObject_GetAttrId((PyObject *)task, &PyId__wakeup);
+    if (wakeup == NULL)
+        return -1;
+    if (Future_CheckExact(fut) || Task_CheckExact(fut))
+        res = future_add_done_callback((FutureObj *)fut, wakeup);
+    else
+        res = _PyObject_CallMethodIdObjArgs(fut, &PyId_add_done_callback,
+                                            wakeup, NULL);
+    Py_DECREF(wakeup);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+
+    Py_INCREF(fut);
+    Py_XDECREF(task->task_fut_waiter);
+    task->task_fut_waiter = fut;
+
+    if (task->task_must_cancel) {
+        ret = call_method_bool(fut, &PyId_cancel);
+        if (ret < 0)
+            return -1;
+        if (ret)
+            task->task_must_cancel = 0;
+    }
+    return 0;
+}
+
+/* Dispatch on what the coroutine yielded */
+static int
+task_handle_yield(TaskObj *task, PyObject *result)
+{
+    PyObject *blocking_obj;
+    int blocking, ret;
+
+    if (Future_Check(result)) {
+        blocking = ((FutureObj *)result)->fut_blocking;
+        if (blocking)
+            ((FutureObj *)result)->fut_blocking = 0;
+    }
+    else {
+        ret = PyObject_IsInstance(result, py_future_type);
+        if (ret < 0)
+            return -1;
+        if (!ret)
+            goto not_a_future;
+        blocking_obj = _PyObject_GetAttrId(result, &PyId__blocking);
+        if (blocking_obj == NULL)
+            return -1;
+        blocking = PyObject_IsTrue(blocking_obj);
+        Py_DECREF(blocking_obj);
+        if (blocking < 0)
+            return -1;
+        if (blocking &&
+            _PyObject_SetAttrId(result, &PyId__blocking, Py_False) < 0)
+            return -1;
+    }
+
+    /* Yielded Future must come from Future.__iter__(). */
+    if (blocking)
+        return task_wait_for(task, result);
+    return task_call_step_soon_error(
+        task,
+        "yield was used instead of yield from in task %R with %R",
+        task, result);
+
+not_a_future:
+    if (result == Py_None) {
+        /* Bare yield relinquishes control for one event loop iteration. */
+        return task_call_step_soon(task, NULL);
+    }
+    if (PyGen_Check(result)) {
+        /* Yielding a generator is just wrong. */
+        return task_call_step_soon_error(
+            task,
+            "yield was used instead of yield from for generator in "
+            "task %R with %S", task, result);
+    }
+    /* Yielding something else is an error. */
+    return task_call_step_soon_error(task, "Task got bad yield: %R", result);
+}
+
+/* Resume the coroutine: coro.throw(exc), coro.send(value) or next(coro) */
+static PyObject *
+task_resume_coro(PyObject *coro, PyObject *value, PyObject *exc)
+{
+    PyObject *result;
+
+    if (exc != NULL)
+        return _PyObject_CallMethodIdObjArgs(coro, &PyId_throw, exc, NULL);
+    if (PyGen_CheckExact(coro))
+        return _PyGen_Send((PyGenObject *)coro,
+                           value != NULL ? value : Py_None);
+    if (value != NULL)
+        return _PyObject_CallMethodIdObjArgs(coro, &PyId_send, value, NULL);
+    if (!PyIter_Check(coro)) {
+        PyErr_Format(PyExc_TypeError,
+                     "'%.200s' object is not an iterator",
+                     Py_TYPE(coro)->tp_name);
+        return NULL;
+    }
+    result = (*Py_TYPE(coro)->tp_iternext)(coro);
+    if (result == NULL && !PyErr_Occurred())
+        PyErr_SetNone(PyExc_StopIteration);
+    return result;
+}
+
+/* The coroutine raised an exception: finish the task accordingly */
+static int
+task_handle_coro_error(TaskObj *task)
+{
+    PyObject *et, *ev, *tb, *val, *res;
+    int is_base_exception;
+
+    if (PyErr_ExceptionMatches(PyExc_StopIteration)) {
+        if (_PyGen_FetchStopIterationValue(&val) < 0)
+            return -1;
+        res = future_set_result((FutureObj *)task, val);
+        Py_DECREF(val);
+        if (res == NULL)
+            return -1;
+        Py_DECREF(res);
+        return 0;
+    }
+
+    if (PyErr_ExceptionMatches(asyncio_CancelledError)) {
+        /* I.e., Future.cancel(self). */
+        PyErr_Clear();
+        res = future_cancel((FutureObj *)task);
+        if (res == NULL)
+            return -1;
+        Py_DECREF(res);
+        return 0;
+    }
+
+    PyErr_Fetch(&et, &ev, &tb);
+    PyErr_NormalizeException(&et, &ev, &tb);
+    if (tb != NULL)
+        PyException_SetTraceback(ev, tb);
+    res = future_set_exception((FutureObj *)task, ev);
+    if (res == NULL) {
+        Py_DECREF(et);
+        Py_XDECREF(ev);
+        Py_XDECREF(tb);
+        return -1;
+    }
+    Py_DECREF(res);
+
+    is_base_exception = !PyErr_GivenExceptionMatches(et, PyExc_Exception);
+    if (is_base_exception) {
+        /* Propagate a BaseException (KeyboardInterrupt, SystemExit...)
+           after setting it on the task. */
+        PyErr_Restore(et, ev, tb);
+        return -1;
+    }
+    Py_DECREF(et);
+    Py_XDECREF(ev);
+    Py_XDECREF(tb);
+    return 0;
+}
+
+static PyObject *
+task_step_impl(TaskObj *task, PyObject *value, PyObject *exc)
+{
+    PyObject *coro, *result, *et, *ev, *tb;
+    int ret;
+
+    ENSURE_FUTURE_ALIVE(task);
+    if (task->task_state != STATE_PENDING) {
+        PyErr_Format(PyExc_AssertionError,
+                     "_step(): already done: %R, %R, %R",
+                     task, value ? value : Py_None, exc ? exc : Py_None);
+        return NULL;
+    }
+
+    if (value == Py_None)
+        value = NULL;
+    if (exc == Py_None)
+        exc = NULL;
+    Py_XINCREF(exc);
+    if (task->task_must_cancel) {
+        ret = exc != NULL ? PyObject_IsInstance(exc, asyncio_CancelledError)
+                          : 0;
+        if (ret < 0)
+            goto fail;
+        if (!ret) {
+            Py_XDECREF(exc);
+            exc = PyObject_CallFunctionObjArgs(asyncio_CancelledError, NULL);
+            if (exc == NULL)
+                return NULL;
+        }
+        task->task_must_cancel = 0;
+    }
+
+    Py_CLEAR(task->task_fut_waiter);
+    coro = task->task_coro;
+    if (coro == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "Task object is not initialized.");
+        goto fail;
+    }
+    Py_INCREF(coro);
+
+    if (PyDict_SetItem(current_tasks, task->task_loop, (PyObject *)task) < 0) {
+        Py_DECREF(coro);
+        goto fail;
+    }
+
+    result = task_resume_coro(coro, value, exc);
+    Py_DECREF(coro);
+    Py_CLEAR(exc);
+    if (result == NULL) {
+        ret = task_handle_coro_error(task);
+    }
+    else {
+        ret = task_handle_yield(task, result);
+        Py_DECREF(result);
+    }
+
+    /* finally: */
+    PyErr_Fetch(&et, &ev, &tb);
+    if (PyDict_DelItem(current_tasks, task->task_loop) < 0) {
+        Py_XDECREF(et);
+        Py_XDECREF(ev);
+        Py_XDECREF(tb);
+        return NULL;
+    }
+    PyErr_Restore(et, ev, tb);
+    if (ret < 0)
+        return NULL;
+    Py_RETURN_NONE;
+
+fail:
+    Py_XDECREF(exc);
+    return NULL;
+}
+
+static PyObject *
+TaskObj__step(TaskObj *task, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"value", "exc", NULL};
+    PyObject *value = Py_None, *exc = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|OO:_step", kwlist,
+                                     &value, &exc))
+        return NULL;
+    return task_step_impl(task, value, exc);
+}
+
+static PyObject *
+TaskObj__wakeup(TaskObj *task, PyObject *fut)
+{
+    PyObject *value, *et, *ev, *tb, *res;
+
+    if (Future_CheckExact(fut) || Task_CheckExact(fut))
+        value = future_get_result((FutureObj *)fut);
+    else
+        value = call_method_noargs(fut, &PyId_result);
+    if (value != NULL) {
+        res = task_step_impl(task, value, NULL);
+        Py_DECREF(value);
+        return res;
+    }
+
+    /* This may also be a cancellation. */
+    if (!PyErr_ExceptionMatches(PyExc_Exception))
+        return NULL;
+    PyErr_Fetch(&et, &ev, &tb);
+    PyErr_NormalizeException(&et, &ev, &tb);
+    if (tb != NULL)
+        PyException_SetTraceback(ev, tb);
+    res = task_step_impl(task, NULL, ev);
+    Py_DECREF(et);
+    Py_XDECREF(ev);
+    Py_XDECREF(tb);
+    return res;
+}
+
+PyDoc_STRVAR(task_cancel_doc,
+"Request that this task cancel itself.\n\
+\n\
+The coroutine gets a CancelledError thrown into it on its next step,\n\
+unless the future it is waiting for is cancelled first.");
+
+static PyObject *
+TaskObj_cancel(TaskObj *task, PyObject *unused)
+{
+    int ret;
+
+    if (task->task_state != STATE_PENDING)
+        Py_RETURN_FALSE;
+    if (task->task_fut_waiter != NULL) {
+        ret = call_method_bool(task->task_fut_waiter, &PyId_cancel);
+        if (ret < 0)
+            return NULL;
+        if (ret) {
+            /* Leave task_fut_waiter; it may be a Task that catches and
+               ignores the cancellation so we may have to cancel it again
+               later. */
+            Py_RETURN_TRUE;
+        }
+    }
+    /* It must be the case that self._step is already scheduled. */
+    task->task_must_cancel = 1;
+    Py_RETURN_TRUE;
+}
+
+static PyObject *
+get_loop_arg(PyObject *args, PyObject *kwds, const char *format)
+{
+    static char *kwlist[] = {"loop", NULL};
+    PyObject *loop = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, format, kwlist, &loop))
+        return NULL;
+    if (module_init() < 0)
+        return NULL;
+    if (loop == Py_None)
+        return _PyObject_CallMethodId(asyncio_events, &PyId_get_event_loop,
+                                      NULL);
+    Py_INCREF(loop);
+    return loop;
+}
+
+PyDoc_STRVAR(task_current_task_doc,
+"Return the currently running task in an event loop or None.\n\
+\n\
+By default the current task for the current event loop is returned.\n\
+\n\
+None is returned when called not in the context of a Task.");
+
+static PyObject *
+TaskObj_current_task(PyObject *cls, PyObject *args, PyObject *kwds)
+{
+    PyObject *loop, *task;
+
+    loop = get_loop_arg(args, kwds, "|O:current_task");
+    if (loop == NULL)
+        return NULL;
+    task = PyDict_GetItem(current_tasks, loop);
+    Py_DECREF(loop);
+    if (task == NULL)
+        task = Py_None;
+    Py_INCREF(task);
+    return task;
+}
+
+PyDoc_STRVAR(task_all_tasks_doc,
+"Return a set of all tasks for an event loop.\n\
+\n\
+By default all tasks for the current event loop are returned.");
+
+static PyObject *
+TaskObj_all_tasks(PyObject *cls, PyObject *args, PyObject *kwds)
+{
+    PyObject *loop, *set, *iter, *task, *task_loop;
+
+    loop = get_loop_arg(args, kwds, "|O:all_tasks");
+    if (loop == NULL)
+        return NULL;
+    set = PySet_New(NULL);
+    if (set == NULL)
+        goto fail;
+    iter = PyObject_GetIter(all_tasks);
+    if (iter == NULL)
+        goto fail;
+    while ((task = PyIter_Next(iter)) != NULL) {
+        task_loop = _PyObject_GetAttrId(task, &PyId__loop);
+        if (task_loop == NULL ||
+            (task_loop == loop && PySet_Add(set, task) < 0)) {
+            Py_XDECREF(task_loop);
+            Py_DECREF(task);
+            Py_DECREF(iter);
+            goto fail;
+        }
+        Py_DECREF(task_loop);
+        Py_DECREF(task);
+    }
+    Py_DECREF(iter);
+    if (PyErr_Occurred())
+        goto fail;
+    Py_DECREF(loop);
+    return set;
+
+fail:
+    Py_XDECREF(set);
+    Py_DECREF(loop);
+    return NULL;
+}
+
+PyDoc_STRVAR(task_get_stack_doc,
+"get_stack(*, limit=None) -> list of frames\n\
+\n\
+Return the list of stack frames for this task's coroutine.\n\
+See asyncio.Task.get_stack() for details.");
+
+static PyObject *
+TaskObj_get_stack(TaskObj *task, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"limit", NULL};
+    PyObject *limit = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|$O:get_stack", kwlist,
+                                     &limit))
+        return NULL;
+    if (module_init() < 0)
+        return NULL;
+    return PyObject_CallFunctionObjArgs(task_get_stack_func, task, limit,
+                                        NULL);
+}
+
+PyDoc_STRVAR(task_print_stack_doc,
+"print_stack(*, limit=None, file=None)\n\
+\n\
+Print the stack or traceback for this task's coroutine.\n\
+See asyncio.Task.print_stack() for details.");
+
+static PyObject *
+TaskObj_print_stack(TaskObj *task, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"limit", "file", NULL};
+    PyObject *limit = Py_None, *file = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|$OO:print_stack", kwlist,
+                                     &limit, &file))
+        return NULL;
+    if (module_init() < 0)
+        return NULL;
+    return PyObject_CallFunctionObjArgs(task_print_stack_func, task, limit,
+                                        file, NULL);
+}
+
+static PyMethodDef TaskType_methods[] = {
+    {"current_task", (PyCFunction)TaskObj_current_task,
+     METH_VARARGS | METH_KEYWORDS | METH_CLASS, task_current_task_doc},
+    {"all_tasks", (PyCFunction)TaskObj_all_tasks,
+     METH_VARARGS | METH_KEYWORDS | METH_CLASS, task_all_tasks_doc},
+    {"get_stack", (PyCFunction)TaskObj_get_stack,
+     METH_VARARGS | METH_KEYWORDS, task_get_stack_doc},
+    {"print_stack", (PyCFunction)TaskObj_print_stack,
+     METH_VARARGS | METH_KEYWORDS, task_print_stack_doc},
+    {"cancel", (PyCFunction)TaskObj_cancel, METH_NOARGS, task_cancel_doc},
+    {"_step", (PyCFunction)TaskObj__step, METH_VARARGS | METH_KEYWORDS,
+     NULL},
+    {"_wakeup", (PyCFunction)TaskObj__wakeup, METH_O, NULL},
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef TaskType_members[] = {
+    FUTURE_COMMON_MEMBERS(task, TaskObj)
+    {"_coro", T_OBJECT, offsetof(TaskObj, task_coro), READONLY},
+    {"_fut_waiter", T_OBJECT, offsetof(TaskObj, task_fut_waiter), READONLY},
+    {"_must_cancel", T_BOOL, offsetof(TaskObj, task_must_cancel), 0},
+    {NULL}      /* Sentinel */
+};
+
+PyDoc_STRVAR(task_doc,
+"Task(coro, *, loop=None)\n\
+\n\
+A coroutine wrapped in a Future.");
+
+static PyTypeObject TaskType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.Task",                            /* tp_name */
+    sizeof(TaskObj),                            /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    (destructor)TaskObj_dealloc,                /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+    0,                                          /* tp_reserved */
+    (reprfunc)TaskObj_repr,                     /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    0,                                          /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC |
+        Py_TPFLAGS_BASETYPE,                    /* tp_flags */
+    task_doc,                                   /* tp_doc */
+    (traverseproc)TaskObj_traverse,             /* tp_traverse */
+    (inquiry)TaskObj_clear,                     /* tp_clear */
+    0,                                          /* tp_richcompare */
+    offsetof(TaskObj, task_weakreflist),        /* tp_weaklistoffset */
+    0,                                          /* tp_iter */
+    0,                                          /* tp_iternext */
+    TaskType_methods,                           /* tp_methods */
+    TaskType_members,                           /* tp_members */
+    0,                                          /* tp_getset */
+    &FutureType,                                /* tp_base */
+    0,                                          /* tp_dict */
+    0,                                          /* tp_descr_get */
+    0,                                          /* tp_descr_set */
+    offsetof(TaskObj, dict),                    /* tp_dictoffset */
+    (initproc)TaskObj_init,                     /* tp_init */
+    0,                                          /* tp_alloc */
+    PyType_GenericNew,                          /* tp_new */
+    PyObject_GC_Del,                            /* tp_free */
+};
+
+
+/* module level code ********************************************************/
+
+PyDoc_STRVAR(module_doc, "Accelerator module for asyncio");
+
+static struct PyModuleDef _asynciomodule = {
+    PyModuleDef_HEAD_INIT,
+    "_asyncio",
+    module_doc,
+    -1,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC
+PyInit__asyncio(void)
+{
+    PyObject *m;
+
+    if (state_names[STATE_PENDING] == NULL) {
+        state_names[STATE_PENDING] = PyUnicode_InternFromString("PENDING");
+        state_names[STATE_CANCELLED] =
+            PyUnicode_InternFromString("CANCELLED");
+        state_names[STATE_FINISHED] = PyUnicode_InternFromString("FINISHED");
+        if (state_names[STATE_PENDING] == NULL ||
+            state_names[STATE_CANCELLED] == NULL ||
+            state_names[STATE_FINISHED] == NULL)
+            return NULL;
+    }
+    if (PyType_Ready(&FutureType) < 0)
+        return NULL;
+    if (PyType_Ready(&FutureIterType) < 0)
+        return NULL;
+    if (PyType_Ready(&TaskType) < 0)
+        return NULL;
+
+    m = PyModule_Create(&_asynciomodule);
+    if (m == NULL)
+        return NULL;
+
+    Py_INCREF(&FutureType);
+    if (PyModule_AddObject(m, "Future", (PyObject *)&FutureType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    Py_INCREF(&TaskType);
+    if (PyModule_AddObject(m, "Task", (PyObject *)&TaskType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
+}
@@ -1753,6 +1753,1171 @@ static PyTypeObject defdict_type = {
     PyObject_GC_Del,                    /* tp_free */
 };
 
+/* OrderedDict type *********************************************************/
+
+/* An OrderedDict is a dict keeping its keys in a doubly linked list of
+   nodes, in insertion order.  To find the node of a key without a second
+   hash table, the nodes are also stored in od_fast_nodes, an array indexed
+   by the slot of their key in the hash table of the dict (see
+   _PyDict_GetSlot()).  Slots move when the dict gets a new hash table, so
+   the array is rebuilt when od_resize_sentinel and od_fast_nodes_size no
+   longer match the table of the dict.
+
+   Each node remembers its slot, so that removing it always clears its entry
+   in od_fast_nodes: the array only points to nodes in the list.  A node
+   found in the array is only used if its key is the object held by the
+   slot, which protects against entries made stale by changing the dict
+   behind our back, e.g. with dict.__delitem__(od, key).
+
+   od_state is incremented whenever the list changes.  Iterators keep a
+   pointer to their next node, which is valid as long as od_state is
+   unchanged.
+*/
+
+typedef struct _odictnode {
+    PyObject *key;
+    Py_hash_t hash;
+    Py_ssize_t slot;            /* -1 if not in od_fast_nodes */
+    struct _odictnode *prev;
+    struct _odictnode *next;
+} odictnode;
+
+typedef struct {
+    PyDictObject dict;
+    odictnode *od_first;
+    odictnode *od_last;
+    odictnode **od_fast_nodes;
+    Py_ssize_t od_fast_nodes_size;
+    PyDictKeysObject *od_resize_sentinel;
+    size_t od_state;
+    PyObject *od_inst_dict;
+    PyObject *od_weakreflist;
+} odictobject;
+
+static PyTypeObject odict_type;         /* Forward */
+static PyTypeObject odictiter_type;
+static PyTypeObject odictkeys_type;
+static PyTypeObject odictvalues_type;
+static PyTypeObject odictitems_type;
+
+#define odict_Check(op) PyObject_TypeCheck(op, &odict_type)
+#define odict_CheckExact(op) (Py_TYPE(op) == &odict_type)
+
+#define ODICT_ITER_REVERSED     1
+#define ODICT_ITER_KEYS         2
+#define ODICT_ITER_VALUES       4
+#define ODICT_ITER_ITEMS        (ODICT_ITER_KEYS | ODICT_ITER_VALUES)
+
+/* Rebuild od_fast_nodes if the dict got a new hash table.  This never runs
+   Python code. */
+static int
+odict_sync_fast_nodes(odictobject *od)
+{
+    PyDictKeysObject *table;
+    odictnode **fast_nodes;
+    odictnode *node;
+    PyObject *stored_key;
+    Py_ssize_t size, slot;
+
+    table = _PyDict_GetTable((PyDictObject *)od, &size);
+    if (table == od->od_resize_sentinel && size == od->od_fast_nodes_size)
+        return 0;
+    fast_nodes = PyMem_NEW(odictnode *, size);
+    if (fast_nodes == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(fast_nodes, 0, size * sizeof(odictnode *));
+    for (node = od->od_first; node != NULL; node = node->next) {
+        slot = _PyDict_GetSlot((PyDictObject *)od, node->key, node->hash,
+                               1, &stored_key);
+        if (slot >= 0) {
+            if (fast_nodes[slot] != NULL)
+                fast_nodes[slot]->slot = -1;
+            fast_nodes[slot] = node;
+        }
+        node->slot = slot < 0 ? -1 : slot;
+    }
+    PyMem_FREE(od->od_fast_nodes);
+    od->od_fast_nodes = fast_nodes;
+    od->od_fast_nodes_size = size;
+    od->od_resize_sentinel = table;
+    return 0;
+}
+
+/* Return the node of key, or NULL if it has none.  The node is only valid
+   until Python code runs.  Check PyErr_Occurred() to tell errors from
+   missing keys. */
+static odictnode *
+odict_find_node(odictobject *od, PyObject *key, Py_hash_t hash)
+{
+    odictnode *node;
+    PyObject *stored_key;
+    Py_ssize_t slot;
+
+    slot = _PyDict_GetSlot((PyDictObject *)od, key, hash, 0, &stored_key);
+    if (slot < 0 || odict_sync_fast_nodes(od) < 0)
+        return NULL;
+    node = od->od_fast_nodes[slot];
+    if (node != NULL && node->key == stored_key)
+        return node;
+    return NULL;
+}
+
+static void
+odict_link_node(odictobject *od, odictnode *node, int last)
+{
+    if (last) {
+        node->prev = od->od_last;
+        node->next = NULL;
+        if (od->od_last == NULL)
+            od->od_first = node;
+        else
+            od->od_last->next = node;
+        od->od_last = node;
+    }
+    else {
+        node->prev = NULL;
+        node->next = od->od_first;
+        if (od->od_first == NULL)
+            od->od_last = node;
+        else
+            od->od_first->prev = node;
+        od->od_first = node;
+    }
+    od->od_state++;
+}
+
+static void
+odict_unlink_node(odictobject *od, odictnode *node)
+{
+    if (node->prev == NULL)
+        od->od_first = node->next;
+    else
+        node->prev->next = node->next;
+    if (node->next == NULL)
+        od->od_last = node->prev;
+    else
+        node->next->prev = node->prev;
+    od->od_state++;
+}
+
+/* Unlink node and drop it from od_fast_nodes.  The caller owns the
+   reference to its key afterwards, and must free it. */
+static void
+odict_remove_node(odictobject *od, odictnode *node)
+{
+    Py_ssize_t slot = node->slot;
+
+    odict_unlink_node(od, node);
+    if (slot >= 0 && slot < od->od_fast_nodes_size &&
+        od->od_fast_nodes[slot] == node)
+        od->od_fast_nodes[slot] = NULL;
+}
+
+/* Give the key a node at the end of the list unless it has one. */
+static int
+odict_add_node(odictobject *od, PyObject *key, Py_hash_t hash)
+{
+    odictnode *node;
+    PyObject *stored_key;
+    Py_ssize_t slot;
+
+    slot = _PyDict_GetSlot((PyDictObject *)od, key, hash, 0, &stored_key);
+    if (slot < 0)
+        /* Python code run by the lookup may have deleted the key */
+        return slot == -1 ? 0 : -1;
+    if (odict_sync_fast_nodes(od) < 0)
+        return -1;
+    node = od->od_fast_nodes[slot];
+    if (node != NULL && node->key == stored_key)
+        return 0;
+    node = PyMem_NEW(odictnode, 1);
+    if (node == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    if (od->od_fast_nodes[slot] != NULL)
+        od->od_fast_nodes[slot]->slot = -1;
+    Py_INCREF(stored_key);
+    node->key = stored_key;
+    node->hash = hash;
+    node->slot = slot;
+    od->od_fast_nodes[slot] = node;
+    odict_link_node(od, node, 1);
+    return 0;
+}
+
+/* Free all the nodes.  Nodes hold their own reference to their key, so
+   this only runs Python code for keys no longer in the dict. */
+static void
+odict_clear_nodes(odictobject *od)
+{
+    odictnode *node = od->od_first;
+    odictnode *next;
+
+    od->od_first = od->od_last = NULL;
+    PyMem_FREE(od->od_fast_nodes);
+    od->od_fast_nodes = NULL;
+    od->od_fast_nodes_size = 0;
+    od->od_resize_sentinel = NULL;
+    od->od_state++;
+    while (node != NULL) {
+        next = node->next;
+        Py_DECREF(node->key);
+        PyMem_FREE(node);
+        node = next;
+    }
+}
+
+static int
+odict_setitem(odictobject *od, PyObject *key, PyObject *value)
+{
+    PyObject *type, *val, *tb;
+    Py_hash_t hash;
+
+    hash = PyObject_Hash(key);
+    if (hash == -1)
+        return -1;
+    if (PyDict_SetItem((PyObject *)od, key, value) < 0)
+        return -1;
+    if (odict_add_node(od, key, hash) == 0)
+        return 0;
+    /* Don't leave a key without a node behind */
+    PyErr_Fetch(&type, &val, &tb);
+    if (PyDict_DelItem((PyObject *)od, key) < 0)
+        PyErr_Clear();
+    PyErr_Restore(type, val, tb);
+    return -1;
+}
+
+static int
+odict_delitem(odictobject *od, PyObject *key)
+{
+    odictnode *node;
+    Py_hash_t hash;
+    int res;
+
+    hash = PyObject_Hash(key);
+    if (hash == -1)
+        return -1;
+    node = odict_find_node(od, key, hash);
+    if (node == NULL && PyErr_Occurred())
+        return -1;
+    if (node != NULL)
+        odict_remove_node(od, node);
+    res = PyDict_DelItem((PyObject *)od, key);
+    if (node != NULL) {
+        Py_DECREF(node->key);
+        PyMem_FREE(node);
+    }
+    return res;
+}
+
+static int
+odict_ass_sub(odictobject *od, PyObject *key, PyObject *value)
+{
+    if (value == NULL)
+        return odict_delitem(od, key);
+    return odict_setitem(od, key, value);
+}
+
+static PyMappingMethods odict_as_mapping = {
+    0,                                  /* mp_length */
+    0,                                  /* mp_subscript */
+    (objobjargproc)odict_ass_sub,       /* mp_ass_subscript */
+};
+
+/* Helpers shared with MutableMapping.update(), which the pure Python
+   OrderedDict uses for __init__() and update(). */
+
+static int
+mutablemapping_add_pairs(PyObject *self, PyObject *pairs)
+{
+    PyObject *it, *pair, *fast;
+    int res = 0;
+
+    it = PyObject_GetIter(pairs);
+    if (it == NULL)
+        return -1;
+    while (res == 0 && (pair = PyIter_Next(it)) != NULL) {
+        fast = PySequence_Fast(pair, "cannot convert dictionary update "
+                                     "sequence element to a sequence");
+        Py_DECREF(pair);
+        if (fast == NULL) {
+            res = -1;
+            break;
+        }
+        if (PySequence_Fast_GET_SIZE(fast) != 2) {
+            PyErr_Format(PyExc_ValueError,
+                         "dictionary update sequence element has length "
+                         "%zd; 2 is required",
+                         PySequence_Fast_GET_SIZE(fast));
+            res = -1;
+        }
+        else
+            res = PyObject_SetItem(self, PySequence_Fast_GET_ITEM(fast, 0),
+                                   PySequence_Fast_GET_ITEM(fast, 1));
+        Py_DECREF(fast);
+    }
+    Py_DECREF(it);
+    if (res == 0 && PyErr_Occurred())
+        res = -1;
+    return res;
+}
+
+static int
+mutablemapping_update(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    _Py_IDENTIFIER(keys);
+    PyObject *other, *keys, *it, *key, *value, *items;
+    int res = 0;
+
+    if (PyTuple_GET_SIZE(args) > 1) {
+        PyErr_Format(PyExc_TypeError,
+                     "expected at most 1 arguments, got %zd",
+                     PyTuple_GET_SIZE(args));
+        return -1;
+    }
+    if (PyTuple_GET_SIZE(args) == 1) {
+        other = PyTuple_GET_ITEM(args, 0);
+        if (PyDict_CheckExact(other)) {
+            items = PyDict_Items(other);
+            if (items == NULL)
+                return -1;
+            res = mutablemapping_add_pairs(self, items);
+            Py_DECREF(items);
+        }
+        else if (_PyObject_HasAttrId(other, &PyId_keys)) {
+            keys = _PyObject_CallMethodId(other, &PyId_keys, NULL);
+            if (keys == NULL)
+                return -1;
+            it = PyObject_GetIter(keys);
+            Py_DECREF(keys);
+            if (it == NULL)
+                return -1;
+            while (res == 0 && (key = PyIter_Next(it)) != NULL) {
+                value = PyObject_GetItem(other, key);
+                if (value == NULL)
+                    res = -1;
+                else {
+                    res = PyObject_SetItem(self, key, value);
+                    Py_DECREF(value);
+                }
+                Py_DECREF(key);
+            }
+            Py_DECREF(it);
+            if (res == 0 && PyErr_Occurred())
+                res = -1;
+        }
+        else
+            res = mutablemapping_add_pairs(self, other);
+        if (res < 0)
+            return -1;
+    }
+    if (kwargs != NULL && PyDict_Size(kwargs) > 0) {
+        items = PyDict_Items(kwargs);
+        if (items == NULL)
+            return -1;
+        res = mutablemapping_add_pairs(self, items);
+        Py_DECREF(items);
+    }
+    return res;
+}
+
+static PyObject *odictiter_new(odictobject *od, int kind);
+
+PyDoc_STRVAR(odict_update_doc,
+"D.update([E, ]**F) -> None.  Update D from mapping/iterable E and F.\n\
+If E present and has a .keys() method, does:     for k in E: D[k] = E[k]\n\
+If E present and lacks .keys() method, does:     for (k, v) in E: D[k] = v\n\
+In either case, this is followed by: for k, v in F.items(): D[k] = v");
+
+static PyObject *
+odict_update(PyObject *od, PyObject *args, PyObject *kwargs)
+{
+    if (mutablemapping_update(od, args, kwargs) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(odict_clear_doc,
+"od.clear() -> None.  Remove all items from od.");
+
+static PyObject *
+odict_clear(odictobject *od)
+{
+    /* The nodes go first: with the keys still in the dict, no Python code
+       can run before both are empty. */
+    odict_clear_nodes(od);
+    PyDict_Clear((PyObject *)od);
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(odict_popitem_doc,
+"od.popitem() -> (k, v), return and remove a (key, value) pair.\n\
+Pairs are returned in LIFO order if last is true or FIFO order if false.");
+
+static PyObject *
+odict_popitem(odictobject *od, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"last", 0};
+    odictnode *node;
+    PyObject *key, *value, *result;
+    int last = 1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p:popitem", kwlist,
+                                     &last))
+        return NULL;
+    node = last ? od->od_last : od->od_first;
+    if (node == NULL) {
+        PyErr_SetString(PyExc_KeyError, "dictionary is empty");
+        return NULL;
+    }
+    odict_remove_node(od, node);
+    key = node->key;
+    PyMem_FREE(node);
+    value = PyDict_GetItemWithError((PyObject *)od, key);
+    if (value == NULL) {
+        if (!PyErr_Occurred())
+            PyErr_SetObject(PyExc_KeyError, key);
+        Py_DECREF(key);
+        return NULL;
+    }
+    Py_INCREF(value);
+    if (PyDict_DelItem((PyObject *)od, key) < 0)
+        result = NULL;
+    else
+        result = PyTuple_Pack(2, key, value);
+    Py_DECREF(key);
+    Py_DECREF(value);
+    return result;
+}
+
+PyDoc_STRVAR(odict_move_to_end_doc,
+"Move an existing element to the end (or beginning if last==False).\n\
+\n\
+Raises KeyError if the element does not exist.\n\
+When last=True, acts like a fast version of self[key]=self.pop(key).");
+
+static PyObject *
+odict_move_to_end(odictobject *od, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"key", "last", 0};
+    odictnode *node;
+    PyObject *key;
+    Py_hash_t hash;
+    int last = 1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|p:move_to_end", kwlist,
+                                     &key, &last))
+        return NULL;
+    hash = PyObject_Hash(key);
+    if (hash == -1)
+        return NULL;
+    node = odict_find_node(od, key, hash);
+    if (node == NULL) {
+        if (!PyErr_Occurred())
+            PyErr_SetObject(PyExc_KeyError, key);
+        return NULL;
+    }
+    if (node != (last ? od->od_last : od->od_first)) {
+        odict_unlink_node(od, node);
+        odict_link_node(od, node, last);
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(odict_pop_doc,
+"od.pop(k[,d]) -> v, remove specified key and return the corresponding\n\
+value.  If key is not found, d is returned if given, otherwise KeyError\n\
+is raised.");
+
+static PyObject *
+odict_pop(odictobject *od, PyObject *args)
+{
+    PyObject *key, *value;
+    PyObject *deflt = NULL;
+    int res;
+
+    if (!PyArg_UnpackTuple(args, "pop", 1, 2, &key, &deflt))
+        return NULL;
+    if (odict_CheckExact(od)) {
+        value = PyDict_GetItemWithError((PyObject *)od, key);
+        if (value != NULL) {
+            Py_INCREF(value);
+            if (odict_delitem(od, key) < 0)
+                Py_CLEAR(value);
+            return value;
+        }
+        if (PyErr_Occurred())
+            return NULL;
+    }
+    else {
+        /* Subclasses may override the methods used by the pure Python
+           version */
+        res = PySequence_Contains((PyObject *)od, key);
+        if (res < 0)
+            return NULL;
+        if (res) {
+            value = PyObject_GetItem((PyObject *)od, key);
+            if (value != NULL && PyObject_DelItem((PyObject *)od, key) < 0)
+                Py_CLEAR(value);
+            return value;
+        }
+    }
+    if (deflt == NULL) {
+        PyErr_SetObject(PyExc_KeyError, key);
+        return NULL;
+    }
+    Py_INCREF(deflt);
+    return deflt;
+}
+
+PyDoc_STRVAR(odict_setdefault_doc,
+"od.setdefault(k[,d]) -> od.get(k,d), also set od[k]=d if k not in od");
+
+static PyObject *
+odict_setdefault(odictobject *od, PyObject *args)
+{
+    PyObject *key, *value;
+    PyObject *deflt = Py_None;
+    int res;
+
+    if (!PyArg_UnpackTuple(args, "setdefault", 1, 2, &key, &deflt))
+        return NULL;
+    if (odict_CheckExact(od)) {
+        value = PyDict_GetItemWithError((PyObject *)od, key);
+        if (value != NULL) {
+            Py_INCREF(value);
+            return value;
+        }
+        if (PyErr_Occurred() || odict_setitem(od, key, deflt) < 0)
+            return NULL;
+    }
+    else {
+        res = PySequence_Contains((PyObject *)od, key);
+        if (res < 0)
+            return NULL;
+        if (res)
+            return PyObject_GetItem((PyObject *)od, key);
+        if (PyObject_SetItem((PyObject *)od, key, deflt) < 0)
+            return NULL;
+    }
+    Py_INCREF(deflt);
+    return deflt;
+}
+
+PyDoc_STRVAR(odict_copy_doc, "od.copy() -> a shallow copy of od");
+
+static PyObject *
+odict_copy(odictobject *od)
+{
+    odictobject *od_copy;
+    odictnode *node;
+    PyObject *key, *value;
+    size_t state = od->od_state;
+    int res;
+
+    if (!odict_CheckExact(od))
+        return PyObject_CallFunctionObjArgs((PyObject *)Py_TYPE(od), od,
+                                            NULL);
+    od_copy = (odictobject *)PyObject_CallObject((PyObject *)&odict_type,
+                                                 NULL);
+    if (od_copy == NULL)
+        return NULL;
+    for (node = od->od_first; node != NULL; node = node->next) {
+        key = node->key;
+        Py_INCREF(key);
+        value = PyDict_GetItemWithError((PyObject *)od, key);
+        if (value == NULL) {
+            if (!PyErr_Occurred())
+                PyErr_SetObject(PyExc_KeyError, key);
+            res = -1;
+        }
+        else
+            res = odict_setitem(od_copy, key, value);
+        Py_DECREF(key);
+        if (res == 0 && od->od_state != state) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "OrderedDict mutated during iteration");
+            res = -1;
+        }
+        if (res < 0) {
+            Py_DECREF(od_copy);
+            return NULL;
+        }
+    }
+    return (PyObject *)od_copy;
+}
+
+PyDoc_STRVAR(odict_fromkeys_doc,
+"OD.fromkeys(S[, v]) -> New ordered dictionary with keys from S.\n\
+If not specified, the value defaults to None.");
+
+static PyObject *
+odict_fromkeys(PyObject *cls, PyObject *args, PyObject *kwargs)
+{
+    static char *kwlist[] = {"iterable", "value", 0};
+    PyObject *iterable, *od, *it, *key;
+    PyObject *value = Py_None;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O:fromkeys", kwlist,
+                                     &iterable, &value))
+        return NULL;
+    od = PyObject_CallObject(cls, NULL);
+    if (od == NULL)
+        return NULL;
+    it = PyObject_GetIter(iterable);
+    if (it == NULL) {
+        Py_DECREF(od);
+        return NULL;
+    }
+    while ((key = PyIter_Next(it)) != NULL) {
+        if (PyObject_SetItem(od, key, value) < 0) {
+            Py_DECREF(key);
+            break;
+        }
+        Py_DECREF(key);
+    }
+    Py_DECREF(it);
+    if (PyErr_Occurred()) {
+        Py_DECREF(od);
+        return NULL;
+    }
+    return od;
+}
+
+PyDoc_STRVAR(odict_sizeof_doc, "D.__sizeof__() -> size of D in memory, in bytes");
+
+static PyObject *
+odict_sizeof(odictobject *od)
+{
+    _Py_IDENTIFIER(__sizeof__);
+    PyObject *dict_size;
+    Py_ssize_t res;
+
+    dict_size = _PyObject_CallMethodId((PyObject *)&PyDict_Type,
+                                       &PyId___sizeof__, "O", od);
+    if (dict_size == NULL)
+        return NULL;
+    res = PyLong_AsSsize_t(dict_size);
+    Py_DECREF(dict_size);
+    if (res == -1 && PyErr_Occurred())
+        return NULL;
+    res += sizeof(odictobject) - sizeof(PyDictObject);
+    res += od->od_fast_nodes_size * sizeof(odictnode *);
+    res += ((PyDictObject *)od)->ma_used * sizeof(odictnode);
+    return PyLong_FromSsize_t(res);
+}
+
+static PyObject *
+odict_reduce(odictobject *od)
+{
+    _Py_IDENTIFIER(__dict__);
+    _Py_IDENTIFIER(items);
+    PyObject *state, *args, *items, *iter;
+    PyObject *result = NULL;
+
+    state = _PyObject_GetAttrId((PyObject *)od, &PyId___dict__);
+    if (state == NULL)
+        return NULL;
+    if (PyObject_Size(state) == 0) {
+        Py_DECREF(state);
+        state = Py_None;
+        Py_INCREF(state);
+    }
+    args = PyTuple_New(0);
+    if (args == NULL)
+        goto done;
+    items = _PyObject_CallMethodId((PyObject *)od, &PyId_items, NULL);
+    if (items == NULL)
+        goto done;
+    iter = PyObject_GetIter(items);
+    Py_DECREF(items);
+    if (iter == NULL)
+        goto done;
+    result = PyTuple_Pack(5, Py_TYPE(od), args, state, Py_None, iter);
+    Py_DECREF(iter);
+done:
+    Py_XDECREF(args);
+    Py_DECREF(state);
+    return result;
+}
+
+static PyObject *
+odict_keys(odictobject *od)
+{
+    return _PyDictView_New((PyObject *)od, &odictkeys_type);
+}
+
+static PyObject *
+odict_values(odictobject *od)
+{
+    return _PyDictView_New((PyObject *)od, &odictvalues_type);
+}
+
+static PyObject *
+odict_items(odictobject *od)
+{
+    return _PyDictView_New((PyObject *)od, &odictitems_type);
+}
+
+static PyObject *
+odict_iter(odictobject *od)
+{
+    return odictiter_new(od, ODICT_ITER_KEYS);
+}
+
+static PyObject *
+odict_reversed(odictobject *od)
+{
+    return odictiter_new(od, ODICT_ITER_KEYS | ODICT_ITER_REVERSED);
+}
+
+PyDoc_STRVAR(odict_keys_doc,
+"D.keys() -> a set-like object providing a view on D's keys");
+PyDoc_STRVAR(odict_values_doc,
+"D.values() -> an object providing a view on D's values");
+PyDoc_STRVAR(odict_items_doc,
+"D.items() -> a set-like object providing a view on D's items");
+PyDoc_STRVAR(odict_reversed_doc,
+"od.__reversed__() <==> reversed(od)");
+
+static PyMethodDef odict_methods[] = {
+    {"__sizeof__", (PyCFunction)odict_sizeof, METH_NOARGS,
+     odict_sizeof_doc},
+    {"__reduce__", (PyCFunction)odict_reduce, METH_NOARGS,
+     reduce_doc},
+    {"__reversed__", (PyCFunction)odict_reversed, METH_NOARGS,
+     odict_reversed_doc},
+    {"clear", (PyCFunction)odict_clear, METH_NOARGS,
+     odict_clear_doc},
+    {"copy", (PyCFunction)odict_copy, METH_NOARGS,
+     odict_copy_doc},
+    {"fromkeys", (PyCFunction)odict_fromkeys,
+     METH_VARARGS | METH_KEYWORDS | METH_CLASS, odict_fromkeys_doc},
+    {"items", (PyCFunction)odict_items, METH_NOARGS,
+     odict_items_doc},
+    {"keys", (PyCFunction)odict_keys, METH_NOARGS,
+     odict_keys_doc},
+    {"move_to_end", (PyCFunction)odict_move_to_end,
+     METH_VARARGS | METH_KEYWORDS, odict_move_to_end_doc},
+    {"pop", (PyCFunction)odict_pop, METH_VARARGS,
+     odict_pop_doc},
+    {"popitem", (PyCFunction)odict_popitem, METH_VARARGS | METH_KEYWORDS,
+     odict_popitem_doc},
+    {"setdefault", (PyCFunction)odict_setdefault, METH_VARARGS,
+     odict_setdefault_doc},
+    {"update", (PyCFunction)odict_update, METH_VARARGS | METH_KEYWORDS,
+     odict_update_doc},
+    {"values", (PyCFunction)odict_values, METH_NOARGS,
+     odict_values_doc},
+    {NULL}
+};
+
+static PyGetSetDef odict_getset[] = {
+    {"__dict__", PyObject_GenericGetDict, PyObject_GenericSetDict},
+    {NULL}
+};
+
+/* Compare the order of the keys of two OrderedDicts holding equal items. */
+static int
+odict_keys_equal(odictobject *a, odictobject *b)
+{
+    odictnode *node_a = a->od_first;
+    odictnode *node_b = b->od_first;
+    size_t state_a = a->od_state;
+    size_t state_b = b->od_state;
+    PyObject *key_a, *key_b;
+    int res;
+
+    while (node_a != NULL && node_b != NULL) {
+        key_a = node_a->key;
+        key_b = node_b->key;
+        Py_INCREF(key_a);
+        Py_INCREF(key_b);
+        res = PyObject_RichCompareBool(key_a, key_b, Py_EQ);
+        Py_DECREF(key_a);
+        Py_DECREF(key_b);
+        if (res <= 0)
+            return res;
+        if (a->od_state != state_a || b->od_state != state_b) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "OrderedDict mutated during iteration");
+            return -1;
+        }
+        node_a = node_a->next;
+        node_b = node_b->next;
+    }
+    return node_a == NULL && node_b == NULL;
+}
+
+static PyObject *
+odict_richcompare(PyObject *v, PyObject *w, int op)
+{
+    PyObject *res;
+    int eq;
+
+    if (!odict_Check(v) || !PyDict_Check(w))
+        Py_RETURN_NOTIMPLEMENTED;
+    if ((op != Py_EQ && op != Py_NE) || !odict_Check(w))
+        return PyDict_Type.tp_richcompare(v, w, op);
+    /* Comparison to another OrderedDict is order-sensitive */
+    res = PyDict_Type.tp_richcompare(v, w, Py_EQ);
+    if (res == NULL)
+        return NULL;
+    eq = (res == Py_True);
+    Py_DECREF(res);
+    if (eq) {
+        eq = odict_keys_equal((odictobject *)v, (odictobject *)w);
+        if (eq < 0)
+            return NULL;
+    }
+    return PyBool_FromLong(eq == (op == Py_EQ));
+}
+
+static PyObject *
+odict_repr(odictobject *od)
+{
+    _Py_IDENTIFIER(__name__);
+    _Py_IDENTIFIER(items);
+    PyObject *name, *items, *pieces;
+    PyObject *result = NULL;
+    Py_ssize_t size;
+    int status;
+
+    status = Py_ReprEnter((PyObject *)od);
+    if (status != 0)
+        return status > 0 ? PyUnicode_FromString("...") : NULL;
+    name = _PyObject_GetAttrId((PyObject *)Py_TYPE(od), &PyId___name__);
+    if (name == NULL)
+        goto done;
+    size = PyObject_Size((PyObject *)od);
+    if (size < 0)
+        goto done;
+    if (size == 0) {
+        result = PyUnicode_FromFormat("%S()", name);
+        goto done;
+    }
+    items = _PyObject_CallMethodId((PyObject *)od, &PyId_items, NULL);
+    if (items == NULL)
+        goto done;
+    pieces = PySequence_List(items);
+    Py_DECREF(items);
+    if (pieces == NULL)
+        goto done;
+    result = PyUnicode_FromFormat("%S(%R)", name, pieces);
+    Py_DECREF(pieces);
+done:
+    Py_XDECREF(name);
+    Py_ReprLeave((PyObject *)od);
+    return result;
+}
+
+static void
+odict_dealloc(odictobject *od)
+{
+    PyObject_GC_UnTrack(od);
+    if (od->od_weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)od);
+    Py_CLEAR(od->od_inst_dict);
+    odict_clear_nodes(od);
+    PyDict_Type.tp_dealloc((PyObject *)od);
+}
+
+static int
+odict_traverse(odictobject *od, visitproc visit, void *arg)
+{
+    odictnode *node;
+
+    Py_VISIT(od->od_inst_dict);
+    for (node = od->od_first; node != NULL; node = node->next)
+        Py_VISIT(node->key);
+    return PyDict_Type.tp_traverse((PyObject *)od, visit, arg);
+}
+
+static int
+odict_tp_clear(odictobject *od)
+{
+    Py_CLEAR(od->od_inst_dict);
+    odict_clear_nodes(od);
+    return PyDict_Type.tp_clear((PyObject *)od);
+}
+
+static int
+odict_init(PyObject *self, PyObject *args, PyObject *kwds)
+{
+    return mutablemapping_update(self, args, kwds);
+}
+
+PyDoc_STRVAR(odict_doc,
+"Dictionary that remembers insertion order");
+
+static PyTypeObject odict_type = {
+    PyVarObject_HEAD_INIT(DEFERRED_ADDRESS(&PyType_Type), 0)
+    "collections.OrderedDict",          /* tp_name */
+    sizeof(odictobject),                /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    /* methods */
+    (destructor)odict_dealloc,          /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    (reprfunc)odict_repr,               /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    &odict_as_mapping,                  /* tp_as_mapping */
+    PyObject_HashNotImplemented,        /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    PyObject_GenericGetAttr,            /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC,
+                                    /* tp_flags */
+    odict_doc,                          /* tp_doc */
+    (traverseproc)odict_traverse,       /* tp_traverse */
+    (inquiry)odict_tp_clear,            /* tp_clear */
+    odict_richcompare,                  /* tp_richcompare */
+    offsetof(odictobject, od_weakreflist), /* tp_weaklistoffset */
+    (getiterfunc)odict_iter,            /* tp_iter */
+    0,                                  /* tp_iternext */
+    odict_methods,                      /* tp_methods */
+    0,                                  /* tp_members */
+    odict_getset,                       /* tp_getset */
+    DEFERRED_ADDRESS(&PyDict_Type),     /* tp_base */
+    0,                                  /* tp_dict */
+    0,                                  /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    offsetof(odictobject, od_inst_dict), /* tp_dictoffset */
+    odict_init,                         /* tp_init */
+    PyType_GenericAlloc,                /* tp_alloc */
+    0,                                  /* tp_new */
+    PyObject_GC_Del,                    /* tp_free */
+};
+
+/* OrderedDict iterator *****************************************************/
+
+typedef struct {
+    PyObject_HEAD
+    odictobject *di_odict;
+    odictnode *di_node;         /* Next node to return */
+    size_t di_state;
+    int di_kind;
+} odictiterobject;
+
+static PyObject *
+odictiter_new(odictobject *od, int kind)
+{
+    odictiterobject *di;
+
+    di = PyObject_GC_New(odictiterobject, &odictiter_type);
+    if (di == NULL)
+        return NULL;
+    Py_INCREF(od);
+    di->di_odict = od;
+    di->di_node = kind & ODICT_ITER_REVERSED ? od->od_last : od->od_first;
+    di->di_state = od->od_state;
+    di->di_kind = kind;
+    PyObject_GC_Track(di);
+    return (PyObject *)di;
+}
+
+static void
+odictiter_dealloc(odictiterobject *di)
+{
+    PyObject_GC_UnTrack(di);
+    Py_XDECREF(di->di_odict);
+    PyObject_GC_Del(di);
+}
+
+static int
+odictiter_traverse(odictiterobject *di, visitproc visit, void *arg)
+{
+    Py_VISIT(di->di_odict);
+    return 0;
+}
+
+static PyObject *
+odictiter_iternext(odictiterobject *di)
+{
+    odictnode *node;
+    PyObject *key, *value, *result;
+
+    if (di->di_odict == NULL)
+        return NULL;
+    if (di->di_state != di->di_odict->od_state) {
+        /* Stays an error, od_state only grows */
+        PyErr_SetString(PyExc_RuntimeError,
+                        "OrderedDict mutated during iteration");
+        return NULL;
+    }
+    node = di->di_node;
+    if (node == NULL) {
+        Py_CLEAR(di->di_odict);
+        return NULL;
+    }
+    di->di_node = di->di_kind & ODICT_ITER_REVERSED ? node->prev : node->next;
+    key = node->key;
+    Py_INCREF(key);
+    if (!(di->di_kind & ODICT_ITER_VALUES))
+        return key;
+    value = PyDict_GetItemWithError((PyObject *)di->di_odict, key);
+    if (value == NULL) {
+        if (!PyErr_Occurred())
+            PyErr_SetObject(PyExc_KeyError, key);
+        Py_DECREF(key);
+        return NULL;
+    }
+    if (!(di->di_kind & ODICT_ITER_KEYS)) {
+        Py_DECREF(key);
+        Py_INCREF(value);
+        return value;
+    }
+    result = PyTuple_Pack(2, key, value);
+    Py_DECREF(key);
+    return result;
+}
+
+static PyTypeObject odictiter_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "odict_iterator",                   /* tp_name */
+    sizeof(odictiterobject),            /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    /* methods */
+    (destructor)odictiter_dealloc,      /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    PyObject_GenericGetAttr,            /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC, /* tp_flags */
+    0,                                  /* tp_doc */
+    (traverseproc)odictiter_traverse,   /* tp_traverse */
+    0,                                  /* tp_clear */
+    0,                                  /* tp_richcompare */
+    0,                                  /* tp_weaklistoffset */
+    PyObject_SelfIter,                  /* tp_iter */
+    (iternextfunc)odictiter_iternext,   /* tp_iternext */
+};
+
+/* OrderedDict views ********************************************************/
+
+/* The views are the dict views, iterating in order. */
+
+static PyObject *
+odictview_iter(_PyDictViewObject *dv, int kind)
+{
+    return odictiter_new((odictobject *)dv->dv_dict, kind);
+}
+
+static PyObject *
+odictkeys_iter(_PyDictViewObject *dv)
+{
+    return odictview_iter(dv, ODICT_ITER_KEYS);
+}
+
+static PyObject *
+odictkeys_reversed(_PyDictViewObject *dv)
+{
+    return odictview_iter(dv, ODICT_ITER_KEYS | ODICT_ITER_REVERSED);
+}
+
+static PyObject *
+odictvalues_iter(_PyDictViewObject *dv)
+{
+    return odictview_iter(dv, ODICT_ITER_VALUES);
+}
+
+static PyObject *
+odictvalues_reversed(_PyDictViewObject *dv)
+{
+    return odictview_iter(dv, ODICT_ITER_VALUES | ODICT_ITER_REVERSED);
+}
+
+static PyObject *
+odictitems_iter(_PyDictViewObject *dv)
+{
+    return odictview_iter(dv, ODICT_ITER_ITEMS);
+}
+
+static PyObject *
+odictitems_reversed(_PyDictViewObject *dv)
+{
+    return odictview_iter(dv, ODICT_ITER_ITEMS | ODICT_ITER_REVERSED);
+}
+
+static PyMethodDef odictkeys_methods[] = {
+    {"__reversed__", (PyCFunction)odictkeys_reversed, METH_NOARGS, NULL},
+    {NULL}
+};
+
+static PyMethodDef odictvalues_methods[] = {
+    {"__reversed__", (PyCFunction)odictvalues_reversed, METH_NOARGS, NULL},
+    {NULL}
+};
+
+static PyMethodDef odictitems_methods[] = {
+    {"__reversed__", (PyCFunction)odictitems_reversed, METH_NOARGS, NULL},
+    {NULL}
+};
+
+#define ODICTVIEW_TYPE(NAME, ITER, METHODS, BASE)                       \
+    {                                                                   \
+    PyVarObject_HEAD_INIT(NULL, 0)                                      \
+    NAME,                               /* tp_name */                   \
+    sizeof(_PyDictViewObject),          /* tp_basicsize */              \
+    0,                                  /* tp_itemsize */               \
+    0,                                  /* tp_dealloc */                \
+    0,                                  /* tp_print */                  \
+    0,                                  /* tp_getattr */                \
+    0,                                  /* tp_setattr */                \
+    0,                                  /* tp_reserved */               \
+    0,                                  /* tp_repr */                   \
+    0,                                  /* tp_as_number */              \
+    0,                                  /* tp_as_sequence */            \
+    0,                                  /* tp_as_mapping */             \
+    0,                                  /* tp_hash */                   \
+    0,                                  /* tp_call */                   \
+    0,                                  /* tp_str */                    \
+    0,                                  /* tp_getattro */               \
+    0,                                  /* tp_setattro */               \
+    0,                                  /* tp_as_buffer */              \
+    Py_TPFLAGS_DEFAULT,                 /* tp_flags */                  \
+    0,                                  /* tp_doc */                    \
+    0,                                  /* tp_traverse */               \
+    0,                                  /* tp_clear */                  \
+    0,                                  /* tp_richcompare */            \
+    0,                                  /* tp_weaklistoffset */         \
+    (getiterfunc)ITER,                  /* tp_iter */                   \
+    0,                                  /* tp_iternext */               \
+    METHODS,                            /* tp_methods */                \
+    0,                                  /* tp_members */                \
+    0,                                  /* tp_getset */                 \
+    DEFERRED_ADDRESS(BASE),             /* tp_base */                   \
+    }
+
+static PyTypeObject odictkeys_type =
+    ODICTVIEW_TYPE("odict_keys", odictkeys_iter, odictkeys_methods,
+                   &PyDictKeys_Type);
+static PyTypeObject odictvalues_type =
+    ODICTVIEW_TYPE("odict_values", odictvalues_iter, odictvalues_methods,
+                   &PyDictValues_Type);
+static PyTypeObject odictitems_type =
+    ODICTVIEW_TYPE("odict_items", odictitems_iter, odictitems_methods,
+                   &PyDictItems_Type);
+
 /* helper function for Counter  *********************************************/
 
 PyDoc_STRVAR(_count_elements_doc,
@@ -1860,6 +3025,7 @@ PyDoc_STRVAR(module_doc,
 "High performance data structures.\n\
 - deque:        ordered collection accessible from endpoints only\n\
 - defaultdict:  dict subclass with a default value factory\n\
+- OrderedDict:  dict subclass that remembers insertion order\n\
 ");
 
 static struct PyMethodDef module_functions[] = {
@@ -1899,6 +3065,22 @@ PyInit__collections(void)
     Py_INCREF(&defdict_type);
     PyModule_AddObject(m, "defaultdict", (PyObject *)&defdict_type);
 
+    odict_type.tp_base = &PyDict_Type;
+    if (PyType_Ready(&odict_type) < 0)
+        return NULL;
+    Py_INCREF(&odict_type);
+    PyModule_AddObject(m, "OrderedDict", (PyObject *)&odict_type);
+
+    if (PyType_Ready(&odictiter_type) < 0)
+        return NULL;
+    odictkeys_type.tp_base = &PyDictKeys_Type;
+    odictvalues_type.tp_base = &PyDictValues_Type;
+    odictitems_type.tp_base = &PyDictItems_Type;
+    if (PyType_Ready(&odictkeys_type) < 0 ||
+        PyType_Ready(&odictvalues_type) < 0 ||
+        PyType_Ready(&odictitems_type) < 0)
+        return NULL;
+
     if (PyType_Ready(&dequeiter_type) < 0)
         return NULL;
     Py_INCREF(&dequeiter_type);
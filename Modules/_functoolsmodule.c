@@ -540,6 +540,599 @@ For example, reduce(lambda x, y: x+y, [1, 2, 3, 4, 5]) calculates\n\
 of the sequence in the calculation, and serves as a default when the\n\
 sequence is empty.");
 
+/* lru_cache object **********************************************************/
+
+/* This is the C version of functools._lru_cache_wrapper().  It differs from
+   the pure Python version in a few ways:
+
+   - It relies on the GIL instead of a lock: no Python code runs while the
+     linked list is being updated.
+
+   - The list is made of lru_list_elem objects, which are owned by the cache
+     dict.  Their prev and next fields are borrowed references.  A link that
+     gets deallocated while still linked removes itself from the list, so a
+     reentrant call replacing a cache entry can't leave a dangling link.
+
+   - The key is hashed once, and the "known hash" dict functions are used
+     for every later lookup, instead of the _HashedSeq wrapper.
+*/
+
+typedef struct lru_list_elem {
+    PyObject_HEAD
+    struct lru_list_elem *prev, *next;  /* borrowed references */
+    Py_hash_t hash;
+    PyObject *key, *result;
+} lru_list_elem;
+
+static void
+lru_cache_extricate_link(lru_list_elem *link)
+{
+    if (link->prev != NULL) {
+        link->prev->next = link->next;
+        link->next->prev = link->prev;
+        link->prev = link->next = NULL;
+    }
+}
+
+static void
+lru_list_elem_dealloc(lru_list_elem *link)
+{
+    lru_cache_extricate_link(link);
+    Py_XDECREF(link->key);
+    Py_XDECREF(link->result);
+    PyObject_Del(link);
+}
+
+static PyTypeObject lru_list_elem_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "functools._lru_list_elem",         /* tp_name */
+    sizeof(lru_list_elem),              /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    /* methods */
+    (destructor)lru_list_elem_dealloc,  /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    0,                                  /* tp_call */
+    0,                                  /* tp_str */
+    0,                                  /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                 /* tp_flags */
+};
+
+
+struct lru_cache_object;
+
+typedef PyObject *(*lru_cache_ternaryfunc)(struct lru_cache_object *,
+                                           PyObject *, PyObject *);
+
+typedef struct lru_cache_object {
+    PyObject_HEAD
+    lru_list_elem root;  /* only prev and next are used */
+    Py_ssize_t maxsize;
+    PyObject *maxsize_O;
+    PyObject *func;
+    lru_cache_ternaryfunc wrapper;
+    PyObject *cache;
+    PyObject *cache_info_type;
+    Py_ssize_t misses, hits;
+    int typed;
+    PyObject *dict;
+    PyObject *weakreflist;
+} lru_cache_object;
+
+static PyTypeObject lru_cache_type;
+
+/* Separates positional from keyword arguments in the keys */
+static PyObject *kwd_mark = NULL;
+
+static PyObject *
+lru_cache_make_key(PyObject *args, PyObject *kwds, int typed)
+{
+    PyObject *key, *sorted_items, *item;
+    Py_ssize_t nargs, nkwds, key_size, i, key_pos;
+
+    nargs = PyTuple_GET_SIZE(args);
+    nkwds = kwds != NULL ? PyDict_Size(kwds) : 0;
+    if (!typed && nkwds == 0) {
+        /* A single argument of a type caching its hash is its own key */
+        if (nargs == 1) {
+            key = PyTuple_GET_ITEM(args, 0);
+            if (PyUnicode_CheckExact(key) || PyLong_CheckExact(key) ||
+                PyFrozenSet_CheckExact(key) || key == Py_None) {
+                Py_INCREF(key);
+                return key;
+            }
+        }
+        Py_INCREF(args);
+        return args;
+    }
+
+    sorted_items = NULL;
+    if (nkwds != 0) {
+        sorted_items = PyDict_Items(kwds);
+        if (sorted_items == NULL)
+            return NULL;
+        if (PyList_Sort(sorted_items) < 0) {
+            Py_DECREF(sorted_items);
+            return NULL;
+        }
+        /* A keyword argument function may have mutated kwds while sorting */
+        nkwds = PyList_GET_SIZE(sorted_items);
+    }
+
+    key_size = nargs;
+    if (nkwds != 0)
+        key_size += 1 + 2 * nkwds;
+    if (typed)
+        key_size += nargs + nkwds;
+    key = PyTuple_New(key_size);
+    if (key == NULL) {
+        Py_XDECREF(sorted_items);
+        return NULL;
+    }
+    key_pos = 0;
+    for (i = 0; i < nargs; i++) {
+        item = PyTuple_GET_ITEM(args, i);
+        Py_INCREF(item);
+        PyTuple_SET_ITEM(key, key_pos++, item);
+    }
+    if (nkwds != 0) {
+        Py_INCREF(kwd_mark);
+        PyTuple_SET_ITEM(key, key_pos++, kwd_mark);
+        for (i = 0; i < nkwds; i++) {
+            PyObject *pair = PyList_GET_ITEM(sorted_items, i);
+            item = PyTuple_GET_ITEM(pair, 0);
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(key, key_pos++, item);
+            item = PyTuple_GET_ITEM(pair, 1);
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(key, key_pos++, item);
+        }
+    }
+    if (typed) {
+        for (i = 0; i < nargs; i++) {
+            item = (PyObject *)Py_TYPE(PyTuple_GET_ITEM(args, i));
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(key, key_pos++, item);
+        }
+        for (i = 0; i < nkwds; i++) {
+            PyObject *pair = PyList_GET_ITEM(sorted_items, i);
+            item = (PyObject *)Py_TYPE(PyTuple_GET_ITEM(pair, 1));
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(key, key_pos++, item);
+        }
+    }
+    assert(key_pos == key_size);
+    Py_XDECREF(sorted_items);
+    return key;
+}
+
+static PyObject *
+uncached_lru_cache_wrapper(lru_cache_object *self,
+                           PyObject *args, PyObject *kwds)
+{
+    PyObject *result = PyObject_Call(self->func, args, kwds);
+    if (result == NULL)
+        return NULL;
+    self->misses++;
+    return result;
+}
+
+static PyObject *
+infinite_lru_cache_wrapper(lru_cache_object *self,
+                           PyObject *args, PyObject *kwds)
+{
+    PyObject *result;
+    Py_hash_t hash;
+    PyObject *key = lru_cache_make_key(args, kwds, self->typed);
+    if (key == NULL)
+        return NULL;
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    result = _PyDict_GetItem_KnownHash(self->cache, key, hash);
+    if (result != NULL) {
+        Py_INCREF(result);
+        self->hits++;
+        Py_DECREF(key);
+        return result;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    result = PyObject_Call(self->func, args, kwds);
+    if (result == NULL) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    if (_PyDict_SetItem_KnownHash(self->cache, key, result, hash) < 0) {
+        Py_DECREF(result);
+        Py_DECREF(key);
+        return NULL;
+    }
+    Py_DECREF(key);
+    self->misses++;
+    return result;
+}
+
+/* Link at the most recently used end of the list, moving the link there if
+   it is already linked. */
+static void
+lru_cache_append_link(lru_cache_object *self, lru_list_elem *link)
+{
+    lru_list_elem *root = &self->root;
+    lru_list_elem *last;
+
+    lru_cache_extricate_link(link);
+    last = root->prev;
+    last->next = root->prev = link;
+    link->prev = last;
+    link->next = root;
+}
+
+static PyObject *
+bounded_lru_cache_wrapper(lru_cache_object *self,
+                          PyObject *args, PyObject *kwds)
+{
+    lru_list_elem *link;
+    PyObject *key, *result, *oldkey, *oldresult;
+    Py_hash_t hash;
+
+    key = lru_cache_make_key(args, kwds, self->typed);
+    if (key == NULL)
+        return NULL;
+    hash = PyObject_Hash(key);
+    if (hash == -1) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    link = (lru_list_elem *)_PyDict_GetItem_KnownHash(self->cache, key, hash);
+    if (link != NULL) {
+        lru_cache_append_link(self, link);
+        result = link->result;
+        Py_INCREF(result);
+        self->hits++;
+        Py_DECREF(key);
+        return result;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    result = PyObject_Call(self->func, args, kwds);
+    if (result == NULL) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    self->misses++;
+    if (_PyDict_GetItem_KnownHash(self->cache, key, hash) != NULL) {
+        /* Getting here means that this same key was added to the cache
+           while the function was running.  The link update is already
+           done, we need only return the computed result. */
+        Py_DECREF(key);
+        return result;
+    }
+    if (PyErr_Occurred()) {
+        Py_DECREF(result);
+        Py_DECREF(key);
+        return NULL;
+    }
+
+    if (PyDict_Size(self->cache) < self->maxsize ||
+        self->root.next == &self->root)
+    {
+        /* Cache is not full, so put the result in a new link */
+        link = PyObject_New(lru_list_elem, &lru_list_elem_type);
+        if (link == NULL) {
+            Py_DECREF(result);
+            Py_DECREF(key);
+            return NULL;
+        }
+        link->prev = link->next = NULL;
+        link->hash = hash;
+        link->key = key;
+        link->result = result;
+        Py_INCREF(result);
+        if (_PyDict_SetItem_KnownHash(self->cache, key, (PyObject *)link,
+                                      hash) < 0) {
+            Py_DECREF(link);
+            Py_DECREF(result);
+            return NULL;
+        }
+        lru_cache_append_link(self, link);
+        Py_DECREF(link);
+        return result;
+    }
+
+    /* Cache is full, so reuse the oldest link for the new key and result.
+       Keep our own reference to it while it is out of the cache dict. */
+    link = self->root.next;
+    lru_cache_extricate_link(link);
+    Py_INCREF(link);
+    if (_PyDict_DelItem_KnownHash(self->cache, link->key, link->hash) < 0) {
+        Py_DECREF(link);
+        if (!PyErr_ExceptionMatches(PyExc_KeyError)) {
+            Py_DECREF(result);
+            Py_DECREF(key);
+            return NULL;
+        }
+        /* The oldest key was removed by a reentrant call: nothing to evict
+           anymore, and the result can go without being cached. */
+        PyErr_Clear();
+        Py_DECREF(key);
+        return result;
+    }
+    /* Keep references to the old key and result so that their clean-up
+       code (i.e. __del__) can't run before the links are consistent. */
+    oldkey = link->key;
+    oldresult = link->result;
+    link->hash = hash;
+    link->key = key;
+    link->result = result;
+    Py_INCREF(result);
+    if (_PyDict_SetItem_KnownHash(self->cache, key, (PyObject *)link,
+                                  hash) < 0) {
+        Py_DECREF(link);
+        Py_DECREF(oldkey);
+        Py_DECREF(oldresult);
+        Py_DECREF(result);
+        return NULL;
+    }
+    lru_cache_append_link(self, link);
+    Py_DECREF(link);
+    Py_DECREF(oldkey);
+    Py_DECREF(oldresult);
+    return result;
+}
+
+static PyObject *
+lru_cache_new(PyTypeObject *type, PyObject *args, PyObject *kw)
+{
+    PyObject *func, *maxsize_O, *cache_info_type, *cachedict;
+    int typed;
+    lru_cache_object *obj;
+    Py_ssize_t maxsize;
+    lru_cache_ternaryfunc wrapper;
+    static char *keywords[] = {"user_function", "maxsize", "typed",
+                               "cache_info_type", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kw, "OOpO:lru_cache", keywords,
+                                     &func, &maxsize_O, &typed,
+                                     &cache_info_type)) {
+        return NULL;
+    }
+
+    if (!PyCallable_Check(func)) {
+        PyErr_SetString(PyExc_TypeError,
+                        "the first argument must be callable");
+        return NULL;
+    }
+
+    /* select the caching function from maxsize */
+    if (maxsize_O == Py_None) {
+        wrapper = infinite_lru_cache_wrapper;
+        maxsize = -1;
+    } else if (PyIndex_Check(maxsize_O)) {
+        maxsize = PyNumber_AsSsize_t(maxsize_O, PyExc_OverflowError);
+        if (maxsize == -1 && PyErr_Occurred())
+            return NULL;
+        if (maxsize == 0)
+            wrapper = uncached_lru_cache_wrapper;
+        else
+            wrapper = bounded_lru_cache_wrapper;
+    } else {
+        PyErr_SetString(PyExc_TypeError,
+                        "Expected maxsize to be an integer or None");
+        return NULL;
+    }
+
+    cachedict = PyDict_New();
+    if (cachedict == NULL)
+        return NULL;
+
+    obj = (lru_cache_object *)type->tp_alloc(type, 0);
+    if (obj == NULL) {
+        Py_DECREF(cachedict);
+        return NULL;
+    }
+
+    obj->root.prev = &obj->root;
+    obj->root.next = &obj->root;
+    obj->maxsize = maxsize;
+    Py_INCREF(maxsize_O);
+    obj->maxsize_O = maxsize_O;
+    Py_INCREF(func);
+    obj->func = func;
+    obj->wrapper = wrapper;
+    obj->cache = cachedict;
+    Py_INCREF(cache_info_type);
+    obj->cache_info_type = cache_info_type;
+    obj->misses = obj->hits = 0;
+    obj->typed = typed;
+    obj->dict = NULL;
+    obj->weakreflist = NULL;
+    return (PyObject *)obj;
+}
+
+/* Unlink all the links, leaving them to the cache dict */
+static void
+lru_cache_clear_list(lru_cache_object *self)
+{
+    lru_list_elem *root = &self->root;
+    lru_list_elem *link = root->next;
+
+    while (link != root) {
+        lru_list_elem *next = link->next;
+        link->prev = link->next = NULL;
+        link = next;
+    }
+    root->prev = root->next = root;
+}
+
+static int
+lru_cache_tp_clear(lru_cache_object *self)
+{
+    lru_cache_clear_list(self);
+    Py_CLEAR(self->func);
+    Py_CLEAR(self->cache);
+    Py_CLEAR(self->cache_info_type);
+    Py_CLEAR(self->dict);
+    return 0;
+}
+
+static void
+lru_cache_dealloc(lru_cache_object *obj)
+{
+    PyObject_GC_UnTrack(obj);
+    if (obj->weakreflist != NULL)
+        PyObject_ClearWeakRefs((PyObject *)obj);
+    lru_cache_tp_clear(obj);
+    Py_XDECREF(obj->maxsize_O);
+    Py_TYPE(obj)->tp_free(obj);
+}
+
+static PyObject *
+lru_cache_call(lru_cache_object *self, PyObject *args, PyObject *kwds)
+{
+    return self->wrapper(self, args, kwds);
+}
+
+static PyObject *
+lru_cache_descr_get(PyObject *self, PyObject *obj, PyObject *type)
+{
+    if (obj == Py_None || obj == NULL) {
+        Py_INCREF(self);
+        return self;
+    }
+    return PyMethod_New(self, obj);
+}
+
+static PyObject *
+lru_cache_cache_info(lru_cache_object *self, PyObject *unused)
+{
+    return PyObject_CallFunction(self->cache_info_type, "nnOn",
+                                 self->hits, self->misses, self->maxsize_O,
+                                 PyDict_Size(self->cache));
+}
+
+static PyObject *
+lru_cache_cache_clear(lru_cache_object *self, PyObject *unused)
+{
+    lru_cache_clear_list(self);
+    self->hits = self->misses = 0;
+    PyDict_Clear(self->cache);
+    Py_RETURN_NONE;
+}
+
+/* Pickle and copy the wrapper by reference, like the function it wraps */
+static PyObject *
+lru_cache_reduce(PyObject *self, PyObject *unused)
+{
+    return PyObject_GetAttrString(self, "__qualname__");
+}
+
+static int
+lru_cache_tp_traverse(lru_cache_object *self, visitproc visit, void *arg)
+{
+    lru_list_elem *link = self->root.next;
+    while (link != &self->root) {
+        lru_list_elem *next = link->next;
+        Py_VISIT(link->key);
+        Py_VISIT(link->result);
+        link = next;
+    }
+    Py_VISIT(self->maxsize_O);
+    Py_VISIT(self->func);
+    Py_VISIT(self->cache);
+    Py_VISIT(self->cache_info_type);
+    Py_VISIT(self->dict);
+    return 0;
+}
+
+PyDoc_STRVAR(lru_cache_doc,
+"Create a cached callable that wraps another function.\n\
+\n\
+user_function:      the function being cached\n\
+\n\
+maxsize:  0         for no caching\n\
+          None      for unlimited cache size\n\
+          n         for a bounded cache\n\
+\n\
+typed:    False     cache f(3) and f(3.0) as identical calls\n\
+          True      cache f(3) and f(3.0) as distinct calls\n\
+\n\
+cache_info_type:    namedtuple class with the fields:\n\
+                        hits misses currsize maxsize\n"
+);
+
+static PyMethodDef lru_cache_methods[] = {
+    {"cache_info", (PyCFunction)lru_cache_cache_info, METH_NOARGS,
+     "Report cache statistics"},
+    {"cache_clear", (PyCFunction)lru_cache_cache_clear, METH_NOARGS,
+     "Clear the cache and cache statistics"},
+    {"__reduce__", (PyCFunction)lru_cache_reduce, METH_NOARGS},
+    {NULL,              NULL}           /* sentinel */
+};
+
+static PyGetSetDef lru_cache_getsetlist[] = {
+    {"__dict__", PyObject_GenericGetDict, PyObject_GenericSetDict},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject lru_cache_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "functools._lru_cache_wrapper",     /* tp_name */
+    sizeof(lru_cache_object),           /* tp_basicsize */
+    0,                                  /* tp_itemsize */
+    /* methods */
+    (destructor)lru_cache_dealloc,      /* tp_dealloc */
+    0,                                  /* tp_print */
+    0,                                  /* tp_getattr */
+    0,                                  /* tp_setattr */
+    0,                                  /* tp_reserved */
+    0,                                  /* tp_repr */
+    0,                                  /* tp_as_number */
+    0,                                  /* tp_as_sequence */
+    0,                                  /* tp_as_mapping */
+    0,                                  /* tp_hash */
+    (ternaryfunc)lru_cache_call,        /* tp_call */
+    0,                                  /* tp_str */
+    0,                                  /* tp_getattro */
+    0,                                  /* tp_setattro */
+    0,                                  /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HAVE_GC,
+                                        /* tp_flags */
+    lru_cache_doc,                      /* tp_doc */
+    (traverseproc)lru_cache_tp_traverse,/* tp_traverse */
+    (inquiry)lru_cache_tp_clear,        /* tp_clear */
+    0,                                  /* tp_richcompare */
+    offsetof(lru_cache_object, weakreflist),    /* tp_weaklistoffset */
+    0,                                  /* tp_iter */
+    0,                                  /* tp_iternext */
+    lru_cache_methods,                  /* tp_methods */
+    0,                                  /* tp_members */
+    lru_cache_getsetlist,               /* tp_getset */
+    0,                                  /* tp_base */
+    0,                                  /* tp_dict */
+    lru_cache_descr_get,                /* tp_descr_get */
+    0,                                  /* tp_descr_set */
+    offsetof(lru_cache_object, dict),   /* tp_dictoffset */
+    0,                                  /* tp_init */
+    0,                                  /* tp_alloc */
+    lru_cache_new,                      /* tp_new */
+};
+
 /* module level code ********************************************************/
 
 PyDoc_STRVAR(module_doc,
@@ -573,6 +1166,7 @@ PyInit__functools(void)
     char *name;
     PyTypeObject *typelist[] = {
         &partial_type,
+        &lru_cache_type,
         NULL
     };
 
@@ -580,6 +1174,18 @@ PyInit__functools(void)
     if (m == NULL)
         return NULL;
 
+    if (PyType_Ready(&lru_list_elem_type) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    if (kwd_mark == NULL) {
+        kwd_mark = PyObject_CallObject((PyObject *)&PyBaseObject_Type, NULL);
+        if (kwd_mark == NULL) {
+            Py_DECREF(m);
+            return NULL;
+        }
+    }
+
     for (i=0 ; typelist[i] != NULL ; i++) {
         if (PyType_Ready(typelist[i]) < 0) {
             Py_DECREF(m);
@@ -61,7 +61,30 @@ PyDoc_STRVAR(iobase_doc,
 
 _Py_IDENTIFIER(__IOBase_closed);
 #define IS_CLOSED(self) \
-    _PyObject_HasAttrId(self, &PyId___IOBase_closed)
+    iobase_is_closed(self)
+
+/* Same as _PyObject_HasAttrId(self, &PyId___IOBase_closed), but looks
+   directly into the instance dict when attribute lookup is the generic one.
+   The attribute is missing until close() is called, and raising and
+   clearing an AttributeError is costly: buffered objects wrapping a raw
+   stream written in Python check it on every readline(). */
+static int
+iobase_is_closed(PyObject *self)
+{
+    PyObject *name, **dictptr;
+
+    name = _PyUnicode_FromId(&PyId___IOBase_closed);
+    if (name == NULL) {
+        PyErr_Clear();
+        return 0;
+    }
+    if (Py_TYPE(self)->tp_getattro != PyObject_GenericGetAttr ||
+        _PyType_Lookup(Py_TYPE(self), name) != NULL)
+        return _PyObject_HasAttrId(self, &PyId___IOBase_closed);
+    dictptr = _PyObject_GetDictPtr(self);
+    return dictptr != NULL && *dictptr != NULL &&
+           PyDict_GetItem(*dictptr, name) != NULL;
+}
 
 _Py_IDENTIFIER(read);
 
@@ -25,8 +25,19 @@ typedef struct _PyScannerObject {
     PyObject *parse_int;
     PyObject *parse_constant;
     PyObject *memo;
+    PyObject *shapes;
+    PyObject *last_shape;
+    PyObject *last_proto;
 } PyScannerObject;
 
+/* The scanner keeps one str object for each key it has decoded in memo,
+   cleared on each call, and a dict of the keys of each shape of JSON objects
+   (the tuple of their keys) in shapes, which the dicts of that shape share
+   as split tables.  Shapes are kept between calls, up to this number. */
+#define SHAPES_MAX 256
+/* Larger JSON objects are decoded to ordinary dicts */
+#define SHAPE_MAX_KEYS 16
+
 static PyMemberDef scanner_members[] = {
     {"strict", T_OBJECT, offsetof(PyScannerObject, strict), READONLY, "strict"},
     {"object_hook", T_OBJECT, offsetof(PyScannerObject, object_hook), READONLY, "object_hook"},
@@ -49,6 +60,11 @@ typedef struct _PyEncoderObject {
     PyObject *skipkeys;
     int fast_encode;
     int allow_nan;
+    /* while streaming: the write callable, how many characters to gather
+       before calling it and how many are pending */
+    PyObject *write;
+    Py_ssize_t buffer_size;
+    Py_ssize_t pending;
 } PyEncoderObject;
 
 static PyMemberDef encoder_members[] = {
@@ -109,6 +125,8 @@ static int
 encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
 static int
 encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+static int
+encoder_flush(PyEncoderObject *s, _PyAccu *acc);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -241,6 +259,66 @@ raise_errmsg(char *msg, PyObject *s, Py_ssize_t end)
     }
 }
 
+/* The scanner reads str objects, and UTF-8 encoded bytes or memoryview
+   objects as 1-byte characters: all the JSON syntax is ASCII, and only
+   the contents of strings need to be decoded (see scanstring_unicode()). */
+static int
+get_input(PyObject *pystr, void **data, int *kind, Py_ssize_t *len)
+{
+    if (PyUnicode_Check(pystr)) {
+        if (PyUnicode_READY(pystr) == -1)
+            return -1;
+        *data = PyUnicode_DATA(pystr);
+        *kind = PyUnicode_KIND(pystr);
+        *len = PyUnicode_GET_LENGTH(pystr);
+    }
+    else if (PyBytes_Check(pystr)) {
+        *data = PyBytes_AS_STRING(pystr);
+        *kind = PyUnicode_1BYTE_KIND;
+        *len = PyBytes_GET_SIZE(pystr);
+    }
+    else if (PyMemoryView_Check(pystr)) {
+        Py_buffer *view = PyMemoryView_GET_BUFFER(pystr);
+        *data = view->buf;
+        *kind = PyUnicode_1BYTE_KIND;
+        *len = view->len;
+    }
+    else {
+        PyErr_Format(PyExc_TypeError,
+                     "first argument must be a string or bytes, not %.80s",
+                     Py_TYPE(pystr)->tp_name);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+decode_utf8_chunk(PyObject *pystr, const char *buf, Py_ssize_t start,
+                  Py_ssize_t end)
+{
+    /* Decode buf[start:end] of the UTF-8 input pystr, raising the usual
+       ValueError with the position of invalid data */
+    PyObject *chunk, *type, *value, *tb;
+    Py_ssize_t pos;
+
+    chunk = PyUnicode_DecodeUTF8(buf + start, end - start, NULL);
+    if (chunk != NULL || !PyErr_ExceptionMatches(PyExc_UnicodeDecodeError))
+        return chunk;
+    PyErr_Fetch(&type, &value, &tb);
+    PyErr_NormalizeException(&type, &value, &tb);
+    if (PyUnicodeDecodeError_GetStart(value, &pos) < 0) {
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(tb);
+        return NULL;
+    }
+    Py_XDECREF(type);
+    Py_XDECREF(value);
+    Py_XDECREF(tb);
+    raise_errmsg("Invalid UTF-8 data at", pystr, start + pos);
+    return NULL;
+}
+
 static void
 raise_stop_iteration(Py_ssize_t idx)
 {
@@ -296,7 +374,7 @@ _build_rval_index_tuple(PyObject *rval, Py_ssize_t idx) {
 static PyObject *
 scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next_end_ptr)
 {
-    /* Read the JSON string from PyUnicode pystr.
+    /* Read the JSON string from PyUnicode pystr, or UTF-8 bytes.
     end is the index of the first character after the quote.
     if strict is zero then literal control characters are allowed
     *next_end_ptr is a return-by-reference index of the character
@@ -310,15 +388,13 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
     Py_ssize_t next /* = begin */;
     const void *buf;
     int kind;
+    int utf8;
     PyObject *chunks = NULL;
     PyObject *chunk = NULL;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (get_input(pystr, (void **)&buf, &kind, &len) < 0)
         return 0;
-
-    len = PyUnicode_GET_LENGTH(pystr);
-    buf = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
+    utf8 = !PyUnicode_Check(pystr);
 
     if (end < 0 || len < end) {
         PyErr_SetString(PyExc_ValueError, "end is out of bounds");
@@ -344,6 +420,9 @@ scanstring_unicode(PyObject *pystr, Py_ssize_t end, int strict, Py_ssize_t *next
         /* Pick up this chunk if it's not zero length */
         if (next != end) {
             APPEND_OLD_CHUNK
+            if (utf8)
+                chunk = decode_utf8_chunk(pystr, buf, end, next);
+            else
                 chunk = PyUnicode_FromKindAndData(
                     kind,
                     (char*)buf + kind * end,
@@ -506,6 +585,66 @@ py_scanstring(PyObject* self UNUSED, PyObject *args)
     return _build_rval_index_tuple(rval, next_end);
 }
 
+PyDoc_STRVAR(pydoc_scan_value_end,
+    "scan_value_end(string, idx, state) -> (end, state)\n"
+    "\n"
+    "Scan string from idx for the end of a JSON array, object or string\n"
+    "starting at or before idx, without decoding it.  state is 0 at the\n"
+    "start of the value.  Returns the index after the end of the value and 0,\n"
+    "or -1 and the state to pass back with the rest of the value if string\n"
+    "ends before it."
+);
+
+static PyObject *
+py_scan_value_end(PyObject* self UNUSED, PyObject *args)
+{
+    PyObject *pystr;
+    Py_ssize_t idx, len, state, depth;
+    int in_string, escape, kind;
+    void *buf;
+
+    if (!PyArg_ParseTuple(args, "Unn:scan_value_end", &pystr, &idx, &state))
+        return NULL;
+    if (PyUnicode_READY(pystr) == -1)
+        return NULL;
+    len = PyUnicode_GET_LENGTH(pystr);
+    if (idx < 0 || idx > len || state < 0) {
+        PyErr_SetString(PyExc_ValueError, "invalid index or state");
+        return NULL;
+    }
+    /* The state packs the nesting depth and whether we are in a string,
+       right after a backslash. */
+    depth = state >> 2;
+    in_string = (state >> 1) & 1;
+    escape = state & 1;
+    kind = PyUnicode_KIND(pystr);
+    buf = PyUnicode_DATA(pystr);
+    for (; idx < len; idx++) {
+        Py_UCS4 c = PyUnicode_READ(kind, buf, idx);
+        if (in_string) {
+            if (escape)
+                escape = 0;
+            else if (c == '\\')
+                escape = 1;
+            else if (c == '"') {
+                in_string = 0;
+                if (depth == 0)
+                    return Py_BuildValue("(nn)", idx + 1, (Py_ssize_t)0);
+            }
+        }
+        else if (c == '"')
+            in_string = 1;
+        else if (c == '[' || c == '{')
+            depth++;
+        else if (c == ']' || c == '}') {
+            if (--depth <= 0)
+                return Py_BuildValue("(nn)", idx + 1, (Py_ssize_t)0);
+        }
+    }
+    state = (depth << 2) | (in_string << 1) | escape;
+    return Py_BuildValue("(nn)", (Py_ssize_t)-1, state);
+}
+
 PyDoc_STRVAR(pydoc_encode_basestring_ascii,
     "encode_basestring_ascii(string) -> string\n"
     "\n"
@@ -566,9 +705,99 @@ scanner_clear(PyObject *self)
     Py_CLEAR(s->parse_int);
     Py_CLEAR(s->parse_constant);
     Py_CLEAR(s->memo);
+    Py_CLEAR(s->shapes);
+    Py_CLEAR(s->last_shape);
+    Py_CLEAR(s->last_proto);
     return 0;
 }
 
+static PyObject *
+_build_object(PyScannerObject *s, PyObject **pairs, Py_ssize_t npairs)
+{
+    /* Build the dict for the npairs keys and values in pairs, stealing the
+       references to them.  Dicts with the same keys in the same order share
+       one split table of keys, as instance dictionaries do.
+    */
+    PyObject *shape = NULL;
+    PyObject *proto;
+    PyObject *rval = NULL;
+    Py_ssize_t i;
+
+    /* Arrays of objects usually repeat the shape of the previous one, whose
+       keys are the same memoized str objects. */
+    if (s->last_shape != NULL && PyTuple_GET_SIZE(s->last_shape) == npairs) {
+        for (i = 0; i < npairs; i++) {
+            if (PyTuple_GET_ITEM(s->last_shape, i) != pairs[2 * i])
+                break;
+        }
+        if (i == npairs) {
+            rval = _PyDict_NewSharingKeys(s->last_proto);
+            if (rval == NULL)
+                goto bail;
+            goto fill;
+        }
+    }
+
+    shape = PyTuple_New(npairs);
+    if (shape == NULL)
+        goto bail;
+    for (i = 0; i < npairs; i++) {
+        Py_INCREF(pairs[2 * i]);
+        PyTuple_SET_ITEM(shape, i, pairs[2 * i]);
+    }
+    proto = PyDict_GetItemWithError(s->shapes, shape);
+    if (proto == NULL) {
+        if (PyErr_Occurred())
+            goto bail;
+        proto = PyDict_New();
+        if (proto == NULL)
+            goto bail;
+        for (i = 0; i < npairs; i++) {
+            if (PyDict_SetItem(proto, pairs[2 * i], Py_None) < 0) {
+                Py_DECREF(proto);
+                goto bail;
+            }
+        }
+        /* Objects with duplicate keys get an ordinary dict */
+        if (PyDict_Size(proto) == npairs &&
+            PyDict_Size(s->shapes) < SHAPES_MAX) {
+            if (PyDict_SetItem(s->shapes, shape, proto) < 0) {
+                Py_DECREF(proto);
+                goto bail;
+            }
+            rval = _PyDict_NewSharingKeys(proto);
+        }
+        else
+            rval = PyDict_New();
+        Py_DECREF(proto);
+    }
+    else {
+        Py_INCREF(proto);
+        Py_INCREF(shape);
+        Py_XDECREF(s->last_shape);
+        Py_XDECREF(s->last_proto);
+        s->last_shape = shape;
+        s->last_proto = proto;
+        rval = _PyDict_NewSharingKeys(proto);
+    }
+    if (rval == NULL)
+        goto bail;
+    Py_CLEAR(shape);
+
+fill:
+    for (i = 0; i < npairs; i++) {
+        if (PyDict_SetItem(rval, pairs[2 * i], pairs[2 * i + 1]) < 0) {
+            Py_CLEAR(rval);
+            goto bail;
+        }
+    }
+bail:
+    Py_XDECREF(shape);
+    for (i = 0; i < 2 * npairs; i++)
+        Py_DECREF(pairs[i]);
+    return rval;
+}
+
 static PyObject *
 _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr) {
     /* Read a JSON object from PyUnicode pystr.
@@ -587,20 +816,20 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     int strict = PyObject_IsTrue(s->strict);
     int has_pairs_hook = (s->object_pairs_hook != Py_None);
     Py_ssize_t next_idx;
+    /* keys and values of a small object, until it is complete */
+    PyObject *pairs[2 * SHAPE_MAX_KEYS];
+    Py_ssize_t npairs = 0;
+    Py_ssize_t i;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (get_input(pystr, &str, &kind, &end_idx) < 0)
         return NULL;
+    end_idx--;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
-
-    if (has_pairs_hook)
+    if (has_pairs_hook) {
         rval = PyList_New(0);
-    else
-        rval = PyDict_New();
-    if (rval == NULL)
-        return NULL;
+        if (rval == NULL)
+            return NULL;
+    }
 
     /* skip whitespace after { */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind,str, idx))) idx++;
@@ -656,7 +885,28 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
                 }
                 Py_DECREF(item);
             }
+            else if (rval == NULL && npairs < SHAPE_MAX_KEYS) {
+                pairs[2 * npairs] = key;
+                pairs[2 * npairs + 1] = val;
+                npairs++;
+                key = NULL;
+                val = NULL;
+            }
             else {
+                if (rval == NULL) {
+                    /* too many keys to share, move them to a dict */
+                    rval = PyDict_New();
+                    if (rval == NULL)
+                        goto bail;
+                    for (i = 0; i < npairs; i++) {
+                        if (PyDict_SetItem(rval, pairs[2 * i],
+                                           pairs[2 * i + 1]) < 0)
+                            goto bail;
+                    }
+                    for (i = 0; i < 2 * npairs; i++)
+                        Py_DECREF(pairs[i]);
+                    npairs = 0;
+                }
                 if (PyDict_SetItem(rval, key, val) < 0)
                     goto bail;
                 Py_CLEAR(key);
@@ -689,6 +939,16 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
         return val;
     }
 
+    if (rval == NULL) {
+        if (npairs == 0)
+            rval = PyDict_New();
+        else
+            rval = _build_object(s, pairs, npairs);
+        npairs = 0;
+        if (rval == NULL)
+            return NULL;
+    }
+
     /* if object_hook is not None: rval = object_hook(rval) */
     if (s->object_hook != Py_None) {
         val = PyObject_CallFunctionObjArgs(s->object_hook, rval, NULL);
@@ -700,6 +960,8 @@ bail:
     Py_XDECREF(key);
     Py_XDECREF(val);
     Py_XDECREF(rval);
+    for (i = 0; i < 2 * npairs; i++)
+        Py_DECREF(pairs[i]);
     return NULL;
 }
 
@@ -721,12 +983,9 @@ _parse_array_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssi
     if (rval == NULL)
         return NULL;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (get_input(pystr, &str, &kind, &end_idx) < 0)
         return NULL;
-
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    end_idx--;
 
     /* skip whitespace after [ */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind, str, idx))) idx++;
@@ -822,12 +1081,9 @@ _match_number_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t start, Py_
     PyObject *numstr = NULL;
     PyObject *custom_func;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (get_input(pystr, &str, &kind, &end_idx) < 0)
         return NULL;
-
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
+    end_idx--;
 
     /* read a sign if it's there, make sure it's not the end of the string */
     if (PyUnicode_READ(kind, str, idx) == '-') {
@@ -934,13 +1190,9 @@ scan_once_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_
     int kind;
     Py_ssize_t length;
 
-    if (PyUnicode_READY(pystr) == -1)
+    if (get_input(pystr, &str, &kind, &length) < 0)
         return NULL;
 
-    str = PyUnicode_DATA(pystr);
-    kind = PyUnicode_KIND(pystr);
-    length = PyUnicode_GET_LENGTH(pystr);
-
     if (idx >= length) {
         raise_stop_iteration(idx);
         return NULL;
@@ -1035,8 +1287,9 @@ scan_once_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_
 static PyObject *
 scanner_call(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    /* Python callable interface to scan_once_{str,unicode} */
+    /* Python callable interface to scan_once_unicode */
     PyObject *pystr;
+    PyObject *view = NULL;
     PyObject *rval;
     Py_ssize_t idx;
     Py_ssize_t next_idx = -1;
@@ -1047,16 +1300,38 @@ scanner_call(PyObject *self, PyObject *args, PyObject *kwds)
     if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:scan_once", kwlist, &pystr, &idx))
         return NULL;
 
-    if (PyUnicode_Check(pystr)) {
+    if (PyUnicode_Check(pystr) || PyBytes_Check(pystr)) {
         rval = scan_once_unicode(s, pystr, idx, &next_idx);
     }
+    else if (PyObject_CheckBuffer(pystr)) {
+        /* The memoryview keeps a bytearray from being resized by hooks */
+        Py_buffer *buffer;
+        view = PyMemoryView_FromObject(pystr);
+        if (view == NULL)
+            return NULL;
+        buffer = PyMemoryView_GET_BUFFER(view);
+        if (buffer->itemsize != 1 || !PyBuffer_IsContiguous(buffer, 'C')) {
+            PyErr_SetString(PyExc_TypeError,
+                            "first argument must be a contiguous buffer "
+                            "of bytes");
+            Py_DECREF(view);
+            return NULL;
+        }
+        rval = scan_once_unicode(s, view, idx, &next_idx);
+        Py_DECREF(view);
+    }
     else {
         PyErr_Format(PyExc_TypeError,
-                 "first argument must be a string, not %.80s",
+                 "first argument must be a string or bytes, not %.80s",
                  Py_TYPE(pystr)->tp_name);
         return NULL;
     }
     PyDict_Clear(s->memo);
+    if (PyDict_Size(s->shapes) >= SHAPES_MAX) {
+        PyDict_Clear(s->shapes);
+        Py_CLEAR(s->last_shape);
+        Py_CLEAR(s->last_proto);
+    }
     if (rval == NULL)
         return NULL;
     return _build_rval_index_tuple(rval, next_idx);
@@ -1097,6 +1372,11 @@ scanner_init(PyObject *self, PyObject *args, PyObject *kwds)
         if (s->memo == NULL)
             goto bail;
     }
+    if (s->shapes == NULL) {
+        s->shapes = PyDict_New();
+        if (s->shapes == NULL)
+            goto bail;
+    }
 
     /* All of these will fail "gracefully" so we don't need to verify them */
     s->strict = PyObject_GetAttrString(ctx, "strict");
@@ -1189,6 +1469,9 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         s->item_separator = NULL;
         s->sort_keys = NULL;
         s->skipkeys = NULL;
+        s->write = NULL;
+        s->buffer_size = 0;
+        s->pending = 0;
     }
     return (PyObject *)s;
 }
@@ -1236,25 +1519,52 @@ encoder_init(PyObject *self, PyObject *args, PyObject *kwds)
 static PyObject *
 encoder_call(PyObject *self, PyObject *args, PyObject *kwds)
 {
-    /* Python callable interface to encode_listencode_obj */
-    static char *kwlist[] = {"obj", "_current_indent_level", NULL};
-    PyObject *obj;
-    Py_ssize_t indent_level;
+    /* Python callable interface to encode_listencode_obj.  If _write is
+       given, the output is passed to it in pieces of about _buffer_size
+       characters as it is produced, and None is returned. */
+    static char *kwlist[] = {"obj", "_current_indent_level", "_write",
+                             "_buffer_size", NULL};
+    PyObject *obj, *write = Py_None;
+    Py_ssize_t indent_level, buffer_size = 65536;
+    PyObject *old_write;
+    Py_ssize_t old_buffer_size, old_pending;
     PyEncoderObject *s;
     _PyAccu acc;
+    int rv;
 
     assert(PyEncoder_Check(self));
     s = (PyEncoderObject *)self;
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:_iterencode", kwlist,
-        &obj, &indent_level))
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On|On:_iterencode", kwlist,
+        &obj, &indent_level, &write, &buffer_size))
         return NULL;
     if (_PyAccu_Init(&acc))
         return NULL;
-    if (encoder_listencode_obj(s, &acc, obj, indent_level)) {
-        _PyAccu_Destroy(&acc);
+    if (write == Py_None) {
+        if (encoder_listencode_obj(s, &acc, obj, indent_level)) {
+            _PyAccu_Destroy(&acc);
+            return NULL;
+        }
+        return _PyAccu_FinishAsList(&acc);
+    }
+
+    /* default() could call this encoder again */
+    old_write = s->write;
+    old_buffer_size = s->buffer_size;
+    old_pending = s->pending;
+    s->write = write;
+    s->buffer_size = buffer_size;
+    s->pending = 0;
+    rv = encoder_listencode_obj(s, &acc, obj, indent_level);
+    if (rv == 0)
+        rv = encoder_flush(s, &acc);
+    s->write = old_write;
+    s->buffer_size = old_buffer_size;
+    s->pending = old_pending;
+    _PyAccu_Destroy(&acc);
+    if (rv)
         return NULL;
-    }
-    return _PyAccu_FinishAsList(&acc);
+    Py_INCREF(Py_None);
+    return Py_None;
 }
 
 static PyObject *
@@ -1374,10 +1684,51 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 }
 
 static int
-_steal_accumulate(_PyAccu *acc, PyObject *stolen)
+encoder_flush(PyEncoderObject *s, _PyAccu *acc)
+{
+    /* Pass the accumulated output to s->write */
+    PyObject *chunk, *res;
+
+    s->pending = 0;
+    chunk = _PyAccu_Finish(acc);
+    if (chunk == NULL)
+        return -1;
+    if (_PyAccu_Init(acc)) {
+        Py_DECREF(chunk);
+        return -1;
+    }
+    if (PyUnicode_GET_LENGTH(chunk) == 0) {
+        Py_DECREF(chunk);
+        return 0;
+    }
+    res = PyObject_CallFunctionObjArgs(s->write, chunk, NULL);
+    Py_DECREF(chunk);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+static int
+encoder_accumulate(PyEncoderObject *s, _PyAccu *acc, PyObject *unicode)
+{
+    /* Append unicode, flushing the output when streaming and enough of
+       it is pending */
+    if (_PyAccu_Accumulate(acc, unicode))
+        return -1;
+    if (s->write == NULL)
+        return 0;
+    s->pending += PyUnicode_GET_LENGTH(unicode);
+    if (s->pending < s->buffer_size)
+        return 0;
+    return encoder_flush(s, acc);
+}
+
+static int
+_steal_accumulate(PyEncoderObject *s, _PyAccu *acc, PyObject *stolen)
 {
     /* Append stolen and then decrement its reference count */
-    int rval = _PyAccu_Accumulate(acc, stolen);
+    int rval = encoder_accumulate(s, acc, stolen);
     Py_DECREF(stolen);
     return rval;
 }
@@ -1394,26 +1745,26 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
         PyObject *cstr = _encoded_const(obj);
         if (cstr == NULL)
             return -1;
-        return _steal_accumulate(acc, cstr);
+        return _steal_accumulate(s, acc, cstr);
     }
     else if (PyUnicode_Check(obj))
     {
         PyObject *encoded = encoder_encode_string(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(s, acc, encoded);
     }
     else if (PyLong_Check(obj)) {
         PyObject *encoded = encoder_encode_long(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(s, acc, encoded);
     }
     else if (PyFloat_Check(obj)) {
         PyObject *encoded = encoder_encode_float(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(s, acc, encoded);
     }
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
@@ -1499,7 +1850,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
             return -1;
     }
     if (Py_SIZE(dct) == 0)
-        return _PyAccu_Accumulate(acc, empty_dict);
+        return encoder_accumulate(s, acc, empty_dict);
 
     if (s->markers != Py_None) {
         int has_key;
@@ -1517,7 +1868,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_dict))
+    if (encoder_accumulate(s, acc, open_dict))
         goto bail;
 
     if (s->indent != Py_None) {
@@ -1605,7 +1956,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
 
         if (idx) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (encoder_accumulate(s, acc, s->item_separator))
                 goto bail;
         }
 
@@ -1613,12 +1964,12 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         Py_CLEAR(kstr);
         if (encoded == NULL)
             goto bail;
-        if (_PyAccu_Accumulate(acc, encoded)) {
+        if (encoder_accumulate(s, acc, encoded)) {
             Py_DECREF(encoded);
             goto bail;
         }
         Py_DECREF(encoded);
-        if (_PyAccu_Accumulate(acc, s->key_separator))
+        if (encoder_accumulate(s, acc, s->key_separator))
             goto bail;
 
         value = PyTuple_GET_ITEM(item, 1);
@@ -1642,7 +1993,7 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_dict))
+    if (encoder_accumulate(s, acc, close_dict))
         goto bail;
     return 0;
 
@@ -1680,7 +2031,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         return -1;
     if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
         Py_DECREF(s_fast);
-        return _PyAccu_Accumulate(acc, empty_array);
+        return encoder_accumulate(s, acc, empty_array);
     }
 
     if (s->markers != Py_None) {
@@ -1699,7 +2050,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_array))
+    if (encoder_accumulate(s, acc, open_array))
         goto bail;
     if (s->indent != Py_None) {
         /* TODO: DOES NOT RUN */
@@ -1713,7 +2064,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
     for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
         PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
         if (i) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (encoder_accumulate(s, acc, s->item_separator))
                 goto bail;
         }
         if (encoder_listencode_obj(s, acc, obj, indent_level))
@@ -1731,7 +2082,7 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
 
         yield '\n' + (' ' * (_indent * _current_indent_level))
     }*/
-    if (_PyAccu_Accumulate(acc, close_array))
+    if (encoder_accumulate(s, acc, close_array))
         goto bail;
     Py_DECREF(s_fast);
     return 0;
@@ -1839,6 +2190,10 @@ static PyMethodDef speedups_methods[] = {
         (PyCFunction)py_scanstring,
         METH_VARARGS,
         pydoc_scanstring},
+    {"scan_value_end",
+        (PyCFunction)py_scan_value_end,
+        METH_VARARGS,
+        pydoc_scan_value_end},
     {NULL, NULL, 0, NULL}
 };
 
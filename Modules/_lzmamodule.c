@@ -572,13 +572,43 @@ Compressor_getstate(Compressor *self, PyObject *noargs)
     return NULL;
 }
 
+/* liblzma's multi-threaded encoder was added in version 5.2.0. */
+#if LZMA_VERSION >= 50020002
+#define HAVE_LZMA_STREAM_ENCODER_MT
+#endif
+
 static int
 Compressor_init_xz(lzma_stream *lzs, int check, uint32_t preset,
-                   PyObject *filterspecs)
+                   PyObject *filterspecs, int threads)
 {
     lzma_ret lzret;
 
-    if (filterspecs == Py_None) {
+    if (threads != 1) {
+#ifdef HAVE_LZMA_STREAM_ENCODER_MT
+        lzma_mt mt;
+        lzma_filter filters[LZMA_FILTERS_MAX + 1];
+
+        memset(&mt, 0, sizeof(mt));
+        mt.threads = threads > 0 ? threads : lzma_cputhreads();
+        if (mt.threads == 0)
+            mt.threads = 1;
+        mt.preset = preset;
+        mt.check = check;
+        if (filterspecs != Py_None) {
+            if (parse_filter_chain_spec(filters, filterspecs) == -1)
+                return -1;
+            mt.filters = filters;
+        }
+        lzret = lzma_stream_encoder_mt(lzs, &mt);
+        if (filterspecs != Py_None)
+            free_filter_chain(filters);
+#else
+        PyErr_SetString(PyExc_ValueError,
+                        "Multi-threaded compression requires liblzma 5.2.0 "
+                        "or later");
+        return -1;
+#endif
+    } else if (filterspecs == Py_None) {
         lzret = lzma_easy_encoder(lzs, preset, check);
     } else {
         lzma_filter filters[LZMA_FILTERS_MAX + 1];
@@ -653,19 +683,33 @@ Compressor_init_raw(lzma_stream *lzs, PyObject *filterspecs)
 static int
 Compressor_init(Compressor *self, PyObject *args, PyObject *kwargs)
 {
-    static char *arg_names[] = {"format", "check", "preset", "filters", NULL};
+    static char *arg_names[] = {"format", "check", "preset", "filters",
+                                "threads", NULL};
     int format = FORMAT_XZ;
     int check = -1;
     uint32_t preset = LZMA_PRESET_DEFAULT;
     PyObject *preset_obj = Py_None;
     PyObject *filterspecs = Py_None;
+    int threads = 1;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-                                     "|iiOO:LZMACompressor", arg_names,
+                                     "|iiOO$i:LZMACompressor", arg_names,
                                      &format, &check, &preset_obj,
-                                     &filterspecs))
+                                     &filterspecs, &threads))
         return -1;
 
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "threads must be a non-negative integer");
+        return -1;
+    }
+    if (format != FORMAT_XZ && threads != 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Multi-threaded compression is only supported by "
+                        "FORMAT_XZ");
+        return -1;
+    }
+
     if (format != FORMAT_XZ && check != -1 && check != LZMA_CHECK_NONE) {
         PyErr_SetString(PyExc_ValueError,
                         "Integrity checks are only supported by FORMAT_XZ");
@@ -700,7 +744,8 @@ Compressor_init(Compressor *self, PyObject *args, PyObject *kwargs)
         case FORMAT_XZ:
             if (check == -1)
                 check = LZMA_CHECK_CRC64;
-            if (Compressor_init_xz(&self->lzs, check, preset, filterspecs) != 0)
+            if (Compressor_init_xz(&self->lzs, check, preset, filterspecs,
+                                   threads) != 0)
                 break;
             return 0;
 
@@ -748,7 +793,8 @@ static PyMethodDef Compressor_methods[] = {
 };
 
 PyDoc_STRVAR(Compressor_doc,
-"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None)\n"
+"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None, *,\n"
+"               threads=1)\n"
 "\n"
 "Create a compressor object for compressing data incrementally.\n"
 "\n"
@@ -773,6 +819,10 @@ PyDoc_STRVAR(Compressor_doc,
 "have an entry for \"id\" indicating the ID of the filter, plus\n"
 "additional entries for options to the filter.\n"
 "\n"
+"threads (FORMAT_XZ only) is the number of threads compressing blocks\n"
+"of the input in parallel, or 0 for one thread per CPU. The output is\n"
+"a standard .xz stream made of several blocks.\n"
+"\n"
 "For one-shot compression, use the compress() function instead.\n");
 
 static PyTypeObject Compressor_type = {
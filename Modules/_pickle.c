@@ -30,7 +30,7 @@ class UnpicklerMemoProxyObject_converter(self_converter):
 
 /* Bump this when new opcodes are added to the pickle protocol. */
 enum {
-    HIGHEST_PROTOCOL = 4,
+    HIGHEST_PROTOCOL = 5,
     DEFAULT_PROTOCOL = 3
 };
 
@@ -107,7 +107,14 @@ enum opcode {
     NEWOBJ_EX        = '\x92',
     STACK_GLOBAL     = '\x93',
     MEMOIZE          = '\x94',
-    FRAME            = '\x95'
+    FRAME            = '\x95',
+
+    /* Protocol 5 */
+    BYTEARRAY8       = '\x96',
+    NEXT_BUFFER      = '\x97',
+    READONLY_BUFFER  = '\x98',
+    PACKED_LIST      = '\x99',
+    PACKED_TUPLE     = '\x9a'
 };
 
 enum {
@@ -117,6 +124,15 @@ enum {
       help anything either. */
     BATCHSIZE = 1000,
 
+    /* Keep in synch with pickle.Pickler._PACK_MIN_SIZE.  Lists and tuples
+       of at least this many ints, floats or short ASCII strings are saved
+       as packed arrays with protocol 5. */
+    PACK_MIN_SIZE = 8,
+
+    /* Size of the buffer in which save_packed() packs items before writing
+       them. */
+    PACK_CHUNK_SIZE = 8192,
+
     /* Nesting limit until Pickler, when running in "fast mode", starts
        checking for self-referential data-structures. */
     FAST_NESTING_LIMIT = 50,
@@ -569,6 +585,8 @@ typedef struct PicklerObject {
     int fix_imports;            /* Indicate whether Pickler should fix
                                    the name of globals for Python 2.x. */
     PyObject *fast_memo;
+    PyObject *buffer_callback;  /* Callable receiving the out-of-band
+                                   PickleBuffers, can be NULL */
 } PicklerObject;
 
 typedef struct UnpicklerObject {
@@ -607,6 +625,8 @@ typedef struct UnpicklerObject {
     int proto;                  /* Protocol of the pickle loaded. */
     int fix_imports;            /* Indicate whether Unpickler should fix
                                    the name of globals pickled by Python 2.x. */
+    PyObject *buffers;          /* Iterator of the out-of-band buffers,
+                                   can be NULL */
 } UnpicklerObject;
 
 /* Forward declarations */
@@ -1005,6 +1025,7 @@ _Pickler_New(void)
     self->fast_nesting = 0;
     self->fix_imports = 0;
     self->fast_memo = NULL;
+    self->buffer_callback = NULL;
     self->max_output_len = WRITE_BUF_SIZE;
     self->output_len = 0;
 
@@ -1064,6 +1085,24 @@ _Pickler_SetOutputStream(PicklerObject *self, PyObject *file)
     return 0;
 }
 
+/* Returns -1 (with an exception set) on failure, 0 on success. This may
+   be called once on a freshly created Pickler, after its protocol is set. */
+static int
+_Pickler_SetBufferCallback(PicklerObject *self, PyObject *buffer_callback)
+{
+    if (buffer_callback == Py_None)
+        buffer_callback = NULL;
+    if (buffer_callback != NULL && self->proto < 5) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer_callback needs protocol >= 5");
+        return -1;
+    }
+
+    Py_XINCREF(buffer_callback);
+    self->buffer_callback = buffer_callback;
+    return 0;
+}
+
 /* Returns the size of the input on success, -1 on failure. This takes its
    own reference to `input`. */
 static Py_ssize_t
@@ -1368,6 +1407,7 @@ _Unpickler_New(void)
     self->marks_size = 0;
     self->proto = 0;
     self->fix_imports = 0;
+    self->buffers = NULL;
     memset(&self->buffer, 0, sizeof(Py_buffer));
     self->memo_size = 32;
     self->memo_len = 0;
@@ -1412,6 +1452,22 @@ _Unpickler_SetInputStream(UnpicklerObject *self, PyObject *file)
     return 0;
 }
 
+/* Returns -1 (with an exception set) on failure, 0 on success. This may
+   be called once on a freshly created Unpickler. */
+static int
+_Unpickler_SetBuffers(UnpicklerObject *self, PyObject *buffers)
+{
+    if (buffers == NULL || buffers == Py_None) {
+        self->buffers = NULL;
+    }
+    else {
+        self->buffers = PyObject_GetIter(buffers);
+        if (self->buffers == NULL)
+            return -1;
+    }
+    return 0;
+}
+
 /* Returns -1 (with an exception set) on failure, 0 on success. This may
    be called once on a freshly created Pickler. */
 static int
@@ -1957,6 +2013,51 @@ done:
     return 0;
 }
 
+static int
+_save_bytes_data(PicklerObject *self, PyObject *obj, const char *data,
+                 Py_ssize_t size)
+{
+    char header[9];
+    Py_ssize_t len;
+
+    assert(self->proto >= 3);
+
+    if (size <= 0xff) {
+        header[0] = SHORT_BINBYTES;
+        header[1] = (unsigned char)size;
+        len = 2;
+    }
+    else if (size <= 0xffffffffL) {
+        header[0] = BINBYTES;
+        header[1] = (unsigned char)(size & 0xff);
+        header[2] = (unsigned char)((size >> 8) & 0xff);
+        header[3] = (unsigned char)((size >> 16) & 0xff);
+        header[4] = (unsigned char)((size >> 24) & 0xff);
+        len = 5;
+    }
+    else if (self->proto >= 4) {
+        header[0] = BINBYTES8;
+        _write_size64(header + 1, size);
+        len = 9;
+    }
+    else {
+        PyErr_SetString(PyExc_OverflowError,
+                        "cannot serialize a bytes object larger than 4 GiB");
+        return -1;          /* string too large */
+    }
+
+    if (_Pickler_Write(self, header, len) < 0)
+        return -1;
+
+    if (_Pickler_Write(self, data, size) < 0)
+        return -1;
+
+    if (memo_put(self, obj) < 0)
+        return -1;
+
+    return 0;
+}
+
 static int
 save_bytes(PicklerObject *self, PyObject *obj)
 {
@@ -2003,49 +2104,99 @@ save_bytes(PicklerObject *self, PyObject *obj)
         return status;
     }
     else {
-        Py_ssize_t size;
-        char header[9];
-        Py_ssize_t len;
+        return _save_bytes_data(self, obj, PyBytes_AS_STRING(obj),
+                                PyBytes_GET_SIZE(obj));
+    }
+}
 
-        size = PyBytes_GET_SIZE(obj);
-        if (size < 0)
-            return -1;
+static int
+_save_bytearray_data(PicklerObject *self, PyObject *obj, const char *data,
+                     Py_ssize_t size)
+{
+    char header[9];
+    Py_ssize_t len;
 
-        if (size <= 0xff) {
-            header[0] = SHORT_BINBYTES;
-            header[1] = (unsigned char)size;
-            len = 2;
-        }
-        else if (size <= 0xffffffffL) {
-            header[0] = BINBYTES;
-            header[1] = (unsigned char)(size & 0xff);
-            header[2] = (unsigned char)((size >> 8) & 0xff);
-            header[3] = (unsigned char)((size >> 16) & 0xff);
-            header[4] = (unsigned char)((size >> 24) & 0xff);
-            len = 5;
-        }
-        else if (self->proto >= 4) {
-            header[0] = BINBYTES8;
-            _write_size64(header + 1, size);
-            len = 9;
-        }
-        else {
-            PyErr_SetString(PyExc_OverflowError,
-                            "cannot serialize a bytes object larger than 4 GiB");
-            return -1;          /* string too large */
-        }
+    assert(self->proto >= 5);
 
-        if (_Pickler_Write(self, header, len) < 0)
-            return -1;
+    header[0] = BYTEARRAY8;
+    _write_size64(header + 1, size);
+    len = 9;
 
-        if (_Pickler_Write(self, PyBytes_AS_STRING(obj), size) < 0)
-            return -1;
+    if (_Pickler_Write(self, header, len) < 0)
+        return -1;
 
-        if (memo_put(self, obj) < 0)
-            return -1;
+    if (_Pickler_Write(self, data, size) < 0)
+        return -1;
 
-        return 0;
+    if (memo_put(self, obj) < 0)
+        return -1;
+
+    return 0;
+}
+
+/* Older protocols pickle bytearrays with their __reduce_ex__() method. */
+static int
+save_bytearray(PicklerObject *self, PyObject *obj)
+{
+    return _save_bytearray_data(self, obj, PyByteArray_AS_STRING(obj),
+                                PyByteArray_GET_SIZE(obj));
+}
+
+static int
+save_picklebuffer(PicklerObject *self, PyObject *obj)
+{
+    const Py_buffer *view;
+    int in_band = 1;
+
+    if (self->proto < 5) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->PicklingError,
+                        "PickleBuffer can only be pickled with protocol >= 5");
+        return -1;
+    }
+    view = PyPickleBuffer_GetBuffer(obj);
+    if (view == NULL)
+        return -1;
+    if (view->suboffsets != NULL || !PyBuffer_IsContiguous(view, 'A')) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->PicklingError,
+                        "PickleBuffer can not be pickled when "
+                        "pointing to a non-contiguous buffer");
+        return -1;
     }
+    if (self->buffer_callback != NULL) {
+        PyObject *ret;
+
+        Py_INCREF(obj);
+        ret = _Pickle_FastCall(self->buffer_callback, obj);
+        if (ret == NULL)
+            return -1;
+        in_band = PyObject_IsTrue(ret);
+        Py_DECREF(ret);
+        if (in_band == -1)
+            return -1;
+    }
+    if (in_band) {
+        /* Write data in-band */
+        if (view->readonly)
+            return _save_bytes_data(self, obj, (const char *) view->buf,
+                                    view->len);
+        else
+            return _save_bytearray_data(self, obj, (const char *) view->buf,
+                                        view->len);
+    }
+    else {
+        /* Write data out-of-band */
+        const char next_buffer_op = NEXT_BUFFER;
+        if (_Pickler_Write(self, &next_buffer_op, 1) < 0)
+            return -1;
+        if (view->readonly) {
+            const char readonly_buffer_op = READONLY_BUFFER;
+            if (_Pickler_Write(self, &readonly_buffer_op, 1) < 0)
+                return -1;
+        }
+    }
+    return 0;
 }
 
 /* A copy of PyUnicode_EncodeRawUnicodeEscape() that also translates
@@ -2238,6 +2389,175 @@ store_tuple_elements(PicklerObject *self, PyObject *t, Py_ssize_t len)
     return 0;
 }
 
+/* Protocol 5 saves lists and tuples whose items are all ints fitting in 64
+ * bits, all floats or all ASCII strings of at most 255 characters as packed
+ * arrays: a PACKED_LIST or PACKED_TUPLE opcode, a type code, an 8-byte item
+ * count and the items without any per-item opcode.  The items aren't
+ * memoized.  The type codes are:
+ *
+ *   'B'  unsigned 8-bit ints
+ *   'h'  signed 16-bit little-endian ints
+ *   'i'  signed 32-bit little-endian ints
+ *   'q'  signed 64-bit little-endian ints
+ *   'd'  little-endian IEEE 754 doubles
+ *   's'  ASCII strings, each prefixed with its 1-byte length
+ *
+ * Ints use the smallest type code which can hold all of them.
+ */
+
+/* Return the type code for packing the len items, 0 if they can't be packed,
+   or -1 on error. */
+static int
+packed_typecode(PyObject **items, Py_ssize_t len)
+{
+    PyTypeObject *type = Py_TYPE(items[0]);
+    Py_ssize_t i;
+
+    if (type == &PyLong_Type) {
+        long x, lo = 0, hi = 0;
+        int overflow, wide = 0;
+        unsigned char buf[8];
+
+        for (i = 0; i < len; i++) {
+            if (Py_TYPE(items[i]) != &PyLong_Type)
+                return 0;
+            x = PyLong_AsLongAndOverflow(items[i], &overflow);
+            if (x == -1 && PyErr_Occurred())
+                return -1;
+            if (overflow) {
+                /* Wider than a C long, may still fit in 64 bits. */
+                if (_PyLong_AsByteArray((PyLongObject *)items[i],
+                                        buf, 8, 1, 1) < 0) {
+                    if (!PyErr_ExceptionMatches(PyExc_OverflowError))
+                        return -1;
+                    PyErr_Clear();
+                    return 0;
+                }
+                wide = 1;
+            }
+            else if (i == 0) {
+                lo = hi = x;
+            }
+            else if (x < lo) {
+                lo = x;
+            }
+            else if (x > hi) {
+                hi = x;
+            }
+        }
+        if (wide)
+            return 'q';
+        if (lo >= 0 && hi <= 0xff)
+            return 'B';
+        if (lo >= -0x8000L && hi <= 0x7fffL)
+            return 'h';
+        if (lo >= -0x7fffffffL - 1 && hi <= 0x7fffffffL)
+            return 'i';
+        return 'q';
+    }
+    else if (type == &PyFloat_Type) {
+        for (i = 0; i < len; i++) {
+            if (Py_TYPE(items[i]) != &PyFloat_Type)
+                return 0;
+        }
+        return 'd';
+    }
+    else if (type == &PyUnicode_Type) {
+        for (i = 0; i < len; i++) {
+            PyObject *item = items[i];
+
+            if (Py_TYPE(item) != &PyUnicode_Type)
+                return 0;
+            if (PyUnicode_READY(item) < 0)
+                return -1;
+            if (!PyUnicode_IS_ASCII(item) || PyUnicode_GET_LENGTH(item) > 0xff)
+                return 0;
+        }
+        return 's';
+    }
+    return 0;
+}
+
+/* Save a list or a tuple as a packed array, if its items allow it.  Returns
+   1 if it was saved, 0 if it can't be packed, -1 on error.  The caller
+   memoizes it.  Packed items don't go through persistent_id(), so the
+   caller must not use this when the pickler has one. */
+static int
+save_packed(PicklerObject *self, PyObject *obj, char opcode)
+{
+    PyObject **items = PySequence_Fast_ITEMS(obj);
+    Py_ssize_t len = PySequence_Fast_GET_SIZE(obj);
+    Py_ssize_t i, n;
+    unsigned char buf[PACK_CHUNK_SIZE];
+    int code;
+
+    assert(self->proto >= 5);
+    assert(len >= PACK_MIN_SIZE);
+
+    code = packed_typecode(items, len);
+    if (code <= 0)
+        return code;
+
+    buf[0] = (unsigned char)opcode;
+    buf[1] = (unsigned char)code;
+    _write_size64((char *)buf + 2, len);
+    n = 10;
+
+    /* No Python code runs here, so the items can't change under us. */
+    for (i = 0; i < len; i++) {
+        PyObject *item = items[i];
+        unsigned char *p;
+        long x;
+
+        /* Room for the largest item: a length byte and 255 characters. */
+        if (n > PACK_CHUNK_SIZE - 256) {
+            if (_Pickler_Write(self, (char *)buf, n) < 0)
+                return -1;
+            n = 0;
+        }
+        p = buf + n;
+        switch (code) {
+        case 'B':
+            p[0] = (unsigned char)PyLong_AsLong(item);
+            n += 1;
+            break;
+        case 'h':
+        case 'i':
+            x = PyLong_AsLong(item);
+            p[0] = (unsigned char)(x & 0xff);
+            p[1] = (unsigned char)((x >> 8) & 0xff);
+            if (code == 'h') {
+                n += 2;
+                break;
+            }
+            p[2] = (unsigned char)((x >> 16) & 0xff);
+            p[3] = (unsigned char)((x >> 24) & 0xff);
+            n += 4;
+            break;
+        case 'q':
+            if (_PyLong_AsByteArray((PyLongObject *)item, p, 8, 1, 1) < 0)
+                return -1;
+            n += 8;
+            break;
+        case 'd':
+            if (_PyFloat_Pack8(PyFloat_AS_DOUBLE(item), p, 1) < 0)
+                return -1;
+            n += 8;
+            break;
+        case 's':
+            x = (long)PyUnicode_GET_LENGTH(item);
+            p[0] = (unsigned char)x;
+            memcpy(p + 1, PyUnicode_1BYTE_DATA(item), x);
+            n += 1 + x;
+            break;
+        }
+    }
+    if (_Pickler_Write(self, (char *)buf, n) < 0)
+        return -1;
+
+    return 1;
+}
+
 /* Tuples are ubiquitous in the pickle protocols, so many techniques are
  * used across protocols to minimize the space needed to pickle them.
  * Tuples are also the only builtin immutable type that can be recursive
@@ -2275,6 +2595,15 @@ save_tuple(PicklerObject *self, PyObject *obj)
         return 0;
     }
 
+    if (self->proto >= 5 && len >= PACK_MIN_SIZE &&
+        self->pers_func == NULL) {
+        int status = save_packed(self, obj, PACKED_TUPLE);
+        if (status < 0)
+            return -1;
+        if (status > 0)
+            goto memoize;
+    }
+
     /* The tuple isn't in the memo now.  If it shows up there after
      * saving the tuple elements, the tuple must be recursive, in
      * which case we'll pop everything we put on the stack, and fetch
@@ -2521,6 +2850,19 @@ save_list(PicklerObject *self, PyObject *obj)
     if (self->fast && !fast_save_enter(self, obj))
         goto error;
 
+    if (self->proto >= 5 && PyList_GET_SIZE(obj) >= PACK_MIN_SIZE &&
+        self->pers_func == NULL) {
+        status = save_packed(self, obj, PACKED_LIST);
+        if (status < 0)
+            goto error;
+        if (status > 0) {
+            status = 0;
+            if (memo_put(self, obj) < 0)
+                goto error;
+            goto done;
+        }
+    }
+
     /* Create an empty list. */
     if (self->bin) {
         header[0] = EMPTY_LIST;
@@ -2568,6 +2910,7 @@ save_list(PicklerObject *self, PyObject *obj)
         status = -1;
     }
 
+  done:
     if (self->fast && !fast_save_leave(self, obj))
         status = -1;
 
@@ -3701,6 +4044,14 @@ save(PicklerObject *self, PyObject *obj, int pers_save)
         status = save_bytes(self, obj);
         goto done;
     }
+    else if (type == &PyByteArray_Type && self->proto >= 5) {
+        status = save_bytearray(self, obj);
+        goto done;
+    }
+    else if (type == &PyPickleBuffer_Type) {
+        status = save_picklebuffer(self, obj);
+        goto done;
+    }
     else if (type == &PyUnicode_Type) {
         status = save_unicode(self, obj);
         goto done;
@@ -3971,6 +4322,7 @@ Pickler_dealloc(PicklerObject *self)
     Py_XDECREF(self->pers_func);
     Py_XDECREF(self->dispatch_table);
     Py_XDECREF(self->fast_memo);
+    Py_XDECREF(self->buffer_callback);
 
     PyMemoTable_Del(self->memo);
 
@@ -3984,6 +4336,7 @@ Pickler_traverse(PicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->pers_func);
     Py_VISIT(self->dispatch_table);
     Py_VISIT(self->fast_memo);
+    Py_VISIT(self->buffer_callback);
     return 0;
 }
 
@@ -3995,6 +4348,7 @@ Pickler_clear(PicklerObject *self)
     Py_CLEAR(self->pers_func);
     Py_CLEAR(self->dispatch_table);
     Py_CLEAR(self->fast_memo);
+    Py_CLEAR(self->buffer_callback);
 
     if (self->memo != NULL) {
         PyMemoTable *memo = self->memo;
@@ -4013,11 +4367,12 @@ _pickle.Pickler.__init__
   file: object
   protocol: object = NULL
   fix_imports: bool = True
+  buffer_callback: object = NULL
 
 This takes a binary file for writing a pickle data stream.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 3; a backward-incompatible protocol designed for Python 3.
 
 Specifying a negative protocol version selects the highest protocol
@@ -4032,14 +4387,20 @@ this interface.
 If *fix_imports* is True and protocol is less than 3, pickle will try
 to map the new Python 3 names to the old module names used in Python
 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None and protocol is at least 5, it is
+called with each PickleBuffer being pickled.  If it returns a false
+value, the buffer is kept out of the pickle data stream, and must be
+given back to the unpickler in its *buffers* argument; otherwise it is
+serialized in-band.
 [clinic]*/
 
 PyDoc_STRVAR(_pickle_Pickler___init____doc__,
-"__init__(file, protocol=None, fix_imports=True)\n"
+"__init__(file, protocol=None, fix_imports=True, buffer_callback=None)\n"
 "This takes a binary file for writing a pickle data stream.\n"
 "\n"
 "The optional *protocol* argument tells the pickler to use the given\n"
-"protocol; supported protocols are 0, 1, 2, 3 and 4.  The default\n"
+"protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default\n"
 "protocol is 3; a backward-incompatible protocol designed for Python 3.\n"
 "\n"
 "Specifying a negative protocol version selects the highest protocol\n"
@@ -4053,36 +4414,43 @@ PyDoc_STRVAR(_pickle_Pickler___init____doc__,
 "\n"
 "If *fix_imports* is True and protocol is less than 3, pickle will try\n"
 "to map the new Python 3 names to the old module names used in Python\n"
-"2, so that the pickle data stream is readable with Python 2.");
+"2, so that the pickle data stream is readable with Python 2.\n"
+"\n"
+"If *buffer_callback* is not None and protocol is at least 5, it is\n"
+"called with each PickleBuffer being pickled.  If it returns a false\n"
+"value, the buffer is kept out of the pickle data stream, and must be\n"
+"given back to the unpickler in its *buffers* argument; otherwise it is\n"
+"serialized in-band.");
 
 #define _PICKLE_PICKLER___INIT___METHODDEF    \
     {"__init__", (PyCFunction)_pickle_Pickler___init__, METH_VARARGS|METH_KEYWORDS, _pickle_Pickler___init____doc__},
 
 static PyObject *
-_pickle_Pickler___init___impl(PicklerObject *self, PyObject *file, PyObject *protocol, int fix_imports);
+_pickle_Pickler___init___impl(PicklerObject *self, PyObject *file, PyObject *protocol, int fix_imports, PyObject *buffer_callback);
 
 static PyObject *
 _pickle_Pickler___init__(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     PyObject *return_value = NULL;
-    static char *_keywords[] = {"file", "protocol", "fix_imports", NULL};
+    static char *_keywords[] = {"file", "protocol", "fix_imports", "buffer_callback", NULL};
     PyObject *file;
     PyObject *protocol = NULL;
     int fix_imports = 1;
+    PyObject *buffer_callback = NULL;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-        "O|Op:__init__", _keywords,
-        &file, &protocol, &fix_imports))
+        "O|OpO:__init__", _keywords,
+        &file, &protocol, &fix_imports, &buffer_callback))
         goto exit;
-    return_value = _pickle_Pickler___init___impl((PicklerObject *)self, file, protocol, fix_imports);
+    return_value = _pickle_Pickler___init___impl((PicklerObject *)self, file, protocol, fix_imports, buffer_callback);
 
 exit:
     return return_value;
 }
 
 static PyObject *
-_pickle_Pickler___init___impl(PicklerObject *self, PyObject *file, PyObject *protocol, int fix_imports)
-/*[clinic checksum: 2b5ce6452544600478cf9f4b701ab9d9b5efbab9]*/
+_pickle_Pickler___init___impl(PicklerObject *self, PyObject *file, PyObject *protocol, int fix_imports, PyObject *buffer_callback)
+/*[clinic checksum: 8e1fcbc0802126d6f7ef15ac9517a9d36c783189]*/
 {
     _Py_IDENTIFIER(persistent_id);
     _Py_IDENTIFIER(dispatch_table);
@@ -4097,6 +4465,9 @@ _pickle_Pickler___init___impl(PicklerObject *self, PyObject *file, PyObject *pro
     if (_Pickler_SetOutputStream(self, file) < 0)
         return NULL;
 
+    if (_Pickler_SetBufferCallback(self, buffer_callback) < 0)
+        return NULL;
+
     /* memo and output_buffer may have already been created in _Pickler_New */
     if (self->memo == NULL) {
         self->memo = PyMemoTable_New();
@@ -4938,6 +5309,223 @@ load_counted_binbytes(UnpicklerObject *self, int nbytes)
     return 0;
 }
 
+static int
+load_counted_bytearray(UnpicklerObject *self)
+{
+    PyObject *bytearray;
+    Py_ssize_t size;
+    char *s;
+
+    if (_Unpickler_Read(self, &s, 8) < 0)
+        return -1;
+
+    size = calc_binsize(s, 8);
+    if (size < 0) {
+        PyErr_Format(PyExc_OverflowError,
+                     "BYTEARRAY8 exceeds system's maximum size of %zd bytes",
+                     PY_SSIZE_T_MAX);
+        return -1;
+    }
+
+    if (_Unpickler_Read(self, &s, size) < 0)
+        return -1;
+
+    bytearray = PyByteArray_FromStringAndSize(s, size);
+    if (bytearray == NULL)
+        return -1;
+
+    PDATA_PUSH(self->stack, bytearray, -1);
+    return 0;
+}
+
+static int
+load_next_buffer(UnpicklerObject *self)
+{
+    PyObject *buf;
+
+    if (self->buffers == NULL) {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_SetString(st->UnpicklingError,
+                        "pickle stream refers to out-of-band data "
+                        "but no *buffers* argument was given");
+        return -1;
+    }
+    buf = PyIter_Next(self->buffers);
+    if (buf == NULL) {
+        if (!PyErr_Occurred()) {
+            PickleState *st = _Pickle_GetGlobalState();
+            PyErr_SetString(st->UnpicklingError,
+                            "not enough out-of-band buffers");
+        }
+        return -1;
+    }
+
+    PDATA_PUSH(self->stack, buf, -1);
+    return 0;
+}
+
+static int
+load_readonly_buffer(UnpicklerObject *self)
+{
+    Py_ssize_t len = Py_SIZE(self->stack);
+    PyObject *obj, *view;
+
+    if (len == 0)
+        return stack_underflow();
+
+    obj = self->stack->data[len - 1];
+    view = PyMemoryView_FromObject(obj);
+    if (view == NULL)
+        return -1;
+    if (!PyMemoryView_GET_BUFFER(view)->readonly) {
+        /* Original object is writable */
+        PyMemoryView_GET_BUFFER(view)->readonly = 1;
+        self->stack->data[len - 1] = view;
+        Py_DECREF(obj);
+    }
+    else {
+        /* Original object is read-only, no need to replace it */
+        Py_DECREF(view);
+    }
+    return 0;
+}
+
+/* Load a packed array saved by save_packed() as a list or a tuple. */
+static int
+load_packed(UnpicklerObject *self, int is_tuple)
+{
+    PyObject *seq, *item;
+    PyObject **items;
+    Py_ssize_t len, i, itemsize;
+    unsigned char *p;
+    char *s;
+    int code;
+    long x;
+
+    if (_Unpickler_Read(self, &s, 9) < 0)
+        return -1;
+
+    code = (unsigned char)s[0];
+    len = calc_binsize(s + 1, 8);
+    if (len < 0) {
+        PyErr_Format(PyExc_OverflowError,
+                     "packed array exceeds system's maximum size of %zd items",
+                     PY_SSIZE_T_MAX);
+        return -1;
+    }
+    switch (code) {
+    case 'B': itemsize = 1; break;
+    case 'h': itemsize = 2; break;
+    case 'i': itemsize = 4; break;
+    case 'q': itemsize = 8; break;
+    case 'd': itemsize = 8; break;
+    case 's': itemsize = 0; break;
+    default: {
+        PickleState *st = _Pickle_GetGlobalState();
+        PyErr_Format(st->UnpicklingError,
+                     "invalid packed array type code, '%c'.", code);
+        return -1;
+    }
+    }
+
+    p = NULL;
+    if (itemsize > 0) {
+        /* Read all the data before allocating the items. */
+        if (len > PY_SSIZE_T_MAX / itemsize) {
+            PyErr_Format(PyExc_OverflowError,
+                         "packed array exceeds system's maximum size of "
+                         "%zd bytes", PY_SSIZE_T_MAX);
+            return -1;
+        }
+        if (_Unpickler_Read(self, &s, len * itemsize) < 0)
+            return -1;
+        p = (unsigned char *)s;
+    }
+
+    if (itemsize > 0)
+        seq = is_tuple ? PyTuple_New(len) : PyList_New(len);
+    else
+        /* Nothing backs the item count of a packed str array before the
+           strings are read: grow the list as they are rather than
+           trusting it. */
+        seq = PyList_New(0);
+    if (seq == NULL)
+        return -1;
+    items = PySequence_Fast_ITEMS(seq);
+
+    for (i = 0; i < len; i++) {
+        switch (code) {
+        case 'B':
+            item = PyLong_FromLong(p[0]);
+            break;
+        case 'h':
+            x = (long)p[0] | ((long)p[1] << 8);
+            item = PyLong_FromLong(x - ((x & 0x8000L) << 1));
+            break;
+        case 'i': {
+            unsigned long ux = (unsigned long)p[0] |
+                ((unsigned long)p[1] << 8) | ((unsigned long)p[2] << 16) |
+                ((unsigned long)p[3] << 24);
+            /* Sign-extend without overflowing a 4 byte long. */
+            if (ux & 0x80000000UL)
+                x = -(long)(0xffffffffUL - ux) - 1;
+            else
+                x = (long)ux;
+            item = PyLong_FromLong(x);
+            break;
+        }
+        case 'q':
+            item = _PyLong_FromByteArray(p, 8, 1, 1);
+            break;
+        case 'd': {
+            double d = _PyFloat_Unpack8(p, 1);
+            if (d == -1.0 && PyErr_Occurred())
+                item = NULL;
+            else
+                item = PyFloat_FromDouble(d);
+            break;
+        }
+        default: /* 's' */
+            if (_Unpickler_Read(self, &s, 1) < 0) {
+                item = NULL;
+                break;
+            }
+            x = (unsigned char)s[0];
+            if (_Unpickler_Read(self, &s, x) < 0)
+                item = NULL;
+            else
+                item = PyUnicode_DecodeASCII(s, x, "strict");
+            break;
+        }
+        if (item == NULL) {
+            Py_DECREF(seq);
+            return -1;
+        }
+        if (itemsize > 0) {
+            items[i] = item;
+            p += itemsize;
+        }
+        else {
+            int status = PyList_Append(seq, item);
+            Py_DECREF(item);
+            if (status < 0) {
+                Py_DECREF(seq);
+                return -1;
+            }
+        }
+    }
+    if (itemsize == 0 && is_tuple) {
+        PyObject *tuple = PyList_AsTuple(seq);
+        Py_DECREF(seq);
+        if (tuple == NULL)
+            return -1;
+        seq = tuple;
+    }
+
+    PDATA_PUSH(self->stack, seq, -1);
+    return 0;
+}
+
 static int
 load_unicode(UnpicklerObject *self)
 {
@@ -6184,6 +6772,11 @@ load(UnpicklerObject *self)
         OP_ARG(SHORT_BINBYTES, load_counted_binbytes, 1)
         OP_ARG(BINBYTES, load_counted_binbytes, 4)
         OP_ARG(BINBYTES8, load_counted_binbytes, 8)
+        OP(BYTEARRAY8, load_counted_bytearray)
+        OP(NEXT_BUFFER, load_next_buffer)
+        OP(READONLY_BUFFER, load_readonly_buffer)
+        OP_ARG(PACKED_LIST, load_packed, 0)
+        OP_ARG(PACKED_TUPLE, load_packed, 1)
         OP_ARG(SHORT_BINSTRING, load_counted_binstring, 1)
         OP_ARG(BINSTRING, load_counted_binstring, 4)
         OP(STRING, load_string)
@@ -6465,6 +7058,7 @@ Unpickler_dealloc(UnpicklerObject *self)
     Py_XDECREF(self->peek);
     Py_XDECREF(self->stack);
     Py_XDECREF(self->pers_func);
+    Py_XDECREF(self->buffers);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -6487,6 +7081,7 @@ Unpickler_traverse(UnpicklerObject *self, visitproc visit, void *arg)
     Py_VISIT(self->peek);
     Py_VISIT(self->stack);
     Py_VISIT(self->pers_func);
+    Py_VISIT(self->buffers);
     return 0;
 }
 
@@ -6498,6 +7093,7 @@ Unpickler_clear(UnpicklerObject *self)
     Py_CLEAR(self->peek);
     Py_CLEAR(self->stack);
     Py_CLEAR(self->pers_func);
+    Py_CLEAR(self->buffers);
     if (self->buffer.buf != NULL) {
         PyBuffer_Release(&self->buffer);
         self->buffer.buf = NULL;
@@ -6526,6 +7122,7 @@ _pickle.Unpickler.__init__
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object = NULL
 
 This takes a binary file for reading a pickle data stream.
 
@@ -6547,10 +7144,15 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it should be an iterable of buffer-enabled
+objects that is consumed each time the pickle stream references an
+out-of-band buffer view.  Such buffers have been given in order to the
+*buffer_callback* of a Pickler object.
 [clinic]*/
 
 PyDoc_STRVAR(_pickle_Unpickler___init____doc__,
-"__init__(file, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\')\n"
+"__init__(file, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\', buffers=None)\n"
 "This takes a binary file for reading a pickle data stream.\n"
 "\n"
 "The protocol version of the pickle is detected automatically, so no\n"
@@ -6570,37 +7172,43 @@ PyDoc_STRVAR(_pickle_Unpickler___init____doc__,
 "*encoding* and *errors* tell pickle how to decode 8-bit string\n"
 "instances pickled by Python 2; these default to \'ASCII\' and \'strict\',\n"
 "respectively.  The *encoding* can be \'bytes\' to read these 8-bit\n"
-"string instances as bytes objects.");
+"string instances as bytes objects.\n"
+"\n"
+"If *buffers* is not None, it should be an iterable of buffer-enabled\n"
+"objects that is consumed each time the pickle stream references an\n"
+"out-of-band buffer view.  Such buffers have been given in order to the\n"
+"*buffer_callback* of a Pickler object.");
 
 #define _PICKLE_UNPICKLER___INIT___METHODDEF    \
     {"__init__", (PyCFunction)_pickle_Unpickler___init__, METH_VARARGS|METH_KEYWORDS, _pickle_Unpickler___init____doc__},
 
 static PyObject *
-_pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file, int fix_imports, const char *encoding, const char *errors);
+_pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file, int fix_imports, const char *encoding, const char *errors, PyObject *buffers);
 
 static PyObject *
 _pickle_Unpickler___init__(PyObject *self, PyObject *args, PyObject *kwargs)
 {
     PyObject *return_value = NULL;
-    static char *_keywords[] = {"file", "fix_imports", "encoding", "errors", NULL};
+    static char *_keywords[] = {"file", "fix_imports", "encoding", "errors", "buffers", NULL};
     PyObject *file;
     int fix_imports = 1;
     const char *encoding = "ASCII";
     const char *errors = "strict";
+    PyObject *buffers = NULL;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-        "O|$pss:__init__", _keywords,
-        &file, &fix_imports, &encoding, &errors))
+        "O|$pssO:__init__", _keywords,
+        &file, &fix_imports, &encoding, &errors, &buffers))
         goto exit;
-    return_value = _pickle_Unpickler___init___impl((UnpicklerObject *)self, file, fix_imports, encoding, errors);
+    return_value = _pickle_Unpickler___init___impl((UnpicklerObject *)self, file, fix_imports, encoding, errors, buffers);
 
 exit:
     return return_value;
 }
 
 static PyObject *
-_pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file, int fix_imports, const char *encoding, const char *errors)
-/*[clinic checksum: 9ce6783224e220573d42a94fe1bb7199d6f1c5a6]*/
+_pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file, int fix_imports, const char *encoding, const char *errors, PyObject *buffers)
+/*[clinic checksum: 6099b174610e56df8a7a3d7be215537b382fd6e8]*/
 {
     _Py_IDENTIFIER(persistent_load);
 
@@ -6614,6 +7222,9 @@ _pickle_Unpickler___init___impl(UnpicklerObject *self, PyObject *file, int fix_i
     if (_Unpickler_SetInputEncoding(self, encoding, errors) < 0)
         return NULL;
 
+    if (_Unpickler_SetBuffers(self, buffers) < 0)
+        return NULL;
+
     self->fix_imports = fix_imports;
     if (self->fix_imports == -1)
         return NULL;
@@ -7046,6 +7657,7 @@ _pickle.dump
   protocol: object = NULL
   *
   fix_imports: bool = True
+  buffer_callback: object = NULL
 
 Write a pickled representation of obj to the open file object file.
 
@@ -7053,7 +7665,7 @@ This is equivalent to ``Pickler(file, protocol).dump(obj)``, but may
 be more efficient.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 3; a backward-incompatible protocol designed for Python 3.
 
 Specifying a negative protocol version selects the highest protocol
@@ -7068,17 +7680,21 @@ this interface.
 If *fix_imports* is True and protocol is less than 3, pickle will try
 to map the new Python 3 names to the old module names used in Python
 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None and protocol is at least 5, it is
+called with each PickleBuffer being pickled, and the buffers it
+returns a false value for are kept out of the pickle data stream.
 [clinic]*/
 
 PyDoc_STRVAR(_pickle_dump__doc__,
-"dump(obj, file, protocol=None, *, fix_imports=True)\n"
+"dump(obj, file, protocol=None, *, fix_imports=True, buffer_callback=None)\n"
 "Write a pickled representation of obj to the open file object file.\n"
 "\n"
 "This is equivalent to ``Pickler(file, protocol).dump(obj)``, but may\n"
 "be more efficient.\n"
 "\n"
 "The optional *protocol* argument tells the pickler to use the given\n"
-"protocol supported protocols are 0, 1, 2, 3 and 4.  The default\n"
+"protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default\n"
 "protocol is 3; a backward-incompatible protocol designed for Python 3.\n"
 "\n"
 "Specifying a negative protocol version selects the highest protocol\n"
@@ -7092,37 +7708,42 @@ PyDoc_STRVAR(_pickle_dump__doc__,
 "\n"
 "If *fix_imports* is True and protocol is less than 3, pickle will try\n"
 "to map the new Python 3 names to the old module names used in Python\n"
-"2, so that the pickle data stream is readable with Python 2.");
+"2, so that the pickle data stream is readable with Python 2.\n"
+"\n"
+"If *buffer_callback* is not None and protocol is at least 5, it is\n"
+"called with each PickleBuffer being pickled, and the buffers it\n"
+"returns a false value for are kept out of the pickle data stream.");
 
 #define _PICKLE_DUMP_METHODDEF    \
     {"dump", (PyCFunction)_pickle_dump, METH_VARARGS|METH_KEYWORDS, _pickle_dump__doc__},
 
 static PyObject *
-_pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file, PyObject *protocol, int fix_imports);
+_pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file, PyObject *protocol, int fix_imports, PyObject *buffer_callback);
 
 static PyObject *
 _pickle_dump(PyModuleDef *module, PyObject *args, PyObject *kwargs)
 {
     PyObject *return_value = NULL;
-    static char *_keywords[] = {"obj", "file", "protocol", "fix_imports", NULL};
+    static char *_keywords[] = {"obj", "file", "protocol", "fix_imports", "buffer_callback", NULL};
     PyObject *obj;
     PyObject *file;
     PyObject *protocol = NULL;
     int fix_imports = 1;
+    PyObject *buffer_callback = NULL;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-        "OO|O$p:dump", _keywords,
-        &obj, &file, &protocol, &fix_imports))
+        "OO|O$pO:dump", _keywords,
+        &obj, &file, &protocol, &fix_imports, &buffer_callback))
         goto exit;
-    return_value = _pickle_dump_impl(module, obj, file, protocol, fix_imports);
+    return_value = _pickle_dump_impl(module, obj, file, protocol, fix_imports, buffer_callback);
 
 exit:
     return return_value;
 }
 
 static PyObject *
-_pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file, PyObject *protocol, int fix_imports)
-/*[clinic checksum: eb5c23e64da34477178230b704d2cc9c6b6650ea]*/
+_pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file, PyObject *protocol, int fix_imports, PyObject *buffer_callback)
+/*[clinic checksum: f05860e1af06031ed5333ec174a0e13d964bb86f]*/
 {
     PicklerObject *pickler = _Pickler_New();
 
@@ -7132,6 +7753,9 @@ _pickle_dump_impl(PyModuleDef *module, PyObject *obj, PyObject *file, PyObject *
     if (_Pickler_SetProtocol(pickler, protocol, fix_imports) < 0)
         goto error;
 
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+        goto error;
+
     if (_Pickler_SetOutputStream(pickler, file) < 0)
         goto error;
 
@@ -7157,11 +7781,12 @@ _pickle.dumps
   protocol: object = NULL
   *
   fix_imports: bool = True
+  buffer_callback: object = NULL
 
 Return the pickled representation of the object as a bytes object.
 
 The optional *protocol* argument tells the pickler to use the given
-protocol; supported protocols are 0, 1, 2, 3 and 4.  The default
+protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default
 protocol is 3; a backward-incompatible protocol designed for Python 3.
 
 Specifying a negative protocol version selects the highest protocol
@@ -7171,14 +7796,18 @@ version of Python needed to read the pickle produced.
 If *fix_imports* is True and *protocol* is less than 3, pickle will
 try to map the new Python 3 names to the old module names used in
 Python 2, so that the pickle data stream is readable with Python 2.
+
+If *buffer_callback* is not None and protocol is at least 5, it is
+called with each PickleBuffer being pickled, and the buffers it
+returns a false value for are kept out of the pickle data stream.
 [clinic]*/
 
 PyDoc_STRVAR(_pickle_dumps__doc__,
-"dumps(obj, protocol=None, *, fix_imports=True)\n"
+"dumps(obj, protocol=None, *, fix_imports=True, buffer_callback=None)\n"
 "Return the pickled representation of the object as a bytes object.\n"
 "\n"
 "The optional *protocol* argument tells the pickler to use the given\n"
-"protocol; supported protocols are 0, 1, 2, 3 and 4.  The default\n"
+"protocol; supported protocols are 0, 1, 2, 3, 4 and 5.  The default\n"
 "protocol is 3; a backward-incompatible protocol designed for Python 3.\n"
 "\n"
 "Specifying a negative protocol version selects the highest protocol\n"
@@ -7187,36 +7816,41 @@ PyDoc_STRVAR(_pickle_dumps__doc__,
 "\n"
 "If *fix_imports* is True and *protocol* is less than 3, pickle will\n"
 "try to map the new Python 3 names to the old module names used in\n"
-"Python 2, so that the pickle data stream is readable with Python 2.");
+"Python 2, so that the pickle data stream is readable with Python 2.\n"
+"\n"
+"If *buffer_callback* is not None and protocol is at least 5, it is\n"
+"called with each PickleBuffer being pickled, and the buffers it\n"
+"returns a false value for are kept out of the pickle data stream.");
 
 #define _PICKLE_DUMPS_METHODDEF    \
     {"dumps", (PyCFunction)_pickle_dumps, METH_VARARGS|METH_KEYWORDS, _pickle_dumps__doc__},
 
 static PyObject *
-_pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol, int fix_imports);
+_pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol, int fix_imports, PyObject *buffer_callback);
 
 static PyObject *
 _pickle_dumps(PyModuleDef *module, PyObject *args, PyObject *kwargs)
 {
     PyObject *return_value = NULL;
-    static char *_keywords[] = {"obj", "protocol", "fix_imports", NULL};
+    static char *_keywords[] = {"obj", "protocol", "fix_imports", "buffer_callback", NULL};
     PyObject *obj;
     PyObject *protocol = NULL;
     int fix_imports = 1;
+    PyObject *buffer_callback = NULL;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-        "O|O$p:dumps", _keywords,
-        &obj, &protocol, &fix_imports))
+        "O|O$pO:dumps", _keywords,
+        &obj, &protocol, &fix_imports, &buffer_callback))
         goto exit;
-    return_value = _pickle_dumps_impl(module, obj, protocol, fix_imports);
+    return_value = _pickle_dumps_impl(module, obj, protocol, fix_imports, buffer_callback);
 
 exit:
     return return_value;
 }
 
 static PyObject *
-_pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol, int fix_imports)
-/*[clinic checksum: e9b915d61202a9692cb6c6718db74fe54fc9c4d1]*/
+_pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol, int fix_imports, PyObject *buffer_callback)
+/*[clinic checksum: a8a113d5a76e2209e23f75a4a56b975f8bb85752]*/
 {
     PyObject *result;
     PicklerObject *pickler = _Pickler_New();
@@ -7227,6 +7861,9 @@ _pickle_dumps_impl(PyModuleDef *module, PyObject *obj, PyObject *protocol, int f
     if (_Pickler_SetProtocol(pickler, protocol, fix_imports) < 0)
         goto error;
 
+    if (_Pickler_SetBufferCallback(pickler, buffer_callback) < 0)
+        goto error;
+
     if (dump(pickler, obj) < 0)
         goto error;
 
@@ -7248,6 +7885,7 @@ _pickle.load
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object = NULL
 
 Read and return an object from the pickle data stored in a file.
 
@@ -7272,10 +7910,14 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it should be an iterable of buffer-enabled
+objects that is consumed each time the pickle stream references an
+out-of-band buffer view.
 [clinic]*/
 
 PyDoc_STRVAR(_pickle_load__doc__,
-"load(file, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\')\n"
+"load(file, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\', buffers=None)\n"
 "Read and return an object from the pickle data stored in a file.\n"
 "\n"
 "This is equivalent to ``Unpickler(file).load()``, but may be more\n"
@@ -7298,37 +7940,42 @@ PyDoc_STRVAR(_pickle_load__doc__,
 "*encoding* and *errors* tell pickle how to decode 8-bit string\n"
 "instances pickled by Python 2; these default to \'ASCII\' and \'strict\',\n"
 "respectively.  The *encoding* can be \'bytes\' to read these 8-bit\n"
-"string instances as bytes objects.");
+"string instances as bytes objects.\n"
+"\n"
+"If *buffers* is not None, it should be an iterable of buffer-enabled\n"
+"objects that is consumed each time the pickle stream references an\n"
+"out-of-band buffer view.");
 
 #define _PICKLE_LOAD_METHODDEF    \
     {"load", (PyCFunction)_pickle_load, METH_VARARGS|METH_KEYWORDS, _pickle_load__doc__},
 
 static PyObject *
-_pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports, const char *encoding, const char *errors);
+_pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports, const char *encoding, const char *errors, PyObject *buffers);
 
 static PyObject *
 _pickle_load(PyModuleDef *module, PyObject *args, PyObject *kwargs)
 {
     PyObject *return_value = NULL;
-    static char *_keywords[] = {"file", "fix_imports", "encoding", "errors", NULL};
+    static char *_keywords[] = {"file", "fix_imports", "encoding", "errors", "buffers", NULL};
     PyObject *file;
     int fix_imports = 1;
     const char *encoding = "ASCII";
     const char *errors = "strict";
+    PyObject *buffers = NULL;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-        "O|$pss:load", _keywords,
-        &file, &fix_imports, &encoding, &errors))
+        "O|$pssO:load", _keywords,
+        &file, &fix_imports, &encoding, &errors, &buffers))
         goto exit;
-    return_value = _pickle_load_impl(module, file, fix_imports, encoding, errors);
+    return_value = _pickle_load_impl(module, file, fix_imports, encoding, errors, buffers);
 
 exit:
     return return_value;
 }
 
 static PyObject *
-_pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports, const char *encoding, const char *errors)
-/*[clinic checksum: b41f06970e57acf2fd602e4b7f88e3f3e1e53087]*/
+_pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports, const char *encoding, const char *errors, PyObject *buffers)
+/*[clinic checksum: e38847bac91cbf5a206687ad916ecbcb63be7293]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7342,6 +7989,9 @@ _pickle_load_impl(PyModuleDef *module, PyObject *file, int fix_imports, const ch
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
         goto error;
 
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        goto error;
+
     unpickler->fix_imports = fix_imports;
 
     result = load(unpickler);
@@ -7362,6 +8012,7 @@ _pickle.loads
   fix_imports: bool = True
   encoding: str = 'ASCII'
   errors: str = 'strict'
+  buffers: object = NULL
 
 Read and return an object from the given pickle data.
 
@@ -7377,10 +8028,14 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *buffers* is not None, it should be an iterable of buffer-enabled
+objects that is consumed each time the pickle stream references an
+out-of-band buffer view.
 [clinic]*/
 
 PyDoc_STRVAR(_pickle_loads__doc__,
-"loads(data, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\')\n"
+"loads(data, *, fix_imports=True, encoding=\'ASCII\', errors=\'strict\', buffers=None)\n"
 "Read and return an object from the given pickle data.\n"
 "\n"
 "The protocol version of the pickle is detected automatically, so no\n"
@@ -7394,37 +8049,42 @@ PyDoc_STRVAR(_pickle_loads__doc__,
 "*encoding* and *errors* tell pickle how to decode 8-bit string\n"
 "instances pickled by Python 2; these default to \'ASCII\' and \'strict\',\n"
 "respectively.  The *encoding* can be \'bytes\' to read these 8-bit\n"
-"string instances as bytes objects.");
+"string instances as bytes objects.\n"
+"\n"
+"If *buffers* is not None, it should be an iterable of buffer-enabled\n"
+"objects that is consumed each time the pickle stream references an\n"
+"out-of-band buffer view.");
 
 #define _PICKLE_LOADS_METHODDEF    \
     {"loads", (PyCFunction)_pickle_loads, METH_VARARGS|METH_KEYWORDS, _pickle_loads__doc__},
 
 static PyObject *
-_pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports, const char *encoding, const char *errors);
+_pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports, const char *encoding, const char *errors, PyObject *buffers);
 
 static PyObject *
 _pickle_loads(PyModuleDef *module, PyObject *args, PyObject *kwargs)
 {
     PyObject *return_value = NULL;
-    static char *_keywords[] = {"data", "fix_imports", "encoding", "errors", NULL};
+    static char *_keywords[] = {"data", "fix_imports", "encoding", "errors", "buffers", NULL};
     PyObject *data;
     int fix_imports = 1;
     const char *encoding = "ASCII";
     const char *errors = "strict";
+    PyObject *buffers = NULL;
 
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-        "O|$pss:loads", _keywords,
-        &data, &fix_imports, &encoding, &errors))
+        "O|$pssO:loads", _keywords,
+        &data, &fix_imports, &encoding, &errors, &buffers))
         goto exit;
-    return_value = _pickle_loads_impl(module, data, fix_imports, encoding, errors);
+    return_value = _pickle_loads_impl(module, data, fix_imports, encoding, errors, buffers);
 
 exit:
     return return_value;
 }
 
 static PyObject *
-_pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports, const char *encoding, const char *errors)
-/*[clinic checksum: 0663de43aca6c21508a777e29d98c9c3a6e7f72d]*/
+_pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports, const char *encoding, const char *errors, PyObject *buffers)
+/*[clinic checksum: 98c9f8531fb54dd328f4f2748a0d85acb8b93411]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7438,6 +8098,9 @@ _pickle_loads_impl(PyModuleDef *module, PyObject *data, int fix_imports, const c
     if (_Unpickler_SetInputEncoding(unpickler, encoding, errors) < 0)
         goto error;
 
+    if (_Unpickler_SetBuffers(unpickler, buffers) < 0)
+        goto error;
+
     unpickler->fix_imports = fix_imports;
 
     result = load(unpickler);
@@ -7529,6 +8192,10 @@ PyInit__pickle(void)
     Py_INCREF(&Unpickler_Type);
     if (PyModule_AddObject(m, "Unpickler", (PyObject *)&Unpickler_Type) < 0)
         return NULL;
+    Py_INCREF(&PyPickleBuffer_Type);
+    if (PyModule_AddObject(m, "PickleBuffer",
+                           (PyObject *)&PyPickleBuffer_Type) < 0)
+        return NULL;
 
     st = _Pickle_GetState(m);
 
@@ -2958,6 +2958,69 @@ exit:
 }
 #endif   /* WITH_THREAD */
 
+static PyObject *
+dict_get_version(PyObject *self, PyObject *args)
+{
+    PyDictObject *dict;
+    PY_UINT64_T version;
+
+    if (!PyArg_ParseTuple(args, "O!:dict_get_version", &PyDict_Type, &dict))
+        return NULL;
+
+    version = dict->ma_version_tag;
+
+    return PyLong_FromUnsignedLongLong((unsigned PY_LONG_LONG)version);
+}
+
+/* Reports received by the hook installed by set_gc_hook() */
+static PyObject *gc_hook_reports = NULL;
+
+static void
+gc_hook(const _PyGC_CollectionInfo *info, void *arg)
+{
+    PyObject *report;
+
+    assert(arg == &gc_hook_reports);
+    /* The hook must not raise */
+    report = Py_BuildValue("(iiinnnddddd)",
+                           info->generation, info->incremental,
+                           info->complete, info->collected,
+                           info->uncollectable, info->examined,
+                           info->duration, info->mark_time,
+                           info->finalize_time, info->weakref_time,
+                           info->delete_time);
+    if (report == NULL || PyList_Append(gc_hook_reports, report) < 0)
+        PyErr_Clear();
+    Py_XDECREF(report);
+}
+
+/* set_gc_hook(True) installs a collection hook which records its reports
+   in a list; set_gc_hook(False) removes it and returns the list. */
+static PyObject *
+set_gc_hook(PyObject *self, PyObject *arg)
+{
+    PyObject *reports;
+    int enable = PyObject_IsTrue(arg);
+
+    if (enable < 0)
+        return NULL;
+    if (enable) {
+        reports = PyList_New(0);
+        if (reports == NULL)
+            return NULL;
+        Py_XDECREF(gc_hook_reports);
+        gc_hook_reports = reports;
+        _PyGC_SetCollectHook(gc_hook, &gc_hook_reports);
+        Py_RETURN_NONE;
+    }
+    _PyGC_SetCollectHook(NULL, NULL);
+    if (gc_hook_reports == NULL)
+        Py_RETURN_NONE;
+    reports = gc_hook_reports;
+    gc_hook_reports = NULL;
+    return reports;
+}
+
 
 static PyMethodDef TestMethods[] = {
     {"raise_exception",         raise_exception,                 METH_VARARGS},
@@ -3091,6 +3154,8 @@ static PyMethodDef TestMethods[] = {
     {"call_in_temporary_c_thread", call_in_temporary_c_thread, METH_O,
      PyDoc_STR("set_error_class(error_class) -> None")},
 #endif
+    {"dict_get_version", dict_get_version, METH_VARARGS},
+    {"set_gc_hook", set_gc_hook, METH_O},
     {NULL, NULL} /* sentinel */
 };
 
@@ -0,0 +1,1135 @@
+/*
+ * Support for Linux io_uring
+ *
+ * The rings are set up with the raw io_uring_setup() and io_uring_enter()
+ * system calls, so no liburing is needed.  Operations are queued on the
+ * submission ring by the Ring methods and are handed to the kernel in a
+ * single io_uring_enter() call by Ring.wait().
+ */
+
+#include "Python.h"
+#include "structmember.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <poll.h>
+#include <signal.h>
+#include <linux/io_uring.h>
+
+enum {TYPE_RECV, TYPE_SEND, TYPE_READ, TYPE_WRITE, TYPE_ACCEPT,
+      TYPE_CONNECT, TYPE_POLL};
+
+static const char *type_names[] = {"recv", "send", "read", "write",
+                                   "accept", "connect", "poll"};
+
+typedef union {
+    struct sockaddr sa;
+    struct sockaddr_in in;
+    struct sockaddr_in6 in6;
+    struct sockaddr_un un;
+} sock_addr_t;
+
+typedef struct OperationObject {
+    PyObject_HEAD
+    /* Type of operation */
+    int type;
+    /* File descriptor the operation works on */
+    int fd;
+    /* Whether the kernel may still access the buffers below */
+    int pending;
+    /* The cqe result: a byte count, a descriptor or a negated errno */
+    int res;
+    /* Links in the ring's list of pending operations */
+    struct OperationObject *prev, *next;
+    /* Buffer used for reading (optional) */
+    PyObject *read_buffer;
+    /* Buffer used for writing (optional) */
+    Py_buffer write_buffer;
+    /* Destination address of a connect operation */
+    sock_addr_t addr;
+} OperationObject;
+
+typedef struct {
+    PyObject_HEAD
+    int fd;
+    /* Set while a thread is waiting in io_uring_enter() */
+    int waiting;
+    unsigned int features;
+    /* Submission ring */
+    unsigned int *sq_khead, *sq_ktail, *sq_kmask, *sq_kflags, *sq_array;
+    unsigned int sq_tail;
+    unsigned int sq_entries;
+    struct io_uring_sqe *sqes;
+    /* Completion ring */
+    unsigned int *cq_khead, *cq_ktail, *cq_kmask;
+    struct io_uring_cqe *cqes;
+    /* Mappings */
+    void *sq_ring, *cq_ring;
+    size_t sq_ring_size, cq_ring_size, sqes_size;
+    /* Operations that have not been reaped yet.  Each holds a reference
+       which is dropped when its completion is reaped. */
+    OperationObject pending;
+    Py_ssize_t npending;
+} RingObject;
+
+static PyTypeObject OperationType;
+
+static int
+sys_io_uring_setup(unsigned int entries, struct io_uring_params *p)
+{
+    return (int) syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int
+sys_io_uring_enter(int fd, unsigned int to_submit, unsigned int min_complete,
+                   unsigned int flags, void *arg, size_t argsz)
+{
+    return (int) syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                         flags, arg, argsz);
+}
+
+static PyObject *
+SetFromErrno(int err)
+{
+    errno = err;
+    return PyErr_SetFromErrno(PyExc_OSError);
+}
+
+/*
+ * Operation
+ */
+
+static void
+Operation_dealloc(OperationObject *self)
+{
+    /* The ring owns a reference to pending operations */
+    assert(!self->pending);
+    if (self->write_buffer.obj)
+        PyBuffer_Release(&self->write_buffer);
+    Py_CLEAR(self->read_buffer);
+    PyObject_Del(self);
+}
+
+static PyObject *
+Operation_repr(OperationObject *self)
+{
+    if (self->pending)
+        return PyUnicode_FromFormat("<%s %s fd=%d pending>",
+                                    Py_TYPE(self)->tp_name,
+                                    type_names[self->type], self->fd);
+    return PyUnicode_FromFormat("<%s %s fd=%d res=%d>",
+                                Py_TYPE(self)->tp_name,
+                                type_names[self->type], self->fd, self->res);
+}
+
+PyDoc_STRVAR(
+    Operation_getresult_doc,
+    "getresult() -> result\n\n"
+    "Retrieve result of operation.  This is the data read for recv and\n"
+    "read, the number of bytes written for send and write, the new file\n"
+    "descriptor for accept, the returned events for poll and None for\n"
+    "connect.  OSError is raised if the operation failed and ValueError\n"
+    "if it is still pending.");
+
+static PyObject *
+Operation_getresult(OperationObject *self)
+{
+    if (self->pending) {
+        PyErr_SetString(PyExc_ValueError, "operation still pending");
+        return NULL;
+    }
+    if (self->res < 0)
+        return SetFromErrno(-self->res);
+
+    switch (self->type) {
+        case TYPE_RECV:
+        case TYPE_READ:
+            Py_INCREF(self->read_buffer);
+            return self->read_buffer;
+        case TYPE_CONNECT:
+            Py_RETURN_NONE;
+        default:
+            return PyLong_FromLong(self->res);
+    }
+}
+
+static PyObject*
+Operation_getpending(OperationObject *self)
+{
+    return PyBool_FromLong(self->pending);
+}
+
+static PyObject*
+Operation_gettype(OperationObject *self)
+{
+    return PyUnicode_FromString(type_names[self->type]);
+}
+
+static PyMethodDef Operation_methods[] = {
+    {"getresult", (PyCFunction) Operation_getresult,
+     METH_NOARGS, Operation_getresult_doc},
+    {NULL}
+};
+
+static PyMemberDef Operation_members[] = {
+    {"fd", T_INT,
+     offsetof(OperationObject, fd),
+     READONLY, "File descriptor of the operation"},
+    {"result", T_INT,
+     offsetof(OperationObject, res),
+     READONLY, "Raw result of the operation, negative on failure"},
+    {NULL}
+};
+
+static PyGetSetDef Operation_getsets[] = {
+    {"pending", (getter)Operation_getpending, NULL,
+     "Whether the operation is pending"},
+    {"type", (getter)Operation_gettype, NULL,
+     "Name of the operation"},
+    {NULL},
+};
+
+static PyTypeObject OperationType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    /* tp_name           */ "_uring.Operation",
+    /* tp_basicsize      */ sizeof(OperationObject),
+    /* tp_itemsize       */ 0,
+    /* tp_dealloc        */ (destructor) Operation_dealloc,
+    /* tp_print          */ 0,
+    /* tp_getattr        */ 0,
+    /* tp_setattr        */ 0,
+    /* tp_reserved       */ 0,
+    /* tp_repr           */ (reprfunc) Operation_repr,
+    /* tp_as_number      */ 0,
+    /* tp_as_sequence    */ 0,
+    /* tp_as_mapping     */ 0,
+    /* tp_hash           */ 0,
+    /* tp_call           */ 0,
+    /* tp_str            */ 0,
+    /* tp_getattro       */ 0,
+    /* tp_setattro       */ 0,
+    /* tp_as_buffer      */ 0,
+    /* tp_flags          */ Py_TPFLAGS_DEFAULT,
+    /* tp_doc            */ "io_uring operation",
+    /* tp_traverse       */ 0,
+    /* tp_clear          */ 0,
+    /* tp_richcompare    */ 0,
+    /* tp_weaklistoffset */ 0,
+    /* tp_iter           */ 0,
+    /* tp_iternext       */ 0,
+    /* tp_methods        */ Operation_methods,
+    /* tp_members        */ Operation_members,
+    /* tp_getset         */ Operation_getsets,
+};
+
+static OperationObject *
+new_operation(int type, int fd)
+{
+    OperationObject *op;
+
+    op = PyObject_New(OperationObject, &OperationType);
+    if (op == NULL)
+        return NULL;
+    op->type = type;
+    op->fd = fd;
+    op->pending = 0;
+    op->res = 0;
+    op->prev = op->next = NULL;
+    op->read_buffer = NULL;
+    memset(&op->write_buffer, 0, sizeof(op->write_buffer));
+    memset(&op->addr, 0, sizeof(op->addr));
+    return op;
+}
+
+/*
+ * Ring
+ */
+
+static int
+check_ring(RingObject *self)
+{
+    if (self->fd < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "I/O operation on closed io_uring object");
+        return -1;
+    }
+    return 0;
+}
+
+/* Return the number of queued entries the kernel has not consumed yet. */
+static unsigned int
+sq_unsubmitted(RingObject *self)
+{
+    return self->sq_tail - __atomic_load_n(self->sq_khead, __ATOMIC_ACQUIRE);
+}
+
+/* Hand the queued entries to the kernel and wait for min_complete
+   completions.  Called without the GIL when blocking. */
+static int
+ring_enter(RingObject *self, unsigned int min_complete,
+           struct __kernel_timespec *ts)
+{
+    struct io_uring_getevents_arg arg;
+    unsigned int flags = 0;
+    int ret;
+
+    if (min_complete > 0 || ts != NULL) {
+        flags |= IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+        memset(&arg, 0, sizeof(arg));
+        arg.sigmask_sz = _NSIG / 8;
+        arg.ts = (__u64) (uintptr_t) ts;
+    }
+    ret = sys_io_uring_enter(self->fd, sq_unsubmitted(self), min_complete,
+                             flags, flags ? &arg : NULL,
+                             flags ? sizeof(arg) : 0);
+    return ret < 0 ? -errno : ret;
+}
+
+/* Return a free submission entry, flushing the submission ring first
+   if it is full. */
+static struct io_uring_sqe *
+get_sqe(RingObject *self)
+{
+    struct io_uring_sqe *sqe;
+    int ret;
+
+    if (sq_unsubmitted(self) >= self->sq_entries) {
+        ret = ring_enter(self, 0, NULL);
+        if (ret < 0) {
+            SetFromErrno(-ret);
+            return NULL;
+        }
+        if (sq_unsubmitted(self) >= self->sq_entries) {
+            SetFromErrno(EBUSY);
+            return NULL;
+        }
+    }
+    sqe = &self->sqes[self->sq_tail & *self->sq_kmask];
+    memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+/* Make sqe visible to the kernel.  If op is not NULL it becomes pending
+   and the ring takes a reference to it. */
+static void
+push_sqe(RingObject *self, struct io_uring_sqe *sqe, OperationObject *op)
+{
+    if (op != NULL) {
+        sqe->user_data = (__u64) (uintptr_t) op;
+        Py_INCREF(op);
+        op->pending = 1;
+        op->prev = &self->pending;
+        op->next = self->pending.next;
+        self->pending.next->prev = op;
+        self->pending.next = op;
+        self->npending++;
+    }
+    self->sq_tail++;
+    __atomic_store_n(self->sq_ktail, self->sq_tail, __ATOMIC_RELEASE);
+}
+
+/* Move the available completions to the list result (or drop them if
+   result is NULL).  Return the number of completions reaped. */
+static Py_ssize_t
+reap_completions(RingObject *self, PyObject *result)
+{
+    unsigned int head, tail;
+    Py_ssize_t count = 0;
+    OperationObject *op;
+    struct io_uring_cqe *cqe;
+    int error = 0;
+
+    head = *self->cq_khead;
+    tail = __atomic_load_n(self->cq_ktail, __ATOMIC_ACQUIRE);
+    for (; head != tail; head++) {
+        cqe = &self->cqes[head & *self->cq_kmask];
+        op = (OperationObject *) (uintptr_t) cqe->user_data;
+        if (op == NULL)
+            /* Completion of a cancel request */
+            continue;
+        op->res = cqe->res;
+        op->pending = 0;
+        op->prev->next = op->next;
+        op->next->prev = op->prev;
+        op->prev = op->next = NULL;
+        self->npending--;
+        count++;
+
+        if (op->write_buffer.obj)
+            PyBuffer_Release(&op->write_buffer);
+        if (op->read_buffer != NULL && op->res >= 0 &&
+            op->res != PyBytes_GET_SIZE(op->read_buffer) &&
+            _PyBytes_Resize(&op->read_buffer, op->res) < 0) {
+            /* Report the MemoryError when the result is retrieved */
+            PyErr_Clear();
+            op->res = -ENOMEM;
+        }
+        if (result != NULL && !error && PyList_Append(result, (PyObject *)op))
+            error = 1;
+        Py_DECREF(op);
+    }
+    __atomic_store_n(self->cq_khead, head, __ATOMIC_RELEASE);
+    return error ? -1 : count;
+}
+
+static int
+queue_cancel(RingObject *self, OperationObject *op)
+{
+    struct io_uring_sqe *sqe;
+
+    sqe = get_sqe(self);
+    if (sqe == NULL)
+        return -1;
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = (__u64) (uintptr_t) op;
+    push_sqe(self, sqe, NULL);
+    return 0;
+}
+
+static void
+ring_unmap(RingObject *self)
+{
+    if (self->sqes != NULL && self->sqes != MAP_FAILED)
+        munmap(self->sqes, self->sqes_size);
+    if (self->cq_ring != NULL && self->cq_ring != MAP_FAILED &&
+        self->cq_ring != self->sq_ring)
+        munmap(self->cq_ring, self->cq_ring_size);
+    if (self->sq_ring != NULL && self->sq_ring != MAP_FAILED)
+        munmap(self->sq_ring, self->sq_ring_size);
+    self->sqes = NULL;
+    self->sq_ring = self->cq_ring = NULL;
+}
+
+/* Cancel all pending operations and wait until the kernel is done with
+   their buffers before tearing the rings down. */
+static int
+ring_close(RingObject *self)
+{
+    OperationObject *op;
+    int ret;
+
+    if (self->fd < 0)
+        return 0;
+    if (self->waiting) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "cannot close io_uring object while waiting");
+        return -1;
+    }
+    for (op = self->pending.next; op != &self->pending; op = op->next) {
+        if (queue_cancel(self, op) < 0)
+            return -1;
+    }
+    while (self->npending > 0 || sq_unsubmitted(self) > 0) {
+        Py_BEGIN_ALLOW_THREADS
+        ret = ring_enter(self, self->npending > 0, NULL);
+        Py_END_ALLOW_THREADS
+        if (ret < 0 && ret != -EINTR && ret != -EBUSY) {
+            SetFromErrno(-ret);
+            return -1;
+        }
+        reap_completions(self, NULL);
+    }
+    ring_unmap(self);
+    close(self->fd);
+    self->fd = -1;
+    return 0;
+}
+
+static PyObject *
+Ring_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    static char *kwlist[] = {"entries", NULL};
+    struct io_uring_params p;
+    RingObject *self;
+    unsigned int entries = 256;
+    unsigned int i;
+    char *sq, *cq;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "|I:Ring", kwlist,
+                                     &entries))
+        return NULL;
+
+    self = (RingObject *) type->tp_alloc(type, 0);
+    if (self == NULL)
+        return NULL;
+    self->fd = -1;
+    self->pending.prev = self->pending.next = &self->pending;
+
+    memset(&p, 0, sizeof(p));
+    self->fd = sys_io_uring_setup(entries, &p);
+    if (self->fd < 0) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        goto error;
+    }
+    if (!(p.features & IORING_FEAT_EXT_ARG)) {
+        /* Waiting with a timeout needs Linux 5.11 */
+        SetFromErrno(ENOSYS);
+        goto error;
+    }
+    self->features = p.features;
+    self->sq_entries = p.sq_entries;
+
+    self->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+    self->cq_ring_size = p.cq_off.cqes +
+                         p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        self->sq_ring_size = self->cq_ring_size =
+            Py_MAX(self->sq_ring_size, self->cq_ring_size);
+    }
+    self->sq_ring = mmap(NULL, self->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, self->fd,
+                         IORING_OFF_SQ_RING);
+    if (self->sq_ring == MAP_FAILED) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        goto error;
+    }
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        self->cq_ring = self->sq_ring;
+    else {
+        self->cq_ring = mmap(NULL, self->cq_ring_size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, self->fd,
+                             IORING_OFF_CQ_RING);
+        if (self->cq_ring == MAP_FAILED) {
+            PyErr_SetFromErrno(PyExc_OSError);
+            goto error;
+        }
+    }
+    self->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    self->sqes = mmap(NULL, self->sqes_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, self->fd,
+                      IORING_OFF_SQES);
+    if (self->sqes == MAP_FAILED) {
+        PyErr_SetFromErrno(PyExc_OSError);
+        goto error;
+    }
+
+    sq = self->sq_ring;
+    self->sq_khead = (unsigned int *) (sq + p.sq_off.head);
+    self->sq_ktail = (unsigned int *) (sq + p.sq_off.tail);
+    self->sq_kmask = (unsigned int *) (sq + p.sq_off.ring_mask);
+    self->sq_kflags = (unsigned int *) (sq + p.sq_off.flags);
+    self->sq_array = (unsigned int *) (sq + p.sq_off.array);
+    self->sq_tail = *self->sq_ktail;
+    /* Submission entries are always used in ring order */
+    for (i = 0; i < p.sq_entries; i++)
+        self->sq_array[i] = i;
+
+    cq = self->cq_ring;
+    self->cq_khead = (unsigned int *) (cq + p.cq_off.head);
+    self->cq_ktail = (unsigned int *) (cq + p.cq_off.tail);
+    self->cq_kmask = (unsigned int *) (cq + p.cq_off.ring_mask);
+    self->cqes = (struct io_uring_cqe *) (cq + p.cq_off.cqes);
+
+    return (PyObject *) self;
+
+error:
+    ring_unmap(self);
+    if (self->fd >= 0) {
+        close(self->fd);
+        self->fd = -1;
+    }
+    Py_DECREF(self);
+    return NULL;
+}
+
+static void
+Ring_dealloc(RingObject *self)
+{
+    PyObject *type, *value, *traceback;
+
+    PyErr_Fetch(&type, &value, &traceback);
+    if (ring_close(self) < 0) {
+        /* The kernel may still write to the buffers of the pending
+           operations, so leak them rather than crash. */
+        PyErr_WriteUnraisable((PyObject *) self);
+    }
+    PyErr_Restore(type, value, traceback);
+    Py_TYPE(self)->tp_free((PyObject *) self);
+}
+
+PyDoc_STRVAR(
+    Ring_recv_doc,
+    "recv(fd, size, flags=0) -> Operation\n\n"
+    "Queue a recv() of at most size bytes from socket fd");
+
+static PyObject *
+Ring_recv(RingObject *self, PyObject *args)
+{
+    struct io_uring_sqe *sqe;
+    OperationObject *op;
+    int fd, flags = 0;
+    unsigned int size;
+
+    if (!PyArg_ParseTuple(args, "iI|i:recv", &fd, &size, &flags))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+
+    op = new_operation(TYPE_RECV, fd);
+    if (op == NULL)
+        return NULL;
+    op->read_buffer = PyBytes_FromStringAndSize(NULL, size);
+    if (op->read_buffer == NULL || (sqe = get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = fd;
+    sqe->addr = (__u64) (uintptr_t) PyBytes_AS_STRING(op->read_buffer);
+    sqe->len = size;
+    sqe->msg_flags = flags;
+    push_sqe(self, sqe, op);
+    return (PyObject *) op;
+}
+
+PyDoc_STRVAR(
+    Ring_read_doc,
+    "read(fd, size, offset=-1) -> Operation\n\n"
+    "Queue a read of at most size bytes from fd at offset, or from the\n"
+    "current file position if offset is -1");
+
+static PyObject *
+Ring_read(RingObject *self, PyObject *args)
+{
+    struct io_uring_sqe *sqe;
+    OperationObject *op;
+    int fd;
+    unsigned int size;
+    long long offset = -1;
+
+    if (!PyArg_ParseTuple(args, "iI|L:read", &fd, &size, &offset))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+
+    op = new_operation(TYPE_READ, fd);
+    if (op == NULL)
+        return NULL;
+    op->read_buffer = PyBytes_FromStringAndSize(NULL, size);
+    if (op->read_buffer == NULL || (sqe = get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->off = (__u64) offset;
+    sqe->addr = (__u64) (uintptr_t) PyBytes_AS_STRING(op->read_buffer);
+    sqe->len = size;
+    push_sqe(self, sqe, op);
+    return (PyObject *) op;
+}
+
+static PyObject *
+queue_write(RingObject *self, int type, int fd, Py_buffer *buf,
+            int flags, long long offset)
+{
+    struct io_uring_sqe *sqe;
+    OperationObject *op;
+
+    if (check_ring(self) < 0) {
+        PyBuffer_Release(buf);
+        return NULL;
+    }
+    if (buf->len > UINT_MAX) {
+        PyBuffer_Release(buf);
+        PyErr_SetString(PyExc_ValueError, "buffer too large");
+        return NULL;
+    }
+    op = new_operation(type, fd);
+    if (op == NULL) {
+        PyBuffer_Release(buf);
+        return NULL;
+    }
+    op->write_buffer = *buf;
+    if ((sqe = get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = type == TYPE_SEND ? IORING_OP_SEND : IORING_OP_WRITE;
+    sqe->fd = fd;
+    sqe->addr = (__u64) (uintptr_t) op->write_buffer.buf;
+    sqe->len = (__u32) op->write_buffer.len;
+    if (type == TYPE_SEND)
+        sqe->msg_flags = flags;
+    else
+        sqe->off = (__u64) offset;
+    push_sqe(self, sqe, op);
+    return (PyObject *) op;
+}
+
+PyDoc_STRVAR(
+    Ring_send_doc,
+    "send(fd, buf, flags=0) -> Operation\n\n"
+    "Queue a send() of buf to socket fd");
+
+static PyObject *
+Ring_send(RingObject *self, PyObject *args)
+{
+    Py_buffer buf;
+    int fd, flags = 0;
+
+    if (!PyArg_ParseTuple(args, "iy*|i:send", &fd, &buf, &flags))
+        return NULL;
+    return queue_write(self, TYPE_SEND, fd, &buf, flags, 0);
+}
+
+PyDoc_STRVAR(
+    Ring_write_doc,
+    "write(fd, buf, offset=-1) -> Operation\n\n"
+    "Queue a write of buf to fd at offset, or at the current file\n"
+    "position if offset is -1");
+
+static PyObject *
+Ring_write(RingObject *self, PyObject *args)
+{
+    Py_buffer buf;
+    int fd;
+    long long offset = -1;
+
+    if (!PyArg_ParseTuple(args, "iy*|L:write", &fd, &buf, &offset))
+        return NULL;
+    return queue_write(self, TYPE_WRITE, fd, &buf, 0, offset);
+}
+
+PyDoc_STRVAR(
+    Ring_accept_doc,
+    "accept(fd, flags=SOCK_CLOEXEC) -> Operation\n\n"
+    "Queue an accept4() on listening socket fd");
+
+static PyObject *
+Ring_accept(RingObject *self, PyObject *args)
+{
+    struct io_uring_sqe *sqe;
+    OperationObject *op;
+    int fd, flags = SOCK_CLOEXEC;
+
+    if (!PyArg_ParseTuple(args, "i|i:accept", &fd, &flags))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+
+    op = new_operation(TYPE_ACCEPT, fd);
+    if (op == NULL)
+        return NULL;
+    if ((sqe = get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = fd;
+    sqe->accept_flags = flags;
+    push_sqe(self, sqe, op);
+    return (PyObject *) op;
+}
+
+/* Convert a numeric socket address in the format used by the socket
+   module to a struct sockaddr.  Return the address length or -1. */
+static int
+parse_address(int family, PyObject *obj, sock_addr_t *addr)
+{
+    char *host;
+    int port;
+    unsigned int flowinfo = 0, scope_id = 0;
+    PyObject *path = NULL;
+    Py_ssize_t len;
+
+    switch (family) {
+        case AF_INET:
+            if (!PyArg_ParseTuple(obj, "si:connect", &host, &port))
+                return -1;
+            if (port < 0 || port > 0xffff)
+                break;
+            addr->in.sin_family = AF_INET;
+            addr->in.sin_port = htons((unsigned short) port);
+            if (inet_pton(AF_INET, host, &addr->in.sin_addr) != 1)
+                break;
+            return sizeof(addr->in);
+        case AF_INET6:
+            if (!PyArg_ParseTuple(obj, "si|II:connect",
+                                  &host, &port, &flowinfo, &scope_id))
+                return -1;
+            if (port < 0 || port > 0xffff)
+                break;
+            addr->in6.sin6_family = AF_INET6;
+            addr->in6.sin6_port = htons((unsigned short) port);
+            addr->in6.sin6_flowinfo = htonl(flowinfo);
+            addr->in6.sin6_scope_id = scope_id;
+            if (inet_pton(AF_INET6, host, &addr->in6.sin6_addr) != 1)
+                break;
+            return sizeof(addr->in6);
+        case AF_UNIX:
+            if (!PyUnicode_FSConverter(obj, &path))
+                return -1;
+            len = PyBytes_GET_SIZE(path);
+            if (len >= (Py_ssize_t) sizeof(addr->un.sun_path)) {
+                Py_DECREF(path);
+                PyErr_SetString(PyExc_OSError, "AF_UNIX path too long");
+                return -1;
+            }
+            addr->un.sun_family = AF_UNIX;
+            memcpy(addr->un.sun_path, PyBytes_AS_STRING(path), len);
+            Py_DECREF(path);
+            /* Abstract namespace addresses are not NUL terminated */
+            if (len > 0 && addr->un.sun_path[0] == 0)
+                return (int) (offsetof(struct sockaddr_un, sun_path) + len);
+            return (int) (offsetof(struct sockaddr_un, sun_path) + len + 1);
+        default:
+            PyErr_SetString(PyExc_ValueError, "unsupported address family");
+            return -1;
+    }
+    PyErr_SetString(PyExc_ValueError, "illegal address");
+    return -1;
+}
+
+PyDoc_STRVAR(
+    Ring_connect_doc,
+    "connect(fd, family, address) -> Operation\n\n"
+    "Queue a connect() of socket fd to a numeric address");
+
+static PyObject *
+Ring_connect(RingObject *self, PyObject *args)
+{
+    struct io_uring_sqe *sqe;
+    OperationObject *op;
+    PyObject *address;
+    int fd, family, len;
+
+    if (!PyArg_ParseTuple(args, "iiO:connect", &fd, &family, &address))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+
+    op = new_operation(TYPE_CONNECT, fd);
+    if (op == NULL)
+        return NULL;
+    len = parse_address(family, address, &op->addr);
+    if (len < 0 || (sqe = get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_CONNECT;
+    sqe->fd = fd;
+    sqe->addr = (__u64) (uintptr_t) &op->addr;
+    sqe->off = (__u64) len;
+    push_sqe(self, sqe, op);
+    return (PyObject *) op;
+}
+
+PyDoc_STRVAR(
+    Ring_poll_doc,
+    "poll(fd, events) -> Operation\n\n"
+    "Queue a one-shot poll of fd for events (a mask of POLLIN, POLLOUT...)");
+
+static PyObject *
+Ring_poll(RingObject *self, PyObject *args)
+{
+    struct io_uring_sqe *sqe;
+    OperationObject *op;
+    int fd;
+    unsigned short events;
+
+    if (!PyArg_ParseTuple(args, "iH:poll", &fd, &events))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+
+    op = new_operation(TYPE_POLL, fd);
+    if (op == NULL)
+        return NULL;
+    if ((sqe = get_sqe(self)) == NULL) {
+        Py_DECREF(op);
+        return NULL;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = fd;
+#ifdef WORDS_BIGENDIAN
+    /* The kernel reads the 32-bit mask with its halfwords swapped */
+    sqe->poll32_events = (__u32) events << 16;
+#else
+    sqe->poll32_events = events;
+#endif
+    push_sqe(self, sqe, op);
+    return (PyObject *) op;
+}
+
+PyDoc_STRVAR(
+    Ring_cancel_doc,
+    "cancel(op) -> None\n\n"
+    "Queue a request to cancel operation op.  The operation still\n"
+    "completes, usually with ECANCELED.");
+
+static PyObject *
+Ring_cancel(RingObject *self, PyObject *args)
+{
+    OperationObject *op;
+
+    if (!PyArg_ParseTuple(args, "O!:cancel", &OperationType, &op))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+    if (op->pending && queue_cancel(self, op) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(
+    Ring_submit_doc,
+    "submit() -> int\n\n"
+    "Submit the queued operations without waiting for completions\n"
+    "and return how many were submitted");
+
+static PyObject *
+Ring_submit(RingObject *self)
+{
+    int ret;
+
+    if (check_ring(self) < 0)
+        return NULL;
+    if (sq_unsubmitted(self) == 0)
+        return PyLong_FromLong(0);
+    ret = ring_enter(self, 0, NULL);
+    if (ret < 0)
+        return SetFromErrno(-ret);
+    return PyLong_FromLong(ret);
+}
+
+PyDoc_STRVAR(
+    Ring_wait_doc,
+    "wait(timeout=None) -> list of operations\n\n"
+    "Submit the queued operations and wait for at least one completion,\n"
+    "with a single system call.  Return the completed operations; the\n"
+    "list is empty if the timeout (in seconds) expires first.");
+
+static PyObject *
+Ring_wait(RingObject *self, PyObject *args)
+{
+    PyObject *timeout_obj = Py_None;
+    PyObject *result;
+    struct __kernel_timespec ts, *pts = NULL;
+    unsigned int min_complete = 1;
+    double timeout;
+    int ret;
+
+    if (!PyArg_ParseTuple(args, "|O:wait", &timeout_obj))
+        return NULL;
+    if (check_ring(self) < 0)
+        return NULL;
+    if (timeout_obj != Py_None) {
+        timeout = PyFloat_AsDouble(timeout_obj);
+        if (timeout == -1 && PyErr_Occurred())
+            return NULL;
+        if (timeout <= 0)
+            min_complete = 0;
+        else {
+            ts.tv_sec = (long long) timeout;
+            ts.tv_nsec = (long long) ((timeout - ts.tv_sec) * 1e9);
+            pts = &ts;
+        }
+    }
+
+    /* Don't block if completions are already waiting to be reaped */
+    if (*self->cq_khead !=
+        __atomic_load_n(self->cq_ktail, __ATOMIC_ACQUIRE))
+        min_complete = 0;
+
+    if (min_complete > 0 || sq_unsubmitted(self) > 0) {
+        self->waiting = 1;
+        Py_BEGIN_ALLOW_THREADS
+        ret = ring_enter(self, min_complete, min_complete ? pts : NULL);
+        Py_END_ALLOW_THREADS
+        self->waiting = 0;
+        /* EBUSY means the completion ring must be drained first */
+        if (ret < 0 && ret != -ETIME && ret != -EBUSY)
+            return SetFromErrno(-ret);
+    }
+
+    result = PyList_New(0);
+    if (result == NULL)
+        return NULL;
+    for (;;) {
+        if (reap_completions(self, result) < 0) {
+            Py_DECREF(result);
+            return NULL;
+        }
+        /* Completions which did not fit in the ring are kept by the
+           kernel until it has room for them again */
+        if (!(__atomic_load_n(self->sq_kflags, __ATOMIC_ACQUIRE) &
+              IORING_SQ_CQ_OVERFLOW))
+            break;
+        ret = sys_io_uring_enter(self->fd, 0, 0, IORING_ENTER_GETEVENTS,
+                                 NULL, 0);
+        if (ret < 0 && errno != EINTR && errno != EBUSY) {
+            Py_DECREF(result);
+            return PyErr_SetFromErrno(PyExc_OSError);
+        }
+    }
+    return result;
+}
+
+PyDoc_STRVAR(
+    Ring_close_doc,
+    "close() -> None\n\n"
+    "Cancel the pending operations, wait for them to complete and\n"
+    "close the io_uring file descriptor");
+
+static PyObject *
+Ring_close(RingObject *self)
+{
+    if (ring_close(self) < 0)
+        return NULL;
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(
+    Ring_fileno_doc,
+    "fileno() -> int\n\n"
+    "Return the io_uring file descriptor");
+
+static PyObject *
+Ring_fileno(RingObject *self)
+{
+    if (check_ring(self) < 0)
+        return NULL;
+    return PyLong_FromLong(self->fd);
+}
+
+static PyObject*
+Ring_getclosed(RingObject *self)
+{
+    return PyBool_FromLong(self->fd < 0);
+}
+
+static PyObject*
+Ring_getpending(RingObject *self)
+{
+    return PyLong_FromSsize_t(self->npending);
+}
+
+static PyMethodDef Ring_methods[] = {
+    {"recv", (PyCFunction) Ring_recv,
+     METH_VARARGS, Ring_recv_doc},
+    {"send", (PyCFunction) Ring_send,
+     METH_VARARGS, Ring_send_doc},
+    {"read", (PyCFunction) Ring_read,
+     METH_VARARGS, Ring_read_doc},
+    {"write", (PyCFunction) Ring_write,
+     METH_VARARGS, Ring_write_doc},
+    {"accept", (PyCFunction) Ring_accept,
+     METH_VARARGS, Ring_accept_doc},
+    {"connect", (PyCFunction) Ring_connect,
+     METH_VARARGS, Ring_connect_doc},
+    {"poll", (PyCFunction) Ring_poll,
+     METH_VARARGS, Ring_poll_doc},
+    {"cancel", (PyCFunction) Ring_cancel,
+     METH_VARARGS, Ring_cancel_doc},
+    {"submit", (PyCFunction) Ring_submit,
+     METH_NOARGS, Ring_submit_doc},
+    {"wait", (PyCFunction) Ring_wait,
+     METH_VARARGS, Ring_wait_doc},
+    {"close", (PyCFunction) Ring_close,
+     METH_NOARGS, Ring_close_doc},
+    {"fileno", (PyCFunction) Ring_fileno,
+     METH_NOARGS, Ring_fileno_doc},
+    {NULL}
+};
+
+static PyMemberDef Ring_members[] = {
+    {"features", T_UINT,
+     offsetof(RingObject, features),
+     READONLY, "IORING_FEAT_* flags reported by the kernel"},
+    {NULL}
+};
+
+static PyGetSetDef Ring_getsets[] = {
+    {"closed", (getter)Ring_getclosed, NULL,
+     "True if the ring is closed"},
+    {"pending", (getter)Ring_getpending, NULL,
+     "Number of operations which have not completed yet"},
+    {NULL},
+};
+
+PyDoc_STRVAR(
+    Ring_doc,
+    "Ring(entries=256)\n\n"
+    "io_uring instance with a submission ring of the given size");
+
+static PyTypeObject RingType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    /* tp_name           */ "_uring.Ring",
+    /* tp_basicsize      */ sizeof(RingObject),
+    /* tp_itemsize       */ 0,
+    /* tp_dealloc        */ (destructor) Ring_dealloc,
+    /* tp_print          */ 0,
+    /* tp_getattr        */ 0,
+    /* tp_setattr        */ 0,
+    /* tp_reserved       */ 0,
+    /* tp_repr           */ 0,
+    /* tp_as_number      */ 0,
+    /* tp_as_sequence    */ 0,
+    /* tp_as_mapping     */ 0,
+    /* tp_hash           */ 0,
+    /* tp_call           */ 0,
+    /* tp_str            */ 0,
+    /* tp_getattro       */ 0,
+    /* tp_setattro       */ 0,
+    /* tp_as_buffer      */ 0,
+    /* tp_flags          */ Py_TPFLAGS_DEFAULT,
+    /* tp_doc            */ Ring_doc,
+    /* tp_traverse       */ 0,
+    /* tp_clear          */ 0,
+    /* tp_richcompare    */ 0,
+    /* tp_weaklistoffset */ 0,
+    /* tp_iter           */ 0,
+    /* tp_iternext       */ 0,
+    /* tp_methods        */ Ring_methods,
+    /* tp_members        */ Ring_members,
+    /* tp_getset         */ Ring_getsets,
+    /* tp_base           */ 0,
+    /* tp_dict           */ 0,
+    /* tp_descr_get      */ 0,
+    /* tp_descr_set      */ 0,
+    /* tp_dictoffset     */ 0,
+    /* tp_init           */ 0,
+    /* tp_alloc          */ 0,
+    /* tp_new            */ Ring_new,
+};
+
+static struct PyModuleDef uring_module = {
+    PyModuleDef_HEAD_INIT,
+    "_uring",
+    NULL,
+    -1,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL
+};
+
+PyMODINIT_FUNC
+PyInit__uring(void)
+{
+    PyObject *m;
+
+    if (PyType_Ready(&RingType) < 0)
+        return NULL;
+    if (PyType_Ready(&OperationType) < 0)
+        return NULL;
+
+    m = PyModule_Create(&uring_module);
+    if (m == NULL)
+        return NULL;
+    Py_INCREF(&RingType);
+    if (PyModule_AddObject(m, "Ring", (PyObject *)&RingType) < 0)
+        return NULL;
+    Py_INCREF(&OperationType);
+    if (PyModule_AddObject(m, "Operation", (PyObject *)&OperationType) < 0)
+        return NULL;
+    return m;
+}
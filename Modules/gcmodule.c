@@ -54,6 +54,14 @@ static struct gc_generation generations[NUM_GENERATIONS] = {
 
 PyGC_Head *_PyGC_generation0 = GEN_HEAD(0);
 
+/* Objects moved out of the generations by gc.freeze().  Collections never
+ * examine them, so that the memory they live in stays untouched, and shared
+ * with the parent after a fork().
+ */
+static struct gc_generation permanent_generation = {
+    {{&permanent_generation.head, &permanent_generation.head, 0}}, 0, 0
+};
+
 static int enabled = 1; /* automatic collection enabled? */
 
 /* true if we are currently running the collector */
@@ -168,6 +176,15 @@ static Py_ssize_t long_lived_pending = 0;
 static int debug;
 static PyObject *tmod = NULL;
 
+/* Upper bounds, in seconds, of the buckets of the pause time histograms;
+ * the last bucket holds the longer pauses.
+ */
+static const double pause_bounds[] = {
+    1e-5, 2e-5, 5e-5, 1e-4, 2e-4, 5e-4, 1e-3, 2e-3, 5e-3,
+    1e-2, 2e-2, 5e-2, 1e-1, 2e-1, 5e-1, 1.0
+};
+#define NUM_PAUSE_BOUNDS (sizeof(pause_bounds) / sizeof(pause_bounds[0]))
+
 /* Running stats per generation */
 struct gc_generation_stats {
     /* total number of collections */
@@ -176,10 +193,34 @@ struct gc_generation_stats {
     Py_ssize_t collected;
     /* total number of uncollectable objects (put into gc.garbage) */
     Py_ssize_t uncollectable;
+    /* number of slices of incremental collections */
+    Py_ssize_t increments;
+    /* total number of objects examined */
+    Py_ssize_t examined;
+    /* total time spent in each phase, see _PyGC_CollectionInfo */
+    double mark_time;
+    double finalize_time;
+    double weakref_time;
+    double delete_time;
+    /* total and longest pause, and histogram of the pauses */
+    double pause_total;
+    double pause_max;
+    Py_ssize_t pauses[NUM_PAUSE_BOUNDS + 1];
 };
 
 static struct gc_generation_stats generation_stats[NUM_GENERATIONS];
 
+/* Incremental collection of the oldest generation, see incremental_step().
+ * Incremental mode is on if either limit is non-zero.
+ */
+static Py_ssize_t inc_max_objects = 0; /* objects examined per slice */
+static Py_ssize_t inc_max_usec = 0;    /* duration of a slice */
+#define INC_ENABLED() (inc_max_objects > 0 || inc_max_usec > 0)
+
+/* C hook called after each collection, see _PyGC_SetCollectHook() */
+static _PyGC_CollectHook collect_hook = NULL;
+static void *collect_hook_arg = NULL;
+
 /*--------------------------------------------------------------------------
 gc_refs values.
 
@@ -228,6 +269,17 @@ GC_TENTATIVELY_UNREACHABLE
 #define IS_TENTATIVELY_UNREACHABLE(o) ( \
     _PyGC_REFS(o) == GC_TENTATIVELY_UNREACHABLE)
 
+/* gc_refs values of the objects of the oldest generation while an
+ * incremental collection is in progress, see incremental_step().  They are
+ * negative, so that collections of the younger generations leave these
+ * objects alone, as they do with GC_REACHABLE ones.
+ */
+#define GC_INC_GRAY                     (-5)
+#define GC_INC_TENTATIVE                (-6)
+#define GC_INC_COUNT(n)                 (-7 - (n))
+#define IS_INC_COUNT(refs)              ((refs) <= GC_INC_COUNT(0))
+#define IS_INCREMENTAL(refs)            ((refs) <= GC_INC_GRAY)
+
 /*** list functions ***/
 
 static void
@@ -334,13 +386,15 @@ append_objects(PyObject *py_list, PyGC_Head *gc_list)
 
 /* Set all gc_refs = ob_refcnt.  After this, gc_refs is > 0 for all objects
  * in containers, and is GC_REACHABLE for all tracked gc objects not in
- * containers.
+ * containers.  Return the number of objects in containers.
  */
-static void
+static Py_ssize_t
 update_refs(PyGC_Head *containers)
 {
+    Py_ssize_t n = 0;
     PyGC_Head *gc = containers->gc.gc_next;
     for (; gc != containers; gc = gc->gc.gc_next) {
+        n++;
         assert(_PyGCHead_REFS(gc) == GC_REACHABLE);
         _PyGCHead_SET_REFS(gc, Py_REFCNT(FROM_GC(gc)));
         /* Python's cyclic gc should never see an incoming refcount
@@ -363,6 +417,7 @@ update_refs(PyGC_Head *containers)
          */
         assert(_PyGCHead_REFS(gc) != 0);
     }
+    return n;
 }
 
 /* A traversal callback for subtract_refs. */
@@ -438,7 +493,8 @@ visit_reachable(PyObject *op, PyGC_Head *reachable)
          else {
             assert(gc_refs > 0
                    || gc_refs == GC_REACHABLE
-                   || gc_refs == GC_UNTRACKED);
+                   || gc_refs == GC_UNTRACKED
+                   || IS_INCREMENTAL(gc_refs));
          }
     }
     return 0;
@@ -676,18 +732,22 @@ handle_weakrefs(PyGC_Head *unreachable, PyGC_Head *old)
      */
             if (IS_TENTATIVELY_UNREACHABLE(wr))
                 continue;
-            assert(IS_REACHABLE(wr));
+            assert(IS_REACHABLE(wr) || IS_INCREMENTAL(_PyGC_REFS(wr)));
 
             /* Create a new reference so that wr can't go away
              * before we can process it again.
              */
             Py_INCREF(wr);
 
-            /* Move wr to wrcb_to_call, for the next pass. */
+            /* Move wr to wrcb_to_call, for the next pass.  If wr belongs
+             * to an incremental collection in progress, this takes it
+             * out of the collection, which is safe.
+             */
             wrasgc = AS_GC(wr);
             assert(wrasgc != next); /* wrasgc is reachable, but
                                        next isn't, so they can't
                                        be the same */
+            _PyGCHead_SET_REFS(wrasgc, GC_REACHABLE);
             gc_list_move(wrasgc, &wrcb_to_call);
         }
     }
@@ -882,6 +942,36 @@ clear_freelists(void)
     (void)PySet_ClearFreeList();
 }
 
+/* Return the current time in seconds, for the pause statistics and the
+ * time limit of incremental slices.  Use a monotonic clock if available.
+ */
+static double
+gc_clock(void)
+{
+    _PyTime_timeval tv;
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+    _PyTime_gettimeofday(&tv);
+    return (double)tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void
+record_pause(struct gc_generation_stats *stats, double pause)
+{
+    size_t i;
+
+    stats->pause_total += pause;
+    if (pause > stats->pause_max)
+        stats->pause_max = pause;
+    for (i = 0; i < NUM_PAUSE_BOUNDS && pause >= pause_bounds[i]; i++)
+        ;
+    stats->pauses[i]++;
+}
+
 static double
 get_time(void)
 {
@@ -903,57 +993,33 @@ get_time(void)
 }
 
 /* This is the main function.  Read this to understand how the
- * collection process works. */
+ * collection process works.  Collect the objects of the young list, which
+ * belong to `generation`, and move the survivors to old.  t1 is the start
+ * time for the DEBUG_STATS output.  The counts and phase times are stored
+ * in info.
+ */
 static Py_ssize_t
-collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
-        int nofail)
+collect_list(int generation, PyGC_Head *young, PyGC_Head *old, double t1,
+             _PyGC_CollectionInfo *info, int nofail)
 {
-    int i;
     Py_ssize_t m = 0; /* # objects collected */
     Py_ssize_t n = 0; /* # unreachable objects that couldn't be collected */
-    PyGC_Head *young; /* the generation we are examining */
-    PyGC_Head *old; /* next older generation */
     PyGC_Head unreachable; /* non-problematic unreachable trash */
     PyGC_Head finalizers;  /* objects with, & reachable from, __del__ */
     PyGC_Head *gc;
-    double t1 = 0.0;
     struct gc_generation_stats *stats = &generation_stats[generation];
+    double t = gc_clock(), now;
 
-    if (debug & DEBUG_STATS) {
-        PySys_WriteStderr("gc: collecting generation %d...\n",
-                          generation);
-        PySys_WriteStderr("gc: objects in each generation:");
-        for (i = 0; i < NUM_GENERATIONS; i++)
-            PySys_WriteStderr(" %" PY_FORMAT_SIZE_T "d",
-                              gc_list_size(GEN_HEAD(i)));
-        t1 = get_time();
-        PySys_WriteStderr("\n");
-    }
-
-    /* update collection and allocation counters */
-    if (generation+1 < NUM_GENERATIONS)
-        generations[generation+1].count += 1;
-    for (i = 0; i <= generation; i++)
-        generations[i].count = 0;
-
-    /* merge younger generations with one we are currently collecting */
-    for (i = 0; i < generation; i++) {
-        gc_list_merge(GEN_HEAD(i), GEN_HEAD(generation));
-    }
-
-    /* handy references */
-    young = GEN_HEAD(generation);
-    if (generation < NUM_GENERATIONS-1)
-        old = GEN_HEAD(generation+1);
-    else
-        old = young;
+    /* Charge the time since t to the phase, and restart the clock */
+#define PHASE_DONE(PHASE) \
+    (now = gc_clock(), info->PHASE += now - t, t = now)
 
     /* Using ob_refcnt and gc_refs, calculate which objects in the
      * container set are reachable from outside the set (i.e., have a
      * refcount greater than 0 when all the references within the
      * set are taken into account).
      */
-    update_refs(young);
+    info->examined = update_refs(young);
     subtract_refs(young);
 
     /* Leave everything reachable from outside young in young, and move
@@ -979,6 +1045,7 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
         long_lived_pending = 0;
         long_lived_total = gc_list_size(young);
     }
+    PHASE_DONE(mark_time);
 
     /* All objects in unreachable are trash, but objects reachable from
      * legacy finalizers (e.g. tp_del) can't safely be deleted.
@@ -990,6 +1057,7 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
      * and we move those into the finalizers list too.
      */
     move_legacy_finalizer_reachable(&finalizers);
+    PHASE_DONE(finalize_time);
 
     /* Collect statistics on collectable objects found and print
      * debugging information.
@@ -1004,6 +1072,7 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
 
     /* Clear weakrefs and invoke callbacks as necessary. */
     m += handle_weakrefs(&unreachable, old);
+    PHASE_DONE(weakref_time);
 
     /* Call tp_finalize on objects which have one. */
     finalize_garbage(&unreachable, old);
@@ -1011,13 +1080,16 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     if (check_garbage(&unreachable)) {
         revive_garbage(&unreachable);
         gc_list_merge(&unreachable, old);
+        PHASE_DONE(finalize_time);
     }
     else {
+        PHASE_DONE(finalize_time);
         /* Call tp_clear on objects in the unreachable set.  This will cause
          * the reference cycles to be broken.  It may also cause some objects
          * in finalizers to be freed.
          */
         delete_garbage(&unreachable, old);
+        PHASE_DONE(delete_time);
     }
 
     /* Collect statistics on uncollectable objects found and print
@@ -1050,6 +1122,8 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
      * this if they insist on creating this type of structure.
      */
     (void)handle_legacy_finalizers(&finalizers, old);
+    PHASE_DONE(finalize_time);
+#undef PHASE_DONE
 
     /* Clear free list only during the collection of the highest
      * generation */
@@ -1070,22 +1144,97 @@ collect(int generation, Py_ssize_t *n_collected, Py_ssize_t *n_uncollectable,
     }
 
     /* Update stats */
-    if (n_collected)
-        *n_collected = m;
-    if (n_uncollectable)
-        *n_uncollectable = n;
+    info->collected = m;
+    info->uncollectable = n;
     stats->collections++;
     stats->collected += m;
     stats->uncollectable += n;
+    stats->examined += info->examined;
+    stats->mark_time += info->mark_time;
+    stats->finalize_time += info->finalize_time;
+    stats->weakref_time += info->weakref_time;
+    stats->delete_time += info->delete_time;
     return n+m;
 }
 
+/* Record the pause of the collection or slice described by info, and
+ * report it to the C hook.
+ */
+static void
+report_collection(const _PyGC_CollectionInfo *info)
+{
+    record_pause(&generation_stats[info->generation], info->duration);
+    if (collect_hook != NULL)
+        collect_hook(info, collect_hook_arg);
+}
+
+static void incremental_abort(void);
+
+/* Collect a generation and the younger ones.  If info isn't NULL, the
+ * report of the collection is stored there.
+ */
+static Py_ssize_t
+collect(int generation, _PyGC_CollectionInfo *info, int nofail)
+{
+    int i;
+    PyGC_Head *young; /* the generation we are examining */
+    PyGC_Head *old; /* next older generation */
+    double t1 = 0.0;
+    double start = gc_clock();
+    Py_ssize_t result;
+    _PyGC_CollectionInfo local_info;
+
+    if (info == NULL)
+        info = &local_info;
+    memset(info, 0, sizeof(*info));
+    info->generation = generation;
+    info->complete = 1;
+
+    /* A full collection supersedes an incremental one. */
+    if (generation == NUM_GENERATIONS - 1)
+        incremental_abort();
+
+    if (debug & DEBUG_STATS) {
+        PySys_WriteStderr("gc: collecting generation %d...\n",
+                          generation);
+        PySys_WriteStderr("gc: objects in each generation:");
+        for (i = 0; i < NUM_GENERATIONS; i++)
+            PySys_WriteStderr(" %" PY_FORMAT_SIZE_T "d",
+                              gc_list_size(GEN_HEAD(i)));
+        t1 = get_time();
+        PySys_WriteStderr("\n");
+    }
+
+    /* update collection and allocation counters */
+    if (generation+1 < NUM_GENERATIONS)
+        generations[generation+1].count += 1;
+    for (i = 0; i <= generation; i++)
+        generations[i].count = 0;
+
+    /* merge younger generations with one we are currently collecting */
+    for (i = 0; i < generation; i++) {
+        gc_list_merge(GEN_HEAD(i), GEN_HEAD(generation));
+    }
+
+    /* handy references */
+    young = GEN_HEAD(generation);
+    if (generation < NUM_GENERATIONS-1)
+        old = GEN_HEAD(generation+1);
+    else
+        old = young;
+
+    result = collect_list(generation, young, old, t1, info, nofail);
+    info->duration = gc_clock() - start;
+    report_collection(info);
+    return result;
+}
+
 /* Invoke progress callbacks to notify clients that garbage collection
- * is starting or stopping
+ * is starting or stopping.  report is NULL when starting.
  */
 static void
 invoke_gc_callback(const char *phase, int generation,
-                   Py_ssize_t collected, Py_ssize_t uncollectable)
+                   const _PyGC_CollectionInfo *report)
 {
     Py_ssize_t i;
     PyObject *info = NULL;
@@ -1096,10 +1245,22 @@ invoke_gc_callback(const char *phase, int generation,
     /* The local variable cannot be rebound, check it for sanity */
     assert(callbacks != NULL && PyList_CheckExact(callbacks));
     if (PyList_GET_SIZE(callbacks) != 0) {
-        info = Py_BuildValue("{sisnsn}",
-            "generation", generation,
-            "collected", collected,
-            "uncollectable", uncollectable);
+        if (report == NULL)
+            info = Py_BuildValue("{sisisi}",
+                "generation", generation,
+                "collected", 0,
+                "uncollectable", 0);
+        else
+            info = Py_BuildValue("{sisnsnsnsdsdsdsdsd}",
+                "generation", generation,
+                "collected", report->collected,
+                "uncollectable", report->uncollectable,
+                "examined", report->examined,
+                "duration", report->duration,
+                "mark_time", report->mark_time,
+                "finalize_time", report->finalize_time,
+                "weakref_time", report->weakref_time,
+                "delete_time", report->delete_time);
         if (info == NULL) {
             PyErr_WriteUnraisable(NULL);
             return;
@@ -1123,10 +1284,295 @@ invoke_gc_callback(const char *phase, int generation,
 static Py_ssize_t
 collect_with_callback(int generation)
 {
-    Py_ssize_t result, collected, uncollectable;
-    invoke_gc_callback("start", generation, 0, 0);
-    result = collect(generation, &collected, &uncollectable, 0);
-    invoke_gc_callback("stop", generation, collected, uncollectable);
+    Py_ssize_t result;
+    _PyGC_CollectionInfo info;
+    invoke_gc_callback("start", generation, NULL);
+    result = collect(generation, &info, 0);
+    invoke_gc_callback("stop", generation, &info);
+    return result;
+}
+
+/*** Incremental collection of the oldest generation ***/
+
+/* A collection of the oldest generation examines every tracked object, so
+   with large heaps its pause can be long.  In incremental mode (see
+   gc.set_incremental()), the work is split into slices, each examining a
+   bounded number of objects or running for a bounded time, and the program
+   runs between the slices.  A slice runs after each automatic collection
+   of the younger generations, or when gc.collect_step() is called.
+
+   When an incremental collection starts, the oldest generation is moved to
+   the inc_lists; these objects are "the set".  The slices then compute the
+   same things as update_refs(), subtract_refs() and move_unreachable() do
+   for an ordinary collection, in three phases:
+
+   INC_COUNT
+       gc_refs of each object of the set is set to GC_INC_COUNT(refcount).
+   INC_SUBTRACT
+       Each object of the set is traversed and the count of the objects of
+       the set it refers to is decremented.
+   INC_MARK
+       Objects with a non-zero count are reachable from outside the set:
+       they become GC_INC_GRAY, and so do the objects of the set they refer
+       to, transitively.  Once traversed, a gray object is GC_REACHABLE again
+       and is moved back to the oldest generation.  Objects with a zero
+       count are set aside as GC_INC_TENTATIVE, until they turn gray or the
+       phase ends.
+
+   The program may change references and reference counts between slices,
+   so the result of the phases is only an approximation.  It is made safe
+   by the final step:  the tentatively unreachable objects left at the end
+   of INC_MARK are collected as an ordinary, atomic, collection of that list
+   alone (collect_list()).  Collecting any subset of the objects is correct,
+   since references from outside the subset keep its objects alive; so the
+   worst a stale count can do is to put live objects in the final list, or
+   to leave garbage for the next collection.  Cycles which were already
+   garbage when the incremental collection started can't be touched by the
+   program, so their counts are exact and they are found.
+
+   Objects of the set are kept in the inc_lists, which the program never
+   walks, so they can be freed or untracked at any time.  Their gc_refs
+   values are negative, which collections of the younger generations treat
+   like GC_REACHABLE.  A full collection aborts the incremental one.
+*/
+
+enum { INC_IDLE, INC_COUNT, INC_SUBTRACT, INC_MARK };
+static int inc_phase = INC_IDLE;
+
+#define INC_TODO        0       /* objects waiting for the current phase */
+#define INC_DONE        1       /* objects done with the current phase */
+#define INC_GRAY        2       /* reachable objects not traversed yet */
+#define INC_TENTATIVE   3       /* possibly unreachable objects */
+#define NUM_INC_LISTS   4
+#define INC_HEAD(n)     (&inc_lists[n])
+
+static PyGC_Head inc_lists[NUM_INC_LISTS] = {
+    {{INC_HEAD(0), INC_HEAD(0), 0}},
+    {{INC_HEAD(1), INC_HEAD(1), 0}},
+    {{INC_HEAD(2), INC_HEAD(2), 0}},
+    {{INC_HEAD(3), INC_HEAD(3), 0}},
+};
+
+/* # of objects of the set found reachable by the current collection */
+static Py_ssize_t inc_survivors = 0;
+
+/* A traversal callback for the INC_SUBTRACT phase. */
+static int
+visit_inc_decref(PyObject *op, void *data)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        const Py_ssize_t gc_refs = _PyGCHead_REFS(gc);
+        /* A stale count may already have dropped to zero. */
+        if (IS_INC_COUNT(gc_refs) && gc_refs != GC_INC_COUNT(0))
+            _PyGCHead_SET_REFS(gc, (gc_refs + 1));
+    }
+    return 0;
+}
+
+/* A traversal callback for the INC_MARK phase. */
+static int
+visit_inc_reachable(PyObject *op, PyGC_Head *gray)
+{
+    if (PyObject_IS_GC(op)) {
+        PyGC_Head *gc = AS_GC(op);
+        const Py_ssize_t gc_refs = _PyGCHead_REFS(gc);
+        if (IS_INC_COUNT(gc_refs) || gc_refs == GC_INC_TENTATIVE) {
+            _PyGCHead_SET_REFS(gc, GC_INC_GRAY);
+            gc_list_move(gc, gray);
+        }
+    }
+    return 0;
+}
+
+static void
+incremental_start(void)
+{
+    assert(inc_phase == INC_IDLE);
+    gc_list_merge(GEN_HEAD(NUM_GENERATIONS - 1), INC_HEAD(INC_TODO));
+    generations[NUM_GENERATIONS - 1].count = 0;
+    long_lived_pending = 0;
+    inc_survivors = 0;
+    inc_phase = INC_COUNT;
+}
+
+/* Give the objects of the set back to the oldest generation. */
+static void
+incremental_abort(void)
+{
+    int i;
+    PyGC_Head *gc;
+
+    if (inc_phase == INC_IDLE)
+        return;
+    for (i = 0; i < NUM_INC_LISTS; i++) {
+        for (gc = INC_HEAD(i)->gc.gc_next; gc != INC_HEAD(i);
+             gc = gc->gc.gc_next)
+            _PyGCHead_SET_REFS(gc, GC_REACHABLE);
+        gc_list_merge(INC_HEAD(i), GEN_HEAD(NUM_GENERATIONS - 1));
+    }
+    inc_phase = INC_IDLE;
+}
+
+/* Advance the incremental collection by one object.  Return 1 when the
+ * phases are over and only the final collection is left, else 0.
+ */
+static int
+incremental_advance(void)
+{
+    PyGC_Head *gc;
+    PyObject *op;
+
+    switch (inc_phase) {
+    case INC_COUNT:
+        if (gc_list_is_empty(INC_HEAD(INC_TODO))) {
+            inc_phase = INC_SUBTRACT;
+            return 0;
+        }
+        gc = INC_HEAD(INC_TODO)->gc.gc_next;
+        assert(_PyGCHead_REFS(gc) == GC_REACHABLE);
+        assert(Py_REFCNT(FROM_GC(gc)) > 0);
+        /* Huge counts, like those of immortal objects, wouldn't fit */
+        _PyGCHead_SET_REFS(gc, GC_INC_COUNT(Py_MIN(Py_REFCNT(FROM_GC(gc)),
+                                                   PY_SSIZE_T_MAX / 4)));
+        gc_list_move(gc, INC_HEAD(INC_DONE));
+        return 0;
+
+    case INC_SUBTRACT:
+        if (gc_list_is_empty(INC_HEAD(INC_DONE))) {
+            inc_phase = INC_MARK;
+            return 0;
+        }
+        gc = INC_HEAD(INC_DONE)->gc.gc_next;
+        /* Move it first: the traversal doesn't care where it is. */
+        gc_list_move(gc, INC_HEAD(INC_TODO));
+        op = FROM_GC(gc);
+        (void) Py_TYPE(op)->tp_traverse(op, visit_inc_decref, NULL);
+        return 0;
+
+    case INC_MARK:
+        if (!gc_list_is_empty(INC_HEAD(INC_GRAY))) {
+            gc = INC_HEAD(INC_GRAY)->gc.gc_next;
+            op = FROM_GC(gc);
+            _PyGCHead_SET_REFS(gc, GC_REACHABLE);
+            gc_list_move(gc, GEN_HEAD(NUM_GENERATIONS - 1));
+            (void) Py_TYPE(op)->tp_traverse(op,
+                                            (visitproc)visit_inc_reachable,
+                                            INC_HEAD(INC_GRAY));
+            inc_survivors++;
+            /* Full collections untrack these, see untrack_dicts() */
+            if (PyTuple_CheckExact(op))
+                _PyTuple_MaybeUntrack(op);
+            else if (PyDict_CheckExact(op))
+                _PyDict_MaybeUntrack(op);
+            return 0;
+        }
+        if (!gc_list_is_empty(INC_HEAD(INC_TODO))) {
+            gc = INC_HEAD(INC_TODO)->gc.gc_next;
+            assert(IS_INC_COUNT(_PyGCHead_REFS(gc)));
+            if (_PyGCHead_REFS(gc) != GC_INC_COUNT(0)) {
+                _PyGCHead_SET_REFS(gc, GC_INC_GRAY);
+                gc_list_move(gc, INC_HEAD(INC_GRAY));
+            }
+            else {
+                _PyGCHead_SET_REFS(gc, GC_INC_TENTATIVE);
+                gc_list_move(gc, INC_HEAD(INC_TENTATIVE));
+            }
+            return 0;
+        }
+        return 1;
+
+    default:
+        assert(0);
+        return 1;
+    }
+}
+
+/* Collect the objects left in INC_TENTATIVE, which ends the incremental
+ * collection.
+ */
+static Py_ssize_t
+incremental_finish(_PyGC_CollectionInfo *info)
+{
+    PyGC_Head *tentative = INC_HEAD(INC_TENTATIVE);
+    PyGC_Head *gc;
+    Py_ssize_t n, left = 0;
+    double t1 = 0.0;
+
+    assert(gc_list_is_empty(INC_HEAD(INC_TODO)));
+    assert(gc_list_is_empty(INC_HEAD(INC_DONE)));
+    assert(gc_list_is_empty(INC_HEAD(INC_GRAY)));
+    for (gc = tentative->gc.gc_next; gc != tentative; gc = gc->gc.gc_next) {
+        _PyGCHead_SET_REFS(gc, GC_REACHABLE);
+        left++;
+    }
+    if (debug & DEBUG_STATS) {
+        PySys_WriteStderr("gc: finishing incremental collection, "
+                          "%" PY_FORMAT_SIZE_T "d objects left...\n",
+                          left);
+        t1 = get_time();
+    }
+    inc_phase = INC_IDLE;
+    n = collect_list(NUM_GENERATIONS - 1, tentative,
+                     GEN_HEAD(NUM_GENERATIONS - 1), t1, info, 0);
+    /* Weakrefs are counted as collected too, so this is approximate. */
+    long_lived_total = inc_survivors + Py_MAX(left - info->collected, 0);
+    return n;
+}
+
+/* Run one slice of the incremental collection, starting one if needed.
+ * Set *finished to 1 if the slice completed a collection.
+ */
+static Py_ssize_t
+incremental_step(int *finished)
+{
+    struct gc_generation_stats *stats = &generation_stats[NUM_GENERATIONS-1];
+    double start = gc_clock();
+    double deadline = start + inc_max_usec * 1e-6;
+    double t, marking;
+    Py_ssize_t work = 0;
+    Py_ssize_t result = 0;
+    int done;
+    _PyGC_CollectionInfo info;
+
+    if (inc_phase == INC_IDLE)
+        incremental_start();
+    for (;;) {
+        done = incremental_advance();
+        if (done)
+            break;
+        work++;
+        if (inc_max_objects > 0 && work >= inc_max_objects)
+            break;
+        /* Reading the clock for every object would be too slow */
+        if (inc_max_usec > 0 && work % 64 == 0 && gc_clock() >= deadline)
+            break;
+    }
+    memset(&info, 0, sizeof(info));
+    info.duration = gc_clock() - start;
+    if (done) {
+        /* Like collect_with_callback(), don't count the callbacks */
+        invoke_gc_callback("start", NUM_GENERATIONS - 1, NULL);
+        t = gc_clock();
+        result = incremental_finish(&info);
+        info.duration += gc_clock() - t;
+    }
+    /* The phases of the slices are all part of marking */
+    marking = info.duration - (info.mark_time + info.finalize_time +
+                               info.weakref_time + info.delete_time);
+    info.generation = NUM_GENERATIONS - 1;
+    info.incremental = 1;
+    info.complete = done;
+    info.examined += work;
+    info.mark_time += marking;
+    stats->increments++;
+    stats->examined += work;
+    stats->mark_time += marking;
+    report_collection(&info);
+    if (done)
+        invoke_gc_callback("stop", NUM_GENERATIONS - 1, &info);
+    if (finished)
+        *finished = done;
     return result;
 }
 
@@ -1148,10 +1594,21 @@ collect_generations(void)
             if (i == NUM_GENERATIONS - 1
                 && long_lived_pending < long_lived_total / 4)
                 continue;
+            if (i == NUM_GENERATIONS - 1 && INC_ENABLED()) {
+                /* Collect the younger generations, and make the oldest
+                   one the set of the incremental collection. */
+                if (inc_phase != INC_IDLE)
+                    continue;
+                n = collect_with_callback(i - 1);
+                incremental_start();
+                break;
+            }
             n = collect_with_callback(i);
             break;
         }
     }
+    if (inc_phase != INC_IDLE)
+        n += incremental_step(NULL);
     return n;
 }
 
@@ -1226,6 +1683,69 @@ gc_collect(PyObject *self, PyObject *args, PyObject *kws)
     return PyLong_FromSsize_t(n);
 }
 
+PyDoc_STRVAR(gc_set_incremental__doc__,
+"set_incremental(max_objects=0, max_usec=0) -> None\n"
+"\n"
+"Collect the oldest generation incrementally, in slices which examine at\n"
+"most max_objects objects and last about max_usec microseconds.  A zero\n"
+"value means no limit; if both are zero, incremental collection is\n"
+"disabled.\n");
+
+static PyObject *
+gc_set_incremental(PyObject *self, PyObject *args, PyObject *kws)
+{
+    static char *keywords[] = {"max_objects", "max_usec", NULL};
+    Py_ssize_t max_objects = 0, max_usec = 0;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kws, "|nn:set_incremental",
+                                     keywords, &max_objects, &max_usec))
+        return NULL;
+    if (max_objects < 0 || max_usec < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "incremental limits must be non-negative");
+        return NULL;
+    }
+    inc_max_objects = max_objects;
+    inc_max_usec = max_usec;
+    if (!INC_ENABLED() && !collecting)
+        incremental_abort();
+
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_get_incremental__doc__,
+"get_incremental() -> (max_objects, max_usec)\n"
+"\n"
+"Return the limits of incremental collection slices.\n");
+
+static PyObject *
+gc_get_incremental(PyObject *self, PyObject *noargs)
+{
+    return Py_BuildValue("(nn)", inc_max_objects, inc_max_usec);
+}
+
+PyDoc_STRVAR(gc_collect_step__doc__,
+"collect_step() -> bool\n"
+"\n"
+"Run one slice of an incremental collection of the oldest generation,\n"
+"starting one if none is in progress.  Return True if the slice completed\n"
+"the collection.  If incremental collection is disabled, the slice runs\n"
+"until the collection completes.\n");
+
+static PyObject *
+gc_collect_step(PyObject *self, PyObject *noargs)
+{
+    int finished = 0;
+
+    if (!collecting) {
+        collecting = 1;
+        (void)incremental_step(&finished);
+        collecting = 0;
+    }
+    return PyBool_FromLong(finished);
+}
+
 PyDoc_STRVAR(gc_set_debug__doc__,
 "set_debug(flags) -> None\n"
 "\n"
@@ -1359,6 +1879,12 @@ gc_get_referrers(PyObject *self, PyObject *args)
             return NULL;
         }
     }
+    for (i = 0; i < NUM_INC_LISTS; i++) {
+        if (!(gc_referrers_for(args, INC_HEAD(i), result))) {
+            Py_DECREF(result);
+            return NULL;
+        }
+    }
     return result;
 }
 
@@ -1420,6 +1946,12 @@ gc_get_objects(PyObject *self, PyObject *noargs)
             return NULL;
         }
     }
+    for (i = 0; i < NUM_INC_LISTS; i++) {
+        if (append_objects(result, INC_HEAD(i))) {
+            Py_DECREF(result);
+            return NULL;
+        }
+    }
     return result;
 }
 
@@ -1446,12 +1978,35 @@ gc_get_stats(PyObject *self, PyObject *noargs)
         return NULL;
 
     for (i = 0; i < NUM_GENERATIONS; i++) {
-        PyObject *dict;
+        PyObject *dict, *hist;
+        size_t j;
         st = &stats[i];
-        dict = Py_BuildValue("{snsnsn}",
+        hist = PyList_New(NUM_PAUSE_BOUNDS + 1);
+        if (hist == NULL)
+            goto error;
+        for (j = 0; j <= NUM_PAUSE_BOUNDS; j++) {
+            PyObject *item = Py_BuildValue("(dn)",
+                j < NUM_PAUSE_BOUNDS ? pause_bounds[j] : Py_HUGE_VAL,
+                st->pauses[j]);
+            if (item == NULL) {
+                Py_DECREF(hist);
+                goto error;
+            }
+            PyList_SET_ITEM(hist, j, item);
+        }
+        dict = Py_BuildValue("{snsnsnsnsnsdsdsdsdsdsdsN}",
                              "collections", st->collections,
                              "collected", st->collected,
-                             "uncollectable", st->uncollectable
+                             "uncollectable", st->uncollectable,
+                             "increments", st->increments,
+                             "examined", st->examined,
+                             "mark_time", st->mark_time,
+                             "finalize_time", st->finalize_time,
+                             "weakref_time", st->weakref_time,
+                             "delete_time", st->delete_time,
+                             "pause_total", st->pause_total,
+                             "pause_max", st->pause_max,
+                             "pause_histogram", hist
                             );
         if (dict == NULL)
             goto error;
@@ -1490,6 +2045,61 @@ gc_is_tracked(PyObject *self, PyObject *obj)
 }
 
 
+PyDoc_STRVAR(gc_freeze__doc__,
+"freeze() -> None\n"
+"\n"
+"Freeze all current tracked objects and ignore them for future collections.\n"
+"\n"
+"This can be used before a POSIX fork() call to make the gc copy-on-write\n"
+"friendly.  Note: collection before a POSIX fork() call may free pages\n"
+"for future allocation which can cause copy-on-write.\n");
+
+static PyObject *
+gc_freeze(PyObject *self, PyObject *noargs)
+{
+    int i;
+
+    /* Give the objects of an incremental collection back first, unless
+     * called from a callback of that collection.
+     */
+    if (!collecting)
+        incremental_abort();
+    for (i = 0; i < NUM_GENERATIONS; ++i) {
+        gc_list_merge(GEN_HEAD(i), &permanent_generation.head);
+        generations[i].count = 0;
+    }
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_unfreeze__doc__,
+"unfreeze() -> None\n"
+"\n"
+"Unfreeze all objects in the permanent generation.\n"
+"\n"
+"Put all objects in the permanent generation back into the oldest\n"
+"generation.\n");
+
+static PyObject *
+gc_unfreeze(PyObject *self, PyObject *noargs)
+{
+    gc_list_merge(&permanent_generation.head, GEN_HEAD(NUM_GENERATIONS-1));
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(gc_get_freeze_count__doc__,
+"get_freeze_count() -> n\n"
+"\n"
+"Return the number of objects in the permanent generation.\n");
+
+static PyObject *
+gc_get_freeze_count(PyObject *self, PyObject *noargs)
+{
+    return PyLong_FromSsize_t(gc_list_size(&permanent_generation.head));
+}
+
+
 PyDoc_STRVAR(gc__doc__,
 "This module provides access to the garbage collector for reference cycles.\n"
 "\n"
@@ -1505,7 +2115,13 @@ PyDoc_STRVAR(gc__doc__,
 "get_objects() -- Return a list of all objects tracked by the collector.\n"
 "is_tracked() -- Returns true if a given object is tracked.\n"
 "get_referrers() -- Return the list of objects that refer to an object.\n"
-"get_referents() -- Return the list of objects that an object refers to.\n");
+"get_referents() -- Return the list of objects that an object refers to.\n"
+"set_incremental() -- Set the limits of incremental collection slices.\n"
+"get_incremental() -- Return the limits of incremental collection slices.\n"
+"collect_step() -- Run a slice of an incremental collection.\n"
+"freeze() -- Freeze all tracked objects and ignore them for future collections.\n"
+"unfreeze() -- Unfreeze all objects in the permanent generation.\n"
+"get_freeze_count() -- Return the number of objects in the permanent generation.\n");
 
 static PyMethodDef GcMethods[] = {
     {"enable",             gc_enable,     METH_NOARGS,  gc_enable__doc__},
@@ -1525,6 +2141,15 @@ static PyMethodDef GcMethods[] = {
         gc_get_referrers__doc__},
     {"get_referents",  gc_get_referents, METH_VARARGS,
         gc_get_referents__doc__},
+    {"set_incremental", (PyCFunction)gc_set_incremental,
+        METH_VARARGS | METH_KEYWORDS, gc_set_incremental__doc__},
+    {"get_incremental", gc_get_incremental, METH_NOARGS,
+        gc_get_incremental__doc__},
+    {"collect_step",   gc_collect_step, METH_NOARGS, gc_collect_step__doc__},
+    {"freeze",         gc_freeze, METH_NOARGS, gc_freeze__doc__},
+    {"unfreeze",       gc_unfreeze, METH_NOARGS, gc_unfreeze__doc__},
+    {"get_freeze_count", gc_get_freeze_count, METH_NOARGS,
+        gc_get_freeze_count__doc__},
     {NULL,      NULL}           /* Sentinel */
 };
 
@@ -1590,6 +2215,45 @@ PyInit_gc(void)
     return m;
 }
 
+void
+_PyGC_SetCollectHook(_PyGC_CollectHook hook, void *arg)
+{
+    collect_hook = hook;
+    collect_hook_arg = arg;
+}
+
+static int
+visit_list(PyGC_Head *list, visitproc visit, void *arg)
+{
+    PyGC_Head *gc;
+    int r;
+
+    for (gc = list->gc.gc_next; gc != list; gc = gc->gc.gc_next) {
+        r = visit(FROM_GC(gc), arg);
+        if (r)
+            return r;
+    }
+    return 0;
+}
+
+int
+_PyGC_VisitObjects(visitproc visit, void *arg)
+{
+    int i, r;
+
+    for (i = 0; i < NUM_GENERATIONS; i++) {
+        r = visit_list(GEN_HEAD(i), visit, arg);
+        if (r)
+            return r;
+    }
+    for (i = 0; i < NUM_INC_LISTS; i++) {
+        r = visit_list(INC_HEAD(i), visit, arg);
+        if (r)
+            return r;
+    }
+    return visit_list(&permanent_generation.head, visit, arg);
+}
+
 /* API to invoke gc.collect() from C */
 Py_ssize_t
 PyGC_Collect(void)
@@ -1622,7 +2286,7 @@ _PyGC_CollectNoFail(void)
         n = 0;
     else {
         collecting = 1;
-        n = collect(NUM_GENERATIONS - 1, NULL, NULL, 1);
+        n = collect(NUM_GENERATIONS - 1, NULL, 1);
         collecting = 0;
     }
     return n;
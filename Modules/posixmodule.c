@@ -25,6 +25,7 @@
 #define PY_SSIZE_T_CLEAN
 
 #include "Python.h"
+#include "structmember.h"
 #ifndef MS_WINDOWS
 #include "posixmodule.h"
 #endif
@@ -3869,6 +3870,765 @@ posix_listdir(PyObject *self, PyObject *args, PyObject *kwargs)
     return return_value;
 }
 
+
+/* scandir() and DirEntry objects */
+
+PyDoc_STRVAR(DirEntry__doc__,
+"Object yielded by scandir() for each entry of a directory.\n\n\
+Its name and path attributes are the entry's file name and its path\n\
+joined to the scandir() argument.  The file type comes from the\n\
+directory listing when the system provides it, and stat() results are\n\
+cached on the object, so that is_dir(), is_file() and is_symlink()\n\
+usually make no system call.");
+
+typedef struct {
+    PyObject_HEAD
+    PyObject *name;
+    PyObject *path;
+    PyObject *stat;
+    PyObject *lstat;
+#ifdef MS_WINDOWS
+    DWORD attributes;
+    DWORD reparse_tag;
+#else
+    unsigned char d_type;
+    ino_t d_ino;
+#endif
+} DirEntry;
+
+static PyTypeObject DirEntryType;
+
+static void
+DirEntry_dealloc(DirEntry *entry)
+{
+    Py_XDECREF(entry->name);
+    Py_XDECREF(entry->path);
+    Py_XDECREF(entry->stat);
+    Py_XDECREF(entry->lstat);
+    Py_TYPE(entry)->tp_free((PyObject *)entry);
+}
+
+static PyObject *
+DirEntry_fetch_stat(DirEntry *self, int follow_symlinks)
+{
+    STRUCT_STAT st;
+    int result;
+#ifdef MS_WINDOWS
+    PyObject *unicode;
+    wchar_t *path;
+
+    if (PyBytes_Check(self->path))
+        unicode = PyUnicode_DecodeFSDefaultAndSize(
+            PyBytes_AS_STRING(self->path), PyBytes_GET_SIZE(self->path));
+    else {
+        unicode = self->path;
+        Py_INCREF(unicode);
+    }
+    if (unicode == NULL)
+        return NULL;
+    path = PyUnicode_AsUnicode(unicode);
+    if (path == NULL) {
+        Py_DECREF(unicode);
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    result = win32_xstat_w(path, &st, follow_symlinks);
+    Py_END_ALLOW_THREADS
+    Py_DECREF(unicode);
+    if (result != 0)
+        return PyErr_SetExcFromWindowsErrWithFilenameObject(PyExc_OSError,
+                                                            0, self->path);
+#else
+    PyObject *bytes;
+    char *path;
+
+    if (!PyUnicode_FSConverter(self->path, &bytes))
+        return NULL;
+    path = PyBytes_AS_STRING(bytes);
+    Py_BEGIN_ALLOW_THREADS
+#ifdef HAVE_LSTAT
+    if (!follow_symlinks)
+        result = LSTAT(path, &st);
+    else
+#endif
+        result = STAT(path, &st);
+    Py_END_ALLOW_THREADS
+    Py_DECREF(bytes);
+    if (result != 0)
+        return PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError,
+                                                    self->path);
+#endif
+    return _pystat_fromstructstat(&st);
+}
+
+static PyObject *
+DirEntry_get_lstat(DirEntry *self)
+{
+    if (self->lstat == NULL) {
+        self->lstat = DirEntry_fetch_stat(self, 0);
+        if (self->lstat == NULL)
+            return NULL;
+    }
+    Py_INCREF(self->lstat);
+    return self->lstat;
+}
+
+static int
+DirEntry_test_symlink(DirEntry *self)
+{
+#ifdef MS_WINDOWS
+    return (self->attributes & FILE_ATTRIBUTE_REPARSE_POINT) &&
+           self->reparse_tag == IO_REPARSE_TAG_SYMLINK;
+#else
+    PyObject *st;
+    long mode;
+
+#ifdef DT_UNKNOWN
+    if (self->d_type != DT_UNKNOWN)
+        return self->d_type == DT_LNK;
+#endif
+    st = DirEntry_get_lstat(self);
+    if (st == NULL)
+        return -1;
+    mode = PyLong_AsLong(PyStructSequence_GET_ITEM(st, 0));
+    Py_DECREF(st);
+    if (mode == -1 && PyErr_Occurred())
+        return -1;
+    return S_ISLNK(mode);
+#endif
+}
+
+static PyObject *
+DirEntry_get_stat(DirEntry *self, int follow_symlinks)
+{
+    int is_symlink;
+
+    if (!follow_symlinks)
+        return DirEntry_get_lstat(self);
+
+    if (self->stat == NULL) {
+        is_symlink = DirEntry_test_symlink(self);
+        if (is_symlink < 0)
+            return NULL;
+        if (is_symlink)
+            self->stat = DirEntry_fetch_stat(self, 1);
+        else
+            self->stat = DirEntry_get_lstat(self);
+        if (self->stat == NULL)
+            return NULL;
+    }
+    Py_INCREF(self->stat);
+    return self->stat;
+}
+
+/* Return whether the entry is a directory (mode_bits == S_IFDIR) or a
+   regular file (mode_bits == S_IFREG), or -1 on error */
+static int
+DirEntry_test_mode(DirEntry *self, int follow_symlinks,
+                   unsigned short mode_bits)
+{
+    PyObject *st;
+    long mode;
+    int need_stat;
+#ifdef MS_WINDOWS
+    int is_symlink = DirEntry_test_symlink(self);
+
+    need_stat = follow_symlinks && is_symlink;
+    if (!need_stat) {
+        if (is_symlink)
+            return 0;
+        if (mode_bits == S_IFDIR)
+            return (self->attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        return (self->attributes & FILE_ATTRIBUTE_DIRECTORY) == 0;
+    }
+#else
+#ifdef DT_UNKNOWN
+    need_stat = self->d_type == DT_UNKNOWN ||
+                (follow_symlinks && self->d_type == DT_LNK);
+    if (!need_stat) {
+        if (mode_bits == S_IFDIR)
+            return self->d_type == DT_DIR;
+        return self->d_type == DT_REG;
+    }
+#else
+    need_stat = 1;
+#endif
+#endif
+
+    st = DirEntry_get_stat(self, follow_symlinks);
+    if (st == NULL) {
+        /* A broken symlink, or a file removed since the listing */
+        if (PyErr_ExceptionMatches(PyExc_FileNotFoundError)) {
+            PyErr_Clear();
+            return 0;
+        }
+        return -1;
+    }
+    mode = PyLong_AsLong(PyStructSequence_GET_ITEM(st, 0));
+    Py_DECREF(st);
+    if (mode == -1 && PyErr_Occurred())
+        return -1;
+    return (mode & S_IFMT) == mode_bits;
+}
+
+static PyObject *
+DirEntry_is_dir(DirEntry *self, PyObject *args, PyObject *kwargs)
+{
+    static char *keywords[] = {"follow_symlinks", NULL};
+    int follow_symlinks = 1;
+    int result;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$p:is_dir", keywords,
+                                     &follow_symlinks))
+        return NULL;
+    result = DirEntry_test_mode(self, follow_symlinks, S_IFDIR);
+    if (result < 0)
+        return NULL;
+    return PyBool_FromLong(result);
+}
+
+static PyObject *
+DirEntry_is_file(DirEntry *self, PyObject *args, PyObject *kwargs)
+{
+    static char *keywords[] = {"follow_symlinks", NULL};
+    int follow_symlinks = 1;
+    int result;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$p:is_file", keywords,
+                                     &follow_symlinks))
+        return NULL;
+    result = DirEntry_test_mode(self, follow_symlinks, S_IFREG);
+    if (result < 0)
+        return NULL;
+    return PyBool_FromLong(result);
+}
+
+static PyObject *
+DirEntry_is_symlink(DirEntry *self)
+{
+    int result = DirEntry_test_symlink(self);
+
+    if (result < 0)
+        return NULL;
+    return PyBool_FromLong(result);
+}
+
+static PyObject *
+DirEntry_stat(DirEntry *self, PyObject *args, PyObject *kwargs)
+{
+    static char *keywords[] = {"follow_symlinks", NULL};
+    int follow_symlinks = 1;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$p:stat", keywords,
+                                     &follow_symlinks))
+        return NULL;
+    return DirEntry_get_stat(self, follow_symlinks);
+}
+
+static PyObject *
+DirEntry_inode(DirEntry *self)
+{
+#ifdef MS_WINDOWS
+    PyObject *st, *ino;
+
+    st = DirEntry_get_lstat(self);
+    if (st == NULL)
+        return NULL;
+    ino = PyStructSequence_GET_ITEM(st, 1);
+    Py_INCREF(ino);
+    Py_DECREF(st);
+    return ino;
+#elif defined(HAVE_LARGEFILE_SUPPORT)
+    return PyLong_FromLongLong((PY_LONG_LONG)self->d_ino);
+#else
+    return PyLong_FromLong((long)self->d_ino);
+#endif
+}
+
+static PyObject *
+DirEntry_repr(DirEntry *self)
+{
+    return PyUnicode_FromFormat("<DirEntry %R>", self->name);
+}
+
+static PyMemberDef DirEntry_members[] = {
+    {"name", T_OBJECT_EX, offsetof(DirEntry, name), READONLY,
+     "the entry's base filename, relative to scandir() \"path\" argument"},
+    {"path", T_OBJECT_EX, offsetof(DirEntry, path), READONLY,
+     "the entry's full path name; equivalent to "
+     "os.path.join(scandir_path, entry.name)"},
+    {NULL}
+};
+
+static PyMethodDef DirEntry_methods[] = {
+    {"is_dir", (PyCFunction)DirEntry_is_dir, METH_VARARGS | METH_KEYWORDS,
+     "is_dir(*, follow_symlinks=True) -> bool\n\n"
+     "Return True if the entry is a directory; cached per entry."},
+    {"is_file", (PyCFunction)DirEntry_is_file, METH_VARARGS | METH_KEYWORDS,
+     "is_file(*, follow_symlinks=True) -> bool\n\n"
+     "Return True if the entry is a regular file; cached per entry."},
+    {"is_symlink", (PyCFunction)DirEntry_is_symlink, METH_NOARGS,
+     "is_symlink() -> bool\n\n"
+     "Return True if the entry is a symbolic link; cached per entry."},
+    {"stat", (PyCFunction)DirEntry_stat, METH_VARARGS | METH_KEYWORDS,
+     "stat(*, follow_symlinks=True) -> stat_result\n\n"
+     "Return the stat_result object for the entry; cached per entry."},
+    {"inode", (PyCFunction)DirEntry_inode, METH_NOARGS,
+     "inode() -> int\n\n"
+     "Return the inode number of the entry."},
+    {NULL}
+};
+
+static PyTypeObject DirEntryType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "os.DirEntry",                          /* tp_name */
+    sizeof(DirEntry),                       /* tp_basicsize */
+    0,                                      /* tp_itemsize */
+    (destructor)DirEntry_dealloc,           /* tp_dealloc */
+    0,                                      /* tp_print */
+    0,                                      /* tp_getattr */
+    0,                                      /* tp_setattr */
+    0,                                      /* tp_compare */
+    (reprfunc)DirEntry_repr,                /* tp_repr */
+    0,                                      /* tp_as_number */
+    0,                                      /* tp_as_sequence */
+    0,                                      /* tp_as_mapping */
+    0,                                      /* tp_hash */
+    0,                                      /* tp_call */
+    0,                                      /* tp_str */
+    0,                                      /* tp_getattro */
+    0,                                      /* tp_setattro */
+    0,                                      /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags */
+    DirEntry__doc__,                        /* tp_doc */
+    0,                                      /* tp_traverse */
+    0,                                      /* tp_clear */
+    0,                                      /* tp_richcompare */
+    0,                                      /* tp_weaklistoffset */
+    0,                                      /* tp_iter */
+    0,                                      /* tp_iternext */
+    DirEntry_methods,                       /* tp_methods */
+    DirEntry_members,                       /* tp_members */
+};
+
+/* Return prefix + name, both being str or both bytes */
+static PyObject *
+join_path_prefix(PyObject *prefix, PyObject *name)
+{
+    PyObject *result;
+    Py_ssize_t prefix_len, name_len;
+
+    if (!PyBytes_Check(prefix))
+        return PyUnicode_Concat(prefix, name);
+    prefix_len = PyBytes_GET_SIZE(prefix);
+    name_len = PyBytes_GET_SIZE(name);
+    result = PyBytes_FromStringAndSize(NULL, prefix_len + name_len);
+    if (result == NULL)
+        return NULL;
+    memcpy(PyBytes_AS_STRING(result), PyBytes_AS_STRING(prefix), prefix_len);
+    memcpy(PyBytes_AS_STRING(result) + prefix_len, PyBytes_AS_STRING(name),
+           name_len);
+    return result;
+}
+
+/* Create a DirEntry; steals the reference to name */
+static DirEntry *
+DirEntry_new(PyObject *prefix, PyObject *name)
+{
+    DirEntry *entry;
+
+    if (name == NULL)
+        return NULL;
+    entry = PyObject_New(DirEntry, &DirEntryType);
+    if (entry == NULL) {
+        Py_DECREF(name);
+        return NULL;
+    }
+    entry->name = name;
+    entry->stat = NULL;
+    entry->lstat = NULL;
+    entry->path = join_path_prefix(prefix, name);
+    if (entry->path == NULL) {
+        Py_DECREF(entry);
+        return NULL;
+    }
+    return entry;
+}
+
+typedef struct {
+    PyObject_HEAD
+    path_t path;
+    /* The directory path with a trailing separator, prepended to the
+       names to get the entries' paths */
+    PyObject *prefix;
+#ifdef MS_WINDOWS
+    HANDLE handle;
+    WIN32_FIND_DATAW file_data;
+    int first_time;
+#else
+    DIR *dirp;
+#endif
+} ScandirIterator;
+
+#ifdef MS_WINDOWS
+
+static void
+ScandirIterator_closedir(ScandirIterator *iterator)
+{
+    HANDLE handle = iterator->handle;
+
+    if (handle == INVALID_HANDLE_VALUE)
+        return;
+    iterator->handle = INVALID_HANDLE_VALUE;
+    Py_BEGIN_ALLOW_THREADS
+    FindClose(handle);
+    Py_END_ALLOW_THREADS
+}
+
+static PyObject *
+ScandirIterator_iternext(ScandirIterator *iterator)
+{
+    WIN32_FIND_DATAW *file_data = &iterator->file_data;
+    const wchar_t *name;
+    PyObject *name_obj, *bytes;
+    DirEntry *entry;
+    BOOL success;
+
+    /* Happens if the iterator is iterated twice, or closed explicitly */
+    if (iterator->handle == INVALID_HANDLE_VALUE)
+        return NULL;
+
+    while (1) {
+        if (!iterator->first_time) {
+            Py_BEGIN_ALLOW_THREADS
+            success = FindNextFileW(iterator->handle, file_data);
+            Py_END_ALLOW_THREADS
+            if (!success) {
+                /* Error or no more files */
+                if (GetLastError() != ERROR_NO_MORE_FILES)
+                    path_error(&iterator->path);
+                break;
+            }
+        }
+        iterator->first_time = 0;
+
+        /* Skip over . and .. */
+        name = file_data->cFileName;
+        if (wcscmp(name, L".") == 0 || wcscmp(name, L"..") == 0)
+            continue;
+
+        name_obj = PyUnicode_FromWideChar(name, wcslen(name));
+        if (name_obj != NULL && PyBytes_Check(iterator->prefix)) {
+            bytes = PyUnicode_EncodeFSDefault(name_obj);
+            Py_DECREF(name_obj);
+            name_obj = bytes;
+        }
+        entry = DirEntry_new(iterator->prefix, name_obj);
+        if (entry == NULL)
+            break;
+        entry->attributes = file_data->dwFileAttributes;
+        entry->reparse_tag = file_data->dwReserved0;
+        return (PyObject *)entry;
+    }
+
+    /* Error or no more files */
+    ScandirIterator_closedir(iterator);
+    return NULL;
+}
+
+#else /* POSIX */
+
+static void
+ScandirIterator_closedir(ScandirIterator *iterator)
+{
+    DIR *dirp = iterator->dirp;
+
+    if (dirp == NULL)
+        return;
+    iterator->dirp = NULL;
+    Py_BEGIN_ALLOW_THREADS
+    closedir(dirp);
+    Py_END_ALLOW_THREADS
+}
+
+static PyObject *
+ScandirIterator_iternext(ScandirIterator *iterator)
+{
+    struct dirent *direntp;
+    Py_ssize_t name_len;
+    PyObject *name_obj;
+    DirEntry *entry;
+
+    /* Happens if the iterator is iterated twice, or closed explicitly */
+    if (iterator->dirp == NULL)
+        return NULL;
+
+    while (1) {
+        errno = 0;
+        Py_BEGIN_ALLOW_THREADS
+        direntp = readdir(iterator->dirp);
+        Py_END_ALLOW_THREADS
+
+        if (direntp == NULL) {
+            /* Error or no more files */
+            if (errno != 0)
+                path_error(&iterator->path);
+            break;
+        }
+
+        /* Skip over . and .. */
+        name_len = NAMLEN(direntp);
+        if (direntp->d_name[0] == '.' &&
+            (name_len == 1 || (direntp->d_name[1] == '.' && name_len == 2)))
+            continue;
+
+        if (PyBytes_Check(iterator->prefix))
+            name_obj = PyBytes_FromStringAndSize(direntp->d_name, name_len);
+        else
+            name_obj = PyUnicode_DecodeFSDefaultAndSize(direntp->d_name,
+                                                        name_len);
+        entry = DirEntry_new(iterator->prefix, name_obj);
+        if (entry == NULL)
+            break;
+#ifdef DT_UNKNOWN
+        entry->d_type = direntp->d_type;
+#endif
+        entry->d_ino = direntp->d_ino;
+        return (PyObject *)entry;
+    }
+
+    /* Error or no more files */
+    ScandirIterator_closedir(iterator);
+    return NULL;
+}
+
+#endif
+
+static PyObject *
+ScandirIterator_close(ScandirIterator *self, PyObject *unused)
+{
+    ScandirIterator_closedir(self);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+ScandirIterator_enter(PyObject *self, PyObject *unused)
+{
+    Py_INCREF(self);
+    return self;
+}
+
+static PyObject *
+ScandirIterator_exit(ScandirIterator *self, PyObject *args)
+{
+    ScandirIterator_closedir(self);
+    Py_RETURN_NONE;
+}
+
+static void
+ScandirIterator_dealloc(ScandirIterator *iterator)
+{
+    ScandirIterator_closedir(iterator);
+    Py_XDECREF(iterator->prefix);
+    Py_XDECREF(iterator->path.object);
+    path_cleanup(&iterator->path);
+    Py_TYPE(iterator)->tp_free((PyObject *)iterator);
+}
+
+static PyMethodDef ScandirIterator_methods[] = {
+    {"__enter__", (PyCFunction)ScandirIterator_enter, METH_NOARGS},
+    {"__exit__", (PyCFunction)ScandirIterator_exit, METH_VARARGS},
+    {"close", (PyCFunction)ScandirIterator_close, METH_NOARGS},
+    {NULL}
+};
+
+static PyTypeObject ScandirIteratorType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "os.ScandirIterator",                   /* tp_name */
+    sizeof(ScandirIterator),                /* tp_basicsize */
+    0,                                      /* tp_itemsize */
+    (destructor)ScandirIterator_dealloc,    /* tp_dealloc */
+    0,                                      /* tp_print */
+    0,                                      /* tp_getattr */
+    0,                                      /* tp_setattr */
+    0,                                      /* tp_compare */
+    0,                                      /* tp_repr */
+    0,                                      /* tp_as_number */
+    0,                                      /* tp_as_sequence */
+    0,                                      /* tp_as_mapping */
+    0,                                      /* tp_hash */
+    0,                                      /* tp_call */
+    0,                                      /* tp_str */
+    0,                                      /* tp_getattro */
+    0,                                      /* tp_setattro */
+    0,                                      /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                     /* tp_flags */
+    0,                                      /* tp_doc */
+    0,                                      /* tp_traverse */
+    0,                                      /* tp_clear */
+    0,                                      /* tp_richcompare */
+    0,                                      /* tp_weaklistoffset */
+    PyObject_SelfIter,                      /* tp_iter */
+    (iternextfunc)ScandirIterator_iternext, /* tp_iternext */
+    ScandirIterator_methods,                /* tp_methods */
+};
+
+PyDoc_STRVAR(posix_scandir__doc__,
+"scandir(path='.') -> iterator of DirEntry objects\n\n\
+Return an iterator of DirEntry objects for the entries of the directory\n\
+given by path.  The entries are yielded in arbitrary order, and the\n\
+special entries '.' and '..' are not included.\n\
+\n\
+If path is bytes, the names and paths of the entries are bytes;\n\
+in all other circumstances they are str.  The iterator can be used as\n\
+a context manager, or closed with its close() method, to release the\n\
+directory handle before it is exhausted.");
+
+static PyObject *
+posix_scandir(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    ScandirIterator *iterator;
+    static char *keywords[] = {"path", NULL};
+    PyObject *prefix;
+#ifdef MS_WINDOWS
+    PyObject *unicode = NULL, *bytes;
+    wchar_t *path_strW, *pattern;
+    Py_ssize_t len;
+    wchar_t last;
+#else
+    const char *path_str, *sep;
+    Py_ssize_t len;
+#endif
+
+    iterator = PyObject_New(ScandirIterator, &ScandirIteratorType);
+    if (iterator == NULL)
+        return NULL;
+    memset(&iterator->path, 0, sizeof(path_t));
+    iterator->path.function_name = "scandir";
+    iterator->path.nullable = 1;
+    iterator->prefix = NULL;
+#ifdef MS_WINDOWS
+    iterator->handle = INVALID_HANDLE_VALUE;
+#else
+    iterator->dirp = NULL;
+#endif
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O&:scandir", keywords,
+                                     path_converter, &iterator->path)) {
+        /* The iterator doesn't own a reference to the path yet */
+        iterator->path.object = NULL;
+        goto error;
+    }
+    /* path_converter doesn't keep the path argument alive */
+    Py_XINCREF(iterator->path.object);
+
+#ifdef MS_WINDOWS
+    if (iterator->path.wide != NULL) {
+        unicode = iterator->path.object;
+        Py_INCREF(unicode);
+    }
+    else if (iterator->path.narrow != NULL)
+        unicode = PyUnicode_DecodeFSDefaultAndSize(iterator->path.narrow,
+                                                   iterator->path.length);
+    else
+        unicode = PyUnicode_FromString(".");
+    if (unicode == NULL)
+        goto error;
+    path_strW = PyUnicode_AsUnicodeAndSize(unicode, &len);
+    if (path_strW == NULL)
+        goto error;
+
+    /* Add a separator unless the path already ends with one */
+    last = len > 0 ? path_strW[len - 1] : L'\0';
+    if (len > 0 && last != SEP && last != ALTSEP && last != L':')
+        prefix = PyUnicode_FromFormat("%U\\", unicode);
+    else {
+        prefix = unicode;
+        Py_INCREF(prefix);
+    }
+    if (prefix == NULL)
+        goto error;
+    if (iterator->path.narrow != NULL) {
+        bytes = PyUnicode_EncodeFSDefault(prefix);
+        Py_DECREF(prefix);
+        prefix = bytes;
+        if (prefix == NULL)
+            goto error;
+    }
+    iterator->prefix = prefix;
+
+    pattern = PyMem_New(wchar_t, len + 5);  /* room for "\\*.*\0" */
+    if (pattern == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    wcscpy(pattern, path_strW);
+    if (len > 0 && last != SEP && last != ALTSEP && last != L':')
+        pattern[len++] = SEP;
+    wcscpy(pattern + len, L"*.*");
+
+    Py_BEGIN_ALLOW_THREADS
+    iterator->handle = FindFirstFileW(pattern, &iterator->file_data);
+    Py_END_ALLOW_THREADS
+    PyMem_Free(pattern);
+
+    if (iterator->handle == INVALID_HANDLE_VALUE) {
+        path_error(&iterator->path);
+        goto error;
+    }
+    iterator->first_time = 1;
+    Py_CLEAR(unicode);
+#else /* POSIX */
+    if (iterator->path.narrow != NULL) {
+        path_str = iterator->path.narrow;
+        len = iterator->path.length;
+        sep = (len > 0 && path_str[len - 1] == '/') ? "" : "/";
+    }
+    else {
+        path_str = ".";
+        sep = "/";
+    }
+
+    if (iterator->path.object != NULL &&
+        PyBytes_Check(iterator->path.object))
+        prefix = PyBytes_FromFormat("%s%s", path_str, sep);
+    else {
+        char *prefix_str = PyMem_Malloc(strlen(path_str) + 2);
+
+        if (prefix_str == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        strcpy(prefix_str, path_str);
+        strcat(prefix_str, sep);
+        prefix = PyUnicode_DecodeFSDefault(prefix_str);
+        PyMem_Free(prefix_str);
+    }
+    if (prefix == NULL)
+        goto error;
+    iterator->prefix = prefix;
+
+    errno = 0;
+    Py_BEGIN_ALLOW_THREADS
+    iterator->dirp = opendir(path_str);
+    Py_END_ALLOW_THREADS
+
+    if (iterator->dirp == NULL) {
+        path_error(&iterator->path);
+        goto error;
+    }
+#endif
+
+    return (PyObject *)iterator;
+
+error:
+#ifdef MS_WINDOWS
+    Py_XDECREF(unicode);
+#endif
+    Py_DECREF(iterator);
+    return NULL;
+}
+
 #ifdef MS_WINDOWS
 /* A helper function for abspath on win32 */
 static PyObject *
@@ -8329,6 +9089,53 @@ done:
 }
 #endif
 
+#ifdef HAVE_COPY_FILE_RANGE
+PyDoc_STRVAR(posix_copy_file_range__doc__,
+"copy_file_range(src, dst, count, offset_src=None, offset_dst=None)\n\
+    -> byteswritten\n\n\
+Copy count bytes from file descriptor src to file descriptor dst.\n\
+If offset_src is None, the data is read from the current position of\n\
+src, which is updated; otherwise it is read from offset offset_src.\n\
+offset_dst works the same way for dst.  The data is copied by the\n\
+kernel, without going through user space.");
+
+static PyObject *
+posix_copy_file_range(PyObject *self, PyObject *args, PyObject *kwdict)
+{
+    int src, dst;
+    Py_ssize_t count, ret;
+    PyObject *offobj_src = Py_None, *offobj_dst = Py_None;
+    off_t offset_src, offset_dst, *p_offset_src = NULL, *p_offset_dst = NULL;
+    static char *keywords[] = {"src", "dst", "count",
+                               "offset_src", "offset_dst", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwdict, "iin|OO:copy_file_range",
+            keywords, &src, &dst, &count, &offobj_src, &offobj_dst))
+        return NULL;
+    if (count < 0) {
+        PyErr_SetString(PyExc_ValueError, "negative count");
+        return NULL;
+    }
+    if (offobj_src != Py_None) {
+        if (!_parse_off_t(offobj_src, &offset_src))
+            return NULL;
+        p_offset_src = &offset_src;
+    }
+    if (offobj_dst != Py_None) {
+        if (!_parse_off_t(offobj_dst, &offset_dst))
+            return NULL;
+        p_offset_dst = &offset_dst;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ret = copy_file_range(src, p_offset_src, dst, p_offset_dst, count, 0);
+    Py_END_ALLOW_THREADS
+    if (ret < 0)
+        return posix_error();
+    return PyLong_FromSsize_t(ret);
+}
+#endif
+
 PyDoc_STRVAR(posix_fstat__doc__,
 "fstat(fd) -> stat result\n\n\
 Like stat(), but for an open file descriptor.\n\
@@ -11193,6 +12000,9 @@ static PyMethodDef posix_methods[] = {
     {"listdir",         (PyCFunction)posix_listdir,
                         METH_VARARGS | METH_KEYWORDS,
                         posix_listdir__doc__},
+    {"scandir",         (PyCFunction)posix_scandir,
+                        METH_VARARGS | METH_KEYWORDS,
+                        posix_scandir__doc__},
     {"lstat",           (PyCFunction)posix_lstat,
                         METH_VARARGS | METH_KEYWORDS,
                         posix_lstat__doc__},
@@ -11431,6 +12241,11 @@ static PyMethodDef posix_methods[] = {
 #ifdef HAVE_SENDFILE
     {"sendfile",        (PyCFunction)posix_sendfile, METH_VARARGS | METH_KEYWORDS,
                             posix_sendfile__doc__},
+#endif
+#ifdef HAVE_COPY_FILE_RANGE
+    {"copy_file_range", (PyCFunction)posix_copy_file_range,
+                        METH_VARARGS | METH_KEYWORDS,
+                        posix_copy_file_range__doc__},
 #endif
     {"fstat",           posix_fstat, METH_VARARGS, posix_fstat__doc__},
     {"isatty",          posix_isatty, METH_VARARGS, posix_isatty__doc__},
@@ -12255,6 +13070,11 @@ INITFUNC(void)
         SchedParamType.tp_new = sched_param_new;
 #endif
 
+        if (PyType_Ready(&DirEntryType) < 0)
+            return NULL;
+        if (PyType_Ready(&ScandirIteratorType) < 0)
+            return NULL;
+
         /* initialize TerminalSize_info */
         if (PyStructSequence_InitType2(&TerminalSizeType,
                                        &TerminalSize_desc) < 0)
@@ -3023,14 +3023,24 @@ sock_recvmsg_guts(PySocketSockObject *s, struct iovec *iov, int iovlen,
         goto finally;
     }
 
-    BEGIN_SELECT_LOOP(s)
-    Py_BEGIN_ALLOW_THREADS;
     msg.msg_name = SAS2SA(&addrbuf);
     msg.msg_namelen = addrbuflen;
     msg.msg_iov = iov;
     msg.msg_iovlen = iovlen;
     msg.msg_control = controlbuf;
     msg.msg_controllen = controllen;
+#ifdef MSG_ERRQUEUE
+    if (flags & MSG_ERRQUEUE) {
+        /* Reading the error queue never blocks, and doesn't make the
+           socket readable: don't wait for it. */
+        Py_BEGIN_ALLOW_THREADS;
+        bytes_received = recvmsg(s->sock_fd, &msg, flags);
+        Py_END_ALLOW_THREADS;
+    }
+    else
+#endif
+    BEGIN_SELECT_LOOP(s)
+    Py_BEGIN_ALLOW_THREADS;
     timeout = internal_select_ex(s, 0, interval);
     if (!timeout)
         bytes_received = recvmsg(s->sock_fd, &msg, flags);
@@ -3294,6 +3304,140 @@ SCM_RIGHTS mechanism.");
 #endif    /* CMSG_LEN */
 
 
+#ifdef HAVE_RECVMMSG
+/* s.recvmmsg_into(buffers[, flags]) method */
+
+static PyObject *
+sock_recvmmsg_into(PySocketSockObject *s, PyObject *args)
+{
+    int flags = 0, timeout, received = -1;
+    Py_ssize_t i, nitems, nbufs = 0;
+    struct mmsghdr *msgs = NULL;
+    struct iovec *iovs = NULL;
+    Py_buffer *bufs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    socklen_t addrbuflen;
+    PyObject *buffers_arg, *fast, *retval = NULL;
+
+    if (!PyArg_ParseTuple(args, "O|i:recvmmsg_into", &buffers_arg, &flags))
+        return NULL;
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+    if (!getsockaddrlen(s, &addrbuflen))
+        goto finally;
+
+    /* Fill in a message header with a single iovec for each buffer,
+       and save the Py_buffer structs to release afterwards. */
+    if ((msgs = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgs, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msgs[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+        msgs[nbufs].msg_hdr.msg_namelen = addrbuflen;
+        msgs[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgs[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    /* Like recv(), return as soon as a message was received, rather than
+       waiting for all the buffers to be filled. */
+#ifdef MSG_WAITFORONE
+    flags |= MSG_WAITFORONE;
+#endif
+    BEGIN_SELECT_LOOP(s)
+    Py_BEGIN_ALLOW_THREADS;
+    timeout = internal_select_ex(s, 0, interval);
+    if (!timeout)
+        received = recvmmsg(s->sock_fd, msgs, (unsigned int)nitems,
+                            flags, NULL);
+    Py_END_ALLOW_THREADS;
+    if (timeout == 1) {
+        PyErr_SetString(socket_timeout, "timed out");
+        goto finally;
+    }
+    END_SELECT_LOOP(s)
+
+    if (received < 0) {
+        s->errorhandler();
+        goto finally;
+    }
+
+    if ((retval = PyList_New(received)) == NULL)
+        goto finally;
+    for (i = 0; i < received; i++) {
+        struct msghdr *msg = &msgs[i].msg_hdr;
+        PyObject *item;
+
+        item = Py_BuildValue("IiN", msgs[i].msg_len, (int)msg->msg_flags,
+                             makesockaddr(s->sock_fd, msg->msg_name,
+                                          ((msg->msg_namelen > addrbuflen) ?
+                                           addrbuflen : msg->msg_namelen),
+                                          s->sock_proto));
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(addrbufs);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgs);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffers[, flags]) -> list of (nbytes, msg_flags, address)\n\
+\n\
+Receive several messages from the socket with a single system call,\n\
+each one into the next buffer of buffers, an iterable of objects that\n\
+export writable buffers (e.g. bytearray objects).  Return as soon as at\n\
+least one message was received, like recv(): the returned list has an\n\
+item for each buffer filled, in order.  nbytes is the size of the\n\
+message written into the buffer, msg_flags the bitwise OR of flags\n\
+indicating conditions on the message (MSG_TRUNC if it didn't fit in the\n\
+buffer), and address the address of the sending socket, if available.\n\
+The flags argument defaults to 0 and has the same meaning as for\n\
+recv().");
+#endif    /* HAVE_RECVMMSG */
+
+
 /* s.send(data [,flags]) method */
 
 static PyObject *
@@ -3735,6 +3879,113 @@ data sent.");
 #endif    /* CMSG_LEN */
 
 
+#ifdef HAVE_SENDMMSG
+/* s.sendmmsg(buffers[, flags[, address]]) method */
+
+static PyObject *
+sock_sendmmsg(PySocketSockObject *s, PyObject *args)
+{
+    int flags = 0, timeout, addrlen, sent = -1;
+    Py_ssize_t i, nitems, nbufs = 0;
+    struct mmsghdr *msgs = NULL;
+    struct iovec *iovs = NULL;
+    Py_buffer *bufs = NULL;
+    sock_addr_t addrbuf;
+    PyObject *buffers_arg, *addr_arg = NULL, *fast, *retval = NULL;
+
+    if (!PyArg_ParseTuple(args, "O|iO:sendmmsg",
+                          &buffers_arg, &flags, &addr_arg))
+        return NULL;
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "sendmmsg() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    if ((msgs = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgs, 0, nitems * sizeof(struct mmsghdr));
+
+    /* Parse destination address, shared by all the messages. */
+    if (addr_arg != NULL && addr_arg != Py_None) {
+        if (!getsockaddrarg(s, addr_arg, SAS2SA(&addrbuf), &addrlen))
+            goto finally;
+        for (i = 0; i < nitems; i++) {
+            msgs[i].msg_hdr.msg_name = SAS2SA(&addrbuf);
+            msgs[i].msg_hdr.msg_namelen = addrlen;
+        }
+    }
+
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "y*;sendmmsg() argument 1 must be an iterable of "
+                         "buffer-compatible objects",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        msgs[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgs[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    BEGIN_SELECT_LOOP(s)
+    Py_BEGIN_ALLOW_THREADS;
+    timeout = internal_select_ex(s, 1, interval);
+    if (!timeout)
+        sent = sendmmsg(s->sock_fd, msgs, (unsigned int)nitems, flags);
+    Py_END_ALLOW_THREADS;
+    if (timeout == 1) {
+        PyErr_SetString(socket_timeout, "timed out");
+        goto finally;
+    }
+    END_SELECT_LOOP(s)
+
+    if (sent < 0) {
+        s->errorhandler();
+        goto finally;
+    }
+    retval = PyLong_FromLong(sent);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgs);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(buffers[, flags[, address]]) -> count\n\
+\n\
+Send each buffer-compatible object of the iterable buffers as a\n\
+separate message, with a single system call.  The flags argument\n\
+defaults to 0 and has the same meaning as for send().  If address is\n\
+supplied and not None, it sets the destination address of all the\n\
+messages.  Return the number of messages sent, which may be less than\n\
+the number of buffers; the following ones should be sent again.");
+#endif    /* HAVE_SENDMMSG */
+
+
 /* s.shutdown(how) method */
 
 static PyObject *
@@ -3900,6 +4151,14 @@ static PyMethodDef sock_methods[] = {
                       recvmsg_into_doc,},
     {"sendmsg",           (PyCFunction)sock_sendmsg, METH_VARARGS,
                       sendmsg_doc},
+#endif
+#ifdef HAVE_RECVMMSG
+    {"recvmmsg_into",     (PyCFunction)sock_recvmmsg_into, METH_VARARGS,
+                      recvmmsg_into_doc},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg",          (PyCFunction)sock_sendmmsg, METH_VARARGS,
+                      sendmmsg_doc},
 #endif
     {NULL,                      NULL}           /* sentinel */
 };
@@ -6246,6 +6505,9 @@ PyInit__socket(void)
 #ifdef  SO_PRIORITY
     PyModule_AddIntMacro(m, SO_PRIORITY);
 #endif
+#ifdef  SO_ZEROCOPY
+    PyModule_AddIntMacro(m, SO_ZEROCOPY);
+#endif
 
     /* Maximum number of connections for "listen" */
 #ifdef  SOMAXCONN
@@ -6326,6 +6588,14 @@ PyInit__socket(void)
 #ifdef MSG_FASTOPEN
     PyModule_AddIntMacro(m, MSG_FASTOPEN);
 #endif
+#ifdef  MSG_ZEROCOPY
+    PyModule_AddIntMacro(m, MSG_ZEROCOPY);
+#endif
+#ifdef  SO_EE_ORIGIN_ZEROCOPY
+    /* Completion notifications of MSG_ZEROCOPY sends */
+    PyModule_AddIntMacro(m, SO_EE_ORIGIN_ZEROCOPY);
+    PyModule_AddIntMacro(m, SO_EE_CODE_ZEROCOPY_COPIED);
+#endif
 
     /* Protocol level and numbers, usable for [gs]etsockopt */
 #ifdef  SOL_SOCKET
@@ -6645,6 +6915,9 @@ PyInit__socket(void)
 #ifdef  IP_TRANSPARENT
     PyModule_AddIntMacro(m, IP_TRANSPARENT);
 #endif
+#ifdef  IP_RECVERR
+    PyModule_AddIntMacro(m, IP_RECVERR);
+#endif
 
     /* IPv6 [gs]etsockopt options, defined in RFC2553 */
 #ifdef  IPV6_JOIN_GROUP
@@ -6697,6 +6970,9 @@ PyInit__socket(void)
 #ifdef IPV6_RECVDSTOPTS
     PyModule_AddIntMacro(m, IPV6_RECVDSTOPTS);
 #endif
+#ifdef IPV6_RECVERR
+    PyModule_AddIntMacro(m, IPV6_RECVERR);
+#endif
 #ifdef IPV6_RECVHOPLIMIT
     PyModule_AddIntMacro(m, IPV6_RECVHOPLIMIT);
 #endif
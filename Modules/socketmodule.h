@@ -72,6 +72,10 @@ typedef int socklen_t;
 # include <linux/tipc.h>
 #endif
 
+#ifdef HAVE_LINUX_ERRQUEUE_H
+# include <linux/errqueue.h>
+#endif
+
 #ifdef HAVE_LINUX_CAN_H
 #include <linux/can.h>
 #endif
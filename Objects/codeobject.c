@@ -1,5 +1,6 @@
 #include "Python.h"
 #include "code.h"
+#include "opcode.h"
 #include "structmember.h"
 
 #define NAME_CHARS \
@@ -152,9 +153,63 @@ PyCode_New(int argcount, int kwonlyargcount,
     co->co_lnotab = lnotab;
     co->co_zombieframe = NULL;
     co->co_weakreflist = NULL;
+    co->co_opcache_map = NULL;
+    co->co_opcache = NULL;
+    co->co_opcache_flag = 0;
+    co->co_opcache_size = 0;
     return co;
 }
 
+/* Allocate the inline caches of a code object.  Every instruction which
+   can use a cache gets its own entry, up to 255 entries per code object;
+   the remaining instructions simply go through the uncached path. */
+int
+_PyCode_InitOpcache(PyCodeObject *co)
+{
+    Py_ssize_t i, co_size;
+    unsigned char *code;
+    int opcode, opts = 0;
+
+    assert(co->co_opcache_map == NULL);
+    code = (unsigned char *)PyBytes_AS_STRING(co->co_code);
+    co_size = PyBytes_GET_SIZE(co->co_code);
+    co->co_opcache_map = (unsigned char *)PyMem_MALLOC(co_size);
+    if (co->co_opcache_map == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(co->co_opcache_map, 0, co_size);
+
+    for (i = 0; i < co_size; i += HAS_ARG(opcode) ? 3 : 1) {
+        opcode = code[i];
+        if (opcode == LOAD_GLOBAL || opcode == LOAD_ATTR ||
+            opcode == STORE_ATTR) {
+            if (opts == 255)
+                break;
+            co->co_opcache_map[i] = ++opts;
+        }
+    }
+
+    if (opts) {
+        co->co_opcache = (_PyOpcache *)PyMem_MALLOC(opts * sizeof(_PyOpcache));
+        if (co->co_opcache == NULL) {
+            PyMem_FREE(co->co_opcache_map);
+            co->co_opcache_map = NULL;
+            PyErr_NoMemory();
+            return -1;
+        }
+        memset(co->co_opcache, 0, opts * sizeof(_PyOpcache));
+    }
+    else {
+        /* Nothing to cache: co_opcache_flag still records that the code
+           object has been inspected, so this is done only once. */
+        PyMem_FREE(co->co_opcache_map);
+        co->co_opcache_map = NULL;
+    }
+    co->co_opcache_size = (unsigned char)opts;
+    return 0;
+}
+
 PyCodeObject *
 PyCode_NewEmpty(const char *filename, const char *funcname, int firstlineno)
 {
@@ -372,6 +427,10 @@ code_dealloc(PyCodeObject *co)
     Py_XDECREF(co->co_lnotab);
     if (co->co_cell2arg != NULL)
         PyMem_FREE(co->co_cell2arg);
+    if (co->co_opcache_map != NULL)
+        PyMem_FREE(co->co_opcache_map);
+    if (co->co_opcache != NULL)
+        PyMem_FREE(co->co_opcache);
     if (co->co_zombieframe != NULL)
         PyObject_GC_Del(co->co_zombieframe);
     if (co->co_weakreflist != NULL)
@@ -387,6 +446,10 @@ code_sizeof(PyCodeObject *co, void *unused)
     res = sizeof(PyCodeObject);
     if (co->co_cell2arg != NULL && co->co_cellvars != NULL)
         res += PyTuple_GET_SIZE(co->co_cellvars) * sizeof(unsigned char);
+    if (co->co_opcache_map != NULL)
+        res += PyBytes_GET_SIZE(co->co_code) * sizeof(unsigned char);
+    if (co->co_opcache != NULL)
+        res += co->co_opcache_size * sizeof(_PyOpcache);
     return PyLong_FromSsize_t(res);
 }
 
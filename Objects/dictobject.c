@@ -226,6 +226,15 @@ static PyDictKeyEntry *lookdict_split(PyDictObject *mp, PyObject *key,
 
 static int dictresize(PyDictObject *mp, Py_ssize_t minused);
 
+/* Global counter used to set ma_version_tag field of dictionary.
+ * It is incremented each time that a dictionary is created and each
+ * time that a dictionary is modified, so two dictionaries (or the same
+ * dictionary at two points in time) never share a version.  The
+ * counter is protected by the GIL. */
+static PY_UINT64_T pydict_global_version = 0;
+
+#define DICT_NEXT_VERSION() (++pydict_global_version)
+
 /* Dictionary reuse scheme to save calls to malloc, free, and memset */
 #ifndef PyDict_MAXFREELIST
 #define PyDict_MAXFREELIST 80
@@ -398,6 +407,7 @@ new_dict(PyDictKeysObject *keys, PyObject **values)
     mp->ma_keys = keys;
     mp->ma_values = values;
     mp->ma_used = 0;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     return (PyObject *)mp;
 }
 
@@ -820,6 +830,7 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
     if (old_value != NULL) {
         assert(ep->me_key != NULL && ep->me_key != dummy);
         *value_addr = value;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
         Py_DECREF(old_value); /* which **CAN** re-enter */
     }
     else {
@@ -851,6 +862,7 @@ insertdict(PyDictObject *mp, PyObject *key, Py_hash_t hash, PyObject *value)
         }
         mp->ma_used++;
         *value_addr = value;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
     }
     assert(ep->me_key != NULL && ep->me_key != dummy);
     assert(PyUnicode_CheckExact(key) || mp->ma_keys->dk_lookup == lookdict);
@@ -1028,6 +1040,22 @@ make_keys_shared(PyObject *op)
     return mp->ma_keys;
 }
 
+/* Return a new empty dict sharing the keys of mp, which is made a split
+ * table (as instance dictionaries are), so that many dicts with the same
+ * keys take less memory.  Returns an ordinary new dict if mp can't be split.
+ */
+PyObject *
+_PyDict_NewSharingKeys(PyObject *mp)
+{
+    PyDictKeysObject *keys = make_keys_shared(mp);
+    if (keys == NULL) {
+        if (PyErr_Occurred())
+            return NULL;
+        return PyDict_New();
+    }
+    return new_dict_with_shared_keys(keys);
+}
+
 PyObject *
 _PyDict_NewPresized(Py_ssize_t minused)
 {
@@ -1109,9 +1137,6 @@ PyObject *
 PyDict_GetItemWithError(PyObject *op, PyObject *key)
 {
     Py_hash_t hash;
-    PyDictObject*mp = (PyDictObject *)op;
-    PyDictKeyEntry *ep;
-    PyObject **value_addr;
 
     if (!PyDict_Check(op)) {
         PyErr_BadInternalCall();
@@ -1125,7 +1150,19 @@ PyDict_GetItemWithError(PyObject *op, PyObject *key)
             return NULL;
         }
     }
+    return _PyDict_GetItem_KnownHash(op, key, hash);
+}
 
+/* Same as PyDict_GetItemWithError(), for callers that have already
+   computed the hash of key. */
+PyObject *
+_PyDict_GetItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
+{
+    PyDictObject *mp = (PyDictObject *)op;
+    PyDictKeyEntry *ep;
+    PyObject **value_addr;
+
+    assert(PyDict_Check(op));
     ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
     if (ep == NULL)
         return NULL;
@@ -1207,14 +1244,20 @@ PyDict_SetItem(PyObject *op, PyObject *key, PyObject *value)
     return insertdict(mp, key, hash, value);
 }
 
+int
+_PyDict_SetItem_KnownHash(PyObject *op, PyObject *key, PyObject *value,
+                          Py_hash_t hash)
+{
+    assert(PyDict_Check(op));
+    assert(key);
+    assert(value);
+    return insertdict((PyDictObject *)op, key, hash, value);
+}
+
 int
 PyDict_DelItem(PyObject *op, PyObject *key)
 {
-    PyDictObject *mp;
     Py_hash_t hash;
-    PyDictKeyEntry *ep;
-    PyObject *old_key, *old_value;
-    PyObject **value_addr;
 
     if (!PyDict_Check(op)) {
         PyErr_BadInternalCall();
@@ -1227,6 +1270,19 @@ PyDict_DelItem(PyObject *op, PyObject *key)
         if (hash == -1)
             return -1;
     }
+    return _PyDict_DelItem_KnownHash(op, key, hash);
+}
+
+int
+_PyDict_DelItem_KnownHash(PyObject *op, PyObject *key, Py_hash_t hash)
+{
+    PyDictObject *mp;
+    PyDictKeyEntry *ep;
+    PyObject *old_key, *old_value;
+    PyObject **value_addr;
+
+    assert(PyDict_Check(op));
+    assert(key);
     mp = (PyDictObject *)op;
     ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
     if (ep == NULL)
@@ -1238,6 +1294,7 @@ PyDict_DelItem(PyObject *op, PyObject *key)
     old_value = *value_addr;
     *value_addr = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     if (!_PyDict_HasSplitTable(mp)) {
         ENSURE_ALLOWS_DELETIONS(mp);
         old_key = ep->me_key;
@@ -1269,6 +1326,7 @@ PyDict_Clear(PyObject *op)
     mp->ma_keys = Py_EMPTY_KEYS;
     mp->ma_values = empty_values;
     mp->ma_used = 0;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     /* ...then clear the keys and values */
     if (oldvalues != NULL) {
         n = DK_SIZE(oldkeys);
@@ -2033,6 +2091,7 @@ PyDict_Copy(PyObject *o)
         split_copy->ma_values = newvalues;
         split_copy->ma_keys = mp->ma_keys;
         split_copy->ma_used = mp->ma_used;
+        split_copy->ma_version_tag = DICT_NEXT_VERSION();
         DK_INCREF(mp->ma_keys);
         for (i = 0, n = DK_SIZE(mp->ma_keys); i < n; i++) {
             PyObject *value = mp->ma_values[i];
@@ -2271,6 +2330,7 @@ PyDict_SetDefault(PyObject *d, PyObject *key, PyObject *defaultobj)
         val = defaultobj;
         mp->ma_keys->dk_usable--;
         mp->ma_used++;
+        mp->ma_version_tag = DICT_NEXT_VERSION();
     }
     return val;
 }
@@ -2335,6 +2395,7 @@ dict_pop(PyDictObject *mp, PyObject *args)
     }
     *value_addr = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     if (!_PyDict_HasSplitTable(mp)) {
         ENSURE_ALLOWS_DELETIONS(mp);
         old_key = ep->me_key;
@@ -2408,6 +2469,7 @@ dict_popitem(PyDictObject *mp)
     ep->me_key = dummy;
     ep->me_value = NULL;
     mp->ma_used--;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
     assert(mp->ma_keys->dk_entries[0].me_value == NULL);
     mp->ma_keys->dk_entries[0].me_hash = i + 1;  /* next place to start */
     return res;
@@ -2611,6 +2673,7 @@ dict_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         _PyObject_GC_UNTRACK(d);
 
     d->ma_used = 0;
+    d->ma_version_tag = DICT_NEXT_VERSION();
     d->ma_keys = new_keys_object(PyDict_MINSIZE_COMBINED);
     if (d->ma_keys == NULL) {
         Py_DECREF(self);
@@ -3148,10 +3211,7 @@ dictiter_reduce(dictiterobject *di)
 
 /* The instance lay-out is the same for all three; but the type differs. */
 
-typedef struct {
-    PyObject_HEAD
-    PyDictObject *dv_dict;
-} dictviewobject;
+typedef _PyDictViewObject dictviewobject;
 
 
 static void
@@ -3177,8 +3237,8 @@ dictview_len(dictviewobject *dv)
     return len;
 }
 
-static PyObject *
-dictview_new(PyObject *dict, PyTypeObject *type)
+PyObject *
+_PyDictView_New(PyObject *dict, PyTypeObject *type)
 {
     dictviewobject *dv;
     if (dict == NULL) {
@@ -3536,7 +3596,7 @@ PyTypeObject PyDictKeys_Type = {
 static PyObject *
 dictkeys_new(PyObject *dict)
 {
-    return dictview_new(dict, &PyDictKeys_Type);
+    return _PyDictView_New(dict, &PyDictKeys_Type);
 }
 
 /*** dict_items ***/
@@ -3622,7 +3682,7 @@ PyTypeObject PyDictItems_Type = {
 static PyObject *
 dictitems_new(PyObject *dict)
 {
-    return dictview_new(dict, &PyDictItems_Type);
+    return _PyDictView_New(dict, &PyDictItems_Type);
 }
 
 /*** dict_values ***/
@@ -3687,7 +3747,7 @@ PyTypeObject PyDictValues_Type = {
 static PyObject *
 dictvalues_new(PyObject *dict)
 {
-    return dictview_new(dict, &PyDictValues_Type);
+    return _PyDictView_New(dict, &PyDictValues_Type);
 }
 
 /* Returns NULL if cannot allocate a new PyDictKeysObject,
@@ -3748,15 +3808,19 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
                 return -1;
             *dictptr = dict;
         }
+        /* The attribute caches of the eval loop rely on the cached keys
+           staying the same as long as the type version tag is valid. */
         if (value == NULL) {
             res = PyDict_DelItem(dict, key);
             if (cached != ((PyDictObject *)dict)->ma_keys) {
+                PyType_Modified(tp);
                 CACHED_KEYS(tp) = NULL;
                 DK_DECREF(cached);
             }
         } else {
             res = PyDict_SetItem(dict, key, value);
             if (cached != ((PyDictObject *)dict)->ma_keys) {
+                PyType_Modified(tp);
                 /* Either update tp->ht_cached_keys or delete it */
                 if (cached->dk_refcnt == 1) {
                     CACHED_KEYS(tp) = make_keys_shared(dict);
@@ -3785,6 +3849,111 @@ _PyObjectDict_SetItem(PyTypeObject *tp, PyObject **dictptr,
     return res;
 }
 
+/* Return the index of key in the values array of the split table mp, or
+ * -1 if mp is a combined table or key is not one of its shared keys.
+ * The index stays valid as long as mp->ma_keys is unchanged, since keys
+ * are never removed from a shared keys object.
+ */
+Py_ssize_t
+_PyDict_GetSplitIndex(PyDictObject *mp, PyObject *key)
+{
+    Py_hash_t hash;
+    PyDictKeyEntry *ep;
+    PyObject **value_addr;
+
+    if (!_PyDict_HasSplitTable(mp) || !PyUnicode_CheckExact(key))
+        return -1;
+    hash = ((PyASCIIObject *) key)->hash;
+    if (hash == -1) {
+        hash = PyObject_Hash(key);
+        if (hash == -1) {
+            PyErr_Clear();
+            return -1;
+        }
+    }
+    ep = lookdict_split(mp, key, hash, &value_addr);
+    if (ep == NULL || ep->me_key == NULL)
+        return -1;
+    return value_addr - mp->ma_values;
+}
+
+/* Store value at index ix of the values array of the split table mp;
+ * the shared keys must already hold the key at that index (see
+ * _PyDict_GetSplitIndex()).
+ */
+void
+_PyDict_SetSplitValue(PyDictObject *mp, Py_ssize_t ix, PyObject *value)
+{
+    PyObject *old_value;
+
+    assert(_PyDict_HasSplitTable(mp));
+    assert(ix >= 0 && ix < DK_SIZE(mp->ma_keys));
+    assert(mp->ma_keys->dk_entries[ix].me_key != NULL);
+    Py_INCREF(value);
+    MAINTAIN_TRACKING(mp, mp->ma_keys->dk_entries[ix].me_key, value);
+    old_value = mp->ma_values[ix];
+    mp->ma_values[ix] = value;
+    mp->ma_version_tag = DICT_NEXT_VERSION();
+    if (old_value == NULL)
+        mp->ma_used++;
+    else
+        Py_DECREF(old_value); /* which **CAN** re-enter */
+}
+
+/* Return the slot of key in the hash table of mp, or -1 if key is missing.
+ * Return -2 with an exception set if comparing keys failed.  On success,
+ * *stored_key is set to the key object held by the slot (a borrowed
+ * reference).  If identity is true, the slot must hold key itself and no
+ * comparison is made, so that no Python code can run.
+ *
+ * Slots are only moved when the dict gets a new hash table: they stay
+ * valid as long as _PyDict_GetTable() returns the same table and size.
+ */
+Py_ssize_t
+_PyDict_GetSlot(PyDictObject *mp, PyObject *key, Py_hash_t hash,
+                int identity, PyObject **stored_key)
+{
+    PyDictKeyEntry *ep0 = &mp->ma_keys->dk_entries[0];
+    PyDictKeyEntry *ep;
+    PyObject **value_addr;
+    size_t i, perturb;
+    size_t mask = DK_MASK(mp->ma_keys);
+
+    if (!identity) {
+        ep = (mp->ma_keys->dk_lookup)(mp, key, hash, &value_addr);
+        if (ep == NULL)
+            return -2;
+        if (*value_addr == NULL)
+            return -1;
+        /* The lookup may have run Python code changing the table */
+        ep0 = &mp->ma_keys->dk_entries[0];
+    }
+    else {
+        i = (size_t)hash & mask;
+        for (perturb = hash; ; perturb >>= PERTURB_SHIFT) {
+            ep = &ep0[i & mask];
+            if (ep->me_key == NULL)
+                return -1;
+            if (ep->me_key == key)
+                break;
+            i = (i << 2) + i + perturb + 1;
+        }
+        if (mp->ma_values != NULL ? mp->ma_values[ep - ep0] == NULL
+                                  : ep->me_value == NULL)
+            return -1;
+    }
+    *stored_key = ep->me_key;
+    return ep - ep0;
+}
+
+/* Return the hash table of mp, and store its number of slots in *size. */
+PyDictKeysObject *
+_PyDict_GetTable(PyDictObject *mp, Py_ssize_t *size)
+{
+    *size = DK_SIZE(mp->ma_keys);
+    return mp->ma_keys;
+}
+
 void
 _PyDictKeys_DecRef(PyDictKeysObject *keys)
 {
@@ -5126,3 +5126,18 @@ PyLong_Fini(void)
     }
 #endif
 }
+
+#ifdef Py_IMMORTAL_OBJECTS
+/* Make the small ints immortal, see _Py_ImmortalizeObjects() */
+Py_ssize_t
+_PyLong_Immortalize(void)
+{
+    Py_ssize_t n = 0;
+#if NSMALLNEGINTS + NSMALLPOSINTS > 0
+    int i;
+    for (i = 0; i < NSMALLNEGINTS + NSMALLPOSINTS; i++)
+        n += _Py_SetImmortal((PyObject *)&small_ints[i]);
+#endif
+    return n;
+}
+#endif
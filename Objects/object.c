@@ -3,6 +3,9 @@
 
 #include "Python.h"
 #include "frameobject.h"
+#ifdef Py_IMMORTAL_OBJECTS
+#include "code.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -217,6 +220,87 @@ Py_DecRef(PyObject *o)
     Py_XDECREF(o);
 }
 
+#ifdef Py_IMMORTAL_OBJECTS
+int
+_Py_SetImmortal(PyObject *op)
+{
+    if (_Py_IsImmortal(op))
+        return 0;
+    /* The references already counted in _Py_RefTotal stay there; the
+       Py_INCREF() and Py_DECREF() of op don't change it anymore. */
+    op->ob_refcnt = _Py_IMMORTAL_REFCNT;
+    return 1;
+}
+
+/* Make a constant of a code object immortal, with the objects it is made
+   of.  Constants are immutable, so they can't refer to mortal objects which
+   could be replaced later. */
+static Py_ssize_t
+immortalize_constant(PyObject *op)
+{
+    Py_ssize_t i, n;
+    PyObject *key;
+    Py_hash_t hash;
+
+    n = _Py_SetImmortal(op);
+    if (n == 0)
+        return 0;
+    if (PyCode_Check(op)) {
+        PyCodeObject *co = (PyCodeObject *)op;
+        n += immortalize_constant(co->co_code);
+        n += immortalize_constant(co->co_consts);
+        n += immortalize_constant(co->co_names);
+        n += immortalize_constant(co->co_varnames);
+        n += immortalize_constant(co->co_freevars);
+        n += immortalize_constant(co->co_cellvars);
+        n += immortalize_constant(co->co_filename);
+        n += immortalize_constant(co->co_name);
+        n += immortalize_constant(co->co_lnotab);
+    }
+    else if (PyTuple_CheckExact(op)) {
+        for (i = 0; i < PyTuple_GET_SIZE(op); i++)
+            n += immortalize_constant(PyTuple_GET_ITEM(op, i));
+    }
+    else if (PyFrozenSet_CheckExact(op)) {
+        i = 0;
+        while (_PySet_NextEntry(op, &i, &key, &hash))
+            n += immortalize_constant(key);
+    }
+    return n;
+}
+
+static int
+immortalize_visit(PyObject *op, void *arg)
+{
+    Py_ssize_t *n = (Py_ssize_t *)arg;
+
+    if (PyFunction_Check(op))
+        *n += immortalize_constant(PyFunction_GET_CODE(op));
+    else if (PyType_Check(op))
+        *n += _PyType_Immortalize((PyTypeObject *)op);
+    return 0;
+}
+
+Py_ssize_t
+_Py_ImmortalizeObjects(void)
+{
+    Py_ssize_t n = 0;
+
+    n += _Py_SetImmortal(Py_None);
+    n += _Py_SetImmortal(Py_False);
+    n += _Py_SetImmortal(Py_True);
+    n += _Py_SetImmortal(Py_Ellipsis);
+    n += _Py_SetImmortal(Py_NotImplemented);
+    n += _PyLong_Immortalize();
+    n += _PyUnicode_Immortalize();
+    /* Static types are only found through their base classes, heap types
+       are tracked by the collector. */
+    n += _PyType_Immortalize(&PyBaseObject_Type);
+    (void)_PyGC_VisitObjects(immortalize_visit, &n);
+    return n;
+}
+#endif /* Py_IMMORTAL_OBJECTS */
+
 PyObject *
 PyObject_Init(PyObject *op, PyTypeObject *tp)
 {
@@ -1103,6 +1187,88 @@ PyObject_GenericGetAttr(PyObject *obj, PyObject *name)
     return _PyObject_GenericGetAttrWithDict(obj, name, NULL);
 }
 
+/* Look up attribute name of obj for a method call.  If obj uses the
+   generic attribute lookup and name resolves to a Python function or a
+   method descriptor of its type, store that unbound object in *method
+   and return 1: the caller passes obj as the first argument itself,
+   instead of creating a bound method.  Otherwise store the result of
+   the normal attribute lookup in *method (NULL with an exception set on
+   failure) and return 0.  *method is a new reference in both cases. */
+int
+_PyObject_GetMethod(PyObject *obj, PyObject *name, PyObject **method)
+{
+    PyTypeObject *tp = Py_TYPE(obj);
+    PyObject *descr;
+    descrgetfunc f = NULL;
+    PyObject **dictptr, *dict;
+    PyObject *attr;
+    int meth_found = 0;
+
+    assert(*method == NULL);
+
+    if (tp->tp_getattro != PyObject_GenericGetAttr || !PyUnicode_Check(name)) {
+        *method = PyObject_GetAttr(obj, name);
+        return 0;
+    }
+
+    if (tp->tp_dict == NULL && PyType_Ready(tp) < 0)
+        return 0;
+
+    descr = _PyType_Lookup(tp, name);
+    if (descr != NULL) {
+        Py_INCREF(descr);
+        if (PyFunction_Check(descr) ||
+            Py_TYPE(descr) == &PyMethodDescr_Type) {
+            meth_found = 1;
+        }
+        else {
+            f = descr->ob_type->tp_descr_get;
+            if (f != NULL && PyDescr_IsData(descr)) {
+                *method = f(descr, obj, (PyObject *)obj->ob_type);
+                Py_DECREF(descr);
+                return 0;
+            }
+        }
+    }
+
+    /* Functions and method descriptors are not data descriptors: the
+       instance dict takes precedence */
+    dictptr = _PyObject_GetDictPtr(obj);
+    if (dictptr != NULL && (dict = *dictptr) != NULL) {
+        Py_INCREF(dict);
+        attr = PyDict_GetItem(dict, name);
+        if (attr != NULL) {
+            Py_INCREF(attr);
+            *method = attr;
+            Py_DECREF(dict);
+            Py_XDECREF(descr);
+            return 0;
+        }
+        Py_DECREF(dict);
+    }
+
+    if (meth_found) {
+        *method = descr;
+        return 1;
+    }
+
+    if (f != NULL) {
+        *method = f(descr, obj, (PyObject *)Py_TYPE(obj));
+        Py_DECREF(descr);
+        return 0;
+    }
+
+    if (descr != NULL) {
+        *method = descr;
+        return 0;
+    }
+
+    PyErr_Format(PyExc_AttributeError,
+                 "'%.50s' object has no attribute '%U'",
+                 tp->tp_name, name);
+    return 0;
+}
+
 int
 _PyObject_GenericSetAttrWithDict(PyObject *obj, PyObject *name,
                                  PyObject *value, PyObject *dict)
@@ -1672,6 +1838,9 @@ _Py_ReadyTypes(void)
     if (PyType_Ready(&_PyNamespace_Type) < 0)
         Py_FatalError("Can't initialize namespace type");
 
+    if (PyType_Ready(&PyPickleBuffer_Type) < 0)
+        Py_FatalError("Can't initialize pickle.PickleBuffer type");
+
     if (PyType_Ready(&PyCapsule_Type) < 0)
         Py_FatalError("Can't initialize capsule type");
 
@@ -38,6 +38,9 @@ static void _PyMem_DebugCheckAddress(char api_id, const void *p);
 #  include <sys/mman.h>
 #  ifdef MAP_ANONYMOUS
 #    define ARENAS_USE_MMAP
+#    if defined(MADV_DONTNEED) && defined(_SC_PAGESIZE)
+#      define ARENAS_USE_PURGE
+#    endif
 #  endif
 #endif
 
@@ -90,10 +93,43 @@ _PyObject_ArenaVirtualFree(void *ctx, void *ptr, size_t size)
 }
 
 #elif defined(ARENAS_USE_MMAP)
+#ifdef MADV_HUGEPAGE
+#define ARENAS_USE_HUGEPAGES
+
+/* Transparent huge pages can only back ranges aligned on HUGE_PAGE_SIZE. */
+#define HUGE_PAGE_SIZE          (2 << 20)       /* 2MB */
+
+/* Set from PYTHONMALLOCHUGEPAGES by arena_config_init(). */
+static int arena_hugepages = 0;
+#endif
+
 static void *
 _PyObject_ArenaMmap(void *ctx, size_t size)
 {
     void *ptr;
+#ifdef ARENAS_USE_HUGEPAGES
+    if (arena_hugepages && size % HUGE_PAGE_SIZE == 0) {
+        /* Map one extra huge page and trim the misaligned head and tail,
+           so that the kernel can back the whole arena with huge pages. */
+        char *base, *aligned;
+        size_t head;
+
+        base = mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ|PROT_WRITE,
+                    MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED)
+            return NULL;
+        aligned = (char *)(((Py_uintptr_t)base + HUGE_PAGE_SIZE - 1) &
+                           ~(Py_uintptr_t)(HUGE_PAGE_SIZE - 1));
+        head = aligned - base;
+        if (head != 0)
+            munmap(base, head);
+        if (head != HUGE_PAGE_SIZE)
+            munmap(aligned + size, HUGE_PAGE_SIZE - head);
+        /* Only a hint: the arena is usable even if the kernel refuses. */
+        (void)madvise(aligned, size, MADV_HUGEPAGE);
+        return aligned;
+    }
+#endif
     ptr = mmap(NULL, size, PROT_READ|PROT_WRITE,
                MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
     if (ptr == MAP_FAILED)
@@ -554,8 +590,19 @@ static int running_on_valgrind = -1;
  *
  * Arenas are allocated with mmap() on systems supporting anonymous memory
  * mappings to reduce heap fragmentation.
+ *
+ * Arenas are DEFAULT_ARENA_SIZE bytes unless the PYTHONMALLOCARENASIZE or
+ * PYTHONMALLOCHUGEPAGES environment variables select another size.  The
+ * size is fixed when the first arena is allocated (see arena_config_init()):
+ * Py_ADDRESS_IN_RANGE relies on all arenas having the same size.  Larger
+ * arenas mean fewer mmap() calls and, with huge pages, fewer TLB misses.
  */
-#define ARENA_SIZE              (256 << 10)     /* 256KB */
+#define DEFAULT_ARENA_SIZE      (256 << 10)     /* 256KB */
+#define MIN_ARENA_SIZE          DEFAULT_ARENA_SIZE
+#define MAX_ARENA_SIZE          (256 << 20)     /* 256MB */
+
+static size_t arena_size = DEFAULT_ARENA_SIZE;
+#define ARENA_SIZE              arena_size
 
 #ifdef WITH_MEMORY_LIMITS
 #define MAX_ARENAS              (SMALL_MEMORY_LIMIT / ARENA_SIZE)
@@ -655,6 +702,15 @@ struct arena_object {
     /* Singly-linked list of available pools. */
     struct pool_header* freepools;
 
+    /* Bitmap of the available pools whose pages were returned to the
+     * system by purge_free_pools(), indexed by pool number in the arena,
+     * and the number of bits set.  `purged` is NULL until the first pool
+     * of the arena is purged.  Purged pools count in nfreepools but are
+     * not on the freepools list:  their headers were discarded.
+     */
+    unsigned char *purged;
+    uint npurged;
+
     /* Whenever this arena_object is not associated with an allocated
      * arena, the nextarena member is used to link all unassociated
      * arena_objects in the singly-linked `unused_arena_objects` list.
@@ -885,6 +941,43 @@ static size_t ntimes_arena_allocated = 0;
 /* High water mark (max value ever seen) for narenas_currently_allocated. */
 static size_t narenas_highwater = 0;
 
+/* Set once arena_config_init() has run. */
+static int arena_configured = 0;
+
+#ifdef ARENAS_USE_PURGE
+/* Pool purging policy, off by default: see purge_free_pools(). */
+static int purge_enabled = 0;
+
+/* madvise() works on whole system pages: on systems with pages larger
+ * than a pool, it would fail on most pools, and zero the neighbouring pools
+ * of the others.  Purging is only supported if pools span whole pages.
+ */
+static int
+purge_supported(void)
+{
+    static long page_size = 0;
+
+    if (page_size == 0)
+        page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 && page_size <= POOL_SIZE;
+}
+#endif
+
+/* Number of pools on the freepools lists of allocated arenas, i.e. empty
+ * pools whose pages are still resident.
+ */
+static size_t nfreepools_resident = 0;
+/* Number of pools currently purged, and total number of bytes returned to
+ * the system by purging pools and by freeing arenas.
+ */
+static size_t npurgedpools = 0;
+static size_t purged_bytes = 0;
+static size_t released_arena_bytes = 0;
+
+/* Address of the first pool of arena AO. */
+#define ARENA_FIRST_POOL(AO) \
+    (((AO)->address + POOL_SIZE_MASK) & ~(uptr)POOL_SIZE_MASK)
+
 static Py_ssize_t _Py_AllocatedBlocks = 0;
 
 Py_ssize_t
@@ -894,6 +987,48 @@ _Py_GetAllocatedBlocks(void)
 }
 
 
+/* Parse PYTHONMALLOCARENASIZE and PYTHONMALLOCHUGEPAGES.  Called once,
+ * before the first arena is allocated.
+ */
+static void
+arena_config_init(void)
+{
+    char *p;
+
+    arena_configured = 1;
+#ifdef ARENAS_USE_PURGE
+    p = Py_GETENV("PYTHONMALLOCPURGE");
+    if (p && *p && purge_supported())
+        purge_enabled = 1;
+#endif
+#ifdef ARENAS_USE_HUGEPAGES
+    p = Py_GETENV("PYTHONMALLOCHUGEPAGES");
+    if (p && *p) {
+        arena_hugepages = 1;
+        arena_size = HUGE_PAGE_SIZE;
+    }
+#endif
+    p = Py_GETENV("PYTHONMALLOCARENASIZE");
+    if (p && *p) {
+        char *endptr;
+        unsigned long size = strtoul(p, &endptr, 10);
+
+        if (*endptr == 'k' || *endptr == 'K') {
+            size <<= 10;
+            endptr++;
+        }
+        else if (*endptr == 'm' || *endptr == 'M') {
+            size <<= 20;
+            endptr++;
+        }
+        if (*endptr != '\0' || size < MIN_ARENA_SIZE ||
+            size > MAX_ARENA_SIZE || (size & (size - 1)) != 0)
+            Py_FatalError("PYTHONMALLOCARENASIZE must be a power of two "
+                          "between 256K and 256M");
+        arena_size = (size_t)size;
+    }
+}
+
 /* Allocate a new arena.  If we run out of memory, return NULL.  Else
  * allocate a new arena, and return the address of an arena_object
  * describing the new arena.  It's expected that the caller will set
@@ -906,6 +1041,8 @@ new_arena(void)
     uint excess;        /* number of bytes above pool alignment */
     void *address;
 
+    if (!arena_configured)
+        arena_config_init();
 #ifdef PYMALLOC_DEBUG
     if (Py_GETENV("PYTHONMALLOCSTATS"))
         _PyObject_DebugMallocStats(stderr);
@@ -967,6 +1104,8 @@ new_arena(void)
         return NULL;
     }
     arenaobj->address = (uptr)address;
+    arenaobj->purged = NULL;
+    arenaobj->npurged = 0;
 
     ++narenas_currently_allocated;
     ++ntimes_arena_allocated;
@@ -988,6 +1127,80 @@ new_arena(void)
     return arenaobj;
 }
 
+#ifdef ARENAS_USE_PURGE
+
+/* Once that many empty pools are resident, purge_free_pools() is called. */
+#define PURGE_THRESHOLD         (ARENA_SIZE / POOL_SIZE)
+
+/* Return the pages of the empty pools of the allocated arenas to the system
+ * with madvise(MADV_DONTNEED), without freeing the arenas themselves.  The
+ * pools stay available, and are faulted back in when they are reused.
+ *
+ * pymalloc only frees an arena once all of its pools are empty, so after a
+ * peak a few long-lived objects can keep most of the memory resident.
+ * Purging is batched, and the pools being reused are taken off the
+ * freepools lists first, so a pool going back and forth between the empty
+ * and used states does not make a system call each time.
+ */
+static void
+purge_free_pools(void)
+{
+    struct arena_object *ao;
+
+    /* Only arenas on usable_arenas have empty pools. */
+    for (ao = usable_arenas; ao != NULL; ao = ao->nextarena) {
+        poolp pool;
+
+        if (ao->freepools == NULL)
+            continue;
+        if (ao->purged == NULL) {
+            size_t nbytes = (ao->ntotalpools + 7) / 8;
+            ao->purged = (unsigned char *)PyMem_RawMalloc(nbytes);
+            if (ao->purged == NULL)
+                return;
+            memset(ao->purged, 0, nbytes);
+        }
+        while ((pool = ao->freepools) != NULL) {
+            uint index;
+            poolp next = pool->nextpool;
+
+            index = (uint)(((uptr)pool - ARENA_FIRST_POOL(ao)) / POOL_SIZE);
+            assert(index < ao->ntotalpools);
+            if (madvise((void *)pool, POOL_SIZE, MADV_DONTNEED) < 0) {
+                /* Don't retry on every free. */
+                purge_enabled = 0;
+                return;
+            }
+            /* The pool header must not be touched any more. */
+            ao->freepools = next;
+            ao->purged[index >> 3] |= 1 << (index & 7);
+            ++ao->npurged;
+            ++npurgedpools;
+            --nfreepools_resident;
+            purged_bytes += POOL_SIZE;
+        }
+    }
+}
+
+/* Take a purged pool off arena AO, which must have one. */
+static poolp
+take_purged_pool(struct arena_object *ao)
+{
+    uint i, bit;
+
+    assert(ao->npurged > 0 && ao->purged != NULL);
+    for (i = 0; ao->purged[i] == 0; i++)
+        assert(i * 8 < ao->ntotalpools);
+    for (bit = 0; !(ao->purged[i] & (1 << bit)); bit++)
+        ;
+    ao->purged[i] &= ~(1 << bit);
+    --ao->npurged;
+    --npurgedpools;
+    return (poolp)(ARENA_FIRST_POOL(ao) + (i * 8 + bit) * POOL_SIZE);
+}
+
+#endif /* ARENAS_USE_PURGE */
+
 /*
 Py_ADDRESS_IN_RANGE(P, POOL)
 
@@ -1207,6 +1420,7 @@ _PyObject_Malloc(void *ctx, size_t nbytes)
         if (pool != NULL) {
             /* Unlink from cached pools. */
             usable_arenas->freepools = pool->nextpool;
+            --nfreepools_resident;
 
             /* This arena already had the smallest nfreepools
              * value, so decreasing nfreepools doesn't change
@@ -1231,11 +1445,12 @@ _PyObject_Malloc(void *ctx, size_t nbytes)
             }
             else {
                 /* nfreepools > 0:  it must be that freepools
-                 * isn't NULL, or that we haven't yet carved
-                 * off all the arena's pools for the first
-                 * time.
+                 * isn't NULL, that some pools were purged, or
+                 * that we haven't yet carved off all the
+                 * arena's pools for the first time.
                  */
                 assert(usable_arenas->freepools != NULL ||
+                       usable_arenas->npurged > 0 ||
                        usable_arenas->pool_address <=
                        (block*)usable_arenas->address +
                            ARENA_SIZE - POOL_SIZE);
@@ -1278,13 +1493,22 @@ _PyObject_Malloc(void *ctx, size_t nbytes)
         /* Carve off a new pool. */
         assert(usable_arenas->nfreepools > 0);
         assert(usable_arenas->freepools == NULL);
-        pool = (poolp)usable_arenas->pool_address;
+#ifdef ARENAS_USE_PURGE
+        if (usable_arenas->npurged > 0) {
+            /* Reuse a purged pool before touching fresh pages. */
+            pool = take_purged_pool(usable_arenas);
+        }
+        else
+#endif
+        {
+            pool = (poolp)usable_arenas->pool_address;
+            usable_arenas->pool_address += POOL_SIZE;
+        }
         assert((block*)pool <= (block*)usable_arenas->address +
                                ARENA_SIZE - POOL_SIZE);
         pool->arenaindex = usable_arenas - arenas;
         assert(&arenas[pool->arenaindex] == usable_arenas);
         pool->szidx = DUMMY_SIZE_IDX;
-        usable_arenas->pool_address += POOL_SIZE;
         --usable_arenas->nfreepools;
 
         if (usable_arenas->nfreepools == 0) {
@@ -1384,6 +1608,7 @@ _PyObject_Free(void *ctx, void *p)
             pool->nextpool = ao->freepools;
             ao->freepools = pool;
             nf = ++ao->nfreepools;
+            ++nfreepools_resident;
 
             /* All the rest is arena management.  We just freed
              * a pool, and there are 4 cases for arena mgmt:
@@ -1430,15 +1655,32 @@ _PyObject_Free(void *ctx, void *p)
                 ao->nextarena = unused_arena_objects;
                 unused_arena_objects = ao;
 
+                /* Forget its resident and purged free pools.
+                 */
+                nfreepools_resident -= nf - ao->npurged -
+                    (uint)((ao->address + ARENA_SIZE -
+                            (uptr)ao->pool_address) / POOL_SIZE);
+                npurgedpools -= ao->npurged;
+                if (ao->purged != NULL) {
+                    PyMem_RawFree(ao->purged);
+                    ao->purged = NULL;
+                }
+
                 /* Free the entire arena. */
                 _PyObject_Arena.free(_PyObject_Arena.ctx,
                                      (void *)ao->address, ARENA_SIZE);
                 ao->address = 0;                        /* mark unassociated */
                 --narenas_currently_allocated;
+                released_arena_bytes += ARENA_SIZE;
 
                 UNLOCK();
                 return;
             }
+#ifdef ARENAS_USE_PURGE
+            if (purge_enabled &&
+                nfreepools_resident >= PURGE_THRESHOLD)
+                purge_free_pools();
+#endif
             if (nf == 1) {
                 /* Case 2.  Put ao at the head of
                  * usable_arenas.  Note that because
@@ -2068,45 +2310,33 @@ _PyDebugAllocatorStats(FILE *out,
 
 #ifdef WITH_PYMALLOC
 
-/* Print summary info to "out" about the state of pymalloc's structures.
- * In Py_DEBUG mode, also perform some expensive internal consistency
- * checks.
+#if NB_SMALL_SIZE_CLASSES > _PyObject_MAX_SIZE_CLASSES
+#error "_PyObject_MallocStats is too small for NB_SMALL_SIZE_CLASSES"
+#endif
+
+/* Walk every arena and fill in *st.  In Py_DEBUG mode, also perform some
+ * expensive internal consistency checks.
  */
 void
-_PyObject_DebugMallocStats(FILE *out)
+_PyObject_GetMallocStats(_PyObject_MallocStats *st)
 {
     uint i;
-    const uint numclasses = SMALL_REQUEST_THRESHOLD >> ALIGNMENT_SHIFT;
-    /* # of pools, allocated blocks, and free blocks per class index */
-    size_t numpools[SMALL_REQUEST_THRESHOLD >> ALIGNMENT_SHIFT];
-    size_t numblocks[SMALL_REQUEST_THRESHOLD >> ALIGNMENT_SHIFT];
-    size_t numfreeblocks[SMALL_REQUEST_THRESHOLD >> ALIGNMENT_SHIFT];
-    /* total # of allocated bytes in used and full pools */
-    size_t allocated_bytes = 0;
-    /* total # of available bytes in used pools */
-    size_t available_bytes = 0;
-    /* # of free pools + pools not yet carved out of current arena */
-    uint numfreepools = 0;
-    /* # of bytes for arena alignment padding */
-    size_t arena_alignment = 0;
-    /* # of bytes in used and full pools used for pool_headers */
-    size_t pool_header_bytes = 0;
-    /* # of bytes in used and full pools wasted due to quantization,
-     * i.e. the necessarily leftover space at the ends of used and
-     * full pools.
-     */
-    size_t quantization = 0;
-    /* # of arenas actually allocated. */
-    size_t narenas = 0;
-    /* running total -- should equal narenas * ARENA_SIZE */
-    size_t total;
-    char buf[128];
 
-    fprintf(out, "Small block threshold = %d, in %u size classes.\n",
-            SMALL_REQUEST_THRESHOLD, numclasses);
-
-    for (i = 0; i < numclasses; ++i)
-        numpools[i] = numblocks[i] = numfreeblocks[i] = 0;
+    memset(st, 0, sizeof(*st));
+    st->arena_size = ARENA_SIZE;
+    st->pool_size = POOL_SIZE;
+#ifdef ARENAS_USE_HUGEPAGES
+    st->hugepages = arena_hugepages;
+#endif
+    st->nclasses = NB_SMALL_SIZE_CLASSES;
+    st->narenas_total = ntimes_arena_allocated;
+    st->narenas_highwater = narenas_highwater;
+#ifdef ARENAS_USE_PURGE
+    st->purge = purge_enabled;
+#endif
+    st->npurgedpools = npurgedpools;
+    st->purged_bytes = purged_bytes;
+    st->released_arena_bytes = released_arena_bytes;
 
     /* Because full pools aren't linked to from anything, it's easiest
      * to march over all the arenas.  If we're lucky, most of the memory
@@ -2119,13 +2349,13 @@ _PyObject_DebugMallocStats(FILE *out)
         /* Skip arenas which are not allocated. */
         if (arenas[i].address == (uptr)NULL)
             continue;
-        narenas += 1;
+        st->narenas += 1;
 
-        numfreepools += arenas[i].nfreepools;
+        st->numfreepools += arenas[i].nfreepools;
 
         /* round up to pool alignment */
         if (base & (uptr)POOL_SIZE_MASK) {
-            arena_alignment += POOL_SIZE;
+            st->arena_alignment += POOL_SIZE;
             base &= ~(uptr)POOL_SIZE_MASK;
             base += POOL_SIZE;
         }
@@ -2139,76 +2369,141 @@ _PyObject_DebugMallocStats(FILE *out)
             const uint sz = p->szidx;
             uint freeblocks;
 
+            if (arenas[i].purged != NULL &&
+                arenas[i].purged[j >> 3] & (1 << (j & 7))) {
+                /* purged:  don't fault its pages back in */
+                continue;
+            }
             if (p->ref.count == 0) {
                 /* currently unused */
                 assert(pool_is_in_list(p, arenas[i].freepools));
                 continue;
             }
-            ++numpools[sz];
-            numblocks[sz] += p->ref.count;
+            ++st->numpools[sz];
+            st->numblocks[sz] += p->ref.count;
             freeblocks = NUMBLOCKS(sz) - p->ref.count;
-            numfreeblocks[sz] += freeblocks;
+            st->numfreeblocks[sz] += freeblocks;
 #ifdef Py_DEBUG
             if (freeblocks > 0)
                 assert(pool_is_in_list(p, usedpools[sz + sz]));
 #endif
         }
     }
-    assert(narenas == narenas_currently_allocated);
+    assert(st->narenas == narenas_currently_allocated);
+
+    for (i = 0; i < NB_SMALL_SIZE_CLASSES; ++i) {
+        size_t p = st->numpools[i];
+        uint size = INDEX2SIZE(i);
+
+        assert(p != 0 || (st->numblocks[i] == 0 &&
+                          st->numfreeblocks[i] == 0));
+        st->class_size[i] = size;
+        st->allocated_bytes += st->numblocks[i] * size;
+        st->available_bytes += st->numfreeblocks[i] * size;
+        st->pool_header_bytes += p * POOL_OVERHEAD;
+        st->quantization += p * ((POOL_SIZE - POOL_OVERHEAD) % size);
+    }
+}
+
+/* Print summary info to "out" about the state of pymalloc's structures.
+ * In Py_DEBUG mode, also perform some expensive internal consistency
+ * checks.
+ */
+void
+_PyObject_DebugMallocStats(FILE *out)
+{
+    uint i;
+    _PyObject_MallocStats st;
+    /* running total -- should equal narenas * ARENA_SIZE */
+    size_t total;
+    char buf[128];
+
+    _PyObject_GetMallocStats(&st);
+
+    fprintf(out, "Small block threshold = %d, in %u size classes.\n",
+            SMALL_REQUEST_THRESHOLD, (uint)NB_SMALL_SIZE_CLASSES);
+    fprintf(out, "Arena size = %" PY_FORMAT_SIZE_T "u bytes%s.\n",
+            st.arena_size, st.hugepages ? ", huge pages" : "");
 
     fputc('\n', out);
-    fputs("class   size   num pools   blocks in use  avail blocks\n"
-          "-----   ----   ---------   -------------  ------------\n",
+    fputs("class   size   num pools   blocks in use  avail blocks  usage\n"
+          "-----   ----   ---------   -------------  ------------  -----\n",
           out);
 
-    for (i = 0; i < numclasses; ++i) {
-        size_t p = numpools[i];
-        size_t b = numblocks[i];
-        size_t f = numfreeblocks[i];
+    for (i = 0; i < NB_SMALL_SIZE_CLASSES; ++i) {
+        size_t p = st.numpools[i];
+        size_t b = st.numblocks[i];
+        size_t f = st.numfreeblocks[i];
         uint size = INDEX2SIZE(i);
-        if (p == 0) {
-            assert(b == 0 && f == 0);
+        if (p == 0)
             continue;
-        }
         fprintf(out, "%5u %6u "
                         "%11" PY_FORMAT_SIZE_T "u "
                         "%15" PY_FORMAT_SIZE_T "u "
-                        "%13" PY_FORMAT_SIZE_T "u\n",
-                i, size, p, b, f);
-        allocated_bytes += b * size;
-        available_bytes += f * size;
-        pool_header_bytes += p * POOL_OVERHEAD;
-        quantization += p * ((POOL_SIZE - POOL_OVERHEAD) % size);
+                        "%13" PY_FORMAT_SIZE_T "u "
+                        "%5.1f%%\n",
+                i, size, p, b, f, 100.0 * b / (b + f));
     }
     fputc('\n', out);
 #ifdef PYMALLOC_DEBUG
     (void)printone(out, "# times object malloc called", serialno);
 #endif
     (void)printone(out, "# arenas allocated total", ntimes_arena_allocated);
-    (void)printone(out, "# arenas reclaimed", ntimes_arena_allocated - narenas);
+    (void)printone(out, "# arenas reclaimed",
+                   ntimes_arena_allocated - st.narenas);
     (void)printone(out, "# arenas highwater mark", narenas_highwater);
-    (void)printone(out, "# arenas allocated current", narenas);
+    (void)printone(out, "# arenas allocated current", st.narenas);
 
     PyOS_snprintf(buf, sizeof(buf),
-        "%" PY_FORMAT_SIZE_T "u arenas * %d bytes/arena",
-        narenas, ARENA_SIZE);
-    (void)printone(out, buf, narenas * ARENA_SIZE);
+        "%" PY_FORMAT_SIZE_T "u arenas * %" PY_FORMAT_SIZE_T "u bytes/arena",
+        st.narenas, ARENA_SIZE);
+    (void)printone(out, buf, st.narenas * ARENA_SIZE);
 
     fputc('\n', out);
 
-    total = printone(out, "# bytes in allocated blocks", allocated_bytes);
-    total += printone(out, "# bytes in available blocks", available_bytes);
+    if (st.purge)
+        fputs("Empty pools are purged.\n", out);
+    (void)printone(out, "# pools purged current", st.npurgedpools);
+    (void)printone(out, "# bytes purged total", st.purged_bytes);
+    (void)printone(out, "# bytes released with arenas total",
+                   st.released_arena_bytes);
 
-    PyOS_snprintf(buf, sizeof(buf),
-        "%u unused pools * %d bytes", numfreepools, POOL_SIZE);
-    total += printone(out, buf, (size_t)numfreepools * POOL_SIZE);
+    fputc('\n', out);
 
-    total += printone(out, "# bytes lost to pool headers", pool_header_bytes);
-    total += printone(out, "# bytes lost to quantization", quantization);
-    total += printone(out, "# bytes lost to arena alignment", arena_alignment);
+    total = printone(out, "# bytes in allocated blocks", st.allocated_bytes);
+    total += printone(out, "# bytes in available blocks", st.available_bytes);
+
+    PyOS_snprintf(buf, sizeof(buf),
+        "%" PY_FORMAT_SIZE_T "u unused pools * %d bytes",
+        st.numfreepools, POOL_SIZE);
+    total += printone(out, buf, st.numfreepools * POOL_SIZE);
+
+    total += printone(out, "# bytes lost to pool headers",
+                      st.pool_header_bytes);
+    total += printone(out, "# bytes lost to quantization", st.quantization);
+    total += printone(out, "# bytes lost to arena alignment",
+                      st.arena_alignment);
     (void)printone(out, "Total", total);
 }
 
+/* Enable or disable purging of empty pools, see purge_free_pools().  Return
+ * -1 if purging is not supported on this platform, else 0.
+ */
+int
+_PyObject_SetMallocPurge(int enabled)
+{
+#ifdef ARENAS_USE_PURGE
+    if (enabled && !purge_supported())
+        return -1;
+    purge_enabled = enabled;
+    if (enabled && nfreepools_resident >= PURGE_THRESHOLD)
+        purge_free_pools();
+    return 0;
+#else
+    return -1;
+#endif
+}
+
 #endif /* #ifdef WITH_PYMALLOC */
 
 #ifdef Py_USING_MEMORY_DEBUGGER
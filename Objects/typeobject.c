@@ -2789,6 +2789,34 @@ type_subclasses(PyTypeObject *type, PyObject *args_ignored)
     return list;
 }
 
+#ifdef Py_IMMORTAL_OBJECTS
+/* Make type and its subclasses immortal, see _Py_ImmortalizeObjects().
+   The subclasses of a type which is immortal already are skipped, which
+   keeps the walk linear. */
+Py_ssize_t
+_PyType_Immortalize(PyTypeObject *type)
+{
+    PyObject *raw, *ref;
+    Py_ssize_t i, n;
+
+    n = _Py_SetImmortal((PyObject *)type);
+    if (n == 0)
+        return 0;
+    raw = type->tp_subclasses;
+    if (raw != NULL) {
+        assert(PyDict_CheckExact(raw));
+        i = 0;
+        while (PyDict_Next(raw, &i, NULL, &ref)) {
+            assert(PyWeakref_CheckRef(ref));
+            ref = PyWeakref_GET_OBJECT(ref);
+            if (ref != Py_None)
+                n += _PyType_Immortalize((PyTypeObject *)ref);
+        }
+    }
+    return n;
+}
+#endif
+
 static PyObject *
 type_prepare(PyObject *self, PyObject *args, PyObject *kwds)
 {
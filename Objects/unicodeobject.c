@@ -15091,6 +15091,32 @@ _Py_ReleaseInternedUnicodeStrings(void)
     Py_CLEAR(interned);
 }
 
+#ifdef Py_IMMORTAL_OBJECTS
+/* Make the interned strings, the empty string and the latin-1 characters
+   immortal, see _Py_ImmortalizeObjects() */
+Py_ssize_t
+_PyUnicode_Immortalize(void)
+{
+    PyObject *s, *value;
+    Py_ssize_t pos = 0, n = 0;
+    int i;
+
+    if (interned != NULL) {
+        while (PyDict_Next(interned, &pos, &s, &value)) {
+            n += _Py_SetImmortal(s);
+            _PyUnicode_STATE(s).interned = SSTATE_INTERNED_IMMORTAL;
+        }
+    }
+    if (unicode_empty != NULL)
+        n += _Py_SetImmortal(unicode_empty);
+    for (i = 0; i < 256; i++) {
+        if (unicode_latin1[i] != NULL)
+            n += _Py_SetImmortal(unicode_latin1[i]);
+    }
+    return n;
+}
+#endif
+
 
 /********************* Unicode Iterator **************************/
 
@@ -116,6 +116,7 @@ static PyObject * update_keyword_args(PyObject *, int, PyObject ***,
                                       PyObject *);
 static PyObject * update_star_args(int, int, PyObject *, PyObject ***);
 static PyObject * load_args(PyObject ***, int);
+static int call_method_descr(PyObject *, PyObject ***, int, PyObject **);
 #define CALL_FLAG_VAR 1
 #define CALL_FLAG_KW 2
 
@@ -142,6 +143,19 @@ static void format_exc_unbound(PyCodeObject *co, int oparg);
 static PyObject * unicode_concatenate(PyObject *, PyObject *,
                                       PyFrameObject *, unsigned char *);
 static PyObject * special_lookup(PyObject *, _Py_Identifier *);
+static _PyOpcache_AttrEntry * opcache_attr_lookup(_PyOpcache *, PyObject *,
+                                                  PyDictObject **);
+static void opcache_attr_record(_PyOpcache *, PyObject *, PyObject *, int);
+
+/* Number of times a code object must be entered or go through a loop
+   before its inline caches are allocated (see _PyCode_InitOpcache()).
+   Code run only a few times (module bodies, class bodies) does not pay
+   for them. */
+#define OPCACHE_MIN_RUNS 1024
+
+/* A LOAD_ATTR or STORE_ATTR stops using its cache after that many misses:
+   the instruction is either megamorphic or not used on plain instances. */
+#define OPCACHE_ATTR_MAX_MISSES 64
 
 #define NAME_ERROR_MSG \
     "name '%.200s' is not defined"
@@ -307,7 +321,7 @@ PyEval_InitThreads(void)
     if (gil_created())
         return;
     create_gil();
-    take_gil(PyThreadState_GET());
+    take_gil(PyThreadState_GET(), 0);
     main_thread = PyThread_get_thread_ident();
     if (!pending_lock)
         pending_lock = PyThread_allocate_lock();
@@ -328,7 +342,7 @@ PyEval_AcquireLock(void)
     PyThreadState *tstate = PyThreadState_GET();
     if (tstate == NULL)
         Py_FatalError("PyEval_AcquireLock: current thread state is NULL");
-    take_gil(tstate);
+    take_gil(tstate, 0);
 }
 
 void
@@ -349,7 +363,7 @@ PyEval_AcquireThread(PyThreadState *tstate)
         Py_FatalError("PyEval_AcquireThread: NULL new thread state");
     /* Check someone has called PyEval_InitThreads() to create the lock */
     assert(gil_created());
-    take_gil(tstate);
+    take_gil(tstate, 0);
     if (PyThreadState_Swap(tstate) != NULL)
         Py_FatalError(
             "PyEval_AcquireThread: non-NULL old thread state");
@@ -381,7 +395,7 @@ PyEval_ReInitThreads(void)
         return;
     recreate_gil();
     pending_lock = PyThread_allocate_lock();
-    take_gil(current_tstate);
+    take_gil(current_tstate, 0);
     main_thread = PyThread_get_thread_ident();
 
     /* Update the threading module with the new state.
@@ -443,7 +457,7 @@ PyEval_RestoreThread(PyThreadState *tstate)
 #ifdef WITH_THREAD
     if (gil_created()) {
         int err = errno;
-        take_gil(tstate);
+        take_gil(tstate, 1);
         /* _Py_Finalizing is protected by the GIL */
         if (_Py_Finalizing && tstate != _Py_Finalizing) {
             drop_gil(tstate);
@@ -817,6 +831,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
     unsigned char *first_instr;
     PyObject *names;
     PyObject *consts;
+    _PyOpcache *co_opcache;
 
 #ifdef LLTRACE
     _Py_IDENTIFIER(__ltrace__);
@@ -997,6 +1012,29 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 #define JUMPTO(x)       (next_instr = first_instr + (x))
 #define JUMPBY(x)       (next_instr += (x))
 
+/* Count a run of the code object; true if allocating the inline caches
+   of the code object failed. */
+
+#define OPCACHE_WARMUP() \
+    (co->co_opcache_flag < OPCACHE_MIN_RUNS && \
+     ++co->co_opcache_flag == OPCACHE_MIN_RUNS && \
+     _PyCode_InitOpcache(co) < 0)
+
+/* Inline cache access: set co_opcache to the cache entry of the
+   instruction at the given offset, or to NULL if it has none. */
+
+#define OPCACHE_CHECK(offset) \
+    do { \
+        co_opcache = NULL; \
+        if (co->co_opcache != NULL) { \
+            unsigned char co_opt_offset = co->co_opcache_map[(offset)]; \
+            if (co_opt_offset > 0) { \
+                assert(co_opt_offset <= co->co_opcache_size); \
+                co_opcache = &co->co_opcache[co_opt_offset - 1]; \
+            } \
+        } \
+    } while (0)
+
 /* OpCode prediction macros
     Some opcodes tend to come in pairs thus making it possible to
     predict the second code when the first is run.  For example,
@@ -1157,6 +1195,8 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
     }
 
     co = f->f_code;
+    if (OPCACHE_WARMUP())
+        goto exit_eval_frame;
     names = co->co_names;
     consts = co->co_consts;
     fastlocals = f->f_localsplus;
@@ -1266,7 +1306,7 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
 
                 /* Other threads may run now */
 
-                take_gil(tstate);
+                take_gil(tstate, 0);
                 if (PyThreadState_Swap(tstate) != NULL)
                     Py_FatalError("ceval: orphan tstate");
             }
@@ -2111,7 +2151,21 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             PyObject *v = SECOND();
             int err;
             STACKADJ(-2);
+            OPCACHE_CHECK(INSTR_OFFSET() - 3);
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                PyDictObject *dict;
+                _PyOpcache_AttrEntry *e;
+                e = opcache_attr_lookup(co_opcache, owner, &dict);
+                if (e != NULL) {
+                    _PyDict_SetSplitValue(dict, e->index, v);
+                    Py_DECREF(v);
+                    Py_DECREF(owner);
+                    DISPATCH();
+                }
+            }
             err = PyObject_SetAttr(owner, name, v);
+            if (err == 0 && co_opcache != NULL && co_opcache->optimized >= 0)
+                opcache_attr_record(co_opcache, owner, name, 1);
             Py_DECREF(v);
             Py_DECREF(owner);
             if (err != 0)
@@ -2209,15 +2263,37 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             PyObject *v;
             if (PyDict_CheckExact(f->f_globals)
                 && PyDict_CheckExact(f->f_builtins)) {
-                v = _PyDict_LoadGlobal((PyDictObject *)f->f_globals,
-                                       (PyDictObject *)f->f_builtins,
-                                       name);
+                PyDictObject *globals = (PyDictObject *)f->f_globals;
+                PyDictObject *builtins = (PyDictObject *)f->f_builtins;
+                _PyOpcache_LoadGlobal *lg;
+
+                OPCACHE_CHECK(INSTR_OFFSET() - 3);
+                if (co_opcache != NULL && co_opcache->optimized > 0) {
+                    lg = &co_opcache->u.lg;
+                    if (lg->globals_ver == globals->ma_version_tag
+                        && lg->builtins_ver == builtins->ma_version_tag) {
+                        /* Neither dict changed since the lookup:
+                           the cached object is still the answer. */
+                        v = lg->ptr;
+                        Py_INCREF(v);
+                        PUSH(v);
+                        DISPATCH();
+                    }
+                }
+                v = _PyDict_LoadGlobal(globals, builtins, name);
                 if (v == NULL) {
                     if (!_PyErr_OCCURRED())
                         format_exc_check_arg(PyExc_NameError,
                                              NAME_ERROR_MSG, name);
                     goto error;
                 }
+                if (co_opcache != NULL) {
+                    lg = &co_opcache->u.lg;
+                    lg->ptr = v; /* borrowed */
+                    lg->globals_ver = globals->ma_version_tag;
+                    lg->builtins_ver = builtins->ma_version_tag;
+                    co_opcache->optimized = 1;
+                }
                 Py_INCREF(v);
             }
             else {
@@ -2408,7 +2484,22 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         TARGET(LOAD_ATTR) {
             PyObject *name = GETITEM(names, oparg);
             PyObject *owner = TOP();
-            PyObject *res = PyObject_GetAttr(owner, name);
+            PyObject *res;
+            OPCACHE_CHECK(INSTR_OFFSET() - 3);
+            if (co_opcache != NULL && co_opcache->optimized > 0) {
+                PyDictObject *dict;
+                _PyOpcache_AttrEntry *e;
+                e = opcache_attr_lookup(co_opcache, owner, &dict);
+                if (e != NULL && (res = dict->ma_values[e->index]) != NULL) {
+                    Py_INCREF(res);
+                    Py_DECREF(owner);
+                    SET_TOP(res);
+                    DISPATCH();
+                }
+            }
+            res = PyObject_GetAttr(owner, name);
+            if (res != NULL && co_opcache != NULL && co_opcache->optimized >= 0)
+                opcache_attr_record(co_opcache, owner, name, 0);
             Py_DECREF(owner);
             SET_TOP(res);
             if (res == NULL)
@@ -2620,6 +2711,8 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
         PREDICTED_WITH_ARG(JUMP_ABSOLUTE);
         TARGET(JUMP_ABSOLUTE) {
             JUMPTO(oparg);
+            if (OPCACHE_WARMUP())
+                goto error;
 #if FAST_LOOPS
             /* Enabling this path speeds-up all while and for-loops by bypassing
                the per-loop checks for signals.  By default, this should be turned-off
@@ -2835,6 +2928,73 @@ PyEval_EvalFrameEx(PyFrameObject *f, int throwflag)
             DISPATCH();
         }
 
+        TARGET(LOAD_METHOD) {
+            /* Designed to work in tandem with CALL_METHOD.  Pushes either
+               [unbound method, self] when the attribute is a method of
+               the type, or [NULL, attribute] otherwise. */
+            PyObject *name = GETITEM(names, oparg);
+            PyObject *obj = TOP();
+            PyObject *meth = NULL;
+            int meth_found = _PyObject_GetMethod(obj, name, &meth);
+
+            if (meth == NULL)
+                goto error;
+            if (meth_found && Py_TYPE(meth) == &PyMethodDescr_Type &&
+                tstate->use_tracing && tstate->c_profilefunc != NULL) {
+                /* Profilers expect c_call events for builtin methods
+                   with a bound builtin function: bind it after all. */
+                PyObject *bound = Py_TYPE(meth)->tp_descr_get(
+                    meth, obj, (PyObject *)Py_TYPE(obj));
+                Py_DECREF(meth);
+                if (bound == NULL)
+                    goto error;
+                meth = bound;
+                meth_found = 0;
+            }
+            if (meth_found) {
+                SET_TOP(meth);
+                PUSH(obj);  /* self */
+            }
+            else {
+                SET_TOP(NULL);
+                Py_DECREF(obj);
+                PUSH(meth);
+            }
+            DISPATCH();
+        }
+
+        TARGET(CALL_METHOD) {
+            /* Designed to work in tandem with LOAD_METHOD. */
+            PyObject **sp, *res, *meth;
+
+            PCALL(PCALL_ALL);
+            sp = stack_pointer;
+            meth = PEEK(oparg + 2);
+            if (meth == NULL) {
+                /* Not a method: [NULL, callable, args...] */
+#ifdef WITH_TSC
+                res = call_function(&sp, oparg, &intr0, &intr1);
+#else
+                res = call_function(&sp, oparg);
+#endif
+                stack_pointer = sp;
+                (void)POP(); /* the NULL */
+            }
+            else {
+                /* [method, self, args...]: self is the first argument */
+#ifdef WITH_TSC
+                res = call_function(&sp, oparg + 1, &intr0, &intr1);
+#else
+                res = call_function(&sp, oparg + 1);
+#endif
+                stack_pointer = sp;
+            }
+            PUSH(res);
+            if (res == NULL)
+                goto error;
+            DISPATCH();
+        }
+
         TARGET_WITH_IMPL(CALL_FUNCTION_VAR, _call_function_var_kw)
         TARGET_WITH_IMPL(CALL_FUNCTION_KW, _call_function_var_kw)
         TARGET(CALL_FUNCTION_VAR_KW)
@@ -4235,6 +4395,9 @@ call_function(PyObject ***pp_stack, int oparg
                 x = NULL;
             }
         }
+    } else if (nk == 0 && Py_TYPE(func) == &PyMethodDescr_Type &&
+               call_method_descr(func, pp_stack, na, &x)) {
+        PCALL(PCALL_CFUNCTION);
     } else {
         if (PyMethod_Check(func) && PyMethod_GET_SELF(func) != NULL) {
             /* optimize access to bound methods */
@@ -4405,6 +4568,49 @@ update_star_args(int nstack, int nstar, PyObject *stararg,
     return callargs;
 }
 
+/* Call the method descriptor of a builtin type pushed by LOAD_METHOD,
+   with the first of the na arguments on the stack as self, without
+   creating a bound builtin method.  Return 0 if the call must go
+   through the generic path instead (which also reports errors about
+   the arguments); otherwise store the result in *result and return 1. */
+static int
+call_method_descr(PyObject *func, PyObject ***pp_stack, int na,
+                  PyObject **result)
+{
+    PyMethodDef *ml = ((PyMethodDescrObject *)func)->d_method;
+    int flags = ml->ml_flags & ~(METH_CLASS | METH_STATIC | METH_COEXIST);
+    PyObject *self, *callargs;
+
+    if (na < 1)
+        return 0;
+    self = (*pp_stack)[-na];
+    if (!PyObject_TypeCheck(self, PyDescr_TYPE(func)))
+        return 0;
+    if (flags == METH_NOARGS && na == 1) {
+        *result = (*ml->ml_meth)(self, NULL);
+    }
+    else if (flags == METH_O && na == 2) {
+        *result = (*ml->ml_meth)(self, (*pp_stack)[-1]);
+    }
+    else if (flags == METH_VARARGS ||
+             flags == (METH_VARARGS | METH_KEYWORDS)) {
+        callargs = load_args(pp_stack, na - 1);
+        if (callargs == NULL) {
+            *result = NULL;
+            return 1;
+        }
+        if (flags & METH_KEYWORDS)
+            *result = (*(PyCFunctionWithKeywords)ml->ml_meth)(self, callargs,
+                                                              NULL);
+        else
+            *result = (*ml->ml_meth)(self, callargs);
+        Py_DECREF(callargs);
+    }
+    else
+        return 0;
+    return 1;
+}
+
 static PyObject *
 load_args(PyObject ***pp_stack, int na)
 {
@@ -4595,6 +4801,90 @@ _PyEval_SliceIndex(PyObject *v, Py_ssize_t *pi)
 #define CANNOT_CATCH_MSG "catching classes that do not inherit from "\
                          "BaseException is not allowed"
 
+/* Find the entry of an attribute cache matching the type of owner and
+   the shared keys of its instance dict, which is stored in *pdict. */
+static _PyOpcache_AttrEntry *
+opcache_attr_lookup(_PyOpcache *oc, PyObject *owner, PyDictObject **pdict)
+{
+    PyTypeObject *tp = Py_TYPE(owner);
+    _PyOpcache_AttrEntry *e;
+    PyObject *dict;
+    int i;
+
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return NULL;
+    for (i = 0; i < _PyOpcache_ATTR_ENTRIES; i++) {
+        e = &oc->u.la.entries[i];
+        if (e->type == tp && e->tp_version_tag == tp->tp_version_tag) {
+            /* The dict offset was checked when the entry was filled and
+               cannot change without changing the version tag. */
+            dict = *(PyObject **)((char *)owner + tp->tp_dictoffset);
+            if (dict == NULL || ((PyDictObject *)dict)->ma_keys != e->keys)
+                return NULL;
+            assert(_PyDict_HasSplitTable((PyDictObject *)dict));
+            *pdict = (PyDictObject *)dict;
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/* Fill an attribute cache entry after a miss, if owner is an instance
+   of a heap type using the generic attribute access, name is not
+   defined on the type and lives in the split instance dict.  Also
+   called for misses of the fast path, which are counted. */
+static void
+opcache_attr_record(_PyOpcache *oc, PyObject *owner, PyObject *name,
+                    int store)
+{
+    PyTypeObject *tp = Py_TYPE(owner);
+    _PyOpcache_Attr *la = &oc->u.la;
+    _PyOpcache_AttrEntry *e;
+    PyDictKeysObject *cached_keys;
+    PyObject *dict;
+    Py_ssize_t ix;
+    int i;
+
+    if (++la->misses >= OPCACHE_ATTR_MAX_MISSES) {
+        oc->optimized = -1;
+        return;
+    }
+    if (!PyType_HasFeature(tp, Py_TPFLAGS_HEAPTYPE) || tp->tp_dictoffset <= 0)
+        return;
+    if (store ? tp->tp_setattro != PyObject_GenericSetAttr
+              : tp->tp_getattro != PyObject_GenericGetAttr)
+        return;
+    cached_keys = ((PyHeapTypeObject *)tp)->ht_cached_keys;
+    dict = *(PyObject **)((char *)owner + tp->tp_dictoffset);
+    if (cached_keys == NULL || dict == NULL || !PyDict_CheckExact(dict) ||
+        ((PyDictObject *)dict)->ma_keys != cached_keys)
+        return;
+    /* The lookup also assigns a version tag to the type */
+    if (_PyType_Lookup(tp, name) != NULL ||
+        !PyType_HasFeature(tp, Py_TPFLAGS_VALID_VERSION_TAG))
+        return;
+    ix = _PyDict_GetSplitIndex((PyDictObject *)dict, name);
+    if (ix < 0)
+        return;
+
+    e = NULL;
+    for (i = 0; i < _PyOpcache_ATTR_ENTRIES; i++) {
+        if (la->entries[i].type == tp) {
+            e = &la->entries[i];
+            break;
+        }
+    }
+    if (e == NULL) {
+        e = &la->entries[la->next];
+        la->next = (la->next + 1) % _PyOpcache_ATTR_ENTRIES;
+    }
+    e->type = tp;
+    e->tp_version_tag = tp->tp_version_tag;
+    e->keys = cached_keys;
+    e->index = ix;
+    oc->optimized = 1;
+}
+
 static PyObject *
 cmp_outcome(int op, PyObject *v, PyObject *w)
 {
@@ -13,6 +13,12 @@
 static unsigned long gil_interval = DEFAULT_INTERVAL;
 #define INTERVAL (gil_interval >= 1 ? gil_interval : 1)
 
+/* Switch delay, in microseconds, of threads returning from a blocking call
+   (see "priority handoff" below); 0 disables priority handoff. */
+static unsigned long gil_priority_interval = 0;
+#define PRIORITY_INTERVAL \
+    (gil_priority_interval >= 1 ? gil_priority_interval : 1)
+
 /* Enable if you want to force the switching of threads at least every `gil_interval` */
 #undef FORCE_SWITCHING
 #define FORCE_SWITCHING
@@ -57,6 +63,23 @@ static unsigned long gil_interval = DEFAULT_INTERVAL;
      run and end up being the first to re-acquire it, making the "timeslices"
      much longer than expected.
      (Note: this mechanism is enabled with FORCE_SWITCHING above)
+
+   - Priority handoff (disabled by default): a thread returning from a
+     blocking call, typically I/O, only waits `priority_interval`
+     microseconds before setting gil_drop_request, instead of `interval`.
+     It waits on its own condition variable (gil_prio_cond), which drop_gil()
+     signals in preference to gil_cond, and the other waiting threads let it
+     take the GIL first, unless they have waited a whole `interval` already.
+     Otherwise, a thread which needs the GIL briefly after each I/O operation
+     would wait behind a CPU-bound thread for an interval each time (the
+     "convoy effect").
+
+     The value is available for the user to read and modify using the Python
+     API `sys._{get,set}switchpriority()`.
+
+   - Statistics on the GIL are kept in gil_stats, protected by gil_mutex,
+     and the time each thread held the GIL in its thread state.  They are
+     available with `sys._getgilstats()`.
 */
 
 #include "condvar.h"
@@ -118,6 +141,50 @@ static _Py_atomic_address gil_last_holder = {NULL};
    variables. */
 static COND_T gil_cond;
 static MUTEX_T gil_mutex;
+/* The same for priority waiters, and their number. */
+static COND_T gil_prio_cond;
+static int gil_prio_waiters = 0;
+
+/* Statistics, and when the current holder took the GIL */
+static _PyEval_GILStats gil_stats;
+static double gil_taken_time;
+
+/* Upper bounds, in seconds, of the buckets of the wait time histogram; the
+   last bucket holds the longer waits. */
+static const double gil_wait_bounds[_PyEval_GIL_WAIT_BUCKETS - 1] = {
+    1e-6, 2e-6, 5e-6, 1e-5, 2e-5, 5e-5, 1e-4, 2e-4, 5e-4,
+    1e-3, 2e-3, 5e-3, 1e-2, 2e-2, 5e-2, 1e-1, 2e-1, 5e-1, 1.0
+};
+
+/* Return the current time in seconds, from a monotonic clock if
+   available. */
+static double
+gil_clock(void)
+{
+    _PyTime_timeval tv;
+#if defined(HAVE_CLOCK_GETTIME) && defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0)
+        return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+    _PyTime_gettimeofday(&tv);
+    return (double)tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+static void
+record_gil_wait(double wait)
+{
+    int i;
+
+    gil_stats.wait_total += wait;
+    if (wait > gil_stats.wait_max)
+        gil_stats.wait_max = wait;
+    for (i = 0; i < _PyEval_GIL_WAIT_BUCKETS - 1 && wait >= gil_wait_bounds[i];
+         i++)
+        ;
+    gil_stats.wait_histogram[i]++;
+}
 
 #ifdef FORCE_SWITCHING
 /* This condition variable helps the GIL-releasing thread wait for
@@ -139,9 +206,11 @@ static void create_gil(void)
     MUTEX_INIT(switch_mutex);
 #endif
     COND_INIT(gil_cond);
+    COND_INIT(gil_prio_cond);
 #ifdef FORCE_SWITCHING
     COND_INIT(switch_cond);
 #endif
+    gil_prio_waiters = 0;
     _Py_atomic_store_relaxed(&gil_last_holder, NULL);
     _Py_ANNOTATE_RWLOCK_CREATE(&gil_locked);
     _Py_atomic_store_explicit(&gil_locked, 0, _Py_memory_order_release);
@@ -153,6 +222,7 @@ static void destroy_gil(void)
      * and must have the cond destroyed first.
      */
     COND_FINI(gil_cond);
+    COND_FINI(gil_prio_cond);
     MUTEX_FINI(gil_mutex);
 #ifdef FORCE_SWITCHING
     COND_FINI(switch_cond);
@@ -182,9 +252,18 @@ static void drop_gil(PyThreadState *tstate)
     }
 
     MUTEX_LOCK(gil_mutex);
+    if (tstate != NULL)
+        tstate->gil_hold_time += gil_clock() - gil_taken_time;
+    if (_Py_atomic_load_relaxed(&gil_drop_request))
+        gil_stats.forced_drops++;
     _Py_ANNOTATE_RWLOCK_RELEASED(&gil_locked, /*is_write=*/1);
     _Py_atomic_store_relaxed(&gil_locked, 0);
-    COND_SIGNAL(gil_cond);
+    if (gil_prio_waiters > 0) {
+        COND_SIGNAL(gil_prio_cond);
+    }
+    else {
+        COND_SIGNAL(gil_cond);
+    }
     MUTEX_UNLOCK(gil_mutex);
     
 #ifdef FORCE_SWITCHING
@@ -204,32 +283,65 @@ static void drop_gil(PyThreadState *tstate)
 #endif
 }
 
-static void take_gil(PyThreadState *tstate)
+/* Take the GIL.  priority is true for a thread returning from a blocking
+   call, see "priority handoff" above. */
+static void take_gil(PyThreadState *tstate, int priority)
 {
     int err;
+    int timed_out = 0;
+    double start;
     if (tstate == NULL)
         Py_FatalError("take_gil: NULL tstate");
 
     err = errno;
     MUTEX_LOCK(gil_mutex);
+    gil_stats.acquisitions++;
+    priority = priority && gil_priority_interval > 0;
 
-    if (!_Py_atomic_load_relaxed(&gil_locked))
+    if (!_Py_atomic_load_relaxed(&gil_locked) &&
+        (priority || gil_prio_waiters == 0))
         goto _ready;
-    
-    while (_Py_atomic_load_relaxed(&gil_locked)) {
-        int timed_out = 0;
-        unsigned long saved_switchnum;
-
-        saved_switchnum = gil_switch_number;
-        COND_TIMED_WAIT(gil_cond, gil_mutex, INTERVAL, timed_out);
-        /* If we timed out and no switch occurred in the meantime, it is time
-           to ask the GIL-holding thread to drop it. */
-        if (timed_out &&
-            _Py_atomic_load_relaxed(&gil_locked) &&
-            gil_switch_number == saved_switchnum) {
-            SET_GIL_DROP_REQUEST();
+
+    gil_stats.contended++;
+    start = gil_clock();
+    if (priority) {
+        gil_stats.priority_acquisitions++;
+        gil_prio_waiters++;
+        while (_Py_atomic_load_relaxed(&gil_locked)) {
+            unsigned long saved_switchnum;
+
+            saved_switchnum = gil_switch_number;
+            COND_TIMED_WAIT(gil_prio_cond, gil_mutex, PRIORITY_INTERVAL,
+                            timed_out);
+            /* Same as below, after a shorter delay */
+            if (timed_out &&
+                _Py_atomic_load_relaxed(&gil_locked) &&
+                gil_switch_number == saved_switchnum) {
+                gil_stats.drop_requests++;
+                SET_GIL_DROP_REQUEST();
+            }
+        }
+        gil_prio_waiters--;
+    }
+    else {
+        /* Let priority waiters go first, for an interval at most. */
+        while (_Py_atomic_load_relaxed(&gil_locked) ||
+               (gil_prio_waiters > 0 && !timed_out)) {
+            unsigned long saved_switchnum;
+
+            saved_switchnum = gil_switch_number;
+            COND_TIMED_WAIT(gil_cond, gil_mutex, INTERVAL, timed_out);
+            /* If we timed out and no switch occurred in the meantime, it is
+               time to ask the GIL-holding thread to drop it. */
+            if (timed_out &&
+                _Py_atomic_load_relaxed(&gil_locked) &&
+                gil_switch_number == saved_switchnum) {
+                gil_stats.drop_requests++;
+                SET_GIL_DROP_REQUEST();
+            }
         }
     }
+    record_gil_wait(gil_clock() - start);
 _ready:
 #ifdef FORCE_SWITCHING
     /* This mutex must be taken before modifying gil_last_holder (see drop_gil()). */
@@ -243,6 +355,8 @@ _ready:
         _Py_atomic_store_relaxed(&gil_last_holder, tstate);
         ++gil_switch_number;
     }
+    tstate->gil_acquisitions++;
+    gil_taken_time = gil_clock();
 
 #ifdef FORCE_SWITCHING
     COND_SIGNAL(switch_cond);
@@ -268,3 +382,26 @@ unsigned long _PyEval_GetSwitchInterval()
 {
     return gil_interval;
 }
+
+void _PyEval_SetSwitchPriority(unsigned long microseconds)
+{
+    gil_priority_interval = microseconds;
+}
+
+unsigned long _PyEval_GetSwitchPriority(void)
+{
+    return gil_priority_interval;
+}
+
+void _PyEval_GetGILStats(_PyEval_GILStats *stats)
+{
+    int created = gil_created();
+
+    if (created)
+        MUTEX_LOCK(gil_mutex);
+    *stats = gil_stats;
+    stats->switches = gil_switch_number;
+    memcpy(stats->wait_bounds, gil_wait_bounds, sizeof(gil_wait_bounds));
+    if (created)
+        MUTEX_UNLOCK(gil_mutex);
+}
@@ -1018,6 +1018,10 @@ PyCompile_OpcodeStackEffect(int opcode, int oparg)
 #define NARGS(o) (((o) % 256) + 2*(((o) / 256) % 256))
         case CALL_FUNCTION:
             return -NARGS(oparg);
+        case LOAD_METHOD:
+            return 1;
+        case CALL_METHOD:
+            return -oparg-1;
         case CALL_FUNCTION_VAR:
         case CALL_FUNCTION_KW:
             return -NARGS(oparg)-1;
@@ -2972,9 +2976,38 @@ compiler_compare(struct compiler *c, expr_ty e)
     return 1;
 }
 
+/* Compile obj.meth(args) as LOAD_METHOD/CALL_METHOD, which avoids
+   creating a bound method.  Return -1 if the call has another form. */
+static int
+maybe_optimize_method_call(struct compiler *c, expr_ty e)
+{
+    Py_ssize_t argsl;
+    expr_ty meth = e->v.Call.func;
+    asdl_seq *args = e->v.Call.args;
+
+    /* Only plain positional arguments are supported; the extra self
+       argument must still fit in the low byte of the oparg. */
+    if (meth->kind != Attribute_kind || meth->v.Attribute.ctx != Load ||
+        asdl_seq_LEN(e->v.Call.keywords) || e->v.Call.starargs ||
+        e->v.Call.kwargs)
+        return -1;
+    argsl = asdl_seq_LEN(args);
+    if (argsl >= 255)
+        return -1;
+
+    VISIT(c, expr, meth->v.Attribute.value);
+    ADDOP_NAME(c, LOAD_METHOD, meth->v.Attribute.attr, names);
+    VISIT_SEQ(c, expr, args);
+    ADDOP_I(c, CALL_METHOD, argsl);
+    return 1;
+}
+
 static int
 compiler_call(struct compiler *c, expr_ty e)
 {
+    int ret = maybe_optimize_method_call(c, e);
+    if (ret >= 0)
+        return ret;
     VISIT(c, expr, e->v.Call.func);
     return compiler_call_helper(c, 0,
                                 e->v.Call.args,
@@ -21,9 +21,9 @@ const unsigned char _Py_M__importlib[] = {
     90,23,0,71,100,37,0,100,38,0,132,0,0,100,38,0,
     131,2,0,90,24,0,100,39,0,100,40,0,132,0,0,90,
     25,0,100,41,0,100,42,0,132,0,0,90,26,0,100,43,
-    0,100,44,0,132,0,0,90,27,0,100,45,0,106,28,0,
-    100,46,0,100,47,0,131,2,0,100,48,0,23,90,29,0,
-    101,30,0,106,31,0,101,29,0,100,47,0,131,2,0,90,
+    0,100,44,0,132,0,0,90,27,0,100,45,0,160,28,0,
+    100,46,0,100,47,0,161,2,0,100,48,0,23,90,29,0,
+    101,30,0,160,31,0,101,29,0,100,47,0,161,2,0,90,
     32,0,100,49,0,90,33,0,100,50,0,103,1,0,90,34,
     0,100,51,0,103,1,0,90,35,0,100,52,0,103,1,0,
     90,36,0,100,53,0,100,54,0,100,55,0,132,1,0,90,
@@ -101,9 +101,9 @@ const unsigned char _Py_M__importlib[] = {
     105,110,103,32,118,101,114,115,105,111,110,32,111,102,32,116,
     104,105,115,32,109,111,100,117,108,101,46,10,10,218,3,119,
     105,110,218,6,99,121,103,119,105,110,218,6,100,97,114,119,
-    105,110,99,0,0,0,0,0,0,0,0,1,0,0,0,2,
+    105,110,99,0,0,0,0,0,0,0,0,1,0,0,0,3,
     0,0,0,67,0,0,0,115,49,0,0,0,116,0,0,106,
-    1,0,106,2,0,116,3,0,131,1,0,114,33,0,100,1,
+    1,0,160,2,0,116,3,0,161,1,0,114,33,0,100,1,
     0,100,2,0,132,0,0,125,0,0,110,12,0,100,3,0,
     100,2,0,132,0,0,125,0,0,124,0,0,83,41,4,78,
     99,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
@@ -137,9 +137,9 @@ const unsigned char _Py_M__importlib[] = {
     97,107,101,95,114,101,108,97,120,95,99,97,115,101,28,0,
     0,0,115,8,0,0,0,0,1,18,1,15,4,12,3,114,
     11,0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,
-    0,3,0,0,0,67,0,0,0,115,26,0,0,0,116,0,
-    0,124,0,0,131,1,0,100,1,0,64,106,1,0,100,2,
-    0,100,3,0,131,2,0,83,41,4,122,42,67,111,110,118,
+    0,4,0,0,0,67,0,0,0,115,26,0,0,0,116,0,
+    0,124,0,0,131,1,0,100,1,0,64,160,1,0,100,2,
+    0,100,3,0,161,2,0,83,41,4,122,42,67,111,110,118,
     101,114,116,32,97,32,51,50,45,98,105,116,32,105,110,116,
     101,103,101,114,32,116,111,32,108,105,116,116,108,101,45,101,
     110,100,105,97,110,46,108,3,0,0,0,255,127,255,127,3,
@@ -148,9 +148,9 @@ const unsigned char _Py_M__importlib[] = {
     1,218,1,120,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,7,95,119,95,108,111,110,103,40,0,0,0,
     115,2,0,0,0,0,2,114,17,0,0,0,99,1,0,0,
-    0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,
-    0,115,16,0,0,0,116,0,0,106,1,0,124,0,0,100,
-    1,0,131,2,0,83,41,2,122,47,67,111,110,118,101,114,
+    0,0,0,0,0,1,0,0,0,4,0,0,0,67,0,0,
+    0,115,16,0,0,0,116,0,0,160,1,0,124,0,0,100,
+    1,0,161,2,0,83,41,2,122,47,67,111,110,118,101,114,
     116,32,52,32,98,121,116,101,115,32,105,110,32,108,105,116,
     116,108,101,45,101,110,100,105,97,110,32,116,111,32,97,110,
     32,105,110,116,101,103,101,114,46,114,13,0,0,0,41,2,
@@ -159,15 +159,15 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,4,0,0,0,114,5,0,0,0,218,7,95,
     114,95,108,111,110,103,45,0,0,0,115,2,0,0,0,0,
     2,114,19,0,0,0,99,0,0,0,0,0,0,0,0,1,
-    0,0,0,3,0,0,0,71,0,0,0,115,26,0,0,0,
-    116,0,0,106,1,0,100,1,0,100,2,0,132,0,0,124,
-    0,0,68,131,1,0,131,1,0,83,41,3,122,31,82,101,
+    0,0,0,4,0,0,0,71,0,0,0,115,26,0,0,0,
+    116,0,0,160,1,0,100,1,0,100,2,0,132,0,0,124,
+    0,0,68,131,1,0,161,1,0,83,41,3,122,31,82,101,
     112,108,97,99,101,109,101,110,116,32,102,111,114,32,111,115,
     46,112,97,116,104,46,106,111,105,110,40,41,46,99,1,0,
-    0,0,0,0,0,0,2,0,0,0,4,0,0,0,83,0,
+    0,0,0,0,0,0,2,0,0,0,5,0,0,0,83,0,
     0,0,115,37,0,0,0,103,0,0,124,0,0,93,27,0,
-    125,1,0,124,1,0,114,6,0,124,1,0,106,0,0,116,
-    1,0,131,1,0,145,2,0,113,6,0,83,114,4,0,0,
+    125,1,0,124,1,0,114,6,0,124,1,0,160,0,0,116,
+    1,0,161,1,0,145,2,0,113,6,0,83,114,4,0,0,
     0,41,2,218,6,114,115,116,114,105,112,218,15,112,97,116,
     104,95,115,101,112,97,114,97,116,111,114,115,41,2,218,2,
     46,48,218,4,112,97,114,116,114,4,0,0,0,114,4,0,
@@ -182,8 +182,8 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,2,15,1,114,28,0,0,0,99,1,0,0,0,
     0,0,0,0,5,0,0,0,5,0,0,0,67,0,0,0,
     115,134,0,0,0,116,0,0,116,1,0,131,1,0,100,1,
-    0,107,2,0,114,52,0,124,0,0,106,2,0,116,3,0,
-    131,1,0,92,3,0,125,1,0,125,2,0,125,3,0,124,
+    0,107,2,0,114,52,0,124,0,0,160,2,0,116,3,0,
+    161,1,0,92,3,0,125,1,0,125,2,0,125,3,0,124,
     1,0,124,3,0,102,2,0,83,120,69,0,116,4,0,124,
     0,0,131,1,0,68,93,55,0,125,4,0,124,4,0,116,
     1,0,107,6,0,114,65,0,124,0,0,106,5,0,124,4,
@@ -202,8 +202,8 @@ const unsigned char _Py_M__importlib[] = {
     116,104,95,115,112,108,105,116,56,0,0,0,115,16,0,0,
     0,0,2,18,1,24,1,10,1,19,1,12,1,27,1,14,
     1,114,38,0,0,0,99,1,0,0,0,0,0,0,0,1,
-    0,0,0,2,0,0,0,67,0,0,0,115,13,0,0,0,
-    116,0,0,106,1,0,124,0,0,131,1,0,83,41,1,122,
+    0,0,0,3,0,0,0,67,0,0,0,115,13,0,0,0,
+    116,0,0,160,1,0,124,0,0,161,1,0,83,41,1,122,
     126,83,116,97,116,32,116,104,101,32,112,97,116,104,46,10,
     10,32,32,32,32,77,97,100,101,32,97,32,115,101,112,97,
     114,97,116,101,32,102,117,110,99,116,105,111,110,32,116,111,
@@ -242,7 +242,7 @@ const unsigned char _Py_M__importlib[] = {
     105,108,101,87,0,0,0,115,2,0,0,0,0,2,114,44,
     0,0,0,99,1,0,0,0,0,0,0,0,1,0,0,0,
     3,0,0,0,67,0,0,0,115,34,0,0,0,124,0,0,
-    115,21,0,116,0,0,106,1,0,131,0,0,125,0,0,110,
+    115,21,0,116,0,0,160,1,0,161,0,0,125,0,0,110,
     0,0,116,2,0,124,0,0,100,1,0,131,2,0,83,41,
     2,122,30,82,101,112,108,97,99,101,109,101,110,116,32,102,
     111,114,32,111,115,46,112,97,116,104,46,105,115,100,105,114,
@@ -253,16 +253,16 @@ const unsigned char _Py_M__importlib[] = {
     0,115,6,0,0,0,0,2,6,1,15,1,114,46,0,0,
     0,105,182,1,0,0,99,3,0,0,0,0,0,0,0,6,
     0,0,0,17,0,0,0,67,0,0,0,115,192,0,0,0,
-    100,1,0,106,0,0,124,0,0,116,1,0,124,0,0,131,
-    1,0,131,2,0,125,3,0,116,2,0,106,3,0,124,3,
+    100,1,0,160,0,0,124,0,0,116,1,0,124,0,0,131,
+    1,0,161,2,0,125,3,0,116,2,0,160,3,0,124,3,
     0,116,2,0,106,4,0,116,2,0,106,5,0,66,116,2,
-    0,106,6,0,66,124,2,0,100,2,0,64,131,3,0,125,
-    4,0,121,60,0,116,7,0,106,8,0,124,4,0,100,3,
-    0,131,2,0,143,20,0,125,5,0,124,5,0,106,9,0,
-    124,1,0,131,1,0,1,87,100,4,0,81,88,116,2,0,
-    106,10,0,124,3,0,124,0,0,131,2,0,1,87,110,59,
+    0,106,6,0,66,124,2,0,100,2,0,64,161,3,0,125,
+    4,0,121,60,0,116,7,0,160,8,0,124,4,0,100,3,
+    0,161,2,0,143,20,0,125,5,0,124,5,0,160,9,0,
+    124,1,0,161,1,0,1,87,100,4,0,81,88,116,2,0,
+    160,10,0,124,3,0,124,0,0,161,2,0,1,87,110,59,
     0,4,116,11,0,107,10,0,114,187,0,1,1,1,121,17,
-    0,116,2,0,106,12,0,124,3,0,131,1,0,1,87,110,
+    0,116,2,0,160,12,0,124,3,0,161,1,0,1,87,110,
     18,0,4,116,11,0,107,10,0,114,179,0,1,1,1,89,
     110,1,0,88,130,0,0,89,110,1,0,88,100,4,0,83,
     41,5,122,162,66,101,115,116,45,101,102,102,111,114,116,32,
@@ -295,8 +295,8 @@ const unsigned char _Py_M__importlib[] = {
     0,125,2,0,116,0,0,124,1,0,124,2,0,131,2,0,
     114,19,0,116,1,0,124,0,0,124,2,0,116,2,0,124,
     1,0,124,2,0,131,2,0,131,3,0,1,113,19,0,113,
-    19,0,87,124,0,0,106,3,0,106,4,0,124,1,0,106,
-    3,0,131,1,0,1,100,5,0,83,41,6,122,47,83,105,
+    19,0,87,124,0,0,106,3,0,160,4,0,124,1,0,106,
+    3,0,161,1,0,1,100,5,0,83,41,6,122,47,83,105,
     109,112,108,101,32,115,117,98,115,116,105,116,117,116,101,32,
     102,111,114,32,102,117,110,99,116,111,111,108,115,46,117,112,
     100,97,116,101,95,119,114,97,112,112,101,114,46,218,10,95,
@@ -400,9 +400,9 @@ const unsigned char _Py_M__importlib[] = {
     116,111,10,32,32,32,32,116,97,107,101,32,108,111,99,107,
     115,32,66,32,116,104,101,110,32,65,41,46,10,32,32,32,
     32,99,2,0,0,0,0,0,0,0,2,0,0,0,2,0,
-    0,0,67,0,0,0,115,70,0,0,0,116,0,0,106,1,
-    0,131,0,0,124,0,0,95,2,0,116,0,0,106,1,0,
-    131,0,0,124,0,0,95,3,0,124,1,0,124,0,0,95,
+    0,0,67,0,0,0,115,70,0,0,0,116,0,0,160,1,
+    0,161,0,0,124,0,0,95,2,0,116,0,0,160,1,0,
+    161,0,0,124,0,0,95,3,0,124,1,0,124,0,0,95,
     4,0,100,0,0,124,0,0,95,5,0,100,1,0,124,0,
     0,95,6,0,100,1,0,124,0,0,95,7,0,100,0,0,
     83,41,2,78,233,0,0,0,0,41,8,218,7,95,116,104,
@@ -415,10 +415,10 @@ const unsigned char _Py_M__importlib[] = {
     0,115,12,0,0,0,0,1,15,1,15,1,9,1,9,1,
     9,1,122,20,95,77,111,100,117,108,101,76,111,99,107,46,
     95,95,105,110,105,116,95,95,99,1,0,0,0,0,0,0,
-    0,4,0,0,0,2,0,0,0,67,0,0,0,115,87,0,
-    0,0,116,0,0,106,1,0,131,0,0,125,1,0,124,0,
-    0,106,2,0,125,2,0,120,59,0,116,3,0,106,4,0,
-    124,2,0,131,1,0,125,3,0,124,3,0,100,0,0,107,
+    0,4,0,0,0,3,0,0,0,67,0,0,0,115,87,0,
+    0,0,116,0,0,160,1,0,161,0,0,125,1,0,124,0,
+    0,106,2,0,125,2,0,120,59,0,116,3,0,160,4,0,
+    124,2,0,161,1,0,125,3,0,124,3,0,100,0,0,107,
     8,0,114,55,0,100,1,0,83,124,3,0,106,2,0,125,
     2,0,124,2,0,124,1,0,107,2,0,114,24,0,100,2,
     0,83,113,24,0,100,0,0,83,41,3,78,70,84,41,5,
@@ -432,19 +432,19 @@ const unsigned char _Py_M__importlib[] = {
     1,9,1,12,1,122,24,95,77,111,100,117,108,101,76,111,
     99,107,46,104,97,115,95,100,101,97,100,108,111,99,107,99,
     1,0,0,0,0,0,0,0,2,0,0,0,17,0,0,0,
-    67,0,0,0,115,214,0,0,0,116,0,0,106,1,0,131,
+    67,0,0,0,115,214,0,0,0,116,0,0,160,1,0,161,
     0,0,125,1,0,124,0,0,116,2,0,124,1,0,60,122,
     177,0,120,170,0,124,0,0,106,3,0,143,130,0,1,124,
     0,0,106,4,0,100,1,0,107,2,0,115,68,0,124,0,
     0,106,5,0,124,1,0,107,2,0,114,96,0,124,1,0,
     124,0,0,95,5,0,124,0,0,4,106,4,0,100,2,0,
-    55,2,95,4,0,100,3,0,83,124,0,0,106,6,0,131,
+    55,2,95,4,0,100,3,0,83,124,0,0,160,6,0,161,
     0,0,114,127,0,116,7,0,100,4,0,124,0,0,22,131,
-    1,0,130,1,0,110,0,0,124,0,0,106,8,0,106,9,
-    0,100,5,0,131,1,0,114,163,0,124,0,0,4,106,10,
+    1,0,130,1,0,110,0,0,124,0,0,106,8,0,160,9,
+    0,100,5,0,161,1,0,114,163,0,124,0,0,4,106,10,
     0,100,2,0,55,2,95,10,0,110,0,0,87,100,6,0,
-    81,88,124,0,0,106,8,0,106,9,0,131,0,0,1,124,
-    0,0,106,8,0,106,11,0,131,0,0,1,113,28,0,87,
+    81,88,124,0,0,106,8,0,160,9,0,161,0,0,1,124,
+    0,0,106,8,0,160,11,0,161,0,0,1,113,28,0,87,
     100,6,0,116,2,0,124,1,0,61,88,100,6,0,83,41,
     7,122,185,10,32,32,32,32,32,32,32,32,65,99,113,117,
     105,114,101,32,116,104,101,32,109,111,100,117,108,101,32,108,
@@ -472,7 +472,7 @@ const unsigned char _Py_M__importlib[] = {
     2,122,19,95,77,111,100,117,108,101,76,111,99,107,46,97,
     99,113,117,105,114,101,99,1,0,0,0,0,0,0,0,2,
     0,0,0,10,0,0,0,67,0,0,0,115,165,0,0,0,
-    116,0,0,106,1,0,131,0,0,125,1,0,124,0,0,106,
+    116,0,0,160,1,0,161,0,0,125,1,0,124,0,0,106,
     2,0,143,138,0,1,124,0,0,106,3,0,124,1,0,107,
     3,0,114,52,0,116,4,0,100,1,0,131,1,0,130,1,
     0,110,0,0,124,0,0,106,5,0,100,2,0,107,4,0,
@@ -480,8 +480,8 @@ const unsigned char _Py_M__importlib[] = {
     100,3,0,56,2,95,5,0,124,0,0,106,5,0,100,2,
     0,107,2,0,114,155,0,100,0,0,124,0,0,95,3,0,
     124,0,0,106,7,0,114,155,0,124,0,0,4,106,7,0,
-    100,3,0,56,2,95,7,0,124,0,0,106,8,0,106,9,
-    0,131,0,0,1,113,155,0,110,0,0,87,100,0,0,81,
+    100,3,0,56,2,95,7,0,124,0,0,106,8,0,160,9,
+    0,161,0,0,1,113,155,0,110,0,0,87,100,0,0,81,
     88,100,0,0,83,41,4,78,122,31,99,97,110,110,111,116,
     32,114,101,108,101,97,115,101,32,117,110,45,97,99,113,117,
     105,114,101,100,32,108,111,99,107,114,84,0,0,0,114,29,
@@ -495,9 +495,9 @@ const unsigned char _Py_M__importlib[] = {
     22,0,0,0,0,1,12,1,10,1,15,1,15,1,21,1,
     15,1,15,1,9,1,9,1,15,1,122,19,95,77,111,100,
     117,108,101,76,111,99,107,46,114,101,108,101,97,115,101,99,
-    1,0,0,0,0,0,0,0,1,0,0,0,4,0,0,0,
-    67,0,0,0,115,25,0,0,0,100,1,0,106,0,0,124,
-    0,0,106,1,0,116,2,0,124,0,0,131,1,0,131,2,
+    1,0,0,0,0,0,0,0,1,0,0,0,5,0,0,0,
+    67,0,0,0,115,25,0,0,0,100,1,0,160,0,0,124,
+    0,0,106,1,0,116,2,0,124,0,0,131,1,0,161,2,
     0,83,41,2,78,122,23,95,77,111,100,117,108,101,76,111,
     99,107,40,123,33,114,125,41,32,97,116,32,123,125,41,3,
     114,47,0,0,0,114,67,0,0,0,114,48,0,0,0,41,
@@ -554,9 +554,9 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,1,15,1,15,1,122,24,95,68,117,109,109,
     121,77,111,100,117,108,101,76,111,99,107,46,114,101,108,101,
     97,115,101,99,1,0,0,0,0,0,0,0,1,0,0,0,
-    4,0,0,0,67,0,0,0,115,25,0,0,0,100,1,0,
-    106,0,0,124,0,0,106,1,0,116,2,0,124,0,0,131,
-    1,0,131,2,0,83,41,2,78,122,28,95,68,117,109,109,
+    5,0,0,0,67,0,0,0,115,25,0,0,0,100,1,0,
+    160,0,0,124,0,0,106,1,0,116,2,0,124,0,0,131,
+    1,0,161,2,0,83,41,2,78,122,28,95,68,117,109,109,
     121,77,111,100,117,108,101,76,111,99,107,40,123,33,114,125,
     41,32,97,116,32,123,125,41,3,114,47,0,0,0,114,67,
     0,0,0,114,48,0,0,0,41,1,114,71,0,0,0,114,
@@ -585,10 +585,10 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,0,1,9,1,122,27,95,77,111,100,117,108,101,
     76,111,99,107,77,97,110,97,103,101,114,46,95,95,105,110,
     105,116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,
-    0,10,0,0,0,67,0,0,0,115,53,0,0,0,122,22,
+    0,11,0,0,0,67,0,0,0,115,53,0,0,0,122,22,
     0,116,0,0,124,0,0,106,1,0,131,1,0,124,0,0,
-    95,2,0,87,100,0,0,116,3,0,106,4,0,131,0,0,
-    1,88,124,0,0,106,2,0,106,5,0,131,0,0,1,100,
+    95,2,0,87,100,0,0,116,3,0,160,4,0,161,0,0,
+    1,88,124,0,0,106,2,0,160,5,0,161,0,0,1,100,
     0,0,83,41,1,78,41,6,218,16,95,103,101,116,95,109,
     111,100,117,108,101,95,108,111,99,107,114,70,0,0,0,114,
     104,0,0,0,218,4,95,105,109,112,218,12,114,101,108,101,
@@ -598,8 +598,8 @@ const unsigned char _Py_M__importlib[] = {
     0,0,1,3,1,22,2,11,1,122,28,95,77,111,100,117,
     108,101,76,111,99,107,77,97,110,97,103,101,114,46,95,95,
     101,110,116,101,114,95,95,99,1,0,0,0,0,0,0,0,
-    3,0,0,0,1,0,0,0,79,0,0,0,115,17,0,0,
-    0,124,0,0,106,0,0,106,1,0,131,0,0,1,100,0,
+    3,0,0,0,2,0,0,0,79,0,0,0,115,17,0,0,
+    0,124,0,0,106,0,0,160,1,0,161,0,0,1,100,0,
     0,83,41,1,78,41,2,114,104,0,0,0,114,98,0,0,
     0,41,3,114,71,0,0,0,114,80,0,0,0,218,6,107,
     119,97,114,103,115,114,4,0,0,0,114,4,0,0,0,114,
@@ -611,7 +611,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,4,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,114,103,0,0,0,255,0,0,0,115,
     6,0,0,0,12,2,12,4,12,7,114,103,0,0,0,99,
-    1,0,0,0,0,0,0,0,3,0,0,0,11,0,0,0,
+    1,0,0,0,0,0,0,0,3,0,0,0,12,0,0,0,
     3,0,0,0,115,142,0,0,0,100,1,0,125,1,0,121,
     17,0,116,0,0,136,0,0,25,131,0,0,125,1,0,87,
     110,18,0,4,116,1,0,107,10,0,114,43,0,1,1,1,
@@ -619,8 +619,8 @@ const unsigned char _Py_M__importlib[] = {
     0,116,2,0,100,1,0,107,8,0,114,83,0,116,3,0,
     136,0,0,131,1,0,125,1,0,110,12,0,116,4,0,136,
     0,0,131,1,0,125,1,0,135,0,0,102,1,0,100,2,
-    0,100,3,0,134,0,0,125,2,0,116,5,0,106,6,0,
-    124,1,0,124,2,0,131,2,0,116,0,0,136,0,0,60,
+    0,100,3,0,134,0,0,125,2,0,116,5,0,160,6,0,
+    124,1,0,124,2,0,161,2,0,116,0,0,136,0,0,60,
     110,0,0,124,1,0,83,41,4,122,109,71,101,116,32,111,
     114,32,99,114,101,97,116,101,32,116,104,101,32,109,111,100,
     117,108,101,32,108,111,99,107,32,102,111,114,32,97,32,103,
@@ -646,10 +646,10 @@ const unsigned char _Py_M__importlib[] = {
     1,15,2,12,1,18,2,25,1,114,105,0,0,0,99,1,
     0,0,0,0,0,0,0,2,0,0,0,11,0,0,0,67,
     0,0,0,115,71,0,0,0,116,0,0,124,0,0,131,1,
-    0,125,1,0,116,1,0,106,2,0,131,0,0,1,121,14,
-    0,124,1,0,106,3,0,131,0,0,1,87,110,18,0,4,
+    0,125,1,0,116,1,0,160,2,0,161,0,0,1,121,14,
+    0,124,1,0,160,3,0,161,0,0,1,87,110,18,0,4,
     116,4,0,107,10,0,114,56,0,1,1,1,89,110,11,0,
-    88,124,1,0,106,5,0,131,0,0,1,100,1,0,83,41,
+    88,124,1,0,160,5,0,161,0,0,1,100,1,0,83,41,
     2,97,21,1,0,0,82,101,108,101,97,115,101,32,116,104,
     101,32,103,108,111,98,97,108,32,105,109,112,111,114,116,32,
     108,111,99,107,44,32,97,110,100,32,97,99,113,117,105,114,
@@ -701,22 +701,22 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,5,0,0,0,218,25,95,99,97,108,108,95,
     119,105,116,104,95,102,114,97,109,101,115,95,114,101,109,111,
     118,101,100,57,1,0,0,115,2,0,0,0,0,8,114,114,
-    0,0,0,105,228,12,0,0,233,2,0,0,0,114,13,0,
+    0,0,0,105,238,12,0,0,233,2,0,0,0,114,13,0,
     0,0,115,2,0,0,0,13,10,90,11,95,95,112,121,99,
     97,99,104,101,95,95,122,3,46,112,121,122,4,46,112,121,
     99,122,4,46,112,121,111,78,99,2,0,0,0,0,0,0,
-    0,11,0,0,0,6,0,0,0,67,0,0,0,115,180,0,
+    0,11,0,0,0,7,0,0,0,67,0,0,0,115,180,0,
     0,0,124,1,0,100,1,0,107,8,0,114,25,0,116,0,
     0,106,1,0,106,2,0,12,110,3,0,124,1,0,125,2,
     0,124,2,0,114,46,0,116,3,0,125,3,0,110,6,0,
     116,4,0,125,3,0,116,5,0,124,0,0,131,1,0,92,
-    2,0,125,4,0,125,5,0,124,5,0,106,6,0,100,2,
-    0,131,1,0,92,3,0,125,6,0,125,7,0,125,8,0,
+    2,0,125,4,0,125,5,0,124,5,0,160,6,0,100,2,
+    0,161,1,0,92,3,0,125,6,0,125,7,0,125,8,0,
     116,0,0,106,7,0,106,8,0,125,9,0,124,9,0,100,
     1,0,107,8,0,114,133,0,116,9,0,100,3,0,131,1,
-    0,130,1,0,110,0,0,100,4,0,106,10,0,124,6,0,
+    0,130,1,0,110,0,0,100,4,0,160,10,0,124,6,0,
     124,7,0,124,9,0,124,3,0,100,5,0,25,103,4,0,
-    131,1,0,125,10,0,116,11,0,124,4,0,116,12,0,124,
+    161,1,0,125,10,0,116,11,0,124,4,0,116,12,0,124,
     10,0,131,3,0,83,41,6,97,244,1,0,0,71,105,118,
     101,110,32,116,104,101,32,112,97,116,104,32,116,111,32,97,
     32,46,112,121,32,102,105,108,101,44,32,114,101,116,117,114,
@@ -770,7 +770,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,90,3,116,97,103,218,8,102,105,108,101,110,97,
     109,101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
     0,218,17,99,97,99,104,101,95,102,114,111,109,95,115,111,
-    117,114,99,101,180,1,0,0,115,22,0,0,0,0,13,31,
+    117,114,99,101,181,1,0,0,115,22,0,0,0,0,13,31,
     1,6,1,9,2,6,1,18,1,24,1,12,1,12,1,15,
     1,31,1,114,132,0,0,0,99,1,0,0,0,0,0,0,
     0,5,0,0,0,5,0,0,0,67,0,0,0,115,193,0,
@@ -779,12 +779,12 @@ const unsigned char _Py_M__importlib[] = {
     110,0,0,116,4,0,124,0,0,131,1,0,92,2,0,125,
     1,0,125,2,0,116,4,0,124,1,0,131,1,0,92,2,
     0,125,1,0,125,3,0,124,3,0,116,5,0,107,3,0,
-    114,108,0,116,6,0,100,3,0,106,7,0,116,5,0,124,
-    0,0,131,2,0,131,1,0,130,1,0,110,0,0,124,2,
-    0,106,8,0,100,4,0,131,1,0,100,5,0,107,3,0,
-    114,153,0,116,6,0,100,6,0,106,7,0,124,2,0,131,
-    1,0,131,1,0,130,1,0,110,0,0,124,2,0,106,9,
-    0,100,4,0,131,1,0,100,7,0,25,125,4,0,116,10,
+    114,108,0,116,6,0,100,3,0,160,7,0,116,5,0,124,
+    0,0,161,2,0,131,1,0,130,1,0,110,0,0,124,2,
+    0,160,8,0,100,4,0,161,1,0,100,5,0,107,3,0,
+    114,153,0,116,6,0,100,6,0,160,7,0,124,2,0,161,
+    1,0,131,1,0,130,1,0,110,0,0,124,2,0,160,9,
+    0,100,4,0,161,1,0,100,7,0,25,125,4,0,116,10,
     0,124,1,0,124,4,0,116,11,0,100,7,0,25,23,131,
     2,0,83,41,8,97,121,1,0,0,71,105,118,101,110,32,
     116,104,101,32,112,97,116,104,32,116,111,32,97,32,46,112,
@@ -827,15 +827,15 @@ const unsigned char _Py_M__importlib[] = {
     97,99,104,101,95,102,105,108,101,110,97,109,101,90,7,112,
     121,99,97,99,104,101,114,129,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,17,115,111,117,114,
-    99,101,95,102,114,111,109,95,99,97,99,104,101,207,1,0,
+    99,101,95,102,114,111,109,95,99,97,99,104,101,208,1,0,
     0,115,24,0,0,0,0,9,18,1,15,1,18,1,18,1,
     12,1,3,1,24,1,21,1,3,1,21,1,19,1,114,135,
     0,0,0,99,1,0,0,0,0,0,0,0,5,0,0,0,
     13,0,0,0,67,0,0,0,115,164,0,0,0,116,0,0,
     124,0,0,131,1,0,100,1,0,107,2,0,114,22,0,100,
-    2,0,83,124,0,0,106,1,0,100,3,0,131,1,0,92,
+    2,0,83,124,0,0,160,1,0,100,3,0,161,1,0,92,
     3,0,125,1,0,125,2,0,125,3,0,124,1,0,12,115,
-    81,0,124,3,0,106,2,0,131,0,0,100,7,0,100,8,
+    81,0,124,3,0,160,2,0,161,0,0,100,7,0,100,8,
     0,133,2,0,25,100,6,0,107,3,0,114,85,0,124,0,
     0,83,121,16,0,116,3,0,124,0,0,131,1,0,125,4,
     0,87,110,40,0,4,116,4,0,116,5,0,102,2,0,107,
@@ -864,7 +864,7 @@ const unsigned char _Py_M__importlib[] = {
     116,101,110,115,105,111,110,218,11,115,111,117,114,99,101,95,
     112,97,116,104,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,15,95,103,101,116,95,115,111,117,114,99,101,
-    102,105,108,101,230,1,0,0,115,20,0,0,0,0,7,18,
+    102,105,108,101,231,1,0,0,115,20,0,0,0,0,7,18,
     1,4,1,24,1,35,1,4,1,3,1,16,1,19,1,21,
     1,114,142,0,0,0,99,1,0,0,0,0,0,0,0,2,
     0,0,0,11,0,0,0,67,0,0,0,115,60,0,0,0,
@@ -879,13 +879,13 @@ const unsigned char _Py_M__importlib[] = {
     39,0,0,0,114,41,0,0,0,114,40,0,0,0,41,2,
     114,35,0,0,0,114,42,0,0,0,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,10,95,99,97,108,99,
-    95,109,111,100,101,249,1,0,0,115,12,0,0,0,0,2,
+    95,109,111,100,101,250,1,0,0,115,12,0,0,0,0,2,
     3,1,19,1,13,1,11,3,10,1,114,144,0,0,0,218,
     9,118,101,114,98,111,115,105,116,121,114,29,0,0,0,99,
     1,0,0,0,1,0,0,0,3,0,0,0,4,0,0,0,
     71,0,0,0,115,81,0,0,0,116,0,0,106,1,0,106,
-    2,0,124,1,0,107,5,0,114,77,0,124,0,0,106,3,
-    0,100,6,0,131,1,0,115,46,0,100,3,0,124,0,0,
+    2,0,124,1,0,107,5,0,114,77,0,124,0,0,160,3,
+    0,100,6,0,161,1,0,115,46,0,100,3,0,124,0,0,
     23,125,0,0,110,0,0,116,4,0,124,0,0,106,5,0,
     124,2,0,140,0,0,100,4,0,116,0,0,106,6,0,131,
     1,1,1,110,0,0,100,5,0,83,41,7,122,61,80,114,
@@ -901,7 +901,7 @@ const unsigned char _Py_M__importlib[] = {
     101,115,115,97,103,101,114,145,0,0,0,114,80,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
     16,95,118,101,114,98,111,115,101,95,109,101,115,115,97,103,
-    101,5,2,0,0,115,8,0,0,0,0,2,18,1,15,1,
+    101,6,2,0,0,115,8,0,0,0,0,2,18,1,15,1,
     13,1,114,152,0,0,0,99,1,0,0,0,0,0,0,0,
     2,0,0,0,4,0,0,0,3,0,0,0,115,38,0,0,
     0,100,1,0,135,0,0,102,1,0,100,2,0,100,3,0,
@@ -936,14 +936,14 @@ const unsigned char _Py_M__importlib[] = {
     0,114,67,0,0,0,114,80,0,0,0,114,108,0,0,0,
     41,1,218,6,109,101,116,104,111,100,114,4,0,0,0,114,
     5,0,0,0,218,19,95,99,104,101,99,107,95,110,97,109,
-    101,95,119,114,97,112,112,101,114,21,2,0,0,115,10,0,
+    101,95,119,114,97,112,112,101,114,22,2,0,0,115,10,0,
     0,0,0,1,12,1,12,1,15,1,25,1,122,40,95,99,
     104,101,99,107,95,110,97,109,101,46,60,108,111,99,97,108,
     115,62,46,95,99,104,101,99,107,95,110,97,109,101,95,119,
     114,97,112,112,101,114,41,1,114,65,0,0,0,41,2,114,
     154,0,0,0,114,155,0,0,0,114,4,0,0,0,41,1,
     114,154,0,0,0,114,5,0,0,0,218,11,95,99,104,101,
-    99,107,95,110,97,109,101,13,2,0,0,115,6,0,0,0,
+    99,107,95,110,97,109,101,14,2,0,0,115,6,0,0,0,
     0,8,21,6,13,1,114,156,0,0,0,99,1,0,0,0,
     0,0,0,0,2,0,0,0,3,0,0,0,3,0,0,0,
     115,35,0,0,0,135,0,0,102,1,0,100,1,0,100,2,
@@ -954,8 +954,8 @@ const unsigned char _Py_M__importlib[] = {
     32,105,115,32,98,117,105,108,116,45,105,110,46,99,2,0,
     0,0,0,0,0,0,2,0,0,0,4,0,0,0,19,0,
     0,0,115,58,0,0,0,124,1,0,116,0,0,106,1,0,
-    107,7,0,114,45,0,116,2,0,100,1,0,106,3,0,124,
-    1,0,131,1,0,100,2,0,124,1,0,131,1,1,130,1,
+    107,7,0,114,45,0,116,2,0,100,1,0,160,3,0,124,
+    1,0,161,1,0,100,2,0,124,1,0,131,1,1,130,1,
     0,110,0,0,136,0,0,124,0,0,124,1,0,131,2,0,
     83,41,3,78,122,29,123,33,114,125,32,105,115,32,110,111,
     116,32,97,32,98,117,105,108,116,45,105,110,32,109,111,100,
@@ -965,7 +965,7 @@ const unsigned char _Py_M__importlib[] = {
     2,114,71,0,0,0,218,8,102,117,108,108,110,97,109,101,
     41,1,218,3,102,120,110,114,4,0,0,0,114,5,0,0,
     0,218,25,95,114,101,113,117,105,114,101,115,95,98,117,105,
-    108,116,105,110,95,119,114,97,112,112,101,114,33,2,0,0,
+    108,116,105,110,95,119,114,97,112,112,101,114,34,2,0,0,
     115,8,0,0,0,0,1,15,1,18,1,12,1,122,52,95,
     114,101,113,117,105,114,101,115,95,98,117,105,108,116,105,110,
     46,60,108,111,99,97,108,115,62,46,95,114,101,113,117,105,
@@ -973,7 +973,7 @@ const unsigned char _Py_M__importlib[] = {
     112,101,114,41,1,114,65,0,0,0,41,2,114,159,0,0,
     0,114,160,0,0,0,114,4,0,0,0,41,1,114,159,0,
     0,0,114,5,0,0,0,218,17,95,114,101,113,117,105,114,
-    101,115,95,98,117,105,108,116,105,110,31,2,0,0,115,6,
+    101,115,95,98,117,105,108,116,105,110,32,2,0,0,115,6,
     0,0,0,0,2,18,5,13,1,114,161,0,0,0,99,1,
     0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,3,
     0,0,0,115,35,0,0,0,135,0,0,102,1,0,100,1,
@@ -983,9 +983,9 @@ const unsigned char _Py_M__importlib[] = {
     102,121,32,116,104,101,32,110,97,109,101,100,32,109,111,100,
     117,108,101,32,105,115,32,102,114,111,122,101,110,46,99,2,
     0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,19,
-    0,0,0,115,58,0,0,0,116,0,0,106,1,0,124,1,
-    0,131,1,0,115,45,0,116,2,0,100,1,0,106,3,0,
-    124,1,0,131,1,0,100,2,0,124,1,0,131,1,1,130,
+    0,0,0,115,58,0,0,0,116,0,0,160,1,0,124,1,
+    0,161,1,0,115,45,0,116,2,0,100,1,0,160,3,0,
+    124,1,0,161,1,0,100,2,0,124,1,0,131,1,1,130,
     1,0,110,0,0,136,0,0,124,0,0,124,1,0,131,2,
     0,83,41,3,78,122,27,123,33,114,125,32,105,115,32,110,
     111,116,32,97,32,102,114,111,122,101,110,32,109,111,100,117,
@@ -994,7 +994,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,41,2,114,71,0,0,0,114,158,0,0,0,41,
     1,114,159,0,0,0,114,4,0,0,0,114,5,0,0,0,
     218,24,95,114,101,113,117,105,114,101,115,95,102,114,111,122,
-    101,110,95,119,114,97,112,112,101,114,44,2,0,0,115,8,
+    101,110,95,119,114,97,112,112,101,114,45,2,0,0,115,8,
     0,0,0,0,1,15,1,18,1,12,1,122,50,95,114,101,
     113,117,105,114,101,115,95,102,114,111,122,101,110,46,60,108,
     111,99,97,108,115,62,46,95,114,101,113,117,105,114,101,115,
@@ -1002,14 +1002,14 @@ const unsigned char _Py_M__importlib[] = {
     1,114,65,0,0,0,41,2,114,159,0,0,0,114,163,0,
     0,0,114,4,0,0,0,41,1,114,159,0,0,0,114,5,
     0,0,0,218,16,95,114,101,113,117,105,114,101,115,95,102,
-    114,111,122,101,110,42,2,0,0,115,6,0,0,0,0,2,
+    114,111,122,101,110,43,2,0,0,115,6,0,0,0,0,2,
     18,5,13,1,114,164,0,0,0,99,2,0,0,0,0,0,
-    0,0,5,0,0,0,5,0,0,0,67,0,0,0,115,87,
-    0,0,0,124,0,0,106,0,0,124,1,0,131,1,0,92,
+    0,0,5,0,0,0,7,0,0,0,67,0,0,0,115,87,
+    0,0,0,124,0,0,160,0,0,124,1,0,161,1,0,92,
     2,0,125,2,0,125,3,0,124,2,0,100,1,0,107,8,
     0,114,83,0,116,1,0,124,3,0,131,1,0,114,83,0,
-    100,2,0,125,4,0,116,2,0,106,3,0,124,4,0,106,
-    4,0,124,3,0,100,3,0,25,131,1,0,116,5,0,131,
+    100,2,0,125,4,0,116,2,0,160,3,0,124,4,0,160,
+    4,0,124,3,0,100,3,0,25,161,1,0,116,5,0,161,
     2,0,1,110,0,0,124,2,0,83,41,4,122,86,84,114,
     121,32,116,111,32,102,105,110,100,32,97,32,108,111,97,100,
     101,114,32,102,111,114,32,116,104,101,32,115,112,101,99,105,
@@ -1027,15 +1027,15 @@ const unsigned char _Py_M__importlib[] = {
     111,97,100,101,114,218,8,112,111,114,116,105,111,110,115,218,
     3,109,115,103,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,17,95,102,105,110,100,95,109,111,100,117,108,
-    101,95,115,104,105,109,53,2,0,0,115,10,0,0,0,0,
+    101,95,115,104,105,109,54,2,0,0,115,10,0,0,0,0,
     6,21,1,24,1,6,1,32,1,114,172,0,0,0,99,2,
     0,0,0,0,0,0,0,5,0,0,0,3,0,0,0,67,
     0,0,0,115,93,0,0,0,116,0,0,124,1,0,124,0,
     0,131,2,0,125,2,0,116,1,0,124,2,0,131,1,0,
     125,3,0,124,1,0,116,2,0,106,3,0,107,6,0,114,
     79,0,116,2,0,106,3,0,124,1,0,25,125,4,0,124,
-    3,0,106,4,0,124,4,0,131,1,0,1,116,2,0,106,
-    3,0,124,1,0,25,83,124,3,0,106,5,0,131,0,0,
+    3,0,160,4,0,124,4,0,161,1,0,1,116,2,0,106,
+    3,0,124,1,0,25,83,124,3,0,160,5,0,161,0,0,
     83,100,1,0,83,41,2,122,57,76,111,97,100,32,116,104,
     101,32,115,112,101,99,105,102,105,101,100,32,109,111,100,117,
     108,101,32,105,110,116,111,32,115,121,115,46,109,111,100,117,
@@ -1048,9 +1048,9 @@ const unsigned char _Py_M__importlib[] = {
     101,116,104,111,100,115,218,6,109,111,100,117,108,101,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,218,17,95,
     108,111,97,100,95,109,111,100,117,108,101,95,115,104,105,109,
-    66,2,0,0,115,14,0,0,0,0,3,15,1,12,1,15,
+    67,2,0,0,115,14,0,0,0,0,3,15,1,12,1,15,
     1,13,1,13,1,11,2,114,180,0,0,0,99,4,0,0,
-    0,0,0,0,0,11,0,0,0,19,0,0,0,67,0,0,
+    0,0,0,0,0,11,0,0,0,20,0,0,0,67,0,0,
     0,115,243,1,0,0,105,0,0,125,4,0,124,2,0,100,
     1,0,107,9,0,114,31,0,124,2,0,124,4,0,100,2,
     0,60,110,6,0,100,3,0,125,2,0,124,3,0,100,1,
@@ -1059,28 +1059,28 @@ const unsigned char _Py_M__importlib[] = {
     25,125,5,0,124,0,0,100,5,0,100,6,0,133,2,0,
     25,125,6,0,124,0,0,100,6,0,100,7,0,133,2,0,
     25,125,7,0,124,5,0,116,0,0,107,3,0,114,168,0,
-    100,8,0,106,1,0,124,2,0,124,5,0,131,2,0,125,
+    100,8,0,160,1,0,124,2,0,124,5,0,161,2,0,125,
     8,0,116,2,0,124,8,0,131,1,0,1,116,3,0,124,
     8,0,124,4,0,141,1,0,130,1,0,110,116,0,116,4,
     0,124,6,0,131,1,0,100,5,0,107,3,0,114,226,0,
-    100,9,0,106,1,0,124,2,0,131,1,0,125,8,0,116,
+    100,9,0,160,1,0,124,2,0,161,1,0,125,8,0,116,
     2,0,124,8,0,131,1,0,1,116,5,0,124,8,0,131,
     1,0,130,1,0,110,58,0,116,4,0,124,7,0,131,1,
-    0,100,5,0,107,3,0,114,28,1,100,10,0,106,1,0,
-    124,2,0,131,1,0,125,8,0,116,2,0,124,8,0,131,
+    0,100,5,0,107,3,0,114,28,1,100,10,0,160,1,0,
+    124,2,0,161,1,0,125,8,0,116,2,0,124,8,0,131,
     1,0,1,116,5,0,124,8,0,131,1,0,130,1,0,110,
     0,0,124,1,0,100,1,0,107,9,0,114,229,1,121,20,
     0,116,6,0,124,1,0,100,11,0,25,131,1,0,125,9,
     0,87,110,18,0,4,116,7,0,107,10,0,114,80,1,1,
     1,1,89,110,62,0,88,116,8,0,124,6,0,131,1,0,
-    124,9,0,107,3,0,114,142,1,100,12,0,106,1,0,124,
-    2,0,131,1,0,125,8,0,116,2,0,124,8,0,131,1,
+    124,9,0,107,3,0,114,142,1,100,12,0,160,1,0,124,
+    2,0,161,1,0,125,8,0,116,2,0,124,8,0,131,1,
     0,1,116,3,0,124,8,0,124,4,0,141,1,0,130,1,
     0,110,0,0,121,18,0,124,1,0,100,13,0,25,100,14,
     0,64,125,10,0,87,110,18,0,4,116,7,0,107,10,0,
     114,180,1,1,1,1,89,113,229,1,88,116,8,0,124,7,
     0,131,1,0,124,10,0,107,3,0,114,229,1,116,3,0,
-    100,12,0,106,1,0,124,2,0,131,1,0,124,4,0,141,
+    100,12,0,160,1,0,124,2,0,161,1,0,124,4,0,141,
     1,0,130,1,0,113,229,1,110,0,0,124,0,0,100,7,
     0,100,1,0,133,2,0,25,83,41,15,97,122,1,0,0,
     86,97,108,105,100,97,116,101,32,116,104,101,32,104,101,97,
@@ -1133,20 +1133,20 @@ const unsigned char _Py_M__importlib[] = {
     11,115,111,117,114,99,101,95,115,105,122,101,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,25,95,118,97,
     108,105,100,97,116,101,95,98,121,116,101,99,111,100,101,95,
-    104,101,97,100,101,114,79,2,0,0,115,76,0,0,0,0,
+    104,101,97,100,101,114,80,2,0,0,115,76,0,0,0,0,
     11,6,1,12,1,13,3,6,1,12,1,13,1,16,1,16,
     1,16,1,12,1,18,1,10,1,18,1,18,1,15,1,10,
     1,15,1,18,1,15,1,10,1,15,1,12,1,3,1,20,
     1,13,1,5,2,18,1,15,1,10,1,18,1,3,1,18,
     1,13,1,5,2,18,1,15,1,15,1,114,190,0,0,0,
     99,4,0,0,0,0,0,0,0,5,0,0,0,6,0,0,
-    0,67,0,0,0,115,115,0,0,0,116,0,0,106,1,0,
-    124,0,0,131,1,0,125,4,0,116,2,0,124,4,0,116,
+    0,67,0,0,0,115,115,0,0,0,116,0,0,160,1,0,
+    124,0,0,161,1,0,125,4,0,116,2,0,124,4,0,116,
     3,0,131,2,0,114,78,0,116,4,0,100,1,0,124,2,
     0,131,2,0,1,124,3,0,100,2,0,107,9,0,114,74,
-    0,116,5,0,106,6,0,124,4,0,124,3,0,131,2,0,
-    1,110,0,0,124,4,0,83,116,7,0,100,3,0,106,8,
-    0,124,2,0,131,1,0,100,4,0,124,1,0,100,5,0,
+    0,116,5,0,160,6,0,124,4,0,124,3,0,161,2,0,
+    1,110,0,0,124,4,0,83,116,7,0,100,3,0,160,8,
+    0,124,2,0,161,1,0,100,4,0,124,1,0,100,5,0,
     124,2,0,131,1,2,130,1,0,100,2,0,83,41,6,122,
     60,67,111,109,112,105,108,101,32,98,121,116,101,99,111,100,
     101,32,97,115,32,114,101,116,117,114,110,101,100,32,98,121,
@@ -1164,15 +1164,15 @@ const unsigned char _Py_M__importlib[] = {
     67,0,0,0,114,140,0,0,0,114,141,0,0,0,218,4,
     99,111,100,101,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,17,95,99,111,109,112,105,108,101,95,98,121,
-    116,101,99,111,100,101,134,2,0,0,115,16,0,0,0,0,
+    116,101,99,111,100,101,135,2,0,0,115,16,0,0,0,0,
     2,15,1,15,1,13,1,12,1,19,1,4,2,18,1,114,
     195,0,0,0,114,84,0,0,0,99,3,0,0,0,0,0,
-    0,0,4,0,0,0,3,0,0,0,67,0,0,0,115,76,
+    0,0,4,0,0,0,5,0,0,0,67,0,0,0,115,76,
     0,0,0,116,0,0,116,1,0,131,1,0,125,3,0,124,
-    3,0,106,2,0,116,3,0,124,1,0,131,1,0,131,1,
-    0,1,124,3,0,106,2,0,116,3,0,124,2,0,131,1,
-    0,131,1,0,1,124,3,0,106,2,0,116,4,0,106,5,
-    0,124,0,0,131,1,0,131,1,0,1,124,3,0,83,41,
+    3,0,160,2,0,116,3,0,124,1,0,131,1,0,161,1,
+    0,1,124,3,0,160,2,0,116,3,0,124,2,0,131,1,
+    0,161,1,0,1,124,3,0,160,2,0,116,4,0,160,5,
+    0,124,0,0,161,1,0,161,1,0,1,124,3,0,83,41,
     1,122,80,67,111,109,112,105,108,101,32,97,32,99,111,100,
     101,32,111,98,106,101,99,116,32,105,110,116,111,32,98,121,
     116,101,99,111,100,101,32,102,111,114,32,119,114,105,116,105,
@@ -1184,15 +1184,15 @@ const unsigned char _Py_M__importlib[] = {
     114,194,0,0,0,114,183,0,0,0,114,189,0,0,0,114,
     53,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,17,95,99,111,100,101,95,116,111,95,98,121,
-    116,101,99,111,100,101,146,2,0,0,115,10,0,0,0,0,
+    116,101,99,111,100,101,147,2,0,0,115,10,0,0,0,0,
     3,12,1,19,1,19,1,22,1,114,198,0,0,0,99,1,
-    0,0,0,0,0,0,0,5,0,0,0,4,0,0,0,67,
+    0,0,0,0,0,0,0,5,0,0,0,6,0,0,0,67,
     0,0,0,115,89,0,0,0,100,1,0,100,2,0,108,0,
-    0,125,1,0,116,1,0,106,2,0,124,0,0,131,1,0,
-    106,3,0,125,2,0,124,1,0,106,4,0,124,2,0,131,
-    1,0,125,3,0,116,1,0,106,5,0,100,2,0,100,3,
-    0,131,2,0,125,4,0,124,4,0,106,6,0,124,0,0,
-    106,6,0,124,3,0,100,1,0,25,131,1,0,131,1,0,
+    0,125,1,0,116,1,0,160,2,0,124,0,0,161,1,0,
+    106,3,0,125,2,0,124,1,0,160,4,0,124,2,0,161,
+    1,0,125,3,0,116,1,0,160,5,0,100,2,0,100,3,
+    0,161,2,0,125,4,0,124,4,0,160,6,0,124,0,0,
+    160,6,0,124,3,0,100,1,0,25,161,1,0,161,1,0,
     83,41,4,122,121,68,101,99,111,100,101,32,98,121,116,101,
     115,32,114,101,112,114,101,115,101,110,116,105,110,103,32,115,
     111,117,114,99,101,32,99,111,100,101,32,97,110,100,32,114,
@@ -1213,26 +1213,26 @@ const unsigned char _Py_M__importlib[] = {
     105,110,103,90,15,110,101,119,108,105,110,101,95,100,101,99,
     111,100,101,114,114,4,0,0,0,114,4,0,0,0,114,5,
     0,0,0,218,13,100,101,99,111,100,101,95,115,111,117,114,
-    99,101,156,2,0,0,115,10,0,0,0,0,5,12,1,18,
+    99,101,157,2,0,0,115,10,0,0,0,0,5,12,1,18,
     1,15,1,18,1,114,203,0,0,0,99,1,0,0,0,0,
-    0,0,0,5,0,0,0,35,0,0,0,67,0,0,0,115,
+    0,0,0,5,0,0,0,36,0,0,0,67,0,0,0,115,
     15,1,0,0,116,0,0,124,0,0,100,1,0,100,0,0,
     131,3,0,125,1,0,116,1,0,124,1,0,100,2,0,131,
-    2,0,114,74,0,121,17,0,124,1,0,106,2,0,124,0,
-    0,131,1,0,83,87,113,74,0,4,116,3,0,107,10,0,
+    2,0,114,74,0,121,17,0,124,1,0,160,2,0,124,0,
+    0,161,1,0,83,87,113,74,0,4,116,3,0,107,10,0,
     114,70,0,1,1,1,89,113,74,0,88,110,0,0,121,13,
     0,124,0,0,106,4,0,125,2,0,87,110,18,0,4,116,
     5,0,107,10,0,114,107,0,1,1,1,89,110,29,0,88,
     124,2,0,100,0,0,107,9,0,114,136,0,116,6,0,124,
-    2,0,131,1,0,106,2,0,131,0,0,83,121,13,0,124,
+    2,0,131,1,0,160,2,0,161,0,0,83,121,13,0,124,
     0,0,106,7,0,125,3,0,87,110,24,0,4,116,5,0,
     107,10,0,114,175,0,1,1,1,100,3,0,125,3,0,89,
     110,1,0,88,121,13,0,124,0,0,106,8,0,125,4,0,
     87,110,59,0,4,116,5,0,107,10,0,114,250,0,1,1,
     1,124,1,0,100,0,0,107,8,0,114,230,0,100,4,0,
-    106,9,0,124,3,0,131,1,0,83,100,5,0,106,9,0,
-    124,3,0,124,1,0,131,2,0,83,89,110,17,0,88,100,
-    6,0,106,9,0,124,3,0,124,4,0,131,2,0,83,100,
+    160,9,0,124,3,0,161,1,0,83,100,5,0,160,9,0,
+    124,3,0,124,1,0,161,2,0,83,89,110,17,0,88,100,
+    6,0,160,9,0,124,3,0,124,4,0,161,2,0,83,100,
     0,0,83,41,7,78,218,10,95,95,108,111,97,100,101,114,
     95,95,218,11,109,111,100,117,108,101,95,114,101,112,114,250,
     1,63,122,13,60,109,111,100,117,108,101,32,123,33,114,125,
@@ -1247,7 +1247,7 @@ const unsigned char _Py_M__importlib[] = {
     5,114,179,0,0,0,114,169,0,0,0,114,177,0,0,0,
     114,67,0,0,0,114,131,0,0,0,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,12,95,109,111,100,117,
-    108,101,95,114,101,112,114,170,2,0,0,115,46,0,0,0,
+    108,101,95,114,101,112,114,171,2,0,0,115,46,0,0,0,
     0,2,18,1,15,2,3,1,17,1,13,1,8,1,3,1,
     13,1,13,1,5,2,12,1,16,4,3,1,13,1,13,1,
     11,1,3,1,13,1,13,1,12,1,13,2,21,2,114,211,
@@ -1264,7 +1264,7 @@ const unsigned char _Py_M__importlib[] = {
     95,109,111,100,117,108,101,114,208,0,0,0,218,5,95,115,
     112,101,99,41,2,114,71,0,0,0,114,179,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,72,
-    0,0,0,206,2,0,0,115,4,0,0,0,0,1,9,1,
+    0,0,0,207,2,0,0,115,4,0,0,0,0,1,9,1,
     122,26,95,105,110,115,116,97,108,108,101,100,95,115,97,102,
     101,108,121,46,95,95,105,110,105,116,95,95,99,1,0,0,
     0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,
@@ -1275,7 +1275,7 @@ const unsigned char _Py_M__importlib[] = {
     108,105,122,105,110,103,114,213,0,0,0,114,7,0,0,0,
     114,73,0,0,0,114,67,0,0,0,41,1,114,71,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,75,0,0,0,210,2,0,0,115,4,0,0,0,0,4,
+    114,75,0,0,0,211,2,0,0,115,4,0,0,0,0,4,
     12,1,122,27,95,105,110,115,116,97,108,108,101,100,95,115,
     97,102,101,108,121,46,95,95,101,110,116,101,114,95,95,99,
     1,0,0,0,0,0,0,0,3,0,0,0,17,0,0,0,
@@ -1293,7 +1293,7 @@ const unsigned char _Py_M__importlib[] = {
     0,86,1,113,3,0,100,0,0,83,41,1,78,114,4,0,
     0,0,41,2,114,22,0,0,0,114,76,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,77,0,
-    0,0,220,2,0,0,115,2,0,0,0,6,0,122,45,95,
+    0,0,221,2,0,0,115,2,0,0,0,6,0,122,45,95,
     105,110,115,116,97,108,108,101,100,95,115,97,102,101,108,121,
     46,95,95,101,120,105,116,95,95,46,60,108,111,99,97,108,
     115,62,46,60,103,101,110,101,120,112,114,62,122,18,105,109,
@@ -1303,14 +1303,14 @@ const unsigned char _Py_M__importlib[] = {
     0,114,152,0,0,0,114,169,0,0,0,114,215,0,0,0,
     41,3,114,71,0,0,0,114,80,0,0,0,114,177,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,81,0,0,0,217,2,0,0,115,18,0,0,0,0,1,
+    114,81,0,0,0,218,2,0,0,115,18,0,0,0,0,1,
     3,1,9,1,25,1,3,1,17,1,13,1,8,2,26,2,
     122,26,95,105,110,115,116,97,108,108,101,100,95,115,97,102,
     101,108,121,46,95,95,101,120,105,116,95,95,78,41,6,114,
     57,0,0,0,114,56,0,0,0,114,58,0,0,0,114,72,
     0,0,0,114,75,0,0,0,114,81,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,212,0,0,0,204,2,0,0,115,6,0,0,0,12,
+    0,114,212,0,0,0,205,2,0,0,115,6,0,0,0,12,
     2,12,4,12,7,114,212,0,0,0,99,0,0,0,0,0,
     0,0,0,0,0,0,0,8,0,0,0,64,0,0,0,115,
     172,0,0,0,101,0,0,90,1,0,100,0,0,90,2,0,
@@ -1435,20 +1435,20 @@ const unsigned char _Py_M__importlib[] = {
     71,0,0,0,114,67,0,0,0,114,169,0,0,0,114,217,
     0,0,0,114,218,0,0,0,114,219,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,72,0,0,
-    0,12,3,0,0,115,14,0,0,0,0,2,9,1,9,1,
+    0,13,3,0,0,115,14,0,0,0,0,2,9,1,9,1,
     9,1,9,1,21,3,9,1,122,19,77,111,100,117,108,101,
     83,112,101,99,46,95,95,105,110,105,116,95,95,99,1,0,
-    0,0,0,0,0,0,2,0,0,0,4,0,0,0,67,0,
-    0,0,115,153,0,0,0,100,1,0,106,0,0,124,0,0,
-    106,1,0,131,1,0,100,2,0,106,0,0,124,0,0,106,
-    2,0,131,1,0,103,2,0,125,1,0,124,0,0,106,3,
-    0,100,0,0,107,9,0,114,79,0,124,1,0,106,4,0,
-    100,3,0,106,0,0,124,0,0,106,3,0,131,1,0,131,
+    0,0,0,0,0,0,2,0,0,0,6,0,0,0,67,0,
+    0,0,115,153,0,0,0,100,1,0,160,0,0,124,0,0,
+    106,1,0,161,1,0,100,2,0,160,0,0,124,0,0,106,
+    2,0,161,1,0,103,2,0,125,1,0,124,0,0,106,3,
+    0,100,0,0,107,9,0,114,79,0,124,1,0,160,4,0,
+    100,3,0,160,0,0,124,0,0,106,3,0,161,1,0,161,
     1,0,1,110,0,0,124,0,0,106,5,0,100,0,0,107,
-    9,0,114,122,0,124,1,0,106,4,0,100,4,0,106,0,
-    0,124,0,0,106,5,0,131,1,0,131,1,0,1,110,0,
-    0,100,5,0,106,0,0,124,0,0,106,6,0,106,7,0,
-    100,6,0,106,8,0,124,1,0,131,1,0,131,2,0,83,
+    9,0,114,122,0,124,1,0,160,4,0,100,4,0,160,0,
+    0,124,0,0,106,5,0,161,1,0,161,1,0,1,110,0,
+    0,100,5,0,160,0,0,124,0,0,106,6,0,106,7,0,
+    100,6,0,160,8,0,124,1,0,161,1,0,161,2,0,83,
     41,7,78,122,9,110,97,109,101,61,123,33,114,125,122,11,
     108,111,97,100,101,114,61,123,33,114,125,122,11,111,114,105,
     103,105,110,61,123,33,114,125,122,29,115,117,98,109,111,100,
@@ -1459,7 +1459,7 @@ const unsigned char _Py_M__importlib[] = {
     100,114,220,0,0,0,218,9,95,95,99,108,97,115,115,95,
     95,114,57,0,0,0,114,26,0,0,0,41,2,114,71,0,
     0,0,114,80,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,101,0,0,0,24,3,0,0,115,
+    0,114,5,0,0,0,114,101,0,0,0,25,3,0,0,115,
     16,0,0,0,0,1,15,1,21,1,15,1,28,1,15,1,
     6,1,22,1,122,19,77,111,100,117,108,101,83,112,101,99,
     46,95,95,114,101,112,114,95,95,99,2,0,0,0,0,0,
@@ -1479,7 +1479,7 @@ const unsigned char _Py_M__importlib[] = {
     116,105,111,110,114,209,0,0,0,41,3,114,71,0,0,0,
     90,5,111,116,104,101,114,90,4,115,109,115,108,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,6,95,95,
-    101,113,95,95,34,3,0,0,115,20,0,0,0,0,1,9,
+    101,113,95,95,35,3,0,0,115,20,0,0,0,0,1,9,
     1,3,1,18,1,18,1,18,1,15,1,18,1,20,1,13,
     1,122,17,77,111,100,117,108,101,83,112,101,99,46,95,95,
     101,113,95,95,99,1,0,0,0,0,0,0,0,2,0,0,
@@ -1487,11 +1487,11 @@ const unsigned char _Py_M__importlib[] = {
     0,106,0,0,100,0,0,107,8,0,114,151,0,124,0,0,
     106,1,0,100,0,0,107,9,0,114,151,0,124,0,0,106,
     2,0,114,151,0,124,0,0,106,1,0,125,1,0,124,1,
-    0,106,3,0,116,4,0,116,5,0,131,1,0,131,1,0,
+    0,160,3,0,116,4,0,116,5,0,131,1,0,161,1,0,
     114,112,0,121,19,0,116,6,0,124,1,0,131,1,0,124,
     0,0,95,0,0,87,113,145,0,4,116,7,0,107,10,0,
     114,108,0,1,1,1,89,113,145,0,88,113,148,0,124,1,
-    0,106,3,0,116,4,0,116,8,0,131,1,0,131,1,0,
+    0,160,3,0,116,4,0,116,8,0,131,1,0,161,1,0,
     114,148,0,124,1,0,124,0,0,95,0,0,113,148,0,113,
     151,0,110,0,0,124,0,0,106,0,0,83,41,1,78,41,
     9,114,222,0,0,0,114,217,0,0,0,114,221,0,0,0,
@@ -1500,7 +1500,7 @@ const unsigned char _Py_M__importlib[] = {
     218,17,66,89,84,69,67,79,68,69,95,83,85,70,70,73,
     88,69,83,41,2,114,71,0,0,0,114,131,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,225,
-    0,0,0,46,3,0,0,115,22,0,0,0,0,2,15,1,
+    0,0,0,47,3,0,0,115,22,0,0,0,0,2,15,1,
     24,1,9,1,21,1,3,1,19,1,13,1,8,1,21,1,
     18,1,122,17,77,111,100,117,108,101,83,112,101,99,46,99,
     97,99,104,101,100,99,2,0,0,0,0,0,0,0,2,0,
@@ -1508,24 +1508,24 @@ const unsigned char _Py_M__importlib[] = {
     1,0,124,0,0,95,0,0,100,0,0,83,41,1,78,41,
     1,114,222,0,0,0,41,2,114,71,0,0,0,114,225,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,225,0,0,0,60,3,0,0,115,2,0,0,0,0,
-    2,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
+    0,114,225,0,0,0,61,3,0,0,115,2,0,0,0,0,
+    2,99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,
     0,0,67,0,0,0,115,46,0,0,0,124,0,0,106,0,
     0,100,1,0,107,8,0,114,35,0,124,0,0,106,1,0,
-    106,2,0,100,2,0,131,1,0,100,3,0,25,83,124,0,
+    160,2,0,100,2,0,161,1,0,100,3,0,25,83,124,0,
     0,106,1,0,83,100,1,0,83,41,4,122,32,84,104,101,
     32,110,97,109,101,32,111,102,32,116,104,101,32,109,111,100,
     117,108,101,39,115,32,112,97,114,101,110,116,46,78,114,116,
     0,0,0,114,84,0,0,0,41,3,114,220,0,0,0,114,
     67,0,0,0,114,32,0,0,0,41,1,114,71,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
-    6,112,97,114,101,110,116,64,3,0,0,115,6,0,0,0,
+    6,112,97,114,101,110,116,65,3,0,0,115,6,0,0,0,
     0,3,15,1,20,2,122,17,77,111,100,117,108,101,83,112,
     101,99,46,112,97,114,101,110,116,99,1,0,0,0,0,0,
     0,0,1,0,0,0,1,0,0,0,67,0,0,0,115,7,
     0,0,0,124,0,0,106,0,0,83,41,1,78,41,1,114,
     221,0,0,0,41,1,114,71,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,226,0,0,0,72,
+    114,4,0,0,0,114,5,0,0,0,114,226,0,0,0,73,
     3,0,0,115,2,0,0,0,0,2,122,23,77,111,100,117,
     108,101,83,112,101,99,46,104,97,115,95,108,111,99,97,116,
     105,111,110,99,2,0,0,0,0,0,0,0,2,0,0,0,
@@ -1534,13 +1534,13 @@ const unsigned char _Py_M__importlib[] = {
     41,1,78,41,2,218,4,98,111,111,108,114,221,0,0,0,
     41,2,114,71,0,0,0,218,5,118,97,108,117,101,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,226,0,
-    0,0,76,3,0,0,115,2,0,0,0,0,2,41,12,114,
+    0,0,77,3,0,0,115,2,0,0,0,0,2,41,12,114,
     57,0,0,0,114,56,0,0,0,114,58,0,0,0,114,59,
     0,0,0,114,72,0,0,0,114,101,0,0,0,114,227,0,
     0,0,218,8,112,114,111,112,101,114,116,121,114,225,0,0,
     0,218,6,115,101,116,116,101,114,114,231,0,0,0,114,226,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,216,0,0,0,231,2,0,0,
+    0,0,114,5,0,0,0,114,216,0,0,0,232,2,0,0,
     115,20,0,0,0,12,35,6,2,15,1,15,11,12,10,12,
     12,18,14,21,4,18,8,18,4,114,216,0,0,0,114,217,
     0,0,0,114,219,0,0,0,99,2,0,0,0,2,0,0,
@@ -1552,7 +1552,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,124,0,0,100,3,0,124,1,0,100,4,0,124,4,
     0,131,1,2,83,124,3,0,100,2,0,107,8,0,114,168,
     0,116,0,0,124,1,0,100,5,0,131,2,0,114,159,0,
-    121,19,0,124,1,0,106,2,0,124,0,0,131,1,0,125,
+    121,19,0,124,1,0,160,2,0,124,0,0,161,1,0,125,
     3,0,87,113,165,0,4,116,3,0,107,10,0,114,155,0,
     1,1,1,100,2,0,125,3,0,89,113,165,0,88,113,168,
     0,100,6,0,125,3,0,110,0,0,116,4,0,124,0,0,
@@ -1569,33 +1569,33 @@ const unsigned char _Py_M__importlib[] = {
     5,114,67,0,0,0,114,169,0,0,0,114,217,0,0,0,
     114,219,0,0,0,90,6,115,101,97,114,99,104,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,173,0,0,
-    0,81,3,0,0,115,28,0,0,0,0,2,15,1,12,1,
+    0,82,3,0,0,115,28,0,0,0,0,2,15,1,12,1,
     16,1,18,1,15,1,7,2,12,1,15,1,3,1,19,1,
     13,1,14,3,9,2,114,173,0,0,0,114,169,0,0,0,
     114,220,0,0,0,99,2,0,0,0,2,0,0,0,9,0,
     0,0,19,0,0,0,67,0,0,0,115,110,1,0,0,124,
     1,0,100,1,0,107,8,0,114,79,0,100,2,0,125,1,
     0,116,0,0,124,2,0,100,3,0,131,2,0,114,79,0,
-    121,19,0,124,2,0,106,1,0,124,0,0,131,1,0,125,
+    121,19,0,124,2,0,160,1,0,124,0,0,161,1,0,125,
     1,0,87,113,76,0,4,116,2,0,107,10,0,114,72,0,
     1,1,1,89,113,76,0,88,113,79,0,110,0,0,116,3,
     0,124,0,0,124,2,0,100,4,0,124,1,0,131,2,1,
     125,4,0,100,5,0,124,4,0,95,4,0,124,2,0,100,
     1,0,107,8,0,114,203,0,120,79,0,116,5,0,131,0,
     0,68,93,61,0,92,2,0,125,5,0,125,6,0,124,1,
-    0,106,6,0,116,7,0,124,6,0,131,1,0,131,1,0,
+    0,160,6,0,116,7,0,124,6,0,131,1,0,161,1,0,
     114,131,0,124,5,0,124,0,0,124,1,0,131,2,0,125,
     2,0,124,2,0,124,4,0,95,8,0,80,113,131,0,113,
     131,0,87,100,1,0,83,110,0,0,124,3,0,116,9,0,
     107,8,0,114,38,1,116,0,0,124,2,0,100,6,0,131,
-    2,0,114,47,1,121,19,0,124,2,0,106,10,0,124,0,
-    0,131,1,0,125,7,0,87,110,18,0,4,116,2,0,107,
+    2,0,114,47,1,121,19,0,124,2,0,160,10,0,124,0,
+    0,161,1,0,125,7,0,87,110,18,0,4,116,2,0,107,
     10,0,114,13,1,1,1,1,89,113,35,1,88,124,7,0,
     114,35,1,103,0,0,124,4,0,95,11,0,113,35,1,113,
     47,1,110,9,0,124,3,0,124,4,0,95,11,0,124,4,
     0,106,11,0,103,0,0,107,2,0,114,106,1,124,1,0,
     114,106,1,116,12,0,124,1,0,131,1,0,100,7,0,25,
-    125,8,0,124,4,0,106,11,0,106,13,0,124,8,0,131,
+    125,8,0,124,4,0,106,11,0,160,13,0,124,8,0,161,
     1,0,1,113,106,1,110,0,0,124,4,0,83,41,8,97,
     61,1,0,0,82,101,116,117,114,110,32,97,32,109,111,100,
     117,108,101,32,115,112,101,99,32,98,97,115,101,100,32,111,
@@ -1630,7 +1630,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,177,0,0,0,218,12,108,111,97,100,101,114,
     95,99,108,97,115,115,114,127,0,0,0,114,219,0,0,0,
     90,7,100,105,114,110,97,109,101,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,237,0,0,0,106,3,0,
+    0,0,0,114,5,0,0,0,114,237,0,0,0,107,3,0,
     0,115,60,0,0,0,0,12,12,4,6,1,15,2,3,1,
     19,1,13,1,11,8,21,1,9,3,12,1,22,1,21,1,
     15,1,9,1,8,2,7,3,12,2,15,1,3,1,19,1,
@@ -1671,7 +1671,7 @@ const unsigned char _Py_M__importlib[] = {
     0,114,67,0,0,0,114,240,0,0,0,114,225,0,0,0,
     114,220,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,17,95,115,112,101,99,95,102,114,111,109,
-    95,109,111,100,117,108,101,170,3,0,0,115,72,0,0,0,
+    95,109,111,100,117,108,101,171,3,0,0,115,72,0,0,0,
     0,2,3,1,13,1,13,1,5,2,12,1,4,2,9,1,
     12,1,3,1,13,1,13,2,8,1,3,1,13,1,13,1,
     11,1,12,1,12,1,3,1,13,1,13,1,14,2,9,1,
@@ -1699,7 +1699,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,124,1,0,124,0,0,95,0,0,100,0,0,83,
     41,1,78,41,1,114,177,0,0,0,41,2,114,71,0,0,
     0,114,177,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,5,0,0,0,114,72,0,0,0,220,3,0,0,115,2,
+    114,5,0,0,0,114,72,0,0,0,221,3,0,0,115,2,
     0,0,0,0,1,122,21,95,83,112,101,99,77,101,116,104,
     111,100,115,46,95,95,105,110,105,116,95,95,99,2,0,0,
     0,0,0,0,0,4,0,0,0,17,0,0,0,67,0,0,
@@ -1720,22 +1720,22 @@ const unsigned char _Py_M__importlib[] = {
     99,114,57,0,0,0,114,173,0,0,0,41,4,218,3,99,
     108,115,114,179,0,0,0,114,177,0,0,0,114,169,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    218,11,102,114,111,109,95,109,111,100,117,108,101,223,3,0,
+    218,11,102,114,111,109,95,109,111,100,117,108,101,224,3,0,
     0,115,22,0,0,0,0,3,3,1,13,1,13,1,3,1,
     13,1,13,1,15,1,12,1,26,2,23,1,122,24,95,83,
     112,101,99,77,101,116,104,111,100,115,46,102,114,111,109,95,
     109,111,100,117,108,101,99,1,0,0,0,0,0,0,0,3,
-    0,0,0,3,0,0,0,67,0,0,0,115,158,0,0,0,
+    0,0,0,4,0,0,0,67,0,0,0,115,158,0,0,0,
     124,0,0,106,0,0,125,1,0,124,1,0,106,1,0,100,
     1,0,107,8,0,114,30,0,100,2,0,110,6,0,124,1,
     0,106,1,0,125,2,0,124,1,0,106,2,0,100,1,0,
     107,8,0,114,104,0,124,1,0,106,3,0,100,1,0,107,
-    8,0,114,82,0,100,3,0,106,4,0,124,2,0,131,1,
-    0,83,100,4,0,106,4,0,124,2,0,124,1,0,106,3,
-    0,131,2,0,83,110,50,0,124,1,0,106,5,0,114,132,
-    0,100,5,0,106,4,0,124,2,0,124,1,0,106,2,0,
-    131,2,0,83,100,6,0,106,4,0,124,1,0,106,1,0,
-    124,1,0,106,2,0,131,2,0,83,100,1,0,83,41,7,
+    8,0,114,82,0,100,3,0,160,4,0,124,2,0,161,1,
+    0,83,100,4,0,160,4,0,124,2,0,124,1,0,106,3,
+    0,161,2,0,83,110,50,0,124,1,0,106,5,0,114,132,
+    0,100,5,0,160,4,0,124,2,0,124,1,0,106,2,0,
+    161,2,0,83,100,6,0,160,4,0,124,1,0,106,1,0,
+    124,1,0,106,2,0,161,2,0,83,100,1,0,83,41,7,
     122,38,82,101,116,117,114,110,32,116,104,101,32,114,101,112,
     114,32,116,111,32,117,115,101,32,102,111,114,32,116,104,101,
     32,109,111,100,117,108,101,46,78,114,206,0,0,0,122,13,
@@ -1748,7 +1748,7 @@ const unsigned char _Py_M__importlib[] = {
     0,114,169,0,0,0,114,47,0,0,0,114,226,0,0,0,
     41,3,114,71,0,0,0,114,177,0,0,0,114,67,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,205,0,0,0,239,3,0,0,115,18,0,0,0,0,3,
+    114,205,0,0,0,240,3,0,0,115,18,0,0,0,0,3,
     9,1,30,1,15,1,15,1,13,2,22,2,9,1,19,2,
     122,24,95,83,112,101,99,77,101,116,104,111,100,115,46,109,
     111,100,117,108,101,95,114,101,112,114,218,9,95,111,118,101,
@@ -1764,7 +1764,7 @@ const unsigned char _Py_M__importlib[] = {
     3,0,100,2,0,131,3,0,100,2,0,107,8,0,114,221,
     0,124,4,0,106,5,0,125,5,0,124,5,0,100,2,0,
     107,8,0,114,184,0,124,4,0,106,6,0,100,2,0,107,
-    9,0,114,184,0,116,7,0,106,8,0,116,7,0,131,1,
+    9,0,114,184,0,116,7,0,160,8,0,116,7,0,161,1,
     0,125,5,0,124,4,0,106,6,0,124,5,0,95,9,0,
     113,184,0,110,0,0,121,13,0,124,5,0,124,1,0,95,
     10,0,87,113,221,0,4,116,4,0,107,10,0,114,217,0,
@@ -1839,8 +1839,8 @@ const unsigned char _Py_M__importlib[] = {
     71,0,0,0,114,179,0,0,0,114,249,0,0,0,114,250,
     0,0,0,114,177,0,0,0,114,169,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,17,105,110,
-    105,116,95,109,111,100,117,108,101,95,97,116,116,114,115,255,
-    3,0,0,115,88,0,0,0,0,17,9,6,12,1,24,1,
+    105,116,95,109,111,100,117,108,101,95,97,116,116,114,115,0,
+    4,0,0,115,88,0,0,0,0,17,9,6,12,1,24,1,
     3,1,16,1,13,1,8,3,30,1,9,1,12,2,15,1,
     15,1,18,1,3,1,13,1,13,1,8,3,30,1,3,1,
     16,1,13,1,8,3,3,1,13,1,13,1,5,3,30,1,
@@ -1851,11 +1851,11 @@ const unsigned char _Py_M__importlib[] = {
     99,1,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
     0,67,0,0,0,115,101,0,0,0,124,0,0,106,0,0,
     125,1,0,116,1,0,124,1,0,106,2,0,100,1,0,131,
-    2,0,114,48,0,124,1,0,106,2,0,106,3,0,124,1,
-    0,131,1,0,125,2,0,110,6,0,100,2,0,125,2,0,
+    2,0,114,48,0,124,1,0,106,2,0,160,3,0,124,1,
+    0,161,1,0,125,2,0,110,6,0,100,2,0,125,2,0,
     124,2,0,100,2,0,107,8,0,114,84,0,116,4,0,124,
     1,0,106,5,0,131,1,0,125,2,0,110,0,0,124,0,
-    0,106,6,0,124,2,0,131,1,0,1,124,2,0,83,41,
+    0,160,6,0,124,2,0,161,1,0,1,124,2,0,83,41,
     3,122,153,82,101,116,117,114,110,32,97,32,110,101,119,32,
     109,111,100,117,108,101,32,116,111,32,98,101,32,108,111,97,
     100,101,100,46,10,10,32,32,32,32,32,32,32,32,84,104,
@@ -1871,13 +1871,13 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,68,0,0,0,114,67,0,0,0,114,255,0,0,
     0,41,3,114,71,0,0,0,114,177,0,0,0,114,179,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,218,6,99,114,101,97,116,101,79,4,0,0,115,16,0,
+    0,218,6,99,114,101,97,116,101,80,4,0,0,115,16,0,
     0,0,0,7,9,2,18,3,21,2,6,1,12,4,18,1,
     13,1,122,19,95,83,112,101,99,77,101,116,104,111,100,115,
     46,99,114,101,97,116,101,99,2,0,0,0,0,0,0,0,
-    2,0,0,0,2,0,0,0,67,0,0,0,115,23,0,0,
-    0,124,0,0,106,0,0,106,1,0,106,2,0,124,1,0,
-    131,1,0,1,100,1,0,83,41,2,122,189,68,111,32,101,
+    2,0,0,0,3,0,0,0,67,0,0,0,115,23,0,0,
+    0,124,0,0,106,0,0,106,1,0,160,2,0,124,1,0,
+    161,1,0,1,100,1,0,83,41,2,122,189,68,111,32,101,
     118,101,114,121,116,104,105,110,103,32,110,101,99,101,115,115,
     97,114,121,32,116,111,32,101,120,101,99,117,116,101,32,116,
     104,101,32,109,111,100,117,108,101,46,10,10,32,32,32,32,
@@ -1893,15 +1893,15 @@ const unsigned char _Py_M__importlib[] = {
     0,114,169,0,0,0,218,11,101,120,101,99,95,109,111,100,
     117,108,101,41,2,114,71,0,0,0,114,179,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,5,
-    95,101,120,101,99,102,4,0,0,115,2,0,0,0,0,7,
+    95,101,120,101,99,103,4,0,0,115,2,0,0,0,0,7,
     122,18,95,83,112,101,99,77,101,116,104,111,100,115,46,95,
     101,120,101,99,99,2,0,0,0,0,0,0,0,4,0,0,
     0,11,0,0,0,67,0,0,0,115,17,1,0,0,124,0,
-    0,106,0,0,106,1,0,125,2,0,116,2,0,106,3,0,
-    131,0,0,1,116,4,0,124,2,0,131,1,0,143,226,0,
-    1,116,5,0,106,6,0,106,7,0,124,2,0,131,1,0,
-    124,1,0,107,9,0,114,95,0,100,1,0,106,8,0,124,
-    2,0,131,1,0,125,3,0,116,9,0,124,3,0,100,2,
+    0,106,0,0,106,1,0,125,2,0,116,2,0,160,3,0,
+    161,0,0,1,116,4,0,124,2,0,131,1,0,143,226,0,
+    1,116,5,0,106,6,0,160,7,0,124,2,0,161,1,0,
+    124,1,0,107,9,0,114,95,0,100,1,0,160,8,0,124,
+    2,0,161,1,0,125,3,0,116,9,0,124,3,0,100,2,
     0,124,2,0,131,1,1,130,1,0,110,0,0,124,0,0,
     106,0,0,106,10,0,100,3,0,107,8,0,114,181,0,124,
     0,0,106,0,0,106,11,0,100,3,0,107,8,0,114,158,
@@ -1911,8 +1911,8 @@ const unsigned char _Py_M__importlib[] = {
     1,0,83,124,0,0,106,12,0,124,1,0,100,5,0,100,
     6,0,131,1,1,1,116,13,0,124,0,0,106,0,0,106,
     10,0,100,7,0,131,2,0,115,243,0,124,0,0,106,0,
-    0,106,10,0,106,14,0,124,2,0,131,1,0,1,110,13,
-    0,124,0,0,106,15,0,124,1,0,131,1,0,1,87,100,
+    0,106,10,0,160,14,0,124,2,0,161,1,0,1,110,13,
+    0,124,0,0,160,15,0,124,1,0,161,1,0,1,87,100,
     3,0,81,88,116,5,0,106,6,0,124,2,0,25,83,41,
     8,122,51,69,120,101,99,117,116,101,32,116,104,101,32,115,
     112,101,99,32,105,110,32,97,110,32,101,120,105,115,116,105,
@@ -1930,14 +1930,14 @@ const unsigned char _Py_M__importlib[] = {
     111,100,117,108,101,114,3,1,0,0,41,4,114,71,0,0,
     0,114,179,0,0,0,114,67,0,0,0,114,171,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    175,0,0,0,112,4,0,0,115,32,0,0,0,0,2,12,
+    175,0,0,0,113,4,0,0,115,32,0,0,0,0,2,12,
     1,10,1,13,1,24,1,15,1,21,1,18,1,18,1,27,
     2,19,1,4,1,19,1,21,2,22,2,19,1,122,17,95,
     83,112,101,99,77,101,116,104,111,100,115,46,101,120,101,99,
     99,1,0,0,0,0,0,0,0,3,0,0,0,27,0,0,
     0,67,0,0,0,115,24,1,0,0,124,0,0,106,0,0,
-    125,1,0,124,1,0,106,1,0,106,2,0,124,1,0,106,
-    3,0,131,1,0,1,116,4,0,106,5,0,124,1,0,106,
+    125,1,0,124,1,0,106,1,0,160,2,0,124,1,0,106,
+    3,0,161,1,0,1,116,4,0,106,5,0,124,1,0,106,
     3,0,25,125,2,0,116,6,0,124,2,0,100,1,0,100,
     0,0,131,3,0,100,0,0,107,8,0,114,108,0,121,16,
     0,124,1,0,106,1,0,124,2,0,95,7,0,87,113,108,
@@ -1946,7 +1946,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,131,3,0,100,0,0,107,8,0,114,215,0,121,59,
     0,124,2,0,106,9,0,124,2,0,95,10,0,116,11,0,
     124,2,0,100,3,0,131,2,0,115,190,0,124,1,0,106,
-    3,0,106,12,0,100,4,0,131,1,0,100,5,0,25,124,
+    3,0,160,12,0,100,4,0,161,1,0,100,5,0,25,124,
     2,0,95,10,0,110,0,0,87,113,215,0,4,116,8,0,
     107,10,0,114,211,0,1,1,1,89,113,215,0,88,110,0,
     0,116,6,0,124,2,0,100,6,0,100,0,0,131,3,0,
@@ -1963,16 +1963,16 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,177,0,0,0,114,179,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,25,95,108,111,
     97,100,95,98,97,99,107,119,97,114,100,95,99,111,109,112,
-    97,116,105,98,108,101,134,4,0,0,115,42,0,0,0,0,
+    97,116,105,98,108,101,135,4,0,0,115,42,0,0,0,0,
     2,9,2,19,1,16,1,24,1,3,1,16,1,13,1,8,
     1,24,1,3,4,12,1,15,1,32,1,13,1,8,1,24,
     1,3,1,13,1,13,1,8,1,122,38,95,83,112,101,99,
     77,101,116,104,111,100,115,46,95,108,111,97,100,95,98,97,
     99,107,119,97,114,100,95,99,111,109,112,97,116,105,98,108,
-    101,99,2,0,0,0,0,0,0,0,3,0,0,0,9,0,
+    101,99,2,0,0,0,0,0,0,0,3,0,0,0,10,0,
     0,0,67,0,0,0,115,38,0,0,0,116,0,0,124,1,
-    0,131,1,0,143,20,0,1,124,0,0,106,1,0,124,1,
-    0,131,1,0,125,2,0,87,100,1,0,81,88,124,2,0,
+    0,131,1,0,143,20,0,1,124,0,0,160,1,0,124,1,
+    0,161,1,0,125,2,0,87,100,1,0,81,88,124,2,0,
     83,41,2,122,60,69,120,101,99,32,116,104,101,32,115,112,
     101,99,39,101,100,32,109,111,100,117,108,101,32,105,110,116,
     111,32,97,110,32,101,120,105,115,116,105,110,103,32,109,111,
@@ -1981,20 +1981,20 @@ const unsigned char _Py_M__importlib[] = {
     114,71,0,0,0,114,179,0,0,0,90,6,108,111,97,100,
     101,100,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
     0,218,14,95,108,111,97,100,95,101,120,105,115,116,105,110,
-    103,164,4,0,0,115,6,0,0,0,0,3,13,1,21,1,
+    103,165,4,0,0,115,6,0,0,0,0,3,13,1,21,1,
     122,27,95,83,112,101,99,77,101,116,104,111,100,115,46,95,
     108,111,97,100,95,101,120,105,115,116,105,110,103,99,1,0,
     0,0,0,0,0,0,2,0,0,0,11,0,0,0,67,0,
     0,0,115,179,0,0,0,124,0,0,106,0,0,106,1,0,
     100,0,0,107,9,0,114,52,0,116,2,0,124,0,0,106,
     0,0,106,1,0,100,1,0,131,2,0,115,52,0,124,0,
-    0,106,3,0,131,0,0,83,110,0,0,124,0,0,106,4,
-    0,131,0,0,125,1,0,116,5,0,124,1,0,131,1,0,
+    0,160,3,0,161,0,0,83,110,0,0,124,0,0,160,4,
+    0,161,0,0,125,1,0,116,5,0,124,1,0,131,1,0,
     143,84,0,1,124,0,0,106,0,0,106,1,0,100,0,0,
     107,8,0,114,143,0,124,0,0,106,0,0,106,6,0,100,
     0,0,107,8,0,114,156,0,116,7,0,100,2,0,100,3,
     0,124,0,0,106,0,0,106,8,0,131,1,1,130,1,0,
-    113,156,0,110,13,0,124,0,0,106,9,0,124,1,0,131,
+    113,156,0,110,13,0,124,0,0,160,9,0,124,1,0,161,
     1,0,1,87,100,0,0,81,88,116,10,0,106,11,0,124,
     0,0,106,0,0,106,8,0,25,83,41,4,78,114,2,1,
     0,0,122,14,109,105,115,115,105,110,103,32,108,111,97,100,
@@ -2005,14 +2005,14 @@ const unsigned char _Py_M__importlib[] = {
     114,73,0,0,0,41,2,114,71,0,0,0,114,179,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
     218,14,95,108,111,97,100,95,117,110,108,111,99,107,101,100,
-    171,4,0,0,115,20,0,0,0,0,2,18,2,21,1,13,
+    172,4,0,0,115,20,0,0,0,0,2,18,2,21,1,13,
     2,12,1,13,1,18,1,18,1,30,3,19,5,122,27,95,
     83,112,101,99,77,101,116,104,111,100,115,46,95,108,111,97,
     100,95,117,110,108,111,99,107,101,100,99,1,0,0,0,0,
-    0,0,0,1,0,0,0,8,0,0,0,67,0,0,0,115,
-    49,0,0,0,116,0,0,106,1,0,131,0,0,1,116,2,
+    0,0,0,1,0,0,0,9,0,0,0,67,0,0,0,115,
+    49,0,0,0,116,0,0,160,1,0,161,0,0,1,116,2,
     0,124,0,0,106,3,0,106,4,0,131,1,0,143,15,0,
-    1,124,0,0,106,5,0,131,0,0,83,87,100,1,0,81,
+    1,124,0,0,160,5,0,161,0,0,83,87,100,1,0,81,
     88,100,1,0,83,41,2,122,207,82,101,116,117,114,110,32,
     97,32,110,101,119,32,109,111,100,117,108,101,32,111,98,106,
     101,99,116,44,32,108,111,97,100,101,100,32,98,121,32,116,
@@ -2030,7 +2030,7 @@ const unsigned char _Py_M__importlib[] = {
     114,4,1,0,0,114,103,0,0,0,114,177,0,0,0,114,
     67,0,0,0,114,8,1,0,0,41,1,114,71,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    176,0,0,0,194,4,0,0,115,6,0,0,0,0,9,10,
+    176,0,0,0,195,4,0,0,115,6,0,0,0,0,9,10,
     1,19,1,122,17,95,83,112,101,99,77,101,116,104,111,100,
     115,46,108,111,97,100,78,41,16,114,57,0,0,0,114,56,
     0,0,0,114,58,0,0,0,114,59,0,0,0,114,72,0,
@@ -2039,7 +2039,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,114,3,1,0,0,114,175,0,0,0,114,6,1,
     0,0,114,7,1,0,0,114,8,1,0,0,114,176,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,5,0,0,0,114,174,0,0,0,215,3,0,0,115,24,
+    114,5,0,0,0,114,174,0,0,0,216,3,0,0,115,24,
     0,0,0,12,3,6,2,12,3,18,16,12,16,24,80,12,
     23,12,10,12,22,12,30,12,7,12,23,114,174,0,0,0,
     99,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
@@ -2066,18 +2066,18 @@ const unsigned char _Py_M__importlib[] = {
     32,116,111,10,32,32,32,32,105,110,115,116,97,110,116,105,
     97,116,101,32,116,104,101,32,99,108,97,115,115,46,10,10,
     32,32,32,32,99,1,0,0,0,0,0,0,0,1,0,0,
-    0,2,0,0,0,67,0,0,0,115,16,0,0,0,100,1,
-    0,106,0,0,124,0,0,106,1,0,131,1,0,83,41,2,
+    0,3,0,0,0,67,0,0,0,115,16,0,0,0,100,1,
+    0,160,0,0,124,0,0,106,1,0,161,1,0,83,41,2,
     78,122,24,60,109,111,100,117,108,101,32,123,33,114,125,32,
     40,98,117,105,108,116,45,105,110,41,62,41,2,114,47,0,
     0,0,114,57,0,0,0,41,1,114,179,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,205,0,
-    0,0,219,4,0,0,115,2,0,0,0,0,3,122,27,66,
+    0,0,220,4,0,0,115,2,0,0,0,0,3,122,27,66,
     117,105,108,116,105,110,73,109,112,111,114,116,101,114,46,109,
     111,100,117,108,101,95,114,101,112,114,78,99,4,0,0,0,
     0,0,0,0,4,0,0,0,5,0,0,0,67,0,0,0,
     115,58,0,0,0,124,2,0,100,0,0,107,9,0,114,16,
-    0,100,0,0,83,116,0,0,106,1,0,124,1,0,131,1,
+    0,100,0,0,83,116,0,0,160,1,0,124,1,0,161,1,
     0,114,50,0,116,2,0,124,1,0,124,0,0,100,1,0,
     100,2,0,131,2,1,83,100,0,0,83,100,0,0,83,41,
     3,78,114,217,0,0,0,122,8,98,117,105,108,116,45,105,
@@ -2085,13 +2085,13 @@ const unsigned char _Py_M__importlib[] = {
     108,116,105,110,114,173,0,0,0,41,4,114,247,0,0,0,
     114,158,0,0,0,114,35,0,0,0,218,6,116,97,114,103,
     101,116,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,218,9,102,105,110,100,95,115,112,101,99,224,4,0,0,
+    0,218,9,102,105,110,100,95,115,112,101,99,225,4,0,0,
     115,10,0,0,0,0,2,12,1,4,1,15,1,19,2,122,
     25,66,117,105,108,116,105,110,73,109,112,111,114,116,101,114,
     46,102,105,110,100,95,115,112,101,99,99,3,0,0,0,0,
-    0,0,0,4,0,0,0,3,0,0,0,67,0,0,0,115,
-    41,0,0,0,124,0,0,106,0,0,124,1,0,124,2,0,
-    131,2,0,125,3,0,124,3,0,100,1,0,107,9,0,114,
+    0,0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,
+    41,0,0,0,124,0,0,160,0,0,124,1,0,124,2,0,
+    161,2,0,125,3,0,124,3,0,100,1,0,107,9,0,114,
     37,0,124,3,0,106,1,0,83,100,1,0,83,41,2,122,
     113,70,105,110,100,32,116,104,101,32,98,117,105,108,116,45,
     105,110,32,109,111,100,117,108,101,46,10,10,32,32,32,32,
@@ -2104,7 +2104,7 @@ const unsigned char _Py_M__importlib[] = {
     4,114,247,0,0,0,114,158,0,0,0,114,35,0,0,0,
     114,177,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,11,102,105,110,100,95,109,111,100,117,108,
-    101,233,4,0,0,115,4,0,0,0,0,7,18,1,122,27,
+    101,234,4,0,0,115,4,0,0,0,0,7,18,1,122,27,
     66,117,105,108,116,105,110,73,109,112,111,114,116,101,114,46,
     102,105,110,100,95,109,111,100,117,108,101,99,2,0,0,0,
     0,0,0,0,3,0,0,0,10,0,0,0,67,0,0,0,
@@ -2118,7 +2118,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,90,12,105,110,105,116,95,98,117,105,108,116,105,110,
     114,204,0,0,0,114,251,0,0,0,41,3,114,247,0,0,
     0,114,158,0,0,0,114,179,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,5,1,0,0,243,
+    114,4,0,0,0,114,5,0,0,0,114,5,1,0,0,244,
     4,0,0,115,10,0,0,0,0,4,13,1,24,1,9,1,
     9,1,122,27,66,117,105,108,116,105,110,73,109,112,111,114,
     116,101,114,46,108,111,97,100,95,109,111,100,117,108,101,99,
@@ -2130,7 +2130,7 @@ const unsigned char _Py_M__importlib[] = {
     101,32,111,98,106,101,99,116,115,46,78,114,4,0,0,0,
     41,2,114,247,0,0,0,114,158,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,218,8,103,101,116,
-    95,99,111,100,101,253,4,0,0,115,2,0,0,0,0,4,
+    95,99,111,100,101,254,4,0,0,115,2,0,0,0,0,4,
     122,24,66,117,105,108,116,105,110,73,109,112,111,114,116,101,
     114,46,103,101,116,95,99,111,100,101,99,2,0,0,0,0,
     0,0,0,2,0,0,0,1,0,0,0,67,0,0,0,115,
@@ -2141,7 +2141,7 @@ const unsigned char _Py_M__importlib[] = {
     111,100,101,46,78,114,4,0,0,0,41,2,114,247,0,0,
     0,114,158,0,0,0,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,10,103,101,116,95,115,111,117,114,99,
-    101,3,5,0,0,115,2,0,0,0,0,4,122,26,66,117,
+    101,4,5,0,0,115,2,0,0,0,0,4,122,26,66,117,
     105,108,116,105,110,73,109,112,111,114,116,101,114,46,103,101,
     116,95,115,111,117,114,99,101,99,2,0,0,0,0,0,0,
     0,2,0,0,0,1,0,0,0,67,0,0,0,115,4,0,
@@ -2151,7 +2151,7 @@ const unsigned char _Py_M__importlib[] = {
     101,118,101,114,32,112,97,99,107,97,103,101,115,46,70,114,
     4,0,0,0,41,2,114,247,0,0,0,114,158,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    219,0,0,0,9,5,0,0,115,2,0,0,0,0,5,122,
+    219,0,0,0,10,5,0,0,115,2,0,0,0,0,5,122,
     26,66,117,105,108,116,105,110,73,109,112,111,114,116,101,114,
     46,105,115,95,112,97,99,107,97,103,101,41,14,114,57,0,
     0,0,114,56,0,0,0,114,58,0,0,0,114,59,0,0,
@@ -2160,7 +2160,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,114,161,0,0,0,114,5,1,0,0,114,14,1,
     0,0,114,15,1,0,0,114,219,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,10,1,0,0,210,4,0,0,115,28,0,0,0,12,7,
+    114,10,1,0,0,211,4,0,0,115,28,0,0,0,12,7,
     6,2,18,5,3,1,21,8,3,1,18,9,3,1,21,9,
     3,1,21,5,3,1,21,5,3,1,114,10,1,0,0,99,
     0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,
@@ -2187,41 +2187,41 @@ const unsigned char _Py_M__importlib[] = {
     116,104,101,32,110,101,101,100,32,116,111,10,32,32,32,32,
     105,110,115,116,97,110,116,105,97,116,101,32,116,104,101,32,
     99,108,97,115,115,46,10,10,32,32,32,32,99,1,0,0,
-    0,0,0,0,0,1,0,0,0,2,0,0,0,67,0,0,
-    0,115,16,0,0,0,100,1,0,106,0,0,124,0,0,106,
-    1,0,131,1,0,83,41,2,78,122,22,60,109,111,100,117,
+    0,0,0,0,0,1,0,0,0,3,0,0,0,67,0,0,
+    0,115,16,0,0,0,100,1,0,160,0,0,124,0,0,106,
+    1,0,161,1,0,83,41,2,78,122,22,60,109,111,100,117,
     108,101,32,123,33,114,125,32,40,102,114,111,122,101,110,41,
     62,41,2,114,47,0,0,0,114,57,0,0,0,41,1,218,
     1,109,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,205,0,0,0,26,5,0,0,115,2,0,0,0,0,
+    0,114,205,0,0,0,27,5,0,0,115,2,0,0,0,0,
     3,122,26,70,114,111,122,101,110,73,109,112,111,114,116,101,
     114,46,109,111,100,117,108,101,95,114,101,112,114,78,99,4,
     0,0,0,0,0,0,0,4,0,0,0,5,0,0,0,67,
-    0,0,0,115,42,0,0,0,116,0,0,106,1,0,124,1,
-    0,131,1,0,114,34,0,116,2,0,124,1,0,124,0,0,
+    0,0,0,115,42,0,0,0,116,0,0,160,1,0,124,1,
+    0,161,1,0,114,34,0,116,2,0,124,1,0,124,0,0,
     100,1,0,100,2,0,131,2,1,83,100,0,0,83,100,0,
     0,83,41,3,78,114,217,0,0,0,90,6,102,114,111,122,
     101,110,41,3,114,106,0,0,0,114,162,0,0,0,114,173,
     0,0,0,41,4,114,247,0,0,0,114,158,0,0,0,114,
     35,0,0,0,114,11,1,0,0,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,12,1,0,0,31,5,0,
+    0,0,0,114,5,0,0,0,114,12,1,0,0,32,5,0,
     0,115,6,0,0,0,0,2,15,1,19,2,122,24,70,114,
     111,122,101,110,73,109,112,111,114,116,101,114,46,102,105,110,
     100,95,115,112,101,99,99,3,0,0,0,0,0,0,0,3,
-    0,0,0,2,0,0,0,67,0,0,0,115,23,0,0,0,
-    116,0,0,106,1,0,124,1,0,131,1,0,114,19,0,124,
+    0,0,0,3,0,0,0,67,0,0,0,115,23,0,0,0,
+    116,0,0,160,1,0,124,1,0,161,1,0,114,19,0,124,
     0,0,83,100,1,0,83,41,2,122,21,70,105,110,100,32,
     97,32,102,114,111,122,101,110,32,109,111,100,117,108,101,46,
     78,41,2,114,106,0,0,0,114,162,0,0,0,41,3,114,
     247,0,0,0,114,158,0,0,0,114,35,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,13,1,
-    0,0,38,5,0,0,115,2,0,0,0,0,3,122,26,70,
+    0,0,39,5,0,0,115,2,0,0,0,0,3,122,26,70,
     114,111,122,101,110,73,109,112,111,114,116,101,114,46,102,105,
     110,100,95,109,111,100,117,108,101,99,1,0,0,0,0,0,
     0,0,3,0,0,0,4,0,0,0,67,0,0,0,115,95,
     0,0,0,124,0,0,106,0,0,106,1,0,125,1,0,116,
-    2,0,106,3,0,124,1,0,131,1,0,115,57,0,116,4,
-    0,100,1,0,106,5,0,124,1,0,131,1,0,100,2,0,
+    2,0,160,3,0,124,1,0,161,1,0,115,57,0,116,4,
+    0,100,1,0,160,5,0,124,1,0,161,1,0,100,2,0,
     124,1,0,131,1,1,130,1,0,110,0,0,116,6,0,116,
     2,0,106,7,0,124,1,0,131,2,0,125,2,0,116,8,
     0,124,2,0,124,0,0,106,9,0,131,2,0,1,100,0,
@@ -2233,7 +2233,7 @@ const unsigned char _Py_M__importlib[] = {
     116,95,102,114,111,122,101,110,95,111,98,106,101,99,116,114,
     175,0,0,0,114,63,0,0,0,41,3,114,179,0,0,0,
     114,67,0,0,0,114,194,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,2,1,0,0,43,5,
+    4,0,0,0,114,5,0,0,0,114,2,1,0,0,44,5,
     0,0,115,12,0,0,0,0,2,12,1,15,1,18,1,12,
     1,18,1,122,26,70,114,111,122,101,110,73,109,112,111,114,
     116,101,114,46,101,120,101,99,95,109,111,100,117,108,101,99,
@@ -2243,18 +2243,18 @@ const unsigned char _Py_M__importlib[] = {
     32,102,114,111,122,101,110,32,109,111,100,117,108,101,46,41,
     1,114,180,0,0,0,41,2,114,247,0,0,0,114,158,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,5,1,0,0,52,5,0,0,115,2,0,0,0,0,
+    0,114,5,1,0,0,53,5,0,0,115,2,0,0,0,0,
     3,122,26,70,114,111,122,101,110,73,109,112,111,114,116,101,
     114,46,108,111,97,100,95,109,111,100,117,108,101,99,2,0,
-    0,0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,
-    0,0,115,13,0,0,0,116,0,0,106,1,0,124,1,0,
-    131,1,0,83,41,1,122,45,82,101,116,117,114,110,32,116,
+    0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,
+    0,0,115,13,0,0,0,116,0,0,160,1,0,124,1,0,
+    161,1,0,83,41,1,122,45,82,101,116,117,114,110,32,116,
     104,101,32,99,111,100,101,32,111,98,106,101,99,116,32,102,
     111,114,32,116,104,101,32,102,114,111,122,101,110,32,109,111,
     100,117,108,101,46,41,2,114,106,0,0,0,114,19,1,0,
     0,41,2,114,247,0,0,0,114,158,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,14,1,0,
-    0,57,5,0,0,115,2,0,0,0,0,4,122,23,70,114,
+    0,58,5,0,0,115,2,0,0,0,0,4,122,23,70,114,
     111,122,101,110,73,109,112,111,114,116,101,114,46,103,101,116,
     95,99,111,100,101,99,2,0,0,0,0,0,0,0,2,0,
     0,0,1,0,0,0,67,0,0,0,115,4,0,0,0,100,
@@ -2264,18 +2264,18 @@ const unsigned char _Py_M__importlib[] = {
     32,115,111,117,114,99,101,32,99,111,100,101,46,78,114,4,
     0,0,0,41,2,114,247,0,0,0,114,158,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,15,
-    1,0,0,63,5,0,0,115,2,0,0,0,0,4,122,25,
+    1,0,0,64,5,0,0,115,2,0,0,0,0,4,122,25,
     70,114,111,122,101,110,73,109,112,111,114,116,101,114,46,103,
     101,116,95,115,111,117,114,99,101,99,2,0,0,0,0,0,
-    0,0,2,0,0,0,2,0,0,0,67,0,0,0,115,13,
-    0,0,0,116,0,0,106,1,0,124,1,0,131,1,0,83,
+    0,0,2,0,0,0,3,0,0,0,67,0,0,0,115,13,
+    0,0,0,116,0,0,160,1,0,124,1,0,161,1,0,83,
     41,1,122,46,82,101,116,117,114,110,32,84,114,117,101,32,
     105,102,32,116,104,101,32,102,114,111,122,101,110,32,109,111,
     100,117,108,101,32,105,115,32,97,32,112,97,99,107,97,103,
     101,46,41,2,114,106,0,0,0,90,17,105,115,95,102,114,
     111,122,101,110,95,112,97,99,107,97,103,101,41,2,114,247,
     0,0,0,114,158,0,0,0,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,219,0,0,0,69,5,0,0,
+    0,0,114,5,0,0,0,114,219,0,0,0,70,5,0,0,
     115,2,0,0,0,0,4,122,25,70,114,111,122,101,110,73,
     109,112,111,114,116,101,114,46,105,115,95,112,97,99,107,97,
     103,101,41,15,114,57,0,0,0,114,56,0,0,0,114,58,
@@ -2284,7 +2284,7 @@ const unsigned char _Py_M__importlib[] = {
     0,114,2,1,0,0,114,5,1,0,0,114,164,0,0,0,
     114,14,1,0,0,114,15,1,0,0,114,219,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,17,1,0,0,17,5,0,0,115,28,0,0,
+    0,0,0,114,17,1,0,0,18,5,0,0,115,28,0,0,
     0,12,7,6,2,18,5,3,1,21,6,3,1,18,4,18,
     9,18,5,3,1,21,5,3,1,21,5,3,1,114,17,1,
     0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,5,
@@ -2311,10 +2311,10 @@ const unsigned char _Py_M__importlib[] = {
     115,105,111,110,125,92,77,111,100,117,108,101,115,92,123,102,
     117,108,108,110,97,109,101,125,92,68,101,98,117,103,70,99,
     2,0,0,0,0,0,0,0,2,0,0,0,11,0,0,0,
-    67,0,0,0,115,67,0,0,0,121,23,0,116,0,0,106,
-    1,0,116,0,0,106,2,0,124,1,0,131,2,0,83,87,
+    67,0,0,0,115,67,0,0,0,121,23,0,116,0,0,160,
+    1,0,116,0,0,106,2,0,124,1,0,161,2,0,83,87,
     110,37,0,4,116,3,0,107,10,0,114,62,0,1,1,1,
-    116,0,0,106,1,0,116,0,0,106,4,0,124,1,0,131,
+    116,0,0,160,1,0,116,0,0,106,4,0,124,1,0,161,
     2,0,83,89,110,1,0,88,100,0,0,83,41,1,78,41,
     5,218,7,95,119,105,110,114,101,103,90,7,79,112,101,110,
     75,101,121,90,17,72,75,69,89,95,67,85,82,82,69,78,
@@ -2322,18 +2322,18 @@ const unsigned char _Py_M__importlib[] = {
     89,95,76,79,67,65,76,95,77,65,67,72,73,78,69,41,
     2,114,247,0,0,0,218,3,107,101,121,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,14,95,111,112,101,
-    110,95,114,101,103,105,115,116,114,121,88,5,0,0,115,8,
+    110,95,114,101,103,105,115,116,114,121,89,5,0,0,115,8,
     0,0,0,0,2,3,1,23,1,13,1,122,36,87,105,110,
     100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,100,
     101,114,46,95,111,112,101,110,95,114,101,103,105,115,116,114,
-    121,99,2,0,0,0,0,0,0,0,6,0,0,0,16,0,
+    121,99,2,0,0,0,0,0,0,0,6,0,0,0,17,0,
     0,0,67,0,0,0,115,142,0,0,0,124,0,0,106,0,
     0,114,21,0,124,0,0,106,1,0,125,2,0,110,9,0,
     124,0,0,106,2,0,125,2,0,124,2,0,106,3,0,100,
     1,0,124,1,0,100,2,0,116,4,0,106,5,0,100,0,
     0,100,3,0,133,2,0,25,131,0,2,125,3,0,121,46,
-    0,124,0,0,106,6,0,124,3,0,131,1,0,143,25,0,
-    125,4,0,116,7,0,106,8,0,124,4,0,100,4,0,131,
+    0,124,0,0,160,6,0,124,3,0,161,1,0,143,25,0,
+    125,4,0,116,7,0,160,8,0,124,4,0,100,4,0,161,
     2,0,125,5,0,87,100,0,0,81,88,87,110,22,0,4,
     116,9,0,107,10,0,114,137,0,1,1,1,100,0,0,83,
     89,110,1,0,88,124,5,0,83,41,5,78,114,158,0,0,
@@ -2349,20 +2349,20 @@ const unsigned char _Py_M__importlib[] = {
     121,114,22,1,0,0,90,4,104,107,101,121,218,8,102,105,
     108,101,112,97,116,104,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,16,95,115,101,97,114,99,104,95,114,
-    101,103,105,115,116,114,121,95,5,0,0,115,22,0,0,0,
+    101,103,105,115,116,114,121,96,5,0,0,115,22,0,0,0,
     0,2,9,1,12,2,9,1,15,1,22,1,3,1,18,1,
     28,1,13,1,9,1,122,38,87,105,110,100,111,119,115,82,
     101,103,105,115,116,114,121,70,105,110,100,101,114,46,95,115,
     101,97,114,99,104,95,114,101,103,105,115,116,114,121,78,99,
     4,0,0,0,0,0,0,0,8,0,0,0,14,0,0,0,
-    67,0,0,0,115,155,0,0,0,124,0,0,106,0,0,124,
-    1,0,131,1,0,125,4,0,124,4,0,100,0,0,107,8,
+    67,0,0,0,115,155,0,0,0,124,0,0,160,0,0,124,
+    1,0,161,1,0,125,4,0,124,4,0,100,0,0,107,8,
     0,114,31,0,100,0,0,83,121,14,0,116,1,0,124,4,
     0,131,1,0,1,87,110,22,0,4,116,2,0,107,10,0,
     114,69,0,1,1,1,100,0,0,83,89,110,1,0,88,120,
     78,0,116,3,0,131,0,0,68,93,67,0,92,2,0,125,
-    5,0,125,6,0,124,4,0,106,4,0,116,5,0,124,6,
-    0,131,1,0,131,1,0,114,80,0,116,6,0,124,1,0,
+    5,0,125,6,0,124,4,0,160,4,0,116,5,0,124,6,
+    0,131,1,0,161,1,0,114,80,0,116,6,0,124,1,0,
     124,5,0,124,1,0,124,4,0,131,2,0,100,1,0,124,
     4,0,131,2,1,125,7,0,124,7,0,83,113,80,0,87,
     100,0,0,83,41,2,78,114,217,0,0,0,41,7,114,29,
@@ -2371,14 +2371,14 @@ const unsigned char _Py_M__importlib[] = {
     0,41,8,114,247,0,0,0,114,158,0,0,0,114,35,0,
     0,0,114,11,1,0,0,114,28,1,0,0,114,169,0,0,
     0,114,127,0,0,0,114,177,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,12,1,0,0,110,
+    114,4,0,0,0,114,5,0,0,0,114,12,1,0,0,111,
     5,0,0,115,24,0,0,0,0,3,15,1,12,1,4,1,
     3,1,14,1,13,1,9,1,22,1,21,1,21,1,9,1,
     122,31,87,105,110,100,111,119,115,82,101,103,105,115,116,114,
     121,70,105,110,100,101,114,46,102,105,110,100,95,115,112,101,
-    99,99,3,0,0,0,0,0,0,0,4,0,0,0,3,0,
-    0,0,67,0,0,0,115,45,0,0,0,116,0,0,106,1,
-    0,124,1,0,124,2,0,131,2,0,125,3,0,124,3,0,
+    99,99,3,0,0,0,0,0,0,0,4,0,0,0,4,0,
+    0,0,67,0,0,0,115,45,0,0,0,116,0,0,160,1,
+    0,124,1,0,124,2,0,161,2,0,125,3,0,124,3,0,
     100,1,0,107,9,0,114,37,0,124,3,0,106,2,0,83,
     100,1,0,83,100,1,0,83,41,2,122,34,70,105,110,100,
     32,109,111,100,117,108,101,32,110,97,109,101,100,32,105,110,
@@ -2386,7 +2386,7 @@ const unsigned char _Py_M__importlib[] = {
     3,114,71,0,0,0,114,12,1,0,0,114,169,0,0,0,
     41,4,114,247,0,0,0,114,158,0,0,0,114,35,0,0,
     0,114,177,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,5,0,0,0,114,13,1,0,0,126,5,0,0,115,8,
+    114,5,0,0,0,114,13,1,0,0,127,5,0,0,115,8,
     0,0,0,0,3,18,1,12,1,7,2,122,33,87,105,110,
     100,111,119,115,82,101,103,105,115,116,114,121,70,105,110,100,
     101,114,46,102,105,110,100,95,109,111,100,117,108,101,41,12,
@@ -2395,7 +2395,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,114,9,1,0,0,114,23,1,0,0,114,29,1,
     0,0,114,12,1,0,0,114,13,1,0,0,114,4,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,20,1,0,0,76,5,0,0,115,20,0,0,0,12,2,
+    114,20,1,0,0,77,5,0,0,115,20,0,0,0,12,2,
     6,3,6,3,6,2,6,2,18,7,18,15,3,1,21,15,
     3,1,114,20,1,0,0,99,0,0,0,0,0,0,0,0,
     0,0,0,0,2,0,0,0,64,0,0,0,115,52,0,0,
@@ -2409,11 +2409,11 @@ const unsigned char _Py_M__importlib[] = {
     32,83,111,117,114,99,101,76,111,97,100,101,114,32,97,110,
     100,10,32,32,32,32,83,111,117,114,99,101,108,101,115,115,
     70,105,108,101,76,111,97,100,101,114,46,99,2,0,0,0,
-    0,0,0,0,5,0,0,0,3,0,0,0,67,0,0,0,
-    115,88,0,0,0,116,0,0,124,0,0,106,1,0,124,1,
-    0,131,1,0,131,1,0,100,1,0,25,125,2,0,124,2,
-    0,106,2,0,100,2,0,100,1,0,131,2,0,100,3,0,
-    25,125,3,0,124,1,0,106,3,0,100,2,0,131,1,0,
+    0,0,0,0,5,0,0,0,4,0,0,0,67,0,0,0,
+    115,88,0,0,0,116,0,0,124,0,0,160,1,0,124,1,
+    0,161,1,0,131,1,0,100,1,0,25,125,2,0,124,2,
+    0,160,2,0,100,2,0,100,1,0,161,2,0,100,3,0,
+    25,125,3,0,124,1,0,160,3,0,100,2,0,161,1,0,
     100,4,0,25,125,4,0,124,3,0,100,5,0,107,2,0,
     111,87,0,124,4,0,100,5,0,107,3,0,83,41,6,122,
     141,67,111,110,99,114,101,116,101,32,105,109,112,108,101,109,
@@ -2431,14 +2431,14 @@ const unsigned char _Py_M__importlib[] = {
     71,0,0,0,114,158,0,0,0,114,131,0,0,0,90,13,
     102,105,108,101,110,97,109,101,95,98,97,115,101,90,9,116,
     97,105,108,95,110,97,109,101,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,219,0,0,0,142,5,0,0,
+    0,0,114,5,0,0,0,114,219,0,0,0,143,5,0,0,
     115,8,0,0,0,0,3,25,1,22,1,19,1,122,24,95,
     76,111,97,100,101,114,66,97,115,105,99,115,46,105,115,95,
     112,97,99,107,97,103,101,99,2,0,0,0,0,0,0,0,
     3,0,0,0,4,0,0,0,67,0,0,0,115,80,0,0,
-    0,124,0,0,106,0,0,124,1,0,106,1,0,131,1,0,
+    0,124,0,0,160,0,0,124,1,0,106,1,0,161,1,0,
     125,2,0,124,2,0,100,1,0,107,8,0,114,57,0,116,
-    2,0,100,2,0,106,3,0,124,1,0,106,1,0,131,1,
+    2,0,100,2,0,160,3,0,124,1,0,106,1,0,161,1,
     0,131,1,0,130,1,0,110,0,0,116,4,0,116,5,0,
     124,2,0,124,1,0,106,6,0,131,3,0,1,100,1,0,
     83,41,3,122,19,69,120,101,99,117,116,101,32,116,104,101,
@@ -2450,14 +2450,14 @@ const unsigned char _Py_M__importlib[] = {
     114,47,0,0,0,114,114,0,0,0,114,175,0,0,0,114,
     63,0,0,0,41,3,114,71,0,0,0,114,179,0,0,0,
     114,194,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,2,1,0,0,150,5,0,0,115,10,0,
+    5,0,0,0,114,2,1,0,0,151,5,0,0,115,10,0,
     0,0,0,2,18,1,12,1,3,1,24,1,122,25,95,76,
     111,97,100,101,114,66,97,115,105,99,115,46,101,120,101,99,
     95,109,111,100,117,108,101,78,41,8,114,57,0,0,0,114,
     56,0,0,0,114,58,0,0,0,114,59,0,0,0,114,219,
     0,0,0,114,2,1,0,0,114,180,0,0,0,114,5,1,
     0,0,114,4,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,30,1,0,0,136,5,0,0,115,
+    0,114,5,0,0,0,114,30,1,0,0,137,5,0,0,115,
     8,0,0,0,12,3,6,3,12,8,12,8,114,30,1,0,
     0,99,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
     0,0,64,0,0,0,115,106,0,0,0,101,0,0,90,1,
@@ -2485,11 +2485,11 @@ const unsigned char _Py_M__importlib[] = {
     41,1,218,7,73,79,69,114,114,111,114,41,2,114,71,0,
     0,0,114,35,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,10,112,97,116,104,95,109,116,105,
-    109,101,163,5,0,0,115,2,0,0,0,0,6,122,23,83,
+    109,101,164,5,0,0,115,2,0,0,0,0,6,122,23,83,
     111,117,114,99,101,76,111,97,100,101,114,46,112,97,116,104,
     95,109,116,105,109,101,99,2,0,0,0,0,0,0,0,2,
-    0,0,0,3,0,0,0,67,0,0,0,115,20,0,0,0,
-    105,1,0,124,0,0,106,0,0,124,1,0,131,1,0,100,
+    0,0,0,4,0,0,0,67,0,0,0,115,20,0,0,0,
+    105,1,0,124,0,0,160,0,0,124,1,0,161,1,0,100,
     1,0,54,83,41,2,97,170,1,0,0,79,112,116,105,111,
     110,97,108,32,109,101,116,104,111,100,32,114,101,116,117,114,
     110,105,110,103,32,97,32,109,101,116,97,100,97,116,97,32,
@@ -2520,12 +2520,12 @@ const unsigned char _Py_M__importlib[] = {
     32,32,32,32,32,114,183,0,0,0,41,1,114,33,1,0,
     0,41,2,114,71,0,0,0,114,35,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,10,112,97,
-    116,104,95,115,116,97,116,115,171,5,0,0,115,2,0,0,
+    116,104,95,115,116,97,116,115,172,5,0,0,115,2,0,0,
     0,0,11,122,23,83,111,117,114,99,101,76,111,97,100,101,
     114,46,112,97,116,104,95,115,116,97,116,115,99,4,0,0,
-    0,0,0,0,0,4,0,0,0,3,0,0,0,67,0,0,
-    0,115,16,0,0,0,124,0,0,106,0,0,124,2,0,124,
-    3,0,131,2,0,83,41,1,122,228,79,112,116,105,111,110,
+    0,0,0,0,0,4,0,0,0,4,0,0,0,67,0,0,
+    0,115,16,0,0,0,124,0,0,160,0,0,124,2,0,124,
+    3,0,161,2,0,83,41,1,122,228,79,112,116,105,111,110,
     97,108,32,109,101,116,104,111,100,32,119,104,105,99,104,32,
     119,114,105,116,101,115,32,100,97,116,97,32,40,98,121,116,
     101,115,41,32,116,111,32,97,32,102,105,108,101,32,112,97,
@@ -2544,7 +2544,7 @@ const unsigned char _Py_M__importlib[] = {
     0,114,141,0,0,0,90,10,99,97,99,104,101,95,112,97,
     116,104,114,53,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,15,95,99,97,99,104,101,95,98,
-    121,116,101,99,111,100,101,184,5,0,0,115,2,0,0,0,
+    121,116,101,99,111,100,101,185,5,0,0,115,2,0,0,0,
     0,8,122,28,83,111,117,114,99,101,76,111,97,100,101,114,
     46,95,99,97,99,104,101,95,98,121,116,101,99,111,100,101,
     99,3,0,0,0,0,0,0,0,3,0,0,0,1,0,0,
@@ -2561,12 +2561,12 @@ const unsigned char _Py_M__importlib[] = {
     32,32,32,32,32,32,32,32,78,114,4,0,0,0,41,3,
     114,71,0,0,0,114,35,0,0,0,114,53,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,35,
-    1,0,0,194,5,0,0,115,0,0,0,0,122,21,83,111,
+    1,0,0,195,5,0,0,115,0,0,0,0,122,21,83,111,
     117,114,99,101,76,111,97,100,101,114,46,115,101,116,95,100,
     97,116,97,99,2,0,0,0,0,0,0,0,5,0,0,0,
     16,0,0,0,67,0,0,0,115,105,0,0,0,124,0,0,
-    106,0,0,124,1,0,131,1,0,125,2,0,121,19,0,124,
-    0,0,106,1,0,124,2,0,131,1,0,125,3,0,87,110,
+    160,0,0,124,1,0,161,1,0,125,2,0,121,19,0,124,
+    0,0,160,1,0,124,2,0,161,1,0,125,3,0,87,110,
     58,0,4,116,2,0,107,10,0,114,94,0,1,125,4,0,
     1,122,26,0,116,3,0,100,1,0,100,2,0,124,1,0,
     131,1,1,124,4,0,130,2,0,87,89,100,3,0,100,3,
@@ -2582,7 +2582,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,153,0,0,0,114,203,0,0,0,41,5,114,
     71,0,0,0,114,158,0,0,0,114,35,0,0,0,114,201,
     0,0,0,218,3,101,120,99,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,15,1,0,0,201,5,0,0,
+    0,0,114,5,0,0,0,114,15,1,0,0,202,5,0,0,
     115,14,0,0,0,0,2,15,1,3,1,19,1,18,1,9,
     1,31,1,122,23,83,111,117,114,99,101,76,111,97,100,101,
     114,46,103,101,116,95,115,111,117,114,99,101,218,9,95,111,
@@ -2604,20 +2604,20 @@ const unsigned char _Py_M__importlib[] = {
     112,105,108,101,41,4,114,71,0,0,0,114,53,0,0,0,
     114,35,0,0,0,114,39,1,0,0,114,4,0,0,0,114,
     4,0,0,0,114,5,0,0,0,218,14,115,111,117,114,99,
-    101,95,116,111,95,99,111,100,101,211,5,0,0,115,4,0,
+    101,95,116,111,95,99,111,100,101,212,5,0,0,115,4,0,
     0,0,0,5,18,1,122,27,83,111,117,114,99,101,76,111,
     97,100,101,114,46,115,111,117,114,99,101,95,116,111,95,99,
     111,100,101,99,2,0,0,0,0,0,0,0,10,0,0,0,
     45,0,0,0,67,0,0,0,115,177,1,0,0,124,0,0,
-    106,0,0,124,1,0,131,1,0,125,2,0,100,1,0,125,
+    160,0,0,124,1,0,161,1,0,125,2,0,100,1,0,125,
     3,0,121,16,0,116,1,0,124,2,0,131,1,0,125,4,
     0,87,110,24,0,4,116,2,0,107,10,0,114,63,0,1,
     1,1,100,1,0,125,4,0,89,110,202,0,88,121,19,0,
-    124,0,0,106,3,0,124,2,0,131,1,0,125,5,0,87,
+    124,0,0,160,3,0,124,2,0,161,1,0,125,5,0,87,
     110,18,0,4,116,4,0,107,10,0,114,103,0,1,1,1,
     89,110,162,0,88,116,5,0,124,5,0,100,2,0,25,131,
-    1,0,125,3,0,121,19,0,124,0,0,106,6,0,124,4,
-    0,131,1,0,125,6,0,87,110,18,0,4,116,7,0,107,
+    1,0,125,3,0,121,19,0,124,0,0,160,6,0,124,4,
+    0,161,1,0,125,6,0,87,110,18,0,4,116,7,0,107,
     10,0,114,159,0,1,1,1,89,110,106,0,88,121,34,0,
     116,8,0,124,6,0,100,3,0,124,5,0,100,4,0,124,
     1,0,100,5,0,124,4,0,131,1,3,125,7,0,87,110,
@@ -2625,15 +2625,15 @@ const unsigned char _Py_M__importlib[] = {
     220,0,1,1,1,89,110,45,0,88,116,11,0,100,6,0,
     124,4,0,124,2,0,131,3,0,1,116,12,0,124,7,0,
     100,4,0,124,1,0,100,7,0,124,4,0,100,8,0,124,
-    2,0,131,1,3,83,124,0,0,106,6,0,124,2,0,131,
-    1,0,125,8,0,124,0,0,106,13,0,124,8,0,124,2,
-    0,131,2,0,125,9,0,116,11,0,100,9,0,124,2,0,
+    2,0,131,1,3,83,124,0,0,160,6,0,124,2,0,161,
+    1,0,125,8,0,124,0,0,160,13,0,124,8,0,124,2,
+    0,161,2,0,125,9,0,116,11,0,100,9,0,124,2,0,
     131,2,0,1,116,14,0,106,15,0,12,114,173,1,124,4,
     0,100,1,0,107,9,0,114,173,1,124,3,0,100,1,0,
     107,9,0,114,173,1,116,16,0,124,9,0,124,3,0,116,
     17,0,124,8,0,131,1,0,131,3,0,125,6,0,121,36,
-    0,124,0,0,106,18,0,124,2,0,124,4,0,124,6,0,
-    131,3,0,1,116,11,0,100,10,0,124,4,0,131,2,0,
+    0,124,0,0,160,18,0,124,2,0,124,4,0,124,6,0,
+    161,3,0,1,116,11,0,100,10,0,124,4,0,131,2,0,
     1,87,113,173,1,4,116,2,0,107,10,0,114,169,1,1,
     1,1,89,113,173,1,88,110,0,0,124,9,0,83,41,11,
     122,190,67,111,110,99,114,101,116,101,32,105,109,112,108,101,
@@ -2665,7 +2665,7 @@ const unsigned char _Py_M__importlib[] = {
     53,0,0,0,218,10,98,121,116,101,115,95,100,97,116,97,
     114,201,0,0,0,90,11,99,111,100,101,95,111,98,106,101,
     99,116,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,14,1,0,0,219,5,0,0,115,78,0,0,0,0,
+    0,114,14,1,0,0,220,5,0,0,115,78,0,0,0,0,
     7,15,1,6,1,3,1,16,1,13,1,11,2,3,1,19,
     1,13,1,5,2,16,1,3,1,19,1,13,1,5,2,3,
     1,9,1,12,1,13,1,19,1,5,2,9,1,7,1,15,
@@ -2677,7 +2677,7 @@ const unsigned char _Py_M__importlib[] = {
     114,34,1,0,0,114,36,1,0,0,114,35,1,0,0,114,
     15,1,0,0,114,42,1,0,0,114,14,1,0,0,114,4,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,31,1,0,0,161,5,0,0,115,14,0,0,0,
+    0,0,114,31,1,0,0,162,5,0,0,115,14,0,0,0,
     12,2,12,8,12,13,12,10,12,7,12,10,18,8,114,31,
     1,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,
     4,0,0,0,0,0,0,0,115,88,0,0,0,101,0,0,
@@ -2704,18 +2704,18 @@ const unsigned char _Py_M__importlib[] = {
     32,32,32,32,102,105,110,100,101,114,46,78,41,2,114,67,
     0,0,0,114,35,0,0,0,41,3,114,71,0,0,0,114,
     158,0,0,0,114,35,0,0,0,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,72,0,0,0,20,6,0,
+    0,0,0,114,5,0,0,0,114,72,0,0,0,21,6,0,
     0,115,4,0,0,0,0,3,9,1,122,19,70,105,108,101,
     76,111,97,100,101,114,46,95,95,105,110,105,116,95,95,99,
     2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
     3,0,0,0,115,22,0,0,0,116,0,0,116,1,0,124,
-    0,0,131,2,0,106,2,0,124,1,0,131,1,0,83,41,
+    0,0,131,2,0,160,2,0,124,1,0,161,1,0,83,41,
     1,122,26,76,111,97,100,32,97,32,109,111,100,117,108,101,
     32,102,114,111,109,32,97,32,102,105,108,101,46,41,3,218,
     5,115,117,112,101,114,114,46,1,0,0,114,5,1,0,0,
     41,2,114,71,0,0,0,114,158,0,0,0,41,1,114,224,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,5,1,
-    0,0,26,6,0,0,115,2,0,0,0,0,7,122,22,70,
+    0,0,27,6,0,0,115,2,0,0,0,0,7,122,22,70,
     105,108,101,76,111,97,100,101,114,46,108,111,97,100,95,109,
     111,100,117,108,101,99,2,0,0,0,0,0,0,0,2,0,
     0,0,1,0,0,0,67,0,0,0,115,7,0,0,0,124,
@@ -2725,27 +2725,27 @@ const unsigned char _Py_M__importlib[] = {
     102,111,117,110,100,32,98,121,32,116,104,101,32,102,105,110,
     100,101,114,46,41,1,114,35,0,0,0,41,2,114,71,0,
     0,0,114,158,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,236,0,0,0,35,6,0,0,115,
+    0,114,5,0,0,0,114,236,0,0,0,36,6,0,0,115,
     2,0,0,0,0,3,122,23,70,105,108,101,76,111,97,100,
     101,114,46,103,101,116,95,102,105,108,101,110,97,109,101,99,
-    2,0,0,0,0,0,0,0,3,0,0,0,8,0,0,0,
-    67,0,0,0,115,41,0,0,0,116,0,0,106,1,0,124,
-    1,0,100,1,0,131,2,0,143,17,0,125,2,0,124,2,
-    0,106,2,0,131,0,0,83,87,100,2,0,81,88,100,2,
+    2,0,0,0,0,0,0,0,3,0,0,0,9,0,0,0,
+    67,0,0,0,115,41,0,0,0,116,0,0,160,1,0,124,
+    1,0,100,1,0,161,2,0,143,17,0,125,2,0,124,2,
+    0,160,2,0,161,0,0,83,87,100,2,0,81,88,100,2,
     0,83,41,3,122,39,82,101,116,117,114,110,32,116,104,101,
     32,100,97,116,97,32,102,114,111,109,32,112,97,116,104,32,
     97,115,32,114,97,119,32,98,121,116,101,115,46,218,1,114,
     78,41,3,114,49,0,0,0,114,50,0,0,0,90,4,114,
     101,97,100,41,3,114,71,0,0,0,114,35,0,0,0,114,
     54,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,37,1,0,0,40,6,0,0,115,4,0,0,
+    0,0,0,114,37,1,0,0,41,6,0,0,115,4,0,0,
     0,0,2,21,1,122,19,70,105,108,101,76,111,97,100,101,
     114,46,103,101,116,95,100,97,116,97,41,9,114,57,0,0,
     0,114,56,0,0,0,114,58,0,0,0,114,59,0,0,0,
     114,72,0,0,0,114,156,0,0,0,114,5,1,0,0,114,
     236,0,0,0,114,37,1,0,0,114,4,0,0,0,114,4,
     0,0,0,41,1,114,224,0,0,0,114,5,0,0,0,114,
-    46,1,0,0,15,6,0,0,115,10,0,0,0,12,3,6,
+    46,1,0,0,16,6,0,0,115,10,0,0,0,12,3,6,
     2,12,6,24,9,18,5,114,46,1,0,0,99,0,0,0,
     0,0,0,0,0,0,0,0,0,4,0,0,0,64,0,0,
     0,115,64,0,0,0,101,0,0,90,1,0,100,0,0,90,
@@ -2768,7 +2768,7 @@ const unsigned char _Py_M__importlib[] = {
     115,116,95,109,116,105,109,101,90,7,115,116,95,115,105,122,
     101,41,3,114,71,0,0,0,114,35,0,0,0,114,44,1,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,34,1,0,0,50,6,0,0,115,4,0,0,0,0,
+    0,114,34,1,0,0,51,6,0,0,115,4,0,0,0,0,
     2,12,1,122,27,83,111,117,114,99,101,70,105,108,101,76,
     111,97,100,101,114,46,112,97,116,104,95,115,116,97,116,115,
     99,4,0,0,0,0,0,0,0,5,0,0,0,5,0,0,
@@ -2779,7 +2779,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,41,5,114,71,0,0,0,114,141,0,0,0,114,140,
     0,0,0,114,53,0,0,0,114,42,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,36,1,0,
-    0,55,6,0,0,115,4,0,0,0,0,2,12,1,122,32,
+    0,56,6,0,0,115,4,0,0,0,0,2,12,1,122,32,
     83,111,117,114,99,101,70,105,108,101,76,111,97,100,101,114,
     46,95,99,97,99,104,101,95,98,121,116,101,99,111,100,101,
     114,51,1,0,0,105,182,1,0,0,99,3,0,0,0,1,
@@ -2788,11 +2788,11 @@ const unsigned char _Py_M__importlib[] = {
     125,4,0,125,5,0,103,0,0,125,6,0,120,54,0,124,
     4,0,114,80,0,116,1,0,124,4,0,131,1,0,12,114,
     80,0,116,0,0,124,4,0,131,1,0,92,2,0,125,4,
-    0,125,7,0,124,6,0,106,2,0,124,7,0,131,1,0,
+    0,125,7,0,124,6,0,160,2,0,124,7,0,161,1,0,
     1,113,27,0,87,120,132,0,116,3,0,124,6,0,131,1,
     0,68,93,118,0,125,7,0,116,4,0,124,4,0,124,7,
-    0,131,2,0,125,4,0,121,17,0,116,5,0,106,6,0,
-    124,4,0,131,1,0,1,87,113,94,0,4,116,7,0,107,
+    0,131,2,0,125,4,0,121,17,0,116,5,0,160,6,0,
+    124,4,0,161,1,0,1,87,113,94,0,4,116,7,0,107,
     10,0,114,155,0,1,1,1,119,94,0,89,113,94,0,4,
     116,8,0,107,10,0,114,211,0,1,125,8,0,1,122,25,
     0,116,9,0,100,1,0,124,4,0,124,8,0,131,3,0,
@@ -2816,7 +2816,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,35,0,0,0,114,53,0,0,0,114,51,1,0,
     0,114,231,0,0,0,114,131,0,0,0,114,27,0,0,0,
     114,23,0,0,0,114,38,1,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,35,1,0,0,60,6,
+    4,0,0,0,114,5,0,0,0,114,35,1,0,0,61,6,
     0,0,115,38,0,0,0,0,2,18,1,6,2,22,1,18,
     1,17,2,19,1,15,1,3,1,17,1,13,2,7,1,18,
     3,16,1,27,1,3,1,16,1,17,1,18,2,122,25,83,
@@ -2825,7 +2825,7 @@ const unsigned char _Py_M__importlib[] = {
     114,56,0,0,0,114,58,0,0,0,114,59,0,0,0,114,
     34,1,0,0,114,36,1,0,0,114,35,1,0,0,114,4,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,49,1,0,0,46,6,0,0,115,8,0,0,0,
+    0,0,114,49,1,0,0,47,6,0,0,115,8,0,0,0,
     12,2,6,2,12,5,12,5,114,49,1,0,0,99,0,0,
     0,0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,
     0,0,115,46,0,0,0,101,0,0,90,1,0,100,0,0,
@@ -2837,8 +2837,8 @@ const unsigned char _Py_M__importlib[] = {
     108,101,115,32,115,111,117,114,99,101,108,101,115,115,32,102,
     105,108,101,32,105,109,112,111,114,116,115,46,99,2,0,0,
     0,0,0,0,0,5,0,0,0,6,0,0,0,67,0,0,
-    0,115,76,0,0,0,124,0,0,106,0,0,124,1,0,131,
-    1,0,125,2,0,124,0,0,106,1,0,124,2,0,131,1,
+    0,115,76,0,0,0,124,0,0,160,0,0,124,1,0,161,
+    1,0,125,2,0,124,0,0,160,1,0,124,2,0,161,1,
     0,125,3,0,116,2,0,124,3,0,100,1,0,124,1,0,
     100,2,0,124,2,0,131,1,2,125,4,0,116,3,0,124,
     4,0,100,1,0,124,1,0,100,3,0,124,2,0,131,1,
@@ -2847,7 +2847,7 @@ const unsigned char _Py_M__importlib[] = {
     114,190,0,0,0,114,195,0,0,0,41,5,114,71,0,0,
     0,114,158,0,0,0,114,35,0,0,0,114,53,0,0,0,
     114,45,1,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,14,1,0,0,93,6,0,0,115,8,0,
+    5,0,0,0,114,14,1,0,0,94,6,0,0,115,8,0,
     0,0,0,1,15,1,15,1,24,1,122,29,83,111,117,114,
     99,101,108,101,115,115,70,105,108,101,76,111,97,100,101,114,
     46,103,101,116,95,99,111,100,101,99,2,0,0,0,0,0,
@@ -2857,13 +2857,13 @@ const unsigned char _Py_M__importlib[] = {
     105,115,32,110,111,32,115,111,117,114,99,101,32,99,111,100,
     101,46,78,114,4,0,0,0,41,2,114,71,0,0,0,114,
     158,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,15,1,0,0,99,6,0,0,115,2,0,0,
+    0,0,0,114,15,1,0,0,100,6,0,0,115,2,0,0,
     0,0,2,122,31,83,111,117,114,99,101,108,101,115,115,70,
     105,108,101,76,111,97,100,101,114,46,103,101,116,95,115,111,
     117,114,99,101,78,41,6,114,57,0,0,0,114,56,0,0,
     0,114,58,0,0,0,114,59,0,0,0,114,14,1,0,0,
     114,15,1,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,53,1,0,0,89,6,
+    4,0,0,0,114,5,0,0,0,114,53,1,0,0,90,6,
     0,0,115,6,0,0,0,12,2,6,2,12,6,114,53,1,
     0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,3,
     0,0,0,64,0,0,0,115,106,0,0,0,101,0,0,90,
@@ -2887,7 +2887,7 @@ const unsigned char _Py_M__importlib[] = {
     2,114,67,0,0,0,114,35,0,0,0,41,3,114,71,0,
     0,0,114,67,0,0,0,114,35,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,72,0,0,0,
-    116,6,0,0,115,4,0,0,0,0,1,9,1,122,28,69,
+    117,6,0,0,115,4,0,0,0,0,1,9,1,122,28,69,
     120,116,101,110,115,105,111,110,70,105,108,101,76,111,97,100,
     101,114,46,95,95,105,110,105,116,95,95,99,2,0,0,0,
     0,0,0,0,4,0,0,0,11,0,0,0,67,0,0,0,
@@ -2895,13 +2895,13 @@ const unsigned char _Py_M__importlib[] = {
     0,1,116,1,0,116,2,0,106,3,0,124,1,0,124,0,
     0,106,4,0,131,3,0,125,2,0,87,100,1,0,81,88,
     116,5,0,100,2,0,124,0,0,106,4,0,131,2,0,1,
-    124,0,0,106,6,0,124,1,0,131,1,0,125,3,0,124,
+    124,0,0,160,6,0,124,1,0,161,1,0,125,3,0,124,
     3,0,114,124,0,116,7,0,124,2,0,100,3,0,131,2,
     0,12,114,124,0,116,8,0,124,0,0,106,4,0,131,1,
     0,100,4,0,25,103,1,0,124,2,0,95,9,0,110,0,
     0,124,0,0,124,2,0,95,10,0,124,2,0,106,11,0,
     124,2,0,95,12,0,124,3,0,115,179,0,124,2,0,106,
-    12,0,106,13,0,100,5,0,131,1,0,100,4,0,25,124,
+    12,0,160,13,0,100,5,0,161,1,0,100,4,0,25,124,
     2,0,95,12,0,110,0,0,124,2,0,83,41,6,122,25,
     76,111,97,100,32,97,110,32,101,120,116,101,110,115,105,111,
     110,32,109,111,100,117,108,101,46,78,122,33,101,120,116,101,
@@ -2915,7 +2915,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,251,0,0,0,114,32,0,0,0,41,4,114,
     71,0,0,0,114,158,0,0,0,114,179,0,0,0,114,219,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,5,1,0,0,120,6,0,0,115,24,0,0,0,
+    0,0,114,5,1,0,0,121,6,0,0,115,24,0,0,0,
     0,3,13,1,9,1,21,1,16,1,15,1,22,1,28,1,
     9,1,12,1,6,1,28,1,122,31,69,120,116,101,110,115,
     105,111,110,70,105,108,101,76,111,97,100,101,114,46,108,111,
@@ -2934,7 +2934,7 @@ const unsigned char _Py_M__importlib[] = {
     3,0,100,1,0,83,41,2,114,72,0,0,0,78,114,4,
     0,0,0,41,2,114,22,0,0,0,218,6,115,117,102,102,
     105,120,41,1,218,9,102,105,108,101,95,110,97,109,101,114,
-    4,0,0,0,114,5,0,0,0,114,77,0,0,0,139,6,
+    4,0,0,0,114,5,0,0,0,114,77,0,0,0,140,6,
     0,0,115,2,0,0,0,6,1,122,49,69,120,116,101,110,
     115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,105,
     115,95,112,97,99,107,97,103,101,46,60,108,111,99,97,108,
@@ -2943,7 +2943,7 @@ const unsigned char _Py_M__importlib[] = {
     88,84,69,78,83,73,79,78,95,83,85,70,70,73,88,69,
     83,41,2,114,71,0,0,0,114,158,0,0,0,114,4,0,
     0,0,41,1,114,56,1,0,0,114,5,0,0,0,114,219,
-    0,0,0,136,6,0,0,115,6,0,0,0,0,2,19,1,
+    0,0,0,137,6,0,0,115,6,0,0,0,0,2,19,1,
     18,1,122,30,69,120,116,101,110,115,105,111,110,70,105,108,
     101,76,111,97,100,101,114,46,105,115,95,112,97,99,107,97,
     103,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
@@ -2954,7 +2954,7 @@ const unsigned char _Py_M__importlib[] = {
     101,97,116,101,32,97,32,99,111,100,101,32,111,98,106,101,
     99,116,46,78,114,4,0,0,0,41,2,114,71,0,0,0,
     114,158,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,14,1,0,0,142,6,0,0,115,2,0,
+    5,0,0,0,114,14,1,0,0,143,6,0,0,115,2,0,
     0,0,0,2,122,28,69,120,116,101,110,115,105,111,110,70,
     105,108,101,76,111,97,100,101,114,46,103,101,116,95,99,111,
     100,101,99,2,0,0,0,0,0,0,0,2,0,0,0,1,
@@ -2964,7 +2964,7 @@ const unsigned char _Py_M__importlib[] = {
     117,108,101,115,32,104,97,118,101,32,110,111,32,115,111,117,
     114,99,101,32,99,111,100,101,46,78,114,4,0,0,0,41,
     2,114,71,0,0,0,114,158,0,0,0,114,4,0,0,0,
-    114,4,0,0,0,114,5,0,0,0,114,15,1,0,0,146,
+    114,4,0,0,0,114,5,0,0,0,114,15,1,0,0,147,
     6,0,0,115,2,0,0,0,0,2,122,30,69,120,116,101,
     110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,46,
     103,101,116,95,115,111,117,114,99,101,99,2,0,0,0,0,
@@ -2976,7 +2976,7 @@ const unsigned char _Py_M__importlib[] = {
     101,32,102,105,110,100,101,114,46,41,1,114,35,0,0,0,
     41,2,114,71,0,0,0,114,158,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,236,0,0,0,
-    150,6,0,0,115,2,0,0,0,0,3,122,32,69,120,116,
+    151,6,0,0,115,2,0,0,0,0,3,122,32,69,120,116,
     101,110,115,105,111,110,70,105,108,101,76,111,97,100,101,114,
     46,103,101,116,95,102,105,108,101,110,97,109,101,78,41,11,
     114,57,0,0,0,114,56,0,0,0,114,58,0,0,0,114,
@@ -2984,7 +2984,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,114,219,0,0,0,114,14,1,0,0,114,15,1,
     0,0,114,236,0,0,0,114,4,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,54,1,0,0,
-    108,6,0,0,115,14,0,0,0,12,6,6,2,12,4,18,
+    109,6,0,0,115,14,0,0,0,12,6,6,2,12,4,18,
     16,12,6,12,4,12,4,114,54,1,0,0,99,0,0,0,
     0,0,0,0,0,0,0,0,0,2,0,0,0,64,0,0,
     0,115,130,0,0,0,101,0,0,90,1,0,100,0,0,90,
@@ -3016,9 +3016,9 @@ const unsigned char _Py_M__importlib[] = {
     112,97,114,101,110,116,32,109,111,100,117,108,101,39,115,32,
     112,97,116,104,10,32,32,32,32,105,115,32,115,121,115,46,
     112,97,116,104,46,99,4,0,0,0,0,0,0,0,4,0,
-    0,0,2,0,0,0,67,0,0,0,115,52,0,0,0,124,
+    0,0,3,0,0,0,67,0,0,0,115,52,0,0,0,124,
     1,0,124,0,0,95,0,0,124,2,0,124,0,0,95,1,
-    0,116,2,0,124,0,0,106,3,0,131,0,0,131,1,0,
+    0,116,2,0,124,0,0,160,3,0,161,0,0,131,1,0,
     124,0,0,95,4,0,124,3,0,124,0,0,95,5,0,100,
     0,0,83,41,1,78,41,6,114,70,0,0,0,114,254,0,
     0,0,114,229,0,0,0,218,16,95,103,101,116,95,112,97,
@@ -3027,12 +3027,12 @@ const unsigned char _Py_M__importlib[] = {
     97,116,104,95,102,105,110,100,101,114,41,4,114,71,0,0,
     0,114,67,0,0,0,114,35,0,0,0,218,11,112,97,116,
     104,95,102,105,110,100,101,114,114,4,0,0,0,114,4,0,
-    0,0,114,5,0,0,0,114,72,0,0,0,163,6,0,0,
+    0,0,114,5,0,0,0,114,72,0,0,0,164,6,0,0,
     115,8,0,0,0,0,1,9,1,9,1,21,1,122,23,95,
     78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,
     105,110,105,116,95,95,99,1,0,0,0,0,0,0,0,4,
     0,0,0,3,0,0,0,67,0,0,0,115,53,0,0,0,
-    124,0,0,106,0,0,106,1,0,100,1,0,131,1,0,92,
+    124,0,0,106,0,0,160,1,0,100,1,0,161,1,0,92,
     3,0,125,1,0,125,2,0,125,3,0,124,2,0,100,2,
     0,107,2,0,114,43,0,100,6,0,83,124,1,0,100,5,
     0,102,2,0,83,41,7,122,62,82,101,116,117,114,110,115,
@@ -3046,28 +3046,28 @@ const unsigned char _Py_M__importlib[] = {
     114,231,0,0,0,218,3,100,111,116,114,94,0,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,23,
     95,102,105,110,100,95,112,97,114,101,110,116,95,112,97,116,
-    104,95,110,97,109,101,115,169,6,0,0,115,8,0,0,0,
+    104,95,110,97,109,101,115,170,6,0,0,115,8,0,0,0,
     0,2,27,1,12,2,4,3,122,38,95,78,97,109,101,115,
     112,97,99,101,80,97,116,104,46,95,102,105,110,100,95,112,
     97,114,101,110,116,95,112,97,116,104,95,110,97,109,101,115,
     99,1,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
-    0,67,0,0,0,115,38,0,0,0,124,0,0,106,0,0,
-    131,0,0,92,2,0,125,1,0,125,2,0,116,1,0,116,
+    0,67,0,0,0,115,38,0,0,0,124,0,0,160,0,0,
+    161,0,0,92,2,0,125,1,0,125,2,0,116,1,0,116,
     2,0,106,3,0,124,1,0,25,124,2,0,131,2,0,83,
     41,1,78,41,4,114,64,1,0,0,114,62,0,0,0,114,
     7,0,0,0,114,73,0,0,0,41,3,114,71,0,0,0,
     90,18,112,97,114,101,110,116,95,109,111,100,117,108,101,95,
     110,97,109,101,90,14,112,97,116,104,95,97,116,116,114,95,
     110,97,109,101,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,59,1,0,0,179,6,0,0,115,4,0,0,
+    0,0,0,114,59,1,0,0,180,6,0,0,115,4,0,0,
     0,0,1,18,1,122,31,95,78,97,109,101,115,112,97,99,
     101,80,97,116,104,46,95,103,101,116,95,112,97,114,101,110,
     116,95,112,97,116,104,99,1,0,0,0,0,0,0,0,3,
-    0,0,0,3,0,0,0,67,0,0,0,115,127,0,0,0,
-    116,0,0,124,0,0,106,1,0,131,0,0,131,1,0,125,
+    0,0,0,4,0,0,0,67,0,0,0,115,127,0,0,0,
+    116,0,0,124,0,0,160,1,0,161,0,0,131,1,0,125,
     1,0,124,1,0,124,0,0,106,2,0,107,3,0,114,120,
-    0,124,0,0,106,3,0,124,0,0,106,4,0,124,1,0,
-    131,2,0,125,2,0,124,2,0,100,0,0,107,9,0,114,
+    0,124,0,0,160,3,0,124,0,0,106,4,0,124,1,0,
+    161,2,0,125,2,0,124,2,0,100,0,0,107,9,0,114,
     108,0,124,2,0,106,5,0,100,0,0,107,8,0,114,108,
     0,124,2,0,106,6,0,114,108,0,124,2,0,106,6,0,
     124,0,0,95,7,0,113,108,0,110,0,0,124,1,0,124,
@@ -3078,49 +3078,49 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,90,11,112,97,114,101,110,116,95,112,97,116,104,
     114,177,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,12,95,114,101,99,97,108,99,117,108,97,
-    116,101,183,6,0,0,115,16,0,0,0,0,2,18,1,15,
+    116,101,184,6,0,0,115,16,0,0,0,0,2,18,1,15,
     1,21,3,27,1,9,1,18,1,12,1,122,27,95,78,97,
     109,101,115,112,97,99,101,80,97,116,104,46,95,114,101,99,
     97,108,99,117,108,97,116,101,99,1,0,0,0,0,0,0,
-    0,1,0,0,0,2,0,0,0,67,0,0,0,115,16,0,
-    0,0,116,0,0,124,0,0,106,1,0,131,0,0,131,1,
+    0,1,0,0,0,3,0,0,0,67,0,0,0,115,16,0,
+    0,0,116,0,0,124,0,0,160,1,0,161,0,0,131,1,
     0,83,41,1,78,41,2,218,4,105,116,101,114,114,65,1,
     0,0,41,1,114,71,0,0,0,114,4,0,0,0,114,4,
     0,0,0,114,5,0,0,0,218,8,95,95,105,116,101,114,
-    95,95,196,6,0,0,115,2,0,0,0,0,1,122,23,95,
+    95,95,197,6,0,0,115,2,0,0,0,0,1,122,23,95,
     78,97,109,101,115,112,97,99,101,80,97,116,104,46,95,95,
     105,116,101,114,95,95,99,1,0,0,0,0,0,0,0,1,
-    0,0,0,2,0,0,0,67,0,0,0,115,16,0,0,0,
-    116,0,0,124,0,0,106,1,0,131,0,0,131,1,0,83,
+    0,0,0,3,0,0,0,67,0,0,0,115,16,0,0,0,
+    116,0,0,124,0,0,160,1,0,161,0,0,131,1,0,83,
     41,1,78,41,2,114,31,0,0,0,114,65,1,0,0,41,
     1,114,71,0,0,0,114,4,0,0,0,114,4,0,0,0,
-    114,5,0,0,0,218,7,95,95,108,101,110,95,95,199,6,
+    114,5,0,0,0,218,7,95,95,108,101,110,95,95,200,6,
     0,0,115,2,0,0,0,0,1,122,22,95,78,97,109,101,
     115,112,97,99,101,80,97,116,104,46,95,95,108,101,110,95,
-    95,99,1,0,0,0,0,0,0,0,1,0,0,0,2,0,
-    0,0,67,0,0,0,115,16,0,0,0,100,1,0,106,0,
-    0,124,0,0,106,1,0,131,1,0,83,41,2,78,122,20,
+    95,99,1,0,0,0,0,0,0,0,1,0,0,0,3,0,
+    0,0,67,0,0,0,115,16,0,0,0,100,1,0,160,0,
+    0,124,0,0,106,1,0,161,1,0,83,41,2,78,122,20,
     95,78,97,109,101,115,112,97,99,101,80,97,116,104,40,123,
     33,114,125,41,41,2,114,47,0,0,0,114,254,0,0,0,
     41,1,114,71,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,101,0,0,0,202,6,0,0,115,
+    0,114,5,0,0,0,114,101,0,0,0,203,6,0,0,115,
     2,0,0,0,0,1,122,23,95,78,97,109,101,115,112,97,
     99,101,80,97,116,104,46,95,95,114,101,112,114,95,95,99,
-    2,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
-    67,0,0,0,115,16,0,0,0,124,1,0,124,0,0,106,
-    0,0,131,0,0,107,6,0,83,41,1,78,41,1,114,65,
+    2,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
+    67,0,0,0,115,16,0,0,0,124,1,0,124,0,0,160,
+    0,0,161,0,0,107,6,0,83,41,1,78,41,1,114,65,
     1,0,0,41,2,114,71,0,0,0,218,4,105,116,101,109,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,
-    12,95,95,99,111,110,116,97,105,110,115,95,95,205,6,0,
+    12,95,95,99,111,110,116,97,105,110,115,95,95,206,6,0,
     0,115,2,0,0,0,0,1,122,27,95,78,97,109,101,115,
     112,97,99,101,80,97,116,104,46,95,95,99,111,110,116,97,
     105,110,115,95,95,99,2,0,0,0,0,0,0,0,2,0,
-    0,0,2,0,0,0,67,0,0,0,115,20,0,0,0,124,
-    0,0,106,0,0,106,1,0,124,1,0,131,1,0,1,100,
+    0,0,3,0,0,0,67,0,0,0,115,20,0,0,0,124,
+    0,0,106,0,0,160,1,0,124,1,0,161,1,0,1,100,
     0,0,83,41,1,78,41,2,114,254,0,0,0,114,223,0,
     0,0,41,2,114,71,0,0,0,114,69,1,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,223,0,
-    0,0,208,6,0,0,115,2,0,0,0,0,1,122,21,95,
+    0,0,209,6,0,0,115,2,0,0,0,0,1,122,21,95,
     78,97,109,101,115,112,97,99,101,80,97,116,104,46,97,112,
     112,101,110,100,78,41,13,114,57,0,0,0,114,56,0,0,
     0,114,58,0,0,0,114,59,0,0,0,114,72,0,0,0,
@@ -3128,7 +3128,7 @@ const unsigned char _Py_M__importlib[] = {
     67,1,0,0,114,68,1,0,0,114,101,0,0,0,114,70,
     1,0,0,114,223,0,0,0,114,4,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,58,1,0,
-    0,156,6,0,0,115,20,0,0,0,12,5,6,2,12,6,
+    0,157,6,0,0,115,20,0,0,0,12,5,6,2,12,6,
     12,10,12,4,12,13,12,3,12,3,12,3,12,3,114,58,
     1,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,
     3,0,0,0,64,0,0,0,115,94,0,0,0,101,0,0,
@@ -3144,31 +3144,31 @@ const unsigned char _Py_M__importlib[] = {
     0,100,0,0,83,41,1,78,41,2,114,58,1,0,0,114,
     254,0,0,0,41,4,114,71,0,0,0,114,67,0,0,0,
     114,35,0,0,0,114,62,1,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,72,0,0,0,214,6,
+    4,0,0,0,114,5,0,0,0,114,72,0,0,0,215,6,
     0,0,115,2,0,0,0,0,1,122,25,95,78,97,109,101,
     115,112,97,99,101,76,111,97,100,101,114,46,95,95,105,110,
     105,116,95,95,99,2,0,0,0,0,0,0,0,2,0,0,
-    0,2,0,0,0,67,0,0,0,115,16,0,0,0,100,1,
-    0,106,0,0,124,1,0,106,1,0,131,1,0,83,41,2,
+    0,3,0,0,0,67,0,0,0,115,16,0,0,0,100,1,
+    0,160,0,0,124,1,0,106,1,0,161,1,0,83,41,2,
     78,122,25,60,109,111,100,117,108,101,32,123,33,114,125,32,
     40,110,97,109,101,115,112,97,99,101,41,62,41,2,114,47,
     0,0,0,114,57,0,0,0,41,2,114,247,0,0,0,114,
     179,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,205,0,0,0,218,6,0,0,115,2,0,0,
+    0,0,0,114,205,0,0,0,219,6,0,0,115,2,0,0,
     0,0,2,122,28,95,78,97,109,101,115,112,97,99,101,76,
     111,97,100,101,114,46,109,111,100,117,108,101,95,114,101,112,
     114,99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,
     0,0,67,0,0,0,115,4,0,0,0,100,1,0,83,41,
     2,78,84,114,4,0,0,0,41,2,114,71,0,0,0,114,
     158,0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,
-    0,0,0,114,219,0,0,0,222,6,0,0,115,2,0,0,
+    0,0,0,114,219,0,0,0,223,6,0,0,115,2,0,0,
     0,0,1,122,27,95,78,97,109,101,115,112,97,99,101,76,
     111,97,100,101,114,46,105,115,95,112,97,99,107,97,103,101,
     99,2,0,0,0,0,0,0,0,2,0,0,0,1,0,0,
     0,67,0,0,0,115,4,0,0,0,100,1,0,83,41,2,
     78,114,30,0,0,0,114,4,0,0,0,41,2,114,71,0,
     0,0,114,158,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,15,1,0,0,225,6,0,0,115,
+    0,114,5,0,0,0,114,15,1,0,0,226,6,0,0,115,
     2,0,0,0,0,1,122,27,95,78,97,109,101,115,112,97,
     99,101,76,111,97,100,101,114,46,103,101,116,95,115,111,117,
     114,99,101,99,2,0,0,0,0,0,0,0,2,0,0,0,
@@ -3178,7 +3178,7 @@ const unsigned char _Py_M__importlib[] = {
     114,105,110,103,62,114,175,0,0,0,114,40,1,0,0,84,
     41,1,114,41,1,0,0,41,2,114,71,0,0,0,114,158,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,14,1,0,0,228,6,0,0,115,2,0,0,0,
+    0,0,114,14,1,0,0,229,6,0,0,115,2,0,0,0,
     0,1,122,25,95,78,97,109,101,115,112,97,99,101,76,111,
     97,100,101,114,46,103,101,116,95,99,111,100,101,99,2,0,
     0,0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,
@@ -3191,7 +3191,7 @@ const unsigned char _Py_M__importlib[] = {
     97,116,104,32,123,33,114,125,41,3,114,152,0,0,0,114,
     254,0,0,0,114,180,0,0,0,41,2,114,71,0,0,0,
     114,158,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,5,1,0,0,232,6,0,0,115,4,0,
+    5,0,0,0,114,5,1,0,0,233,6,0,0,115,4,0,
     0,0,0,2,16,1,122,28,95,78,97,109,101,115,112,97,
     99,101,76,111,97,100,101,114,46,108,111,97,100,95,109,111,
     100,117,108,101,78,41,10,114,57,0,0,0,114,56,0,0,
@@ -3199,7 +3199,7 @@ const unsigned char _Py_M__importlib[] = {
     114,205,0,0,0,114,219,0,0,0,114,15,1,0,0,114,
     14,1,0,0,114,5,1,0,0,114,4,0,0,0,114,4,
     0,0,0,114,4,0,0,0,114,5,0,0,0,114,252,0,
-    0,0,213,6,0,0,115,12,0,0,0,12,1,12,4,18,
+    0,0,214,6,0,0,115,12,0,0,0,12,1,12,4,18,
     4,12,3,12,3,12,4,114,252,0,0,0,99,0,0,0,
     0,0,0,0,0,0,0,0,0,5,0,0,0,64,0,0,
     0,115,160,0,0,0,101,0,0,90,1,0,100,0,0,90,
@@ -3219,9 +3219,9 @@ const unsigned char _Py_M__importlib[] = {
     95,95,112,97,116,104,95,95,32,97,116,116,114,105,98,117,
     116,101,115,46,99,1,0,0,0,0,0,0,0,2,0,0,
     0,4,0,0,0,67,0,0,0,115,58,0,0,0,120,51,
-    0,116,0,0,106,1,0,106,2,0,131,0,0,68,93,34,
+    0,116,0,0,106,1,0,160,2,0,161,0,0,68,93,34,
     0,125,1,0,116,3,0,124,1,0,100,1,0,131,2,0,
-    114,16,0,124,1,0,106,4,0,131,0,0,1,113,16,0,
+    114,16,0,124,1,0,160,4,0,161,0,0,1,113,16,0,
     113,16,0,87,100,2,0,83,41,3,122,125,67,97,108,108,
     32,116,104,101,32,105,110,118,97,108,105,100,97,116,101,95,
     99,97,99,104,101,115,40,41,32,109,101,116,104,111,100,32,
@@ -3236,13 +3236,13 @@ const unsigned char _Py_M__importlib[] = {
     116,101,114,95,99,97,99,104,101,218,6,118,97,108,117,101,
     115,114,60,0,0,0,114,72,1,0,0,41,2,114,247,0,
     0,0,218,6,102,105,110,100,101,114,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,72,1,0,0,244,6,
+    4,0,0,0,114,5,0,0,0,114,72,1,0,0,245,6,
     0,0,115,6,0,0,0,0,4,22,1,15,1,122,28,80,
     97,116,104,70,105,110,100,101,114,46,105,110,118,97,108,105,
     100,97,116,101,95,99,97,99,104,101,115,99,2,0,0,0,
     0,0,0,0,3,0,0,0,12,0,0,0,67,0,0,0,
     115,94,0,0,0,116,0,0,106,1,0,115,28,0,116,2,
-    0,106,3,0,100,1,0,116,4,0,131,2,0,1,110,0,
+    0,160,3,0,100,1,0,116,4,0,161,2,0,1,110,0,
     0,120,59,0,116,0,0,106,1,0,68,93,44,0,125,2,
     0,121,14,0,124,2,0,124,1,0,131,1,0,83,87,113,
     38,0,4,116,5,0,107,10,0,114,81,0,1,1,1,119,
@@ -3261,16 +3261,16 @@ const unsigned char _Py_M__importlib[] = {
     168,0,0,0,114,153,0,0,0,41,3,114,247,0,0,0,
     114,35,0,0,0,90,4,104,111,111,107,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,11,95,112,97,116,
-    104,95,104,111,111,107,115,252,6,0,0,115,16,0,0,0,
+    104,95,104,111,111,107,115,253,6,0,0,115,16,0,0,0,
     0,7,9,1,19,1,16,1,3,1,14,1,13,1,12,2,
     122,22,80,97,116,104,70,105,110,100,101,114,46,95,112,97,
     116,104,95,104,111,111,107,115,99,2,0,0,0,0,0,0,
     0,3,0,0,0,11,0,0,0,67,0,0,0,115,97,0,
     0,0,124,1,0,100,1,0,107,2,0,114,27,0,116,0,
-    0,106,1,0,131,0,0,125,1,0,110,0,0,121,17,0,
+    0,160,1,0,161,0,0,125,1,0,110,0,0,121,17,0,
     116,2,0,106,3,0,124,1,0,25,125,2,0,87,110,46,
     0,4,116,4,0,107,10,0,114,92,0,1,1,1,124,0,
-    0,106,5,0,124,1,0,131,1,0,125,2,0,124,2,0,
+    0,160,5,0,124,1,0,161,1,0,125,2,0,124,2,0,
     116,2,0,106,3,0,124,1,0,60,89,110,1,0,88,124,
     2,0,83,41,2,122,210,71,101,116,32,116,104,101,32,102,
     105,110,100,101,114,32,102,111,114,32,116,104,101,32,112,97,
@@ -3291,15 +3291,15 @@ const unsigned char _Py_M__importlib[] = {
     114,247,0,0,0,114,35,0,0,0,114,75,1,0,0,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,218,20,
     95,112,97,116,104,95,105,109,112,111,114,116,101,114,95,99,
-    97,99,104,101,13,7,0,0,115,16,0,0,0,0,8,12,
+    97,99,104,101,14,7,0,0,115,16,0,0,0,0,8,12,
     1,15,1,3,1,17,1,13,1,15,1,18,1,122,31,80,
     97,116,104,70,105,110,100,101,114,46,95,112,97,116,104,95,
     105,109,112,111,114,116,101,114,95,99,97,99,104,101,99,3,
     0,0,0,0,0,0,0,6,0,0,0,3,0,0,0,67,
     0,0,0,115,113,0,0,0,116,0,0,124,2,0,100,1,
-    0,131,2,0,114,39,0,124,2,0,106,1,0,124,1,0,
-    131,1,0,92,2,0,125,3,0,125,4,0,110,21,0,124,
-    2,0,106,2,0,124,1,0,131,1,0,125,3,0,100,0,
+    0,131,2,0,114,39,0,124,2,0,160,1,0,124,1,0,
+    161,1,0,92,2,0,125,3,0,125,4,0,110,21,0,124,
+    2,0,160,2,0,124,1,0,161,1,0,125,3,0,100,0,
     0,125,4,0,124,3,0,100,0,0,107,9,0,114,85,0,
     116,3,0,124,1,0,124,3,0,131,2,0,83,116,4,0,
     124,1,0,100,0,0,131,2,0,125,5,0,124,4,0,124,
@@ -3310,7 +3310,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,169,0,0,0,114,170,0,0,0,114,177,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
     218,16,95,108,101,103,97,99,121,95,103,101,116,95,115,112,
-    101,99,30,7,0,0,115,18,0,0,0,0,2,15,1,24,
+    101,99,31,7,0,0,115,18,0,0,0,0,2,15,1,24,
     2,15,1,6,1,12,1,13,1,15,1,9,1,122,27,80,
     97,116,104,70,105,110,100,101,114,46,95,108,101,103,97,99,
     121,95,103,101,116,95,115,112,101,99,78,99,4,0,0,0,
@@ -3318,17 +3318,17 @@ const unsigned char _Py_M__importlib[] = {
     115,252,0,0,0,103,0,0,125,4,0,120,239,0,124,2,
     0,68,93,203,0,125,5,0,116,0,0,124,5,0,116,1,
     0,116,2,0,102,2,0,131,2,0,115,46,0,113,13,0,
-    110,0,0,124,0,0,106,3,0,124,5,0,131,1,0,125,
+    110,0,0,124,0,0,160,3,0,124,5,0,161,1,0,125,
     6,0,124,6,0,100,1,0,107,9,0,114,13,0,116,4,
     0,124,6,0,100,2,0,131,2,0,114,109,0,124,6,0,
-    106,5,0,124,1,0,124,3,0,131,2,0,125,7,0,110,
-    18,0,124,0,0,106,6,0,124,1,0,124,6,0,131,2,
+    160,5,0,124,1,0,124,3,0,161,2,0,125,7,0,110,
+    18,0,124,0,0,160,6,0,124,1,0,124,6,0,161,2,
     0,125,7,0,124,7,0,100,1,0,107,8,0,114,145,0,
     113,13,0,110,0,0,124,7,0,106,7,0,100,1,0,107,
     9,0,114,164,0,124,7,0,83,124,7,0,106,8,0,125,
     8,0,124,8,0,100,1,0,107,8,0,114,200,0,116,9,
     0,100,3,0,131,1,0,130,1,0,110,0,0,124,4,0,
-    106,10,0,124,8,0,131,1,0,1,113,13,0,113,13,0,
+    160,10,0,124,8,0,161,1,0,1,113,13,0,113,13,0,
     87,116,11,0,124,1,0,100,1,0,131,2,0,125,7,0,
     124,4,0,124,7,0,95,8,0,124,7,0,83,100,1,0,
     83,41,4,122,63,70,105,110,100,32,116,104,101,32,108,111,
@@ -3346,15 +3346,15 @@ const unsigned char _Py_M__importlib[] = {
     95,112,97,116,104,90,5,101,110,116,114,121,114,75,1,0,
     0,114,177,0,0,0,114,170,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,9,95,103,101,116,
-    95,115,112,101,99,43,7,0,0,115,40,0,0,0,0,5,
+    95,115,112,101,99,44,7,0,0,115,40,0,0,0,0,5,
     6,1,13,1,21,1,6,1,15,1,12,1,15,1,21,2,
     18,1,12,1,6,1,15,1,4,1,9,1,12,1,15,5,
     20,2,15,1,9,1,122,20,80,97,116,104,70,105,110,100,
     101,114,46,95,103,101,116,95,115,112,101,99,99,4,0,0,
-    0,0,0,0,0,6,0,0,0,4,0,0,0,67,0,0,
+    0,0,0,0,0,6,0,0,0,5,0,0,0,67,0,0,
     0,115,143,0,0,0,124,2,0,100,1,0,107,8,0,114,
     24,0,116,0,0,106,1,0,125,2,0,110,0,0,124,0,
-    0,106,2,0,124,1,0,124,2,0,124,3,0,131,3,0,
+    0,160,2,0,124,1,0,124,2,0,124,3,0,161,3,0,
     125,4,0,124,4,0,100,1,0,107,8,0,114,61,0,100,
     1,0,83,124,4,0,106,3,0,100,1,0,107,8,0,114,
     135,0,124,4,0,106,4,0,125,5,0,124,5,0,114,128,
@@ -3374,12 +3374,12 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,114,158,0,0,0,114,35,0,0,0,114,11,1,
     0,0,114,177,0,0,0,114,82,1,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,12,1,0,0,
-    75,7,0,0,115,26,0,0,0,0,4,12,1,12,1,21,
+    76,7,0,0,115,26,0,0,0,0,4,12,1,12,1,21,
     1,12,1,4,1,15,1,9,1,6,3,9,1,24,1,4,
     2,7,2,122,20,80,97,116,104,70,105,110,100,101,114,46,
     102,105,110,100,95,115,112,101,99,99,3,0,0,0,0,0,
-    0,0,4,0,0,0,3,0,0,0,67,0,0,0,115,41,
-    0,0,0,124,0,0,106,0,0,124,1,0,124,2,0,131,
+    0,0,4,0,0,0,4,0,0,0,67,0,0,0,115,41,
+    0,0,0,124,0,0,160,0,0,124,1,0,124,2,0,161,
     2,0,125,3,0,124,3,0,100,1,0,107,8,0,114,34,
     0,100,1,0,83,124,3,0,106,1,0,83,41,2,122,98,
     102,105,110,100,32,116,104,101,32,109,111,100,117,108,101,32,
@@ -3391,7 +3391,7 @@ const unsigned char _Py_M__importlib[] = {
     101,46,78,41,2,114,12,1,0,0,114,169,0,0,0,41,
     4,114,247,0,0,0,114,158,0,0,0,114,35,0,0,0,
     114,177,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,13,1,0,0,97,7,0,0,115,8,0,
+    5,0,0,0,114,13,1,0,0,98,7,0,0,115,8,0,
     0,0,0,5,18,1,12,1,4,1,122,22,80,97,116,104,
     70,105,110,100,101,114,46,102,105,110,100,95,109,111,100,117,
     108,101,41,12,114,57,0,0,0,114,56,0,0,0,114,58,
@@ -3399,7 +3399,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,77,1,0,0,114,78,1,0,0,114,79,1,0,
     0,114,83,1,0,0,114,12,1,0,0,114,13,1,0,0,
     114,4,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,71,1,0,0,240,6,0,0,115,22,0,
+    5,0,0,0,114,71,1,0,0,241,6,0,0,115,22,0,
     0,0,12,2,6,2,18,8,18,17,18,17,18,13,3,1,
     18,31,3,1,21,21,3,1,114,71,1,0,0,99,0,0,
     0,0,0,0,0,0,0,0,0,0,3,0,0,0,64,0,
@@ -3424,11 +3424,11 @@ const unsigned char _Py_M__importlib[] = {
     100,101,114,32,105,115,32,104,97,110,100,108,105,110,103,32,
     104,97,115,32,98,101,101,110,32,109,111,100,105,102,105,101,
     100,46,10,10,32,32,32,32,99,2,0,0,0,0,0,0,
-    0,5,0,0,0,5,0,0,0,7,0,0,0,115,122,0,
+    0,5,0,0,0,6,0,0,0,7,0,0,0,115,122,0,
     0,0,103,0,0,125,3,0,120,52,0,124,2,0,68,93,
-    44,0,92,2,0,137,0,0,125,4,0,124,3,0,106,0,
+    44,0,92,2,0,137,0,0,125,4,0,124,3,0,160,0,
     0,135,0,0,102,1,0,100,1,0,100,2,0,134,0,0,
-    124,4,0,68,131,1,0,131,1,0,1,113,13,0,87,124,
+    124,4,0,68,131,1,0,161,1,0,1,113,13,0,87,124,
     3,0,124,0,0,95,1,0,124,1,0,112,79,0,100,3,
     0,124,0,0,95,2,0,100,6,0,124,0,0,95,3,0,
     116,4,0,131,0,0,124,0,0,95,5,0,116,4,0,131,
@@ -3448,7 +3448,7 @@ const unsigned char _Py_M__importlib[] = {
     136,0,0,102,2,0,86,1,113,3,0,100,0,0,83,41,
     1,78,114,4,0,0,0,41,2,114,22,0,0,0,114,55,
     1,0,0,41,1,114,169,0,0,0,114,4,0,0,0,114,
-    5,0,0,0,114,77,0,0,0,123,7,0,0,115,2,0,
+    5,0,0,0,114,77,0,0,0,124,7,0,0,115,2,0,
     0,0,6,0,122,38,70,105,108,101,70,105,110,100,101,114,
     46,95,95,105,110,105,116,95,95,46,60,108,111,99,97,108,
     115,62,46,60,103,101,110,101,120,112,114,62,114,116,0,0,
@@ -3461,7 +3461,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,218,14,108,111,97,100,101,114,95,100,101,116,97,105,
     108,115,90,7,108,111,97,100,101,114,115,114,127,0,0,0,
     114,4,0,0,0,41,1,114,169,0,0,0,114,5,0,0,
-    0,114,72,0,0,0,117,7,0,0,115,16,0,0,0,0,
+    0,114,72,0,0,0,118,7,0,0,115,16,0,0,0,0,
     4,6,1,19,1,36,1,9,2,15,1,9,1,12,1,122,
     19,70,105,108,101,70,105,110,100,101,114,46,95,95,105,110,
     105,116,95,95,99,1,0,0,0,0,0,0,0,1,0,0,
@@ -3471,12 +3471,12 @@ const unsigned char _Py_M__importlib[] = {
     114,101,99,116,111,114,121,32,109,116,105,109,101,46,114,29,
     0,0,0,78,114,138,0,0,0,41,1,114,86,1,0,0,
     41,1,114,71,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,72,1,0,0,131,7,0,0,115,
+    0,114,5,0,0,0,114,72,1,0,0,132,7,0,0,115,
     2,0,0,0,0,2,122,28,70,105,108,101,70,105,110,100,
     101,114,46,105,110,118,97,108,105,100,97,116,101,95,99,97,
     99,104,101,115,99,2,0,0,0,0,0,0,0,3,0,0,
     0,3,0,0,0,67,0,0,0,115,59,0,0,0,124,0,
-    0,106,0,0,124,1,0,131,1,0,125,2,0,124,2,0,
+    0,160,0,0,124,1,0,161,1,0,125,2,0,124,2,0,
     100,1,0,107,8,0,114,37,0,100,1,0,103,0,0,102,
     2,0,83,124,2,0,106,1,0,124,2,0,106,2,0,112,
     55,0,103,0,0,102,2,0,83,41,2,122,125,84,114,121,
@@ -3491,7 +3491,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,169,0,0,0,114,220,0,0,0,41,3,114,71,
     0,0,0,114,158,0,0,0,114,177,0,0,0,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,114,165,0,0,
-    0,137,7,0,0,115,8,0,0,0,0,3,15,1,12,1,
+    0,138,7,0,0,115,8,0,0,0,0,3,15,1,12,1,
     10,1,122,22,70,105,108,101,70,105,110,100,101,114,46,102,
     105,110,100,95,108,111,97,100,101,114,99,6,0,0,0,0,
     0,0,0,8,0,0,0,13,0,0,0,67,0,0,0,115,
@@ -3507,40 +3507,40 @@ const unsigned char _Py_M__importlib[] = {
     158,0,0,0,114,35,0,0,0,114,220,0,0,0,114,11,
     1,0,0,114,169,0,0,0,90,8,103,101,116,95,115,112,
     101,99,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,83,1,0,0,145,7,0,0,115,14,0,0,0,0,
+    0,114,83,1,0,0,146,7,0,0,115,14,0,0,0,0,
     1,15,1,3,1,13,1,13,1,18,1,12,2,122,20,70,
     105,108,101,70,105,110,100,101,114,46,95,103,101,116,95,115,
     112,101,99,78,99,3,0,0,0,0,0,0,0,14,0,0,
-    0,15,0,0,0,67,0,0,0,115,240,1,0,0,100,1,
-    0,125,3,0,124,1,0,106,0,0,100,2,0,131,1,0,
+    0,16,0,0,0,67,0,0,0,115,240,1,0,0,100,1,
+    0,125,3,0,124,1,0,160,0,0,100,2,0,161,1,0,
     100,3,0,25,125,4,0,121,34,0,116,1,0,124,0,0,
-    106,2,0,112,49,0,116,3,0,106,4,0,131,0,0,131,
+    106,2,0,112,49,0,116,3,0,160,4,0,161,0,0,131,
     1,0,106,5,0,125,5,0,87,110,24,0,4,116,6,0,
     107,10,0,114,85,0,1,1,1,100,10,0,125,5,0,89,
     110,1,0,88,124,5,0,124,0,0,106,7,0,107,3,0,
-    114,123,0,124,0,0,106,8,0,131,0,0,1,124,5,0,
+    114,123,0,124,0,0,160,8,0,161,0,0,1,124,5,0,
     124,0,0,95,7,0,110,0,0,116,9,0,131,0,0,114,
-    156,0,124,0,0,106,10,0,125,6,0,124,4,0,106,11,
-    0,131,0,0,125,7,0,110,15,0,124,0,0,106,12,0,
+    156,0,124,0,0,106,10,0,125,6,0,124,4,0,160,11,
+    0,161,0,0,125,7,0,110,15,0,124,0,0,106,12,0,
     125,6,0,124,4,0,125,7,0,124,7,0,124,6,0,107,
     6,0,114,51,1,116,13,0,124,0,0,106,2,0,124,4,
     0,131,2,0,125,8,0,120,103,0,124,0,0,106,14,0,
     68,93,77,0,92,2,0,125,9,0,125,10,0,100,5,0,
     124,9,0,23,125,11,0,116,13,0,124,8,0,124,11,0,
     131,2,0,125,12,0,116,15,0,124,12,0,131,1,0,114,
-    211,0,124,0,0,106,16,0,124,10,0,124,1,0,124,12,
-    0,124,8,0,103,1,0,124,2,0,131,5,0,83,113,211,
+    211,0,124,0,0,160,16,0,124,10,0,124,1,0,124,12,
+    0,124,8,0,103,1,0,124,2,0,161,5,0,83,113,211,
     0,87,116,17,0,124,8,0,131,1,0,125,3,0,110,0,
     0,120,126,0,124,0,0,106,14,0,68,93,115,0,92,2,
     0,125,9,0,125,10,0,116,13,0,124,0,0,106,2,0,
     124,4,0,124,9,0,23,131,2,0,125,12,0,116,18,0,
-    100,6,0,106,19,0,124,12,0,131,1,0,100,7,0,100,
+    100,6,0,160,19,0,124,12,0,161,1,0,100,7,0,100,
     3,0,131,1,1,1,124,7,0,124,9,0,23,124,6,0,
     107,6,0,114,61,1,116,15,0,124,12,0,131,1,0,114,
-    176,1,124,0,0,106,16,0,124,10,0,124,1,0,124,12,
-    0,100,8,0,124,2,0,131,5,0,83,113,61,1,113,61,
-    1,87,124,3,0,114,236,1,116,18,0,100,9,0,106,19,
-    0,124,8,0,131,1,0,131,1,0,1,116,20,0,124,1,
+    176,1,124,0,0,160,16,0,124,10,0,124,1,0,124,12,
+    0,100,8,0,124,2,0,161,5,0,83,113,61,1,113,61,
+    1,87,124,3,0,114,236,1,116,18,0,100,9,0,160,19,
+    0,124,8,0,161,1,0,131,1,0,1,116,20,0,124,1,
     0,100,8,0,131,2,0,125,13,0,124,8,0,103,1,0,
     124,13,0,95,21,0,124,13,0,83,100,8,0,83,41,11,
     122,125,84,114,121,32,116,111,32,102,105,110,100,32,97,32,
@@ -3571,30 +3571,30 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,114,241,0,0,0,90,13,105,110,105,116,95,102,
     105,108,101,110,97,109,101,90,9,102,117,108,108,95,112,97,
     116,104,114,177,0,0,0,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,114,12,1,0,0,155,7,0,0,115,
+    0,114,5,0,0,0,114,12,1,0,0,156,7,0,0,115,
     68,0,0,0,0,3,6,1,19,1,3,1,34,1,13,1,
     11,1,15,1,10,1,12,2,9,1,9,1,15,2,9,1,
     6,2,12,1,18,1,22,1,10,1,15,1,12,1,32,4,
     15,2,22,1,22,1,25,1,16,1,12,1,32,1,6,1,
     19,1,15,1,12,1,4,1,122,20,70,105,108,101,70,105,
     110,100,101,114,46,102,105,110,100,95,115,112,101,99,99,1,
-    0,0,0,0,0,0,0,9,0,0,0,13,0,0,0,67,
+    0,0,0,0,0,0,0,9,0,0,0,14,0,0,0,67,
     0,0,0,115,14,1,0,0,124,0,0,106,0,0,125,1,
-    0,121,31,0,116,1,0,106,2,0,124,1,0,112,33,0,
-    116,1,0,106,3,0,131,0,0,131,1,0,125,2,0,87,
+    0,121,31,0,116,1,0,160,2,0,124,1,0,112,33,0,
+    116,1,0,160,3,0,161,0,0,161,1,0,125,2,0,87,
     110,33,0,4,116,4,0,116,5,0,116,6,0,102,3,0,
     107,10,0,114,75,0,1,1,1,103,0,0,125,2,0,89,
-    110,1,0,88,116,7,0,106,8,0,106,9,0,100,1,0,
-    131,1,0,115,112,0,116,10,0,124,2,0,131,1,0,124,
+    110,1,0,88,116,7,0,106,8,0,160,9,0,100,1,0,
+    161,1,0,115,112,0,116,10,0,124,2,0,131,1,0,124,
     0,0,95,11,0,110,111,0,116,10,0,131,0,0,125,3,
     0,120,90,0,124,2,0,68,93,82,0,125,4,0,124,4,
-    0,106,12,0,100,2,0,131,1,0,92,3,0,125,5,0,
-    125,6,0,125,7,0,124,6,0,114,191,0,100,3,0,106,
-    13,0,124,5,0,124,7,0,106,14,0,131,0,0,131,2,
+    0,160,12,0,100,2,0,161,1,0,92,3,0,125,5,0,
+    125,6,0,125,7,0,124,6,0,114,191,0,100,3,0,160,
+    13,0,124,5,0,124,7,0,160,14,0,161,0,0,161,2,
     0,125,8,0,110,6,0,124,5,0,125,8,0,124,3,0,
-    106,15,0,124,8,0,131,1,0,1,113,128,0,87,124,3,
-    0,124,0,0,95,11,0,116,7,0,106,8,0,106,9,0,
-    116,16,0,131,1,0,114,10,1,100,4,0,100,5,0,132,
+    160,15,0,124,8,0,161,1,0,1,113,128,0,87,124,3,
+    0,124,0,0,95,11,0,116,7,0,106,8,0,160,9,0,
+    116,16,0,161,1,0,114,10,1,100,4,0,100,5,0,132,
     0,0,124,2,0,68,131,1,0,124,0,0,95,17,0,110,
     0,0,100,6,0,83,41,7,122,68,70,105,108,108,32,116,
     104,101,32,99,97,99,104,101,32,111,102,32,112,111,116,101,
@@ -3602,13 +3602,13 @@ const unsigned char _Py_M__importlib[] = {
     100,32,112,97,99,107,97,103,101,115,32,102,111,114,32,116,
     104,105,115,32,100,105,114,101,99,116,111,114,121,46,114,0,
     0,0,0,114,116,0,0,0,122,5,123,125,46,123,125,99,
-    1,0,0,0,0,0,0,0,2,0,0,0,3,0,0,0,
+    1,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,
     83,0,0,0,115,28,0,0,0,104,0,0,124,0,0,93,
-    18,0,125,1,0,124,1,0,106,0,0,131,0,0,146,2,
+    18,0,125,1,0,124,1,0,160,0,0,161,0,0,146,2,
     0,113,6,0,83,114,4,0,0,0,41,1,114,139,0,0,
     0,41,2,114,22,0,0,0,90,2,102,110,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,250,9,60,115,101,
-    116,99,111,109,112,62,229,7,0,0,115,2,0,0,0,9,
+    116,99,111,109,112,62,230,7,0,0,115,2,0,0,0,9,
     0,122,41,70,105,108,101,70,105,110,100,101,114,46,95,102,
     105,108,108,95,99,97,99,104,101,46,60,108,111,99,97,108,
     115,62,46,60,115,101,116,99,111,109,112,62,78,41,18,114,
@@ -3626,7 +3626,7 @@ const unsigned char _Py_M__importlib[] = {
     110,116,115,114,69,1,0,0,114,67,0,0,0,114,63,1,
     0,0,114,55,1,0,0,90,8,110,101,119,95,110,97,109,
     101,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,91,1,0,0,200,7,0,0,115,34,0,0,0,0,2,
+    114,91,1,0,0,201,7,0,0,115,34,0,0,0,0,2,
     9,1,3,1,31,1,22,3,11,3,18,1,18,7,9,1,
     13,1,24,1,6,1,27,2,6,1,17,1,9,1,18,1,
     122,22,70,105,108,101,70,105,110,100,101,114,46,95,102,105,
@@ -3665,7 +3665,7 @@ const unsigned char _Py_M__importlib[] = {
     41,1,114,35,0,0,0,41,2,114,247,0,0,0,114,90,
     1,0,0,114,4,0,0,0,114,5,0,0,0,218,24,112,
     97,116,104,95,104,111,111,107,95,102,111,114,95,70,105,108,
-    101,70,105,110,100,101,114,241,7,0,0,115,6,0,0,0,
+    101,70,105,110,100,101,114,242,7,0,0,115,6,0,0,0,
     0,2,12,1,21,1,122,54,70,105,108,101,70,105,110,100,
     101,114,46,112,97,116,104,95,104,111,111,107,46,60,108,111,
     99,97,108,115,62,46,112,97,116,104,95,104,111,111,107,95,
@@ -3673,15 +3673,15 @@ const unsigned char _Py_M__importlib[] = {
     0,0,0,41,3,114,247,0,0,0,114,90,1,0,0,114,
     97,1,0,0,114,4,0,0,0,41,2,114,247,0,0,0,
     114,90,1,0,0,114,5,0,0,0,218,9,112,97,116,104,
-    95,104,111,111,107,231,7,0,0,115,4,0,0,0,0,10,
+    95,104,111,111,107,232,7,0,0,115,4,0,0,0,0,10,
     21,6,122,20,70,105,108,101,70,105,110,100,101,114,46,112,
     97,116,104,95,104,111,111,107,99,1,0,0,0,0,0,0,
-    0,1,0,0,0,2,0,0,0,67,0,0,0,115,16,0,
-    0,0,100,1,0,106,0,0,124,0,0,106,1,0,131,1,
+    0,1,0,0,0,3,0,0,0,67,0,0,0,115,16,0,
+    0,0,100,1,0,160,0,0,124,0,0,106,1,0,161,1,
     0,83,41,2,78,122,16,70,105,108,101,70,105,110,100,101,
     114,40,123,33,114,125,41,41,2,114,47,0,0,0,114,35,
     0,0,0,41,1,114,71,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,101,0,0,0,249,7,
+    4,0,0,0,114,5,0,0,0,114,101,0,0,0,250,7,
     0,0,115,2,0,0,0,0,1,122,19,70,105,108,101,70,
     105,110,100,101,114,46,95,95,114,101,112,114,95,95,41,15,
     114,57,0,0,0,114,56,0,0,0,114,58,0,0,0,114,
@@ -3690,7 +3690,7 @@ const unsigned char _Py_M__importlib[] = {
     0,0,114,12,1,0,0,114,91,1,0,0,114,9,1,0,
     0,114,98,1,0,0,114,101,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,
-    84,1,0,0,108,7,0,0,115,20,0,0,0,12,7,6,
+    84,1,0,0,109,7,0,0,115,20,0,0,0,12,7,6,
     2,12,14,12,4,6,2,12,8,12,10,15,45,12,31,18,
     18,114,84,1,0,0,99,0,0,0,0,0,0,0,0,0,
     0,0,0,2,0,0,0,64,0,0,0,115,46,0,0,0,
@@ -3701,17 +3701,17 @@ const unsigned char _Py_M__importlib[] = {
     116,101,120,116,122,36,67,111,110,116,101,120,116,32,109,97,
     110,97,103,101,114,32,102,111,114,32,116,104,101,32,105,109,
     112,111,114,116,32,108,111,99,107,46,99,1,0,0,0,0,
-    0,0,0,1,0,0,0,1,0,0,0,67,0,0,0,115,
-    14,0,0,0,116,0,0,106,1,0,131,0,0,1,100,1,
+    0,0,0,1,0,0,0,2,0,0,0,67,0,0,0,115,
+    14,0,0,0,116,0,0,160,1,0,161,0,0,1,100,1,
     0,83,41,2,122,24,65,99,113,117,105,114,101,32,116,104,
     101,32,105,109,112,111,114,116,32,108,111,99,107,46,78,41,
     2,114,106,0,0,0,114,4,1,0,0,41,1,114,71,0,
     0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,114,75,0,0,0,3,8,0,0,115,2,0,0,0,0,
+    0,114,75,0,0,0,4,8,0,0,115,2,0,0,0,0,
     2,122,28,95,73,109,112,111,114,116,76,111,99,107,67,111,
     110,116,101,120,116,46,95,95,101,110,116,101,114,95,95,99,
-    4,0,0,0,0,0,0,0,4,0,0,0,1,0,0,0,
-    67,0,0,0,115,14,0,0,0,116,0,0,106,1,0,131,
+    4,0,0,0,0,0,0,0,4,0,0,0,2,0,0,0,
+    67,0,0,0,115,14,0,0,0,116,0,0,160,1,0,161,
     0,0,1,100,1,0,83,41,2,122,60,82,101,108,101,97,
     115,101,32,116,104,101,32,105,109,112,111,114,116,32,108,111,
     99,107,32,114,101,103,97,114,100,108,101,115,115,32,111,102,
@@ -3721,21 +3721,21 @@ const unsigned char _Py_M__importlib[] = {
     95,116,121,112,101,90,9,101,120,99,95,118,97,108,117,101,
     90,13,101,120,99,95,116,114,97,99,101,98,97,99,107,114,
     4,0,0,0,114,4,0,0,0,114,5,0,0,0,114,81,
-    0,0,0,7,8,0,0,115,2,0,0,0,0,2,122,27,
+    0,0,0,8,8,0,0,115,2,0,0,0,0,2,122,27,
     95,73,109,112,111,114,116,76,111,99,107,67,111,110,116,101,
     120,116,46,95,95,101,120,105,116,95,95,78,41,6,114,57,
     0,0,0,114,56,0,0,0,114,58,0,0,0,114,59,0,
     0,0,114,75,0,0,0,114,81,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,4,0,0,0,114,5,0,0,0,
-    114,99,1,0,0,255,7,0,0,115,6,0,0,0,12,2,
+    114,99,1,0,0,0,8,0,0,115,6,0,0,0,12,2,
     6,2,12,4,114,99,1,0,0,99,3,0,0,0,0,0,
-    0,0,5,0,0,0,4,0,0,0,67,0,0,0,115,91,
-    0,0,0,124,1,0,106,0,0,100,1,0,124,2,0,100,
-    2,0,24,131,2,0,125,3,0,116,1,0,124,3,0,131,
+    0,0,5,0,0,0,5,0,0,0,67,0,0,0,115,91,
+    0,0,0,124,1,0,160,0,0,100,1,0,124,2,0,100,
+    2,0,24,161,2,0,125,3,0,116,1,0,124,3,0,131,
     1,0,124,2,0,107,0,0,114,55,0,116,2,0,100,3,
     0,131,1,0,130,1,0,110,0,0,124,3,0,100,4,0,
-    25,125,4,0,124,0,0,114,87,0,100,5,0,106,3,0,
-    124,4,0,124,0,0,131,2,0,83,124,4,0,83,41,6,
+    25,125,4,0,124,0,0,114,87,0,100,5,0,160,3,0,
+    124,4,0,124,0,0,161,2,0,83,124,4,0,83,41,6,
     122,50,82,101,115,111,108,118,101,32,97,32,114,101,108,97,
     116,105,118,101,32,109,111,100,117,108,101,32,110,97,109,101,
     32,116,111,32,97,110,32,97,98,115,111,108,117,116,101,32,
@@ -3749,17 +3749,17 @@ const unsigned char _Py_M__importlib[] = {
     107,97,103,101,218,5,108,101,118,101,108,90,4,98,105,116,
     115,90,4,98,97,115,101,114,4,0,0,0,114,4,0,0,
     0,114,5,0,0,0,218,13,95,114,101,115,111,108,118,101,
-    95,110,97,109,101,12,8,0,0,115,10,0,0,0,0,2,
+    95,110,97,109,101,13,8,0,0,115,10,0,0,0,0,2,
     22,1,18,1,15,1,10,1,114,102,1,0,0,99,3,0,
     0,0,0,0,0,0,10,0,0,0,27,0,0,0,67,0,
     0,0,115,49,1,0,0,116,0,0,106,1,0,115,28,0,
-    116,2,0,106,3,0,100,1,0,116,4,0,131,2,0,1,
+    116,2,0,160,3,0,100,1,0,116,4,0,161,2,0,1,
     110,0,0,124,0,0,116,0,0,106,5,0,107,6,0,125,
     3,0,120,255,0,116,0,0,106,1,0,68,93,240,0,125,
     4,0,116,6,0,131,0,0,143,108,0,1,121,13,0,124,
     4,0,106,7,0,125,5,0,87,110,69,0,4,116,8,0,
-    107,10,0,114,153,0,1,1,1,124,4,0,106,9,0,124,
-    0,0,124,1,0,131,2,0,125,6,0,124,6,0,100,2,
+    107,10,0,114,153,0,1,1,1,124,4,0,160,9,0,124,
+    0,0,124,1,0,161,2,0,125,6,0,124,6,0,100,2,
     0,107,8,0,114,134,0,119,53,0,110,0,0,116,10,0,
     124,0,0,124,6,0,131,2,0,125,7,0,89,110,19,0,
     88,124,5,0,124,0,0,124,1,0,124,2,0,131,3,0,
@@ -3783,22 +3783,22 @@ const unsigned char _Py_M__importlib[] = {
     0,90,9,105,115,95,114,101,108,111,97,100,114,75,1,0,
     0,114,12,1,0,0,114,169,0,0,0,114,177,0,0,0,
     114,179,0,0,0,114,208,0,0,0,114,4,0,0,0,114,
-    4,0,0,0,114,5,0,0,0,114,246,0,0,0,21,8,
+    4,0,0,0,114,5,0,0,0,114,246,0,0,0,22,8,
     0,0,115,50,0,0,0,0,2,9,1,19,4,15,1,16,
     1,10,1,3,1,13,1,13,1,18,1,12,1,6,1,20,
     2,24,1,12,2,22,1,13,1,3,1,13,1,13,4,9,
     2,12,1,4,2,7,2,11,2,114,246,0,0,0,99,3,
-    0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,67,
+    0,0,0,0,0,0,0,4,0,0,0,5,0,0,0,67,
     0,0,0,115,194,0,0,0,116,0,0,124,0,0,116,1,
-    0,131,2,0,115,45,0,116,2,0,100,1,0,106,3,0,
-    116,4,0,124,0,0,131,1,0,131,1,0,131,1,0,130,
+    0,131,2,0,115,45,0,116,2,0,100,1,0,160,3,0,
+    116,4,0,124,0,0,131,1,0,161,1,0,131,1,0,130,
     1,0,110,0,0,124,2,0,100,2,0,107,0,0,114,72,
     0,116,5,0,100,3,0,131,1,0,130,1,0,110,0,0,
     124,1,0,114,156,0,116,0,0,124,1,0,116,1,0,131,
     2,0,115,108,0,116,2,0,100,4,0,131,1,0,130,1,
     0,113,156,0,124,1,0,116,6,0,106,7,0,107,7,0,
-    114,156,0,100,5,0,125,3,0,116,8,0,124,3,0,106,
-    3,0,124,1,0,131,1,0,131,1,0,130,1,0,113,156,
+    114,156,0,100,5,0,125,3,0,116,8,0,124,3,0,160,
+    3,0,124,1,0,161,1,0,131,1,0,130,1,0,113,156,
     0,110,0,0,124,0,0,12,114,190,0,124,2,0,100,2,
     0,107,2,0,114,190,0,116,5,0,100,6,0,131,1,0,
     130,1,0,110,0,0,100,7,0,83,41,8,122,28,86,101,
@@ -3821,31 +3821,31 @@ const unsigned char _Py_M__importlib[] = {
     69,114,114,111,114,41,4,114,67,0,0,0,114,100,1,0,
     0,114,101,1,0,0,114,171,0,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,13,95,115,97,110,
-    105,116,121,95,99,104,101,99,107,62,8,0,0,115,24,0,
+    105,116,121,95,99,104,101,99,107,63,8,0,0,115,24,0,
     0,0,0,2,15,1,30,1,12,1,15,1,6,1,15,1,
     15,1,15,1,6,2,27,1,19,1,114,106,1,0,0,122,
     16,78,111,32,109,111,100,117,108,101,32,110,97,109,101,100,
     32,122,4,123,33,114,125,99,2,0,0,0,0,0,0,0,
-    8,0,0,0,12,0,0,0,67,0,0,0,115,52,1,0,
-    0,100,0,0,125,2,0,124,0,0,106,0,0,100,1,0,
-    131,1,0,100,2,0,25,125,3,0,124,3,0,114,178,0,
+    8,0,0,0,13,0,0,0,67,0,0,0,115,52,1,0,
+    0,100,0,0,125,2,0,124,0,0,160,0,0,100,1,0,
+    161,1,0,100,2,0,25,125,3,0,124,3,0,114,178,0,
     124,3,0,116,1,0,106,2,0,107,7,0,114,62,0,116,
     3,0,124,1,0,124,3,0,131,2,0,1,110,0,0,124,
     0,0,116,1,0,106,2,0,107,6,0,114,88,0,116,1,
     0,106,2,0,124,0,0,25,83,116,1,0,106,2,0,124,
     3,0,25,125,4,0,121,13,0,124,4,0,106,4,0,125,
     2,0,87,113,178,0,4,116,5,0,107,10,0,114,174,0,
-    1,1,1,116,6,0,100,3,0,23,106,7,0,124,0,0,
-    124,3,0,131,2,0,125,5,0,116,8,0,124,5,0,100,
+    1,1,1,116,6,0,100,3,0,23,160,7,0,124,0,0,
+    124,3,0,161,2,0,125,5,0,116,8,0,124,5,0,100,
     4,0,124,0,0,131,1,1,130,1,0,89,113,178,0,88,
     110,0,0,116,9,0,124,0,0,124,2,0,131,2,0,125,
     6,0,124,6,0,100,0,0,107,8,0,114,235,0,116,8,
-    0,116,6,0,106,7,0,124,0,0,131,1,0,100,4,0,
+    0,116,6,0,160,7,0,124,0,0,161,1,0,100,4,0,
     124,0,0,131,1,1,130,1,0,110,18,0,116,10,0,124,
-    6,0,131,1,0,106,11,0,131,0,0,125,7,0,124,3,
+    6,0,131,1,0,160,11,0,161,0,0,125,7,0,124,3,
     0,114,48,1,116,1,0,106,2,0,124,3,0,25,125,4,
-    0,116,12,0,124,4,0,124,0,0,106,0,0,100,1,0,
-    131,1,0,100,5,0,25,124,7,0,131,3,0,1,110,0,
+    0,116,12,0,124,4,0,124,0,0,160,0,0,100,1,0,
+    161,1,0,100,5,0,25,124,7,0,131,3,0,1,110,0,
     0,124,7,0,83,41,6,78,114,116,0,0,0,114,84,0,
     0,0,122,23,59,32,123,33,114,125,32,105,115,32,110,111,
     116,32,97,32,112,97,99,107,97,103,101,114,67,0,0,0,
@@ -3859,7 +3859,7 @@ const unsigned char _Py_M__importlib[] = {
     109,111,100,117,108,101,114,171,0,0,0,114,177,0,0,0,
     114,179,0,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,23,95,102,105,110,100,95,97,110,100,95,
-    108,111,97,100,95,117,110,108,111,99,107,101,100,82,8,0,
+    108,111,97,100,95,117,110,108,111,99,107,101,100,83,8,0,
     0,115,42,0,0,0,0,1,6,1,19,1,6,1,15,1,
     16,2,15,1,11,1,13,1,3,1,13,1,13,1,22,1,
     26,1,15,1,12,1,30,2,18,1,6,2,13,1,32,1,
@@ -3874,18 +3874,18 @@ const unsigned char _Py_M__importlib[] = {
     114,103,0,0,0,114,109,1,0,0,41,2,114,67,0,0,
     0,114,108,1,0,0,114,4,0,0,0,114,4,0,0,0,
     114,5,0,0,0,218,14,95,102,105,110,100,95,97,110,100,
-    95,108,111,97,100,109,8,0,0,115,4,0,0,0,0,2,
+    95,108,111,97,100,110,8,0,0,115,4,0,0,0,0,2,
     13,1,114,110,1,0,0,99,3,0,0,0,0,0,0,0,
     5,0,0,0,4,0,0,0,67,0,0,0,115,172,0,0,
     0,116,0,0,124,0,0,124,1,0,124,2,0,131,3,0,
     1,124,2,0,100,1,0,107,4,0,114,49,0,116,1,0,
     124,0,0,124,1,0,124,2,0,131,3,0,125,0,0,110,
-    0,0,116,2,0,106,3,0,131,0,0,1,124,0,0,116,
+    0,0,116,2,0,160,3,0,161,0,0,1,124,0,0,116,
     4,0,106,5,0,107,7,0,114,87,0,116,6,0,124,0,
     0,116,7,0,131,2,0,83,116,4,0,106,5,0,124,0,
     0,25,125,3,0,124,3,0,100,2,0,107,8,0,114,158,
-    0,116,2,0,106,8,0,131,0,0,1,100,3,0,106,9,
-    0,124,0,0,131,1,0,125,4,0,116,10,0,124,4,0,
+    0,116,2,0,160,8,0,161,0,0,1,100,3,0,160,9,
+    0,124,0,0,161,1,0,125,4,0,116,10,0,124,4,0,
     100,4,0,124,0,0,131,1,1,130,1,0,110,0,0,116,
     11,0,124,0,0,131,1,0,1,124,3,0,83,41,5,97,
     50,1,0,0,73,109,112,111,114,116,32,97,110,100,32,114,
@@ -3918,23 +3918,23 @@ const unsigned char _Py_M__importlib[] = {
     0,41,5,114,67,0,0,0,114,100,1,0,0,114,101,1,
     0,0,114,179,0,0,0,114,151,0,0,0,114,4,0,0,
     0,114,4,0,0,0,114,5,0,0,0,114,111,1,0,0,
-    115,8,0,0,115,26,0,0,0,0,9,16,1,12,1,21,
+    116,8,0,0,115,26,0,0,0,0,9,16,1,12,1,21,
     1,10,1,15,1,13,1,13,1,12,1,10,2,15,1,21,
     1,10,1,114,111,1,0,0,99,3,0,0,0,0,0,0,
     0,6,0,0,0,17,0,0,0,67,0,0,0,115,1,1,
     0,0,116,0,0,124,0,0,100,1,0,131,2,0,114,253,
     0,100,2,0,124,1,0,107,6,0,114,89,0,116,1,0,
-    124,1,0,131,1,0,125,1,0,124,1,0,106,2,0,100,
-    2,0,131,1,0,1,116,0,0,124,0,0,100,3,0,131,
-    2,0,114,89,0,124,1,0,106,3,0,124,0,0,106,4,
-    0,131,1,0,1,113,89,0,110,0,0,120,161,0,124,1,
+    124,1,0,131,1,0,125,1,0,124,1,0,160,2,0,100,
+    2,0,161,1,0,1,116,0,0,124,0,0,100,3,0,131,
+    2,0,114,89,0,124,1,0,160,3,0,124,0,0,106,4,
+    0,161,1,0,1,113,89,0,110,0,0,120,161,0,124,1,
     0,68,93,150,0,125,3,0,116,0,0,124,0,0,124,3,
-    0,131,2,0,115,96,0,100,4,0,106,5,0,124,0,0,
-    106,6,0,124,3,0,131,2,0,125,4,0,121,17,0,116,
+    0,131,2,0,115,96,0,100,4,0,160,5,0,124,0,0,
+    106,6,0,124,3,0,161,2,0,125,4,0,121,17,0,116,
     7,0,124,2,0,124,4,0,131,2,0,1,87,113,246,0,
     4,116,8,0,107,10,0,114,242,0,1,125,5,0,1,122,
-    53,0,116,9,0,124,5,0,131,1,0,106,10,0,116,11,
-    0,131,1,0,114,221,0,124,5,0,106,12,0,124,4,0,
+    53,0,116,9,0,124,5,0,131,1,0,160,10,0,116,11,
+    0,161,1,0,114,221,0,124,5,0,106,12,0,124,4,0,
     107,2,0,114,221,0,119,96,0,113,221,0,110,0,0,130,
     0,0,87,89,100,5,0,100,5,0,125,5,0,126,5,0,
     88,113,246,0,88,113,96,0,113,96,0,87,110,0,0,124,
@@ -3964,16 +3964,16 @@ const unsigned char _Py_M__importlib[] = {
     116,114,108,1,0,0,114,16,0,0,0,90,9,102,114,111,
     109,95,110,97,109,101,114,38,1,0,0,114,4,0,0,0,
     114,4,0,0,0,114,5,0,0,0,218,16,95,104,97,110,
-    100,108,101,95,102,114,111,109,108,105,115,116,139,8,0,0,
+    100,108,101,95,102,114,111,109,108,105,115,116,140,8,0,0,
     115,34,0,0,0,0,10,15,1,12,1,12,1,13,1,15,
     1,22,1,13,1,15,1,21,1,3,1,17,1,18,4,21,
     1,15,1,9,1,32,1,114,117,1,0,0,99,1,0,0,
-    0,0,0,0,0,2,0,0,0,2,0,0,0,67,0,0,
-    0,115,78,0,0,0,124,0,0,106,0,0,100,1,0,131,
+    0,0,0,0,0,2,0,0,0,3,0,0,0,67,0,0,
+    0,115,78,0,0,0,124,0,0,160,0,0,100,1,0,161,
     1,0,125,1,0,124,1,0,100,2,0,107,8,0,114,74,
     0,124,0,0,100,3,0,25,125,1,0,100,4,0,124,0,
-    0,107,7,0,114,74,0,124,1,0,106,1,0,100,5,0,
-    131,1,0,100,6,0,25,125,1,0,113,74,0,110,0,0,
+    0,107,7,0,114,74,0,124,1,0,160,1,0,100,5,0,
+    161,1,0,100,6,0,25,125,1,0,113,74,0,110,0,0,
     124,1,0,83,41,7,122,167,67,97,108,99,117,108,97,116,
     101,32,119,104,97,116,32,95,95,112,97,99,107,97,103,101,
     95,95,32,115,104,111,117,108,100,32,98,101,46,10,10,32,
@@ -3990,11 +3990,11 @@ const unsigned char _Py_M__importlib[] = {
     114,32,0,0,0,41,2,218,7,103,108,111,98,97,108,115,
     114,100,1,0,0,114,4,0,0,0,114,4,0,0,0,114,
     5,0,0,0,218,17,95,99,97,108,99,95,95,95,112,97,
-    99,107,97,103,101,95,95,171,8,0,0,115,12,0,0,0,
+    99,107,97,103,101,95,95,172,8,0,0,115,12,0,0,0,
     0,7,15,1,12,1,10,1,12,1,25,1,114,119,1,0,
     0,99,0,0,0,0,0,0,0,0,3,0,0,0,3,0,
     0,0,67,0,0,0,115,55,0,0,0,116,0,0,116,1,
-    0,106,2,0,131,0,0,102,2,0,125,0,0,116,3,0,
+    0,160,2,0,161,0,0,102,2,0,125,0,0,116,3,0,
     116,4,0,102,2,0,125,1,0,116,5,0,116,6,0,102,
     2,0,125,2,0,124,0,0,124,1,0,124,2,0,103,3,
     0,83,41,1,122,95,82,101,116,117,114,110,115,32,97,32,
@@ -4009,7 +4009,7 @@ const unsigned char _Py_M__importlib[] = {
     53,1,0,0,114,230,0,0,0,41,3,90,10,101,120,116,
     101,110,115,105,111,110,115,90,6,115,111,117,114,99,101,90,
     8,98,121,116,101,99,111,100,101,114,4,0,0,0,114,4,
-    0,0,0,114,5,0,0,0,114,238,0,0,0,186,8,0,
+    0,0,0,114,5,0,0,0,114,238,0,0,0,187,8,0,
     0,115,8,0,0,0,0,5,18,1,12,1,12,1,114,238,
     0,0,0,99,5,0,0,0,0,0,0,0,9,0,0,0,
     5,0,0,0,67,0,0,0,115,227,0,0,0,124,4,0,
@@ -4019,10 +4019,10 @@ const unsigned char _Py_M__importlib[] = {
     116,1,0,124,6,0,131,1,0,125,7,0,116,0,0,124,
     0,0,124,7,0,124,4,0,131,3,0,125,5,0,124,3,
     0,115,207,0,124,4,0,100,1,0,107,2,0,114,122,0,
-    116,0,0,124,0,0,106,2,0,100,3,0,131,1,0,100,
+    116,0,0,124,0,0,160,2,0,100,3,0,161,1,0,100,
     1,0,25,131,1,0,83,124,0,0,115,132,0,124,5,0,
     83,116,3,0,124,0,0,131,1,0,116,3,0,124,0,0,
-    106,2,0,100,3,0,131,1,0,100,1,0,25,131,1,0,
+    160,2,0,100,3,0,161,1,0,100,1,0,25,131,1,0,
     24,125,8,0,116,4,0,106,5,0,124,5,0,106,6,0,
     100,2,0,116,3,0,124,5,0,106,6,0,131,1,0,124,
     8,0,24,133,2,0,25,25,83,110,16,0,116,7,0,124,
@@ -4065,37 +4065,37 @@ const unsigned char _Py_M__importlib[] = {
     114,179,0,0,0,90,8,103,108,111,98,97,108,115,95,114,
     100,1,0,0,90,7,99,117,116,95,111,102,102,114,4,0,
     0,0,114,4,0,0,0,114,5,0,0,0,218,10,95,95,
-    105,109,112,111,114,116,95,95,197,8,0,0,115,26,0,0,
+    105,109,112,111,114,116,95,95,198,8,0,0,115,26,0,0,
     0,0,11,12,1,15,2,24,1,12,1,18,1,6,3,12,
     1,23,1,6,1,4,4,35,3,40,2,114,122,1,0,0,
     99,1,0,0,0,0,0,0,0,3,0,0,0,3,0,0,
-    0,67,0,0,0,115,68,0,0,0,116,0,0,106,1,0,
-    124,0,0,131,1,0,125,1,0,124,1,0,100,0,0,107,
+    0,67,0,0,0,115,68,0,0,0,116,0,0,160,1,0,
+    124,0,0,161,1,0,125,1,0,124,1,0,100,0,0,107,
     8,0,114,46,0,116,2,0,100,1,0,124,0,0,23,131,
     1,0,130,1,0,110,0,0,116,3,0,124,1,0,131,1,
-    0,125,2,0,124,2,0,106,4,0,131,0,0,83,41,2,
+    0,125,2,0,124,2,0,160,4,0,161,0,0,83,41,2,
     78,122,25,110,111,32,98,117,105,108,116,45,105,110,32,109,
     111,100,117,108,101,32,110,97,109,101,100,32,41,5,114,10,
     1,0,0,114,12,1,0,0,114,153,0,0,0,114,174,0,
     0,0,114,8,1,0,0,41,3,114,67,0,0,0,114,177,
     0,0,0,114,178,0,0,0,114,4,0,0,0,114,4,0,
     0,0,114,5,0,0,0,218,18,95,98,117,105,108,116,105,
-    110,95,102,114,111,109,95,110,97,109,101,232,8,0,0,115,
+    110,95,102,114,111,109,95,110,97,109,101,233,8,0,0,115,
     10,0,0,0,0,1,15,1,12,1,19,1,12,1,114,123,
     1,0,0,99,2,0,0,0,0,0,0,0,19,0,0,0,
     12,0,0,0,67,0,0,0,115,232,2,0,0,124,1,0,
     97,0,0,124,0,0,97,1,0,116,1,0,106,2,0,106,
     3,0,114,33,0,116,4,0,97,5,0,110,6,0,116,6,
     0,97,5,0,116,7,0,116,1,0,131,1,0,125,2,0,
-    120,138,0,116,1,0,106,8,0,106,9,0,131,0,0,68,
+    120,138,0,116,1,0,106,8,0,160,9,0,161,0,0,68,
     93,121,0,92,2,0,125,3,0,125,4,0,116,10,0,124,
     4,0,124,2,0,131,2,0,114,67,0,124,3,0,116,1,
     0,106,11,0,107,6,0,114,118,0,116,12,0,125,5,0,
-    110,27,0,116,0,0,106,13,0,124,3,0,131,1,0,114,
+    110,27,0,116,0,0,160,13,0,124,3,0,161,1,0,114,
     67,0,116,14,0,125,5,0,110,3,0,113,67,0,116,15,
     0,124,4,0,124,5,0,131,2,0,125,6,0,116,16,0,
-    124,6,0,131,1,0,125,7,0,124,7,0,106,17,0,124,
-    4,0,131,1,0,1,113,67,0,113,67,0,87,116,1,0,
+    124,6,0,131,1,0,125,7,0,124,7,0,160,17,0,124,
+    4,0,161,1,0,1,113,67,0,113,67,0,87,116,1,0,
     106,8,0,116,18,0,25,125,8,0,120,73,0,100,26,0,
     68,93,65,0,125,9,0,124,9,0,116,1,0,106,8,0,
     107,7,0,114,248,0,116,19,0,124,9,0,131,1,0,125,
@@ -4115,7 +4115,7 @@ const unsigned char _Py_M__importlib[] = {
     116,23,0,100,12,0,131,1,0,130,1,0,116,20,0,124,
     8,0,100,13,0,124,15,0,131,3,0,1,116,20,0,124,
     8,0,100,14,0,124,14,0,131,3,0,1,116,20,0,124,
-    8,0,100,15,0,100,16,0,106,24,0,124,13,0,131,1,
+    8,0,100,15,0,100,16,0,160,24,0,124,13,0,161,1,
     0,131,3,0,1,121,16,0,116,19,0,100,17,0,131,1,
     0,125,16,0,87,110,24,0,4,116,23,0,107,10,0,114,
     50,2,1,1,1,100,18,0,125,16,0,89,110,1,0,88,
@@ -4125,10 +4125,10 @@ const unsigned char _Py_M__importlib[] = {
     7,0,107,2,0,114,138,2,116,19,0,100,20,0,131,1,
     0,125,18,0,116,20,0,124,8,0,100,21,0,124,18,0,
     131,3,0,1,110,0,0,116,20,0,124,8,0,100,22,0,
-    116,25,0,131,0,0,131,3,0,1,116,26,0,106,27,0,
-    116,0,0,106,28,0,131,0,0,131,1,0,1,124,12,0,
-    100,7,0,107,2,0,114,228,2,116,29,0,106,30,0,100,
-    23,0,131,1,0,1,100,24,0,116,26,0,107,6,0,114,
+    116,25,0,131,0,0,131,3,0,1,116,26,0,160,27,0,
+    116,0,0,160,28,0,161,0,0,161,1,0,1,124,12,0,
+    100,7,0,107,2,0,114,228,2,116,29,0,160,30,0,100,
+    23,0,161,1,0,1,100,24,0,116,26,0,107,6,0,114,
     228,2,100,25,0,116,31,0,95,32,0,113,228,2,110,0,
     0,100,18,0,83,41,27,122,250,83,101,116,117,112,32,105,
     109,112,111,114,116,108,105,98,32,98,121,32,105,109,112,111,
@@ -4155,7 +4155,7 @@ const unsigned char _Py_M__importlib[] = {
     1,113,3,0,100,1,0,83,41,2,114,29,0,0,0,78,
     41,1,114,31,0,0,0,41,2,114,22,0,0,0,114,130,
     0,0,0,114,4,0,0,0,114,4,0,0,0,114,5,0,
-    0,0,114,77,0,0,0,28,9,0,0,115,2,0,0,0,
+    0,0,114,77,0,0,0,29,9,0,0,115,2,0,0,0,
     6,0,122,25,95,115,101,116,117,112,46,60,108,111,99,97,
     108,115,62,46,60,103,101,110,101,120,112,114,62,114,84,0,
     0,0,122,30,105,109,112,111,114,116,108,105,98,32,114,101,
@@ -4190,7 +4190,7 @@ const unsigned char _Py_M__importlib[] = {
     100,95,109,111,100,117,108,101,90,14,119,101,97,107,114,101,
     102,95,109,111,100,117,108,101,90,13,119,105,110,114,101,103,
     95,109,111,100,117,108,101,114,4,0,0,0,114,4,0,0,
-    0,114,5,0,0,0,218,6,95,115,101,116,117,112,240,8,
+    0,114,5,0,0,0,218,6,95,115,101,116,117,112,241,8,
     0,0,115,108,0,0,0,0,9,6,1,6,2,12,1,9,
     2,6,3,12,1,28,1,15,1,15,1,9,1,15,1,9,
     2,3,1,15,1,12,1,20,3,13,1,13,1,15,1,15,
@@ -4199,16 +4199,16 @@ const unsigned char _Py_M__importlib[] = {
     1,16,1,25,3,3,1,16,1,13,2,11,1,16,3,12,
     1,16,3,12,1,12,1,19,3,19,1,19,1,12,1,13,
     1,12,1,114,132,1,0,0,99,2,0,0,0,0,0,0,
-    0,3,0,0,0,3,0,0,0,67,0,0,0,115,136,0,
+    0,3,0,0,0,4,0,0,0,67,0,0,0,115,136,0,
     0,0,116,0,0,124,0,0,124,1,0,131,2,0,1,116,
-    1,0,131,0,0,125,2,0,116,2,0,106,3,0,106,4,
+    1,0,131,0,0,125,2,0,116,2,0,106,3,0,160,4,
     0,116,5,0,106,6,0,124,2,0,140,0,0,103,1,0,
-    131,1,0,1,116,2,0,106,7,0,106,8,0,116,9,0,
-    131,1,0,1,116,2,0,106,7,0,106,8,0,116,10,0,
-    131,1,0,1,116,11,0,106,12,0,100,1,0,107,2,0,
-    114,116,0,116,2,0,106,7,0,106,8,0,116,13,0,131,
-    1,0,1,110,0,0,116,2,0,106,7,0,106,8,0,116,
-    14,0,131,1,0,1,100,2,0,83,41,3,122,50,73,110,
+    161,1,0,1,116,2,0,106,7,0,160,8,0,116,9,0,
+    161,1,0,1,116,2,0,106,7,0,160,8,0,116,10,0,
+    161,1,0,1,116,11,0,106,12,0,100,1,0,107,2,0,
+    114,116,0,116,2,0,106,7,0,160,8,0,116,13,0,161,
+    1,0,1,110,0,0,116,2,0,106,7,0,160,8,0,116,
+    14,0,161,1,0,1,100,2,0,83,41,3,122,50,73,110,
     115,116,97,108,108,32,105,109,112,111,114,116,108,105,98,32,
     97,115,32,116,104,101,32,105,109,112,108,101,109,101,110,116,
     97,116,105,111,110,32,111,102,32,105,109,112,111,114,116,46,
@@ -4220,7 +4220,7 @@ const unsigned char _Py_M__importlib[] = {
     1,0,0,41,3,114,130,1,0,0,114,131,1,0,0,90,
     17,115,117,112,112,111,114,116,101,100,95,108,111,97,100,101,
     114,115,114,4,0,0,0,114,4,0,0,0,114,5,0,0,
-    0,218,8,95,105,110,115,116,97,108,108,71,9,0,0,115,
+    0,218,8,95,105,110,115,116,97,108,108,72,9,0,0,115,
     16,0,0,0,0,2,13,1,9,1,28,1,16,1,16,1,
     15,1,19,1,114,133,1,0,0,41,3,122,3,119,105,110,
     114,1,0,0,0,114,2,0,0,0,41,90,114,59,0,0,
@@ -4258,7 +4258,7 @@ const unsigned char _Py_M__importlib[] = {
     101,62,8,0,0,0,115,166,0,0,0,6,17,6,3,12,
     12,12,5,12,5,12,6,12,12,12,10,12,9,12,5,12,
     7,15,22,12,8,12,4,15,4,19,20,6,2,6,3,22,
-    4,19,68,19,21,19,19,12,19,12,20,12,113,22,1,18,
+    4,19,68,19,21,19,19,12,19,12,20,12,114,22,1,18,
     2,6,2,9,2,9,1,9,2,15,27,12,23,12,19,12,
     12,18,8,12,18,12,11,12,11,12,13,12,13,21,55,21,
     12,18,10,12,14,12,34,19,27,19,106,24,22,9,3,12,
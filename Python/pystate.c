@@ -210,6 +210,9 @@ new_threadstate(PyInterpreterState *interp, int init)
         tstate->on_delete = NULL;
         tstate->on_delete_data = NULL;
 
+        tstate->gil_hold_time = 0.0;
+        tstate->gil_acquisitions = 0;
+
         if (init)
             _PyThreadState_Init(tstate);
 
@@ -644,6 +647,51 @@ _PyThread_CurrentFrames(void)
     return NULL;
 }
 
+/* The per-thread part of sys._getgilstats(), to be called with the GIL
+   held like _PyThread_CurrentFrames().  The GIL statistics of a thread
+   state are only updated by its thread while it holds the GIL.
+*/
+PyObject *
+_PyThread_GILStats(void)
+{
+    PyObject *result;
+    PyInterpreterState *i;
+
+    result = PyDict_New();
+    if (result == NULL)
+        return NULL;
+
+    HEAD_LOCK();
+    for (i = interp_head; i != NULL; i = i->next) {
+        PyThreadState *t;
+        for (t = i->tstate_head; t != NULL; t = t->next) {
+            PyObject *id, *value;
+            int stat;
+            id = PyLong_FromLong(t->thread_id);
+            if (id == NULL)
+                goto Fail;
+            value = Py_BuildValue("(dk)", t->gil_hold_time,
+                                  t->gil_acquisitions);
+            if (value == NULL) {
+                Py_DECREF(id);
+                goto Fail;
+            }
+            stat = PyDict_SetItem(result, id, value);
+            Py_DECREF(id);
+            Py_DECREF(value);
+            if (stat < 0)
+                goto Fail;
+        }
+    }
+    HEAD_UNLOCK();
+    return result;
+
+ Fail:
+    HEAD_UNLOCK();
+    Py_DECREF(result);
+    return NULL;
+}
+
 /* Python "auto thread state" API. */
 #ifdef WITH_THREAD
 
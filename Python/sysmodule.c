@@ -605,6 +605,92 @@ PyDoc_STRVAR(getswitchinterval_doc,
 "getswitchinterval() -> current thread switch interval; see setswitchinterval()."
 );
 
+static PyObject *
+sys_setswitchpriority(PyObject *self, PyObject *args)
+{
+    double d;
+    if (!PyArg_ParseTuple(args, "d:_setswitchpriority", &d))
+        return NULL;
+    if (d < 0.0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "switch priority interval must be positive or zero");
+        return NULL;
+    }
+    _PyEval_SetSwitchPriority((unsigned long) (1e6 * d));
+    Py_INCREF(Py_None);
+    return Py_None;
+}
+
+PyDoc_STRVAR(setswitchpriority_doc,
+"_setswitchpriority(n)\n\
+\n\
+Set the switching delay of threads returning from a blocking call, such\n\
+as I/O: such a thread asks for the GIL after n seconds instead of the\n\
+switch interval, and takes it before the other waiting threads.\n\
+0 (the default) disables this priority handoff."
+);
+
+static PyObject *
+sys_getswitchpriority(PyObject *self, PyObject *args)
+{
+    return PyFloat_FromDouble(1e-6 * _PyEval_GetSwitchPriority());
+}
+
+PyDoc_STRVAR(getswitchpriority_doc,
+"_getswitchpriority() -> current priority switch interval; see _setswitchpriority()."
+);
+
+static PyObject *
+sys_getgilstats(PyObject *self, PyObject *args)
+{
+    _PyEval_GILStats stats;
+    PyObject *result, *histogram, *threads;
+    int i;
+
+    _PyEval_GetGILStats(&stats);
+    histogram = PyList_New(_PyEval_GIL_WAIT_BUCKETS);
+    if (histogram == NULL)
+        return NULL;
+    for (i = 0; i < _PyEval_GIL_WAIT_BUCKETS; i++) {
+        double bound = (i < _PyEval_GIL_WAIT_BUCKETS - 1)
+                       ? stats.wait_bounds[i] : Py_HUGE_VAL;
+        PyObject *item = Py_BuildValue("(dk)", bound,
+                                       stats.wait_histogram[i]);
+        if (item == NULL) {
+            Py_DECREF(histogram);
+            return NULL;
+        }
+        PyList_SET_ITEM(histogram, i, item);
+    }
+    threads = _PyThread_GILStats();
+    if (threads == NULL) {
+        Py_DECREF(histogram);
+        return NULL;
+    }
+    result = Py_BuildValue(
+        "{sk,sk,sk,sk,sk,sk,sd,sd,sN,sN}",
+        "acquisitions", stats.acquisitions,
+        "contended", stats.contended,
+        "priority_acquisitions", stats.priority_acquisitions,
+        "switches", stats.switches,
+        "drop_requests", stats.drop_requests,
+        "forced_drops", stats.forced_drops,
+        "wait_total", stats.wait_total,
+        "wait_max", stats.wait_max,
+        "wait_histogram", histogram,
+        "threads", threads);
+    return result;
+}
+
+PyDoc_STRVAR(getgilstats_doc,
+"_getgilstats() -> dict\n\
+\n\
+Return statistics on the global interpreter lock since the interpreter\n\
+started: how many times it was taken and how long threads waited for it.\n\
+\n\
+This function should be used for internal and specialized purposes only."
+);
+
 #endif /* WITH_THREAD */
 
 #ifdef WITH_TSC
@@ -939,6 +1025,22 @@ sys_gettotalrefcount(PyObject *self)
 }
 #endif /* Py_REF_DEBUG */
 
+#ifdef Py_IMMORTAL_OBJECTS
+PyDoc_STRVAR(immortalize_doc,
+"_immortalize() -> integer\n\
+\n\
+Make the singletons, small ints, interned strings, types and the code\n\
+of functions immortal, and return the number of objects which were not\n\
+immortal yet.  Meant to be called once, just before forking worker\n\
+processes.");
+
+static PyObject *
+sys_immortalize(PyObject *self)
+{
+    return PyLong_FromSsize_t(_Py_ImmortalizeObjects());
+}
+#endif /* Py_IMMORTAL_OBJECTS */
+
 PyDoc_STRVAR(getrefcount_doc,
 "getrefcount(object) -> integer\n\
 \n\
@@ -1084,6 +1186,121 @@ In Py_DEBUG mode, also perform some expensive internal consistency\n\
 checks.\n\
 ");
 
+#ifdef WITH_PYMALLOC
+static int
+set_malloc_stat(PyObject *dict, const char *key, size_t value)
+{
+    int res;
+    PyObject *v = PyLong_FromSize_t(value);
+    if (v == NULL)
+        return -1;
+    res = PyDict_SetItemString(dict, key, v);
+    Py_DECREF(v);
+    return res;
+}
+
+static PyObject *
+sys_getmallocstats(PyObject *self)
+{
+    _PyObject_MallocStats st;
+    PyObject *result, *classes;
+    unsigned int i;
+
+    /* Take the snapshot first: building the result allocates memory */
+    _PyObject_GetMallocStats(&st);
+
+    result = PyDict_New();
+    if (result == NULL)
+        return NULL;
+    if (PyDict_SetItemString(result, "hugepages",
+                             st.hugepages ? Py_True : Py_False) < 0 ||
+        set_malloc_stat(result, "arena_size", st.arena_size) < 0 ||
+        set_malloc_stat(result, "pool_size", st.pool_size) < 0 ||
+        set_malloc_stat(result, "arenas_allocated_total",
+                        st.narenas_total) < 0 ||
+        set_malloc_stat(result, "arenas_reclaimed",
+                        st.narenas_total - st.narenas) < 0 ||
+        set_malloc_stat(result, "arenas_highwater",
+                        st.narenas_highwater) < 0 ||
+        set_malloc_stat(result, "arenas_allocated_current",
+                        st.narenas) < 0 ||
+        set_malloc_stat(result, "allocated_bytes", st.allocated_bytes) < 0 ||
+        set_malloc_stat(result, "available_bytes", st.available_bytes) < 0 ||
+        set_malloc_stat(result, "free_pools", st.numfreepools) < 0 ||
+        set_malloc_stat(result, "pool_header_bytes",
+                        st.pool_header_bytes) < 0 ||
+        set_malloc_stat(result, "quantization_bytes", st.quantization) < 0 ||
+        set_malloc_stat(result, "arena_alignment_bytes",
+                        st.arena_alignment) < 0 ||
+        PyDict_SetItemString(result, "purge",
+                             st.purge ? Py_True : Py_False) < 0 ||
+        set_malloc_stat(result, "purged_pools", st.npurgedpools) < 0 ||
+        set_malloc_stat(result, "purged_bytes_total", st.purged_bytes) < 0 ||
+        set_malloc_stat(result, "released_arena_bytes_total",
+                        st.released_arena_bytes) < 0)
+        goto error;
+
+    classes = PyList_New(st.nclasses);
+    if (classes == NULL)
+        goto error;
+    if (PyDict_SetItemString(result, "size_classes", classes) < 0) {
+        Py_DECREF(classes);
+        goto error;
+    }
+    Py_DECREF(classes);
+    for (i = 0; i < st.nclasses; i++) {
+        PyObject *entry = PyDict_New();
+        if (entry == NULL)
+            goto error;
+        PyList_SET_ITEM(classes, i, entry);
+        if (set_malloc_stat(entry, "size", st.class_size[i]) < 0 ||
+            set_malloc_stat(entry, "pools", st.numpools[i]) < 0 ||
+            set_malloc_stat(entry, "blocks", st.numblocks[i]) < 0 ||
+            set_malloc_stat(entry, "free_blocks", st.numfreeblocks[i]) < 0)
+            goto error;
+    }
+    return result;
+
+error:
+    Py_DECREF(result);
+    return NULL;
+}
+
+static PyObject *
+sys_setmallocpurge(PyObject *self, PyObject *args)
+{
+    int enabled;
+
+    if (!PyArg_ParseTuple(args, "p:_setmallocpurge", &enabled))
+        return NULL;
+    if (_PyObject_SetMallocPurge(enabled) < 0 && enabled) {
+        PyErr_SetString(PyExc_NotImplementedError,
+                        "purging empty pools is not supported "
+                        "on this platform");
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+PyDoc_STRVAR(setmallocpurge_doc,
+"_setmallocpurge(enabled)\n\
+\n\
+Enable or disable returning the memory of empty pymalloc pools to the\n\
+system while their arena is still in use."
+);
+
+PyDoc_STRVAR(getmallocstats_doc,
+"_getmallocstats() -> dict\n\
+\n\
+Return a dict describing the state of pymalloc's arenas, pools and\n\
+size classes.  The size_classes entry holds, for each size class, the\n\
+number of pools, allocated blocks and free blocks.\n\
+\n\
+In Py_DEBUG mode, also perform some expensive internal consistency\n\
+checks.\n\
+");
+#endif
+
 #ifdef Py_TRACE_REFS
 /* Defined in objects.c because it uses static globals if that file */
 extern PyObject *_Py_GetObjects(PyObject *, PyObject *);
@@ -1130,6 +1347,10 @@ static PyMethodDef sys_methods[] = {
 #endif
     {"getallocatedblocks", (PyCFunction)sys_getallocatedblocks, METH_NOARGS,
       getallocatedblocks_doc},
+#ifdef WITH_PYMALLOC
+    {"_getmallocstats", (PyCFunction)sys_getmallocstats, METH_NOARGS,
+      getmallocstats_doc},
+#endif
 #ifdef COUNT_ALLOCS
     {"getcounts",       (PyCFunction)sys_getcounts, METH_NOARGS},
 #endif
@@ -1143,6 +1364,10 @@ static PyMethodDef sys_methods[] = {
 #endif
 #ifdef Py_REF_DEBUG
     {"gettotalrefcount", (PyCFunction)sys_gettotalrefcount, METH_NOARGS},
+#endif
+#ifdef Py_IMMORTAL_OBJECTS
+    {"_immortalize",    (PyCFunction)sys_immortalize, METH_NOARGS,
+     immortalize_doc},
 #endif
     {"getrefcount",     (PyCFunction)sys_getrefcount, METH_O, getrefcount_doc},
     {"getrecursionlimit", (PyCFunction)sys_getrecursionlimit, METH_NOARGS,
@@ -1167,10 +1392,20 @@ static PyMethodDef sys_methods[] = {
      setswitchinterval_doc},
     {"getswitchinterval",       sys_getswitchinterval, METH_NOARGS,
      getswitchinterval_doc},
+    {"_setswitchpriority",      sys_setswitchpriority, METH_VARARGS,
+     setswitchpriority_doc},
+    {"_getswitchpriority",      sys_getswitchpriority, METH_NOARGS,
+     getswitchpriority_doc},
+    {"_getgilstats",            sys_getgilstats, METH_NOARGS,
+     getgilstats_doc},
 #endif
 #ifdef HAVE_DLOPEN
     {"setdlopenflags", sys_setdlopenflags, METH_VARARGS,
      setdlopenflags_doc},
+#endif
+#ifdef WITH_PYMALLOC
+    {"_setmallocpurge", sys_setmallocpurge, METH_VARARGS,
+     setmallocpurge_doc},
 #endif
     {"setprofile",      sys_setprofile, METH_O, setprofile_doc},
     {"getprofile",      sys_getprofile, METH_NOARGS, getprofile_doc},
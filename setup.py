@@ -579,6 +579,8 @@ class PyBuildExt(build_ext):
         exts.append( Extension("_bisect", ["_bisectmodule.c"]) )
         # heapq
         exts.append( Extension("_heapq", ["_heapqmodule.c"]) )
+        # asyncio Future and Task
+        exts.append( Extension("_asyncio", ["_asynciomodule.c"]) )
         # C-optimized pickle replacement
         exts.append( Extension("_pickle", ["_pickle.c"]) )
         # atexit
@@ -623,6 +625,19 @@ class PyBuildExt(build_ext):
         # select(2); not on ancient System V
         exts.append( Extension('select', ['selectmodule.c']) )
 
+        # Linux io_uring; waiting with a timeout needs the 5.11 headers
+        if host_platform.startswith('linux'):
+            uring_inc = find_file('linux/io_uring.h', [], inc_dirs)
+            if uring_inc:
+                name = os.path.join(uring_inc[0], 'linux/io_uring.h')
+                with open(name, 'r') as incfile:
+                    if 'IORING_FEAT_EXT_ARG' not in incfile.read():
+                        uring_inc = None
+            if uring_inc:
+                exts.append( Extension('_uring', ['_uringmodule.c']) )
+            else:
+                missing.append('_uring')
+
         # Fred Drake's interface to the Python parser
         exts.append( Extension('parser', ['parsermodule.c']) )
 